@@ -1,4 +1,5 @@
 #include "ST7735.h"
+#include "st77xx_trace.h"
 
 uint16_t ST7735_X_Start = ST7735_XSTART;
 uint16_t ST7735_Y_Start = ST7735_YSTART;
@@ -84,7 +85,7 @@ void ST7735_Init(void)
 	ST77XX_GPIO_Init();
 	ST77XX_SPI_Init();
 
-	HAL_GPIO_WritePin(BLK_GPIO_Port, BLK_Pin, GPIO_PIN_SET);
+	ST77XX_BL_Init();
 	// Задержка после подачи питания
 	// если при старте не всегда запускаеться дисплей увеличиваем время задержки
 	HAL_Delay(500);
@@ -190,6 +191,8 @@ static void ST7735_ExecuteCommandList(const uint8_t *addr)
 void ST7735_DrawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *data)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_IMAGE);
+
 	if ((x >= ST7735_Width) || (y >= ST7735_Height))
 	{
 		return;
@@ -212,6 +215,8 @@ void ST7735_DrawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint
 	ST7735_SendDataMASS((uint8_t *)data, sizeof(uint16_t) * w * h);
 
 	ST7735_Unselect();
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -233,6 +238,8 @@ void ST7735_HardReset(void)
 __inline void ST7735_SendCmd(uint8_t Cmd)
 {
 
+	ST77XX_TRACE_CMD(Cmd, ST7735_RAMWR);
+
 //-- если захотим переделать под HAL ------------------
 #ifdef ST7735_SPI_HAL
 
@@ -330,6 +337,8 @@ __inline void ST7735_SendCmd(uint8_t Cmd)
 __inline void ST7735_SendData(uint8_t Data)
 {
 
+	ST77XX_TRACE_DATA(1);
+
 //-- если захотим переделать под HAL ------------------
 #ifdef ST7735_SPI_HAL
 
@@ -415,6 +424,8 @@ __inline void ST7735_SendData(uint8_t Data)
 __inline void ST7735_SendDataMASS(uint8_t *buff, size_t buff_size)
 {
 
+	ST77XX_TRACE_DATA(buff_size);
+
 //-- если захотим переделать под HAL ------------------
 #ifdef ST7735_SPI_HAL
 
@@ -582,7 +593,11 @@ void ST7735_InversionMode(uint8_t Mode)
 void ST7735_FillScreen(uint16_t color)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_FILLSCREEN);
+
 	ST7735_FillRect(0, 0, ST7735_Width, ST7735_Height, color);
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -592,7 +607,11 @@ void ST7735_FillScreen(uint16_t color)
 void ST7735_Clear(void)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_FILLSCREEN);
+
 	ST7735_FillRect(0, 0, ST7735_Width, ST7735_Height, 0);
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -602,6 +621,8 @@ void ST7735_Clear(void)
 void ST7735_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_FILLRECT);
+
 	if ((x >= ST7735_Width) || (y >= ST7735_Height))
 	{
 		return;
@@ -624,6 +645,8 @@ void ST7735_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 	//  }
 
 	ST7735_RamWrite(&color, (h * w));
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -633,6 +656,8 @@ void ST7735_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 void ST7735_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
 
+	ST77XX_TRACE_WINDOW();
+
 	ST7735_Select();
 
 	ST7735_ColumnSet(x0, x1);
@@ -728,10 +753,11 @@ static void ST7735_RowSet(uint16_t RowStart, uint16_t RowEnd)
 void ST7735_SetBL(uint8_t Value)
 {
 
-	//  if (Value > 100)
-	//    Value = 100;
+	if (Value > 100)
+		Value = 100;
 
-	//	tmr2_PWM_set(ST77xx_PWM_TMR2_Chan, Value);
+	// 0...100 % -> уровень 0...255, гамма-коррекция в ST77XX_BL
+	ST77XX_BL_Set((uint8_t)(((uint16_t)Value * 255) / 100));
 }
 //==============================================================================
 
@@ -762,10 +788,14 @@ void ST7735_DisplayPower(uint8_t On)
 void ST7735_DrawRectangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_RECT);
+
 	ST7735_DrawLine(x1, y1, x1, y2, color);
 	ST7735_DrawLine(x2, y1, x2, y2, color);
 	ST7735_DrawLine(x1, y1, x2, y1, color);
 	ST7735_DrawLine(x1, y2, x2, y2, color);
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -787,6 +817,8 @@ static void SwapInt16Values(int16_t *pValue1, int16_t *pValue2)
 void ST7735_DrawRectangleFilled(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t fillcolor)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_RECTFILLED);
+
 	if (x1 > x2)
 	{
 		SwapInt16Values(&x1, &x2);
@@ -798,6 +830,8 @@ void ST7735_DrawRectangleFilled(int16_t x1, int16_t y1, int16_t x2, int16_t y2,
 	}
 
 	ST7735_FillRect(x1, y1, x2 - x1, y2 - y1, fillcolor);
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -844,6 +878,8 @@ static void ST7735_DrawLine_Slow(int16_t x1, int16_t y1, int16_t x2, int16_t y2,
 void ST7735_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_LINE);
+
 	if (x1 == x2)
 	{
 
@@ -856,6 +892,7 @@ void ST7735_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t co
 			ST7735_FillRect(x1, y1, 1, y2 - y1 + 1, color);
 		}
 
+		ST77XX_TRACE_END();
 		return;
 	}
 
@@ -871,10 +908,13 @@ void ST7735_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t co
 			ST7735_FillRect(x1, y1, x2 - x1 + 1, 1, color);
 		}
 
+		ST77XX_TRACE_END();
 		return;
 	}
 
 	ST7735_DrawLine_Slow(x1, y1, x2, y2, color);
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -883,10 +923,15 @@ void ST7735_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t co
 //==============================================================================
 void ST7735_DrawTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t color)
 {
+
+	ST77XX_TRACE_BEGIN(ST77XX_TR_TRIANGLE);
+
 	/* Draw lines */
 	ST7735_DrawLine(x1, y1, x2, y2, color);
 	ST7735_DrawLine(x2, y2, x3, y3, color);
 	ST7735_DrawLine(x3, y3, x1, y1, color);
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -900,6 +945,8 @@ void ST7735_DrawFilledTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y
 			yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0,
 			curpixel = 0;
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_TRIANGLEFILLED);
+
 	deltax = abs(x2 - x1);
 	deltay = abs(y2 - y1);
 	x = x1;
@@ -960,6 +1007,8 @@ void ST7735_DrawFilledTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y
 		x += xinc2;
 		y += yinc2;
 	}
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -969,6 +1018,8 @@ void ST7735_DrawFilledTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y
 void ST7735_DrawPixel(int16_t x, int16_t y, uint16_t color)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_PIXEL);
+
 	if ((x < 0) || (x >= ST7735_Width) || (y < 0) || (y >= ST7735_Height))
 	{
 		return;
@@ -976,6 +1027,8 @@ void ST7735_DrawPixel(int16_t x, int16_t y, uint16_t color)
 
 	ST7735_SetWindow(x, y, x, y);
 	ST7735_RamWrite(&color, 1);
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -990,6 +1043,8 @@ void ST7735_DrawCircleFilled(int16_t x0, int16_t y0, int16_t radius, uint16_t fi
 	int delta = 1 - 2 * radius;
 	int error = 0;
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_CIRCLEFILLED);
+
 	while (y >= 0)
 	{
 
@@ -1019,6 +1074,8 @@ void ST7735_DrawCircleFilled(int16_t x0, int16_t y0, int16_t radius, uint16_t fi
 		delta += 2 * (x - y);
 		--y;
 	}
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -1033,6 +1090,8 @@ void ST7735_DrawCircle(int16_t x0, int16_t y0, int16_t radius, uint16_t color)
 	int delta = 1 - 2 * radius;
 	int error = 0;
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_CIRCLE);
+
 	while (y >= 0)
 	{
 
@@ -1064,6 +1123,8 @@ void ST7735_DrawCircle(int16_t x0, int16_t y0, int16_t radius, uint16_t color)
 		delta += 2 * (x - y);
 		--y;
 	}
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -1079,6 +1140,8 @@ void ST7735_DrawChar(uint16_t x, uint16_t y, uint16_t TextColor, uint16_t BgColo
 
 	uint8_t xx, yy;
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_CHAR);
+
 	if (multiplier < 1)
 	{
 		multiplier = 1;
@@ -1150,6 +1213,8 @@ void ST7735_DrawChar(uint16_t x, uint16_t y, uint16_t TextColor, uint16_t BgColo
 			Y = Y + multiplier;
 		}
 	}
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -1168,6 +1233,8 @@ void ST7735_print(uint16_t x, uint16_t y, uint16_t TextColor, uint16_t BgColor,
 
 	uint16_t len = strlen(str);
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_PRINT);
+
 	while (len--)
 	{
 
@@ -1230,6 +1297,8 @@ void ST7735_print(uint16_t x, uint16_t y, uint16_t TextColor, uint16_t BgColor,
 		/* Increase string pointer */
 		str++;
 	}
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -1472,6 +1541,8 @@ void ST7735_DrawBitmap(int16_t x, int16_t y, const unsigned char *bitmap, int16_
 	int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
 	uint8_t byte = 0;
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_BITMAP);
+
 	for (int16_t j = 0; j < h; j++, y++)
 	{
 
@@ -1493,6 +1564,8 @@ void ST7735_DrawBitmap(int16_t x, int16_t y, const unsigned char *bitmap, int16_
 			}
 		}
 	}
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -4,7 +4,7 @@
 
 /* C++ detection */
 #ifdef __cplusplus
-extern C {
+extern "C" {
 #endif
 
 // Обязательно нужен #include "main.h" 
@@ -12,6 +12,7 @@ extern C {
 
 #include "stm32f1xx.h"
 #include "st77xx_spi.h"
+#include "st77xx_bl.h"
 #include "st77xx_fonts.h"
 #include "stdlib.h"
 #include "string.h"
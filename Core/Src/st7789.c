@@ -1,10 +1,18 @@
 #include "st7789.h"
+#include "arm_math.h"
+#include "st77xx_trace.h"
 
 uint16_t ST7789_X_Start = ST7789_XSTART;
 uint16_t ST7789_Y_Start = ST7789_YSTART;
 
 uint16_t ST7789_Width, ST7789_Height;
 
+// буфер строки для потокового вывода ( пиксели в порядке байт дисплея )
+static uint16_t ST7789_LineBuff[ST7789_LINE_BUFF_SIZE];
+
+// делитель SPI для чтения GRAM ( может быть уточнен калибровкой )
+static uint32_t ST7789_ReadBR = ST7789_READ_PRESCALER;
+
 /*所有显示器的初始化为一个，因为驱动程序的最大尺寸为240x320
   根据旋转显示功能调整孔尺寸*/
 static const uint8_t init_cmds[] = {
@@ -37,7 +45,7 @@ void ST7789_Init(void)
 	ST77XX_GPIO_Init();
 	ST77XX_SPI_Init();
 	
-	HAL_GPIO_WritePin( BLK_GPIO_Port, BLK_Pin, GPIO_PIN_SET );
+	ST77XX_BL_Init();
 	//如果启动时不总是启动显示器，则延长延迟时间
 	HAL_Delay(300);
 
@@ -52,6 +60,10 @@ void ST7789_Init(void)
 	//ST7789_Unselect();
 	
 	ST7789_rotation( 2 );
+
+#ifdef ST7789_SPI_AUTOCAL
+	ST7789_CalibrateSPI(NULL);
+#endif
 }
 
 // SPI控制程序
@@ -132,6 +144,8 @@ static void ST7789_ExecuteCommandList(const uint8_t *addr)
 void ST7789_DrawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *data)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_IMAGE);
+
 	if ((x >= ST7789_Width) || (y >= ST7789_Height))
 	{
 		return;
@@ -154,6 +168,8 @@ void ST7789_DrawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint
 	ST7789_SendDataMASS((uint8_t *)data, sizeof(uint16_t) * w * h);
 
 	ST7789_Unselect();
+
+	ST77XX_TRACE_END();
 }
 
 /* 显示硬件重置过程（RESET脚） */
@@ -169,9 +185,14 @@ void ST7789_HardReset(void)
 __inline void ST7789_SendCmd(uint8_t Cmd)
 {
 
+	ST77XX_TRACE_CMD(Cmd, ST7789_RAMWR);
+
 /* 如果我们想重新设计为HAL */
 #ifdef ST7789_SPI_HAL
 
+	// нельзя переключать DC, пока идет DMA передача
+	ST7789_WaitDMA();
+
 	// pin DC LOW
 	HAL_GPIO_WritePin(DC_GPIO_Port, DC_Pin, GPIO_PIN_RESET);
 
@@ -262,8 +283,12 @@ __inline void ST7789_SendCmd(uint8_t Cmd)
 /* 将数据（参数）发送到1字节显示的过程 */
 __inline void ST7789_SendData(uint8_t Data)
 {
+	ST77XX_TRACE_DATA(1);
+
 #ifdef ST7789_SPI_HAL
 
+	ST7789_WaitDMA();
+
 	HAL_SPI_Transmit(&ST7789_SPI_HAL, &Data, 1, HAL_MAX_DELAY);
 	while (HAL_SPI_GetState(&ST7789_SPI_HAL) != HAL_SPI_STATE_READY)
 	{
@@ -346,9 +371,13 @@ __inline void ST7789_SendData(uint8_t Data)
 __inline void ST7789_SendDataMASS(uint8_t *buff, size_t buff_size)
 {
 
+	ST77XX_TRACE_DATA(buff_size);
+
 //-- если захотим переделать под HAL ------------------
 #ifdef ST7789_SPI_HAL
 
+	ST7789_WaitDMA();
+
 	if (buff_size <= 0xFFFF)
 	{
 		HAL_SPI_Transmit(&ST7789_SPI_HAL, buff, buff_size, HAL_MAX_DELAY);
@@ -451,6 +480,130 @@ __inline void ST7789_SendDataMASS(uint8_t *buff, size_t buff_size)
 }
 //==============================================================================
 
+//==============================================================================
+// Процедура приема данных из дисплея MASS ( чтение GRAM, MISO )
+//==============================================================================
+void ST7789_ReceiveDataMASS(uint8_t *buff, size_t buff_size)
+{
+
+	ST77XX_TRACE_RX(buff_size);
+
+//-- если захотим переделать под HAL ------------------
+#ifdef ST7789_SPI_HAL
+
+	ST7789_WaitDMA();
+
+	// в режиме 2 линий HAL сам выдает буфер как пустые такты на MOSI
+	while (buff_size > 0xFFFF)
+	{
+		HAL_SPI_Receive(&ST7789_SPI_HAL, buff, 0xFFFF, HAL_MAX_DELAY);
+		buff_size -= 0xFFFF;
+		buff += 0xFFFF;
+	}
+	HAL_SPI_Receive(&ST7789_SPI_HAL, buff, buff_size, HAL_MAX_DELAY);
+
+	while (HAL_SPI_GetState(&ST7789_SPI_HAL) != HAL_SPI_STATE_READY)
+	{
+	};
+
+#endif
+//-----------------------------------------------------
+
+//-- если захотим переделать под CMSIS  ---------------------------------------------
+#ifdef ST7789_SPI_CMSIS
+
+	if ((ST7789_SPI_CMSIS->CR1 & SPI_CR1_SPE) != SPI_CR1_SPE)
+	{
+		SET_BIT(ST7789_SPI_CMSIS->CR1, SPI_CR1_SPE);
+	}
+
+	// сбрасываем то, что осталось в приемнике после передачи команды
+	(void)*((__IO uint8_t *)&ST7789_SPI_CMSIS->DR);
+	(void)ST7789_SPI_CMSIS->SR;
+
+	while (buff_size)
+	{
+
+		while ((ST7789_SPI_CMSIS->SR & SPI_SR_TXE) == RESET)
+		{
+		};
+
+		// пустой байт для тактирования чтения
+		*((__IO uint8_t *)&ST7789_SPI_CMSIS->DR) = 0xFF;
+
+		while ((ST7789_SPI_CMSIS->SR & SPI_SR_RXNE) == RESET)
+		{
+		};
+
+		*buff++ = *((__IO uint8_t *)&ST7789_SPI_CMSIS->DR);
+
+		buff_size--;
+	}
+
+	while ((ST7789_SPI_CMSIS->SR & SPI_SR_BSY) != RESET)
+	{
+	};
+
+#endif
+	//-----------------------------------------------------------------------------------
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура запуска передачи данных в дисплей через DMA ( не ждет окончания )
+// буфер должен оставаться неизменным до ST7789_WaitDMA()
+//==============================================================================
+void ST7789_SendDataDMA(uint8_t *buff, size_t buff_size)
+{
+
+//-- если захотим переделать под HAL ------------------
+#ifdef ST7789_SPI_HAL
+
+	ST7789_WaitDMA();
+
+	// в ветке CMSIS байты посчитает ST7789_SendDataMASS
+	ST77XX_TRACE_DATA(buff_size);
+
+	// длина одной DMA передачи ограничена 0xFFFF байт
+	while (buff_size > 0xFFFF)
+	{
+		HAL_SPI_Transmit_DMA(&ST7789_SPI_HAL, buff, 0xFFFF);
+		ST7789_WaitDMA();
+		buff_size -= 0xFFFF;
+		buff += 0xFFFF;
+	}
+	HAL_SPI_Transmit_DMA(&ST7789_SPI_HAL, buff, buff_size);
+
+#endif
+//-----------------------------------------------------
+
+//-- если захотим переделать под CMSIS  ---------------------------------------------
+#ifdef ST7789_SPI_CMSIS
+
+	// без DMA канала передаем синхронно
+	ST7789_SendDataMASS(buff, buff_size);
+
+#endif
+	//-----------------------------------------------------------------------------------
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура ожидания окончания DMA передачи
+//==============================================================================
+void ST7789_WaitDMA(void)
+{
+
+#ifdef ST7789_SPI_HAL
+
+	while (HAL_SPI_GetState(&ST7789_SPI_HAL) != HAL_SPI_STATE_READY)
+	{
+	};
+
+#endif
+}
+//==============================================================================
+
 //==============================================================================
 // Процедура включения режима сна
 //==============================================================================
@@ -510,7 +663,11 @@ void ST7789_InversionMode(uint8_t Mode)
 void ST7789_FillScreen(uint16_t color)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_FILLSCREEN);
+
 	ST7789_FillRect(0, 0, ST7789_Width, ST7789_Height, color);
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -520,7 +677,11 @@ void ST7789_FillScreen(uint16_t color)
 void ST7789_Clear(void)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_FILLSCREEN);
+
 	ST7789_FillRect(0, 0, ST7789_Width, ST7789_Height, 0);
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -530,11 +691,31 @@ void ST7789_Clear(void)
 void ST7789_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_FILLRECT);
+
 	if ((x >= ST7789_Width) || (y >= ST7789_Height))
 	{
 		return;
 	}
 
+	// отсекаем часть за левым/верхним краем (дуги и скругления выходят за экран)
+	if (x < 0)
+	{
+		w += x;
+		x = 0;
+	}
+
+	if (y < 0)
+	{
+		h += y;
+		y = 0;
+	}
+
+	if ((w <= 0) || (h <= 0))
+	{
+		return;
+	}
+
 	if ((x + w) > ST7789_Width)
 	{
 		w = ST7789_Width - x;
@@ -551,7 +732,9 @@ void ST7789_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 	//	  ST7789_RamWrite(&color, 1);
 	//  }
 
-	ST7789_RamWrite(&color, (h * w));
+	ST7789_RamFill(color, (h * w));
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -561,6 +744,8 @@ void ST7789_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 void ST7789_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
 
+	ST77XX_TRACE_WINDOW();
+
 	ST7789_Select();
 
 	ST7789_ColumnSet(x0, x1);
@@ -579,19 +764,39 @@ void ST7789_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 void ST7789_RamWrite(uint16_t *pBuff, uint32_t Len)
 {
 
-	ST7789_Select();
+	ST7789_RamFill(*pBuff, Len);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура заполнения окна одним цветом ( пакетами по ST7789_LINE_BUFF_SIZE )
+//==============================================================================
+void ST7789_RamFill(uint16_t color, uint32_t Len)
+{
+
+	uint32_t n = (Len < ST7789_LINE_BUFF_SIZE) ? Len : ST7789_LINE_BUFF_SIZE;
+
+	// буфер мог еще передаваться по DMA
+	ST7789_WaitDMA();
+
+	for (uint32_t i = 0; i < n; i++)
+	{
+		ST7789_LineBuff[i] = (color >> 8) | (color << 8);
+	}
 
-	uint8_t buff[2];
-	buff[0] = *pBuff >> 8;
-	buff[1] = *pBuff & 0xFF;
+	ST7789_Select();
 
-	while (Len--)
+	// буфер не меняется между пакетами, ждать перед следующим не нужно
+	while (Len > 0)
 	{
-		//    ST7789_SendData( buff[0] );
-		//    ST7789_SendData( buff[1] );
-		ST7789_SendDataMASS(buff, 2);
+		n = (Len < ST7789_LINE_BUFF_SIZE) ? Len : ST7789_LINE_BUFF_SIZE;
+		ST7789_SendDataDMA((uint8_t *)ST7789_LineBuff, sizeof(uint16_t) * n);
+		Len -= n;
 	}
 
+	// CS нельзя снимать, пока идет DMA передача
+	ST7789_WaitDMA();
+
 	ST7789_Unselect();
 }
 //==============================================================================
@@ -656,10 +861,11 @@ static void ST7789_RowSet(uint16_t RowStart, uint16_t RowEnd)
 void ST7789_SetBL(uint8_t Value)
 {
 
-	//  if (Value > 100)
-	//    Value = 100;
+	if (Value > 100)
+		Value = 100;
 
-	//	tmr2_PWM_set(ST77xx_PWM_TMR2_Chan, Value);
+	// 0...100 % -> уровень 0...255, гамма-коррекция в ST77XX_BL
+	ST77XX_BL_Set((uint8_t)(((uint16_t)Value * 255) / 100));
 }
 //==============================================================================
 
@@ -690,10 +896,14 @@ void ST7789_DisplayPower(uint8_t On)
 void ST7789_DrawRectangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_RECT);
+
 	ST7789_DrawLine(x1, y1, x1, y2, color);
 	ST7789_DrawLine(x2, y1, x2, y2, color);
 	ST7789_DrawLine(x1, y1, x2, y1, color);
 	ST7789_DrawLine(x1, y2, x2, y2, color);
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -715,6 +925,8 @@ static void SwapInt16Values(int16_t *pValue1, int16_t *pValue2)
 void ST7789_DrawRectangleFilled(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t fillcolor)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_RECTFILLED);
+
 	if (x1 > x2)
 	{
 		SwapInt16Values(&x1, &x2);
@@ -726,6 +938,8 @@ void ST7789_DrawRectangleFilled(int16_t x1, int16_t y1, int16_t x2, int16_t y2,
 	}
 
 	ST7789_FillRect(x1, y1, x2 - x1, y2 - y1, fillcolor);
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -772,6 +986,8 @@ static void ST7789_DrawLine_Slow(int16_t x1, int16_t y1, int16_t x2, int16_t y2,
 void ST7789_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_LINE);
+
 	if (x1 == x2)
 	{
 
@@ -784,6 +1000,7 @@ void ST7789_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t co
 			ST7789_FillRect(x1, y1, 1, y2 - y1 + 1, color);
 		}
 
+		ST77XX_TRACE_END();
 		return;
 	}
 
@@ -799,10 +1016,13 @@ void ST7789_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t co
 			ST7789_FillRect(x1, y1, x2 - x1 + 1, 1, color);
 		}
 
+		ST77XX_TRACE_END();
 		return;
 	}
 
 	ST7789_DrawLine_Slow(x1, y1, x2, y2, color);
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -811,10 +1031,15 @@ void ST7789_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t co
 //==============================================================================
 void ST7789_DrawTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t color)
 {
+
+	ST77XX_TRACE_BEGIN(ST77XX_TR_TRIANGLE);
+
 	/* Draw lines */
 	ST7789_DrawLine(x1, y1, x2, y2, color);
 	ST7789_DrawLine(x2, y2, x3, y3, color);
 	ST7789_DrawLine(x3, y3, x1, y1, color);
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -828,6 +1053,8 @@ void ST7789_DrawFilledTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y
 			yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0,
 			curpixel = 0;
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_TRIANGLEFILLED);
+
 	deltax = abs(x2 - x1);
 	deltay = abs(y2 - y1);
 	x = x1;
@@ -888,6 +1115,8 @@ void ST7789_DrawFilledTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y
 		x += xinc2;
 		y += yinc2;
 	}
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -897,6 +1126,8 @@ void ST7789_DrawFilledTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y
 void ST7789_DrawPixel(int16_t x, int16_t y, uint16_t color)
 {
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_PIXEL);
+
 	if ((x < 0) || (x >= ST7789_Width) || (y < 0) || (y >= ST7789_Height))
 	{
 		return;
@@ -904,6 +1135,8 @@ void ST7789_DrawPixel(int16_t x, int16_t y, uint16_t color)
 
 	ST7789_SetWindow(x, y, x, y);
 	ST7789_RamWrite(&color, 1);
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -918,6 +1151,8 @@ void ST7789_DrawCircleFilled(int16_t x0, int16_t y0, int16_t radius, uint16_t fi
 	int delta = 1 - 2 * radius;
 	int error = 0;
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_CIRCLEFILLED);
+
 	while (y >= 0)
 	{
 
@@ -947,6 +1182,8 @@ void ST7789_DrawCircleFilled(int16_t x0, int16_t y0, int16_t radius, uint16_t fi
 		delta += 2 * (x - y);
 		--y;
 	}
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
@@ -961,6 +1198,8 @@ void ST7789_DrawCircle(int16_t x0, int16_t y0, int16_t radius, uint16_t color)
 	int delta = 1 - 2 * radius;
 	int error = 0;
 
+	ST77XX_TRACE_BEGIN(ST77XX_TR_CIRCLE);
+
 	while (y >= 0)
 	{
 
@@ -992,371 +1231,1382 @@ void ST7789_DrawCircle(int16_t x0, int16_t y0, int16_t radius, uint16_t color)
 		delta += 2 * (x - y);
 		--y;
 	}
+
+	ST77XX_TRACE_END();
 }
 //==============================================================================
 
 //==============================================================================
-// Процедура рисования символа ( 1 буква или знак )
+// Процедура рисования горизонтального отрезка ( одним пакетом в окно 1 x w )
 //==============================================================================
-void ST7789_DrawChar(uint16_t x, uint16_t y, uint16_t TextColor, uint16_t BgColor, uint8_t TransparentBg, FontDef_t *Font, uint8_t multiplier, unsigned char ch)
+void ST7789_DrawHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
 {
 
-	uint32_t i, b, j;
+	ST77XX_TRACE_BEGIN(ST77XX_TR_HLINE);
 
-	uint32_t X = x, Y = y;
+	ST7789_FillRect(x, y, w, 1, color);
 
-	uint8_t xx, yy;
+	ST77XX_TRACE_END();
+}
+//==============================================================================
 
-	if (multiplier < 1)
+//==============================================================================
+// Процедура вспомогательная - целочисленный квадратный корень ( floor )
+//==============================================================================
+static uint32_t ST7789_isqrt(uint32_t value)
+{
+
+	uint32_t root = 0;
+	uint32_t bit = 1UL << 30;
+
+	while (bit > value)
 	{
-		multiplier = 1;
+		bit >>= 2;
 	}
 
-	/* Check available space in LCD */
-	if (ST7789_Width >= (x + Font->FontWidth) || ST7789_Height >= (y + Font->FontHeight))
+	while (bit)
 	{
-
-		/* Go through font */
-		for (i = 0; i < Font->FontHeight; i++)
+		if (value >= root + bit)
 		{
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
 
-			if (ch < 127)
-			{
-				b = Font->data[(ch - 32) * Font->FontHeight + i];
-			}
-
-			else if ((uint8_t)ch > 191)
-			{
-				// +96 это так как латинские символы и знаки в шрифтах занимают 96 позиций
-				// и если в шрифте который содержит сперва латиницу и спец символы и потом
-				// только кирилицу то нужно добавлять 95 если шрифт
-				// содержит только кирилицу то +96 не нужно
-				b = Font->data[((ch - 192) + 96) * Font->FontHeight + i];
-			}
-
-			else if ((uint8_t)ch == 168)
-			{ // 168 символ по ASCII - Ё
-				// 160 эллемент ( символ Ё )
-				b = Font->data[(160) * Font->FontHeight + i];
-			}
+	return root;
+}
+//==============================================================================
 
-			else if ((uint8_t)ch == 184)
-			{ // 184 символ по ASCII - ё
-				// 161 эллемент  ( символ ё )
-				b = Font->data[(161) * Font->FontHeight + i];
-			}
-			//-------------------------------------------------------------------
+//==============================================================================
+// Процедура вспомогательная - деление с округлением вниз ( divisor > 0 )
+//==============================================================================
+static int32_t ST7789_FloorDiv(int64_t dividend, int64_t divisor)
+{
 
-			for (j = 0; j < Font->FontWidth; j++)
-			{
+	int64_t q = dividend / divisor;
 
-				if ((b << j) & 0x8000)
-				{
+	if ((dividend % divisor) != 0 && dividend < 0)
+	{
+		q--;
+	}
 
-					for (yy = 0; yy < multiplier; yy++)
-					{
-						for (xx = 0; xx < multiplier; xx++)
-						{
-							ST7789_DrawPixel(X + xx, Y + yy, TextColor);
-						}
-					}
-				}
-				else if (TransparentBg)
-				{
+	if (q > INT16_MAX)
+	{
+		return INT16_MAX;
+	}
 
-					for (yy = 0; yy < multiplier; yy++)
-					{
-						for (xx = 0; xx < multiplier; xx++)
-						{
-							ST7789_DrawPixel(X + xx, Y + yy, BgColor);
-						}
-					}
-				}
-				X = X + multiplier;
-			}
-			X = x;
-			Y = Y + multiplier;
-		}
+	if (q < INT16_MIN)
+	{
+		return INT16_MIN;
 	}
+
+	return (int32_t)q;
 }
 //==============================================================================
 
 //==============================================================================
-// Процедура рисования строки
+// Процедура вспомогательная - луч границы сектора ( cos / sin в q31 )
+// угол в градусах: 0 = на 3 часа, рост по часовой стрелке ( ось Y вниз )
 //==============================================================================
-void ST7789_print(uint16_t x, uint16_t y, uint16_t TextColor, uint16_t BgColor, uint8_t TransparentBg, FontDef_t *Font, uint8_t multiplier, char *str)
+static void ST7789_AngleToRay(int16_t angle, q31_t *pCos, q31_t *pSin)
 {
 
-	if (multiplier < 1)
+	int32_t deg = angle % 360;
+
+	if (deg < 0)
 	{
-		multiplier = 1;
+		deg += 360;
 	}
 
-	unsigned char buff_char;
-
-	uint16_t len = strlen(str);
-
-	while (len--)
+	// arm_sin_cos_q31 принимает [-1 .. 1) что соответствует [-180 .. 180) градусам
+	if (deg >= 180)
 	{
+		deg -= 360;
+	}
 
-		//---------------------------------------------------------------------
-		// проверка на кириллицу UTF-8, если латиница то пропускаем if
-		// Расширенные символы ASCII Win-1251 кириллица (код символа 128-255)
-		// проверяем первый байт из двух ( так как UTF-8 ето два байта )
-		// если он больше либо равен 0xC0 ( первый байт в кириллеце будет равен 0xD0 либо 0xD1 именно в алфавите )
-		if ((uint8_t)*str >= 0xC0)
-		{ // код 0xC0 соответствует символу кириллица 'A' по ASCII Win-1251
+	arm_sin_cos_q31((q31_t)(((int64_t)deg << 31) / 180), pSin, pCos);
+}
+//==============================================================================
 
-			// проверяем какой именно байт первый 0xD0 либо 0xD1
-			switch ((uint8_t)*str)
+//==============================================================================
+// Процедура вспомогательная - полуплоскость A - B * dx >= 0 в строке как отрезок [lo..hi]
+//==============================================================================
+static void ST7789_HalfPlaneSpan(int64_t A, int64_t B, int32_t *pLo, int32_t *pHi)
+{
+
+	if (B > 0)
+	{
+		*pLo = INT16_MIN;
+		*pHi = ST7789_FloorDiv(A, B);
+	}
+	else if (B < 0)
+	{
+		// ceil( A / B ) = -floor( A / -B )
+		*pLo = -ST7789_FloorDiv(A, -B);
+		*pHi = INT16_MAX;
+	}
+	else if (A >= 0)
+	{
+		*pLo = INT16_MIN;
+		*pHi = INT16_MAX;
+	}
+	else
+	{
+		*pLo = 1;
+		*pHi = 0;
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вспомогательная - вывод отрезка [a..b] строки кольца с учетом сектора
+//==============================================================================
+static void ST7789_RingSpan(int16_t x0, int16_t y, int32_t a, int32_t b, uint8_t Wide, int32_t lo, int32_t hi, uint16_t color)
+{
+
+	if (a > b)
+	{
+		return;
+	}
+
+	if (!Wide)
+	{
+		// сектор <= 180: разрешенный отрезок [lo..hi]
+		if (lo > a)
+		{
+			a = lo;
+		}
+		if (hi < b)
+		{
+			b = hi;
+		}
+		if (a <= b)
+		{
+			ST7789_DrawHLine(x0 + a, y, b - a + 1, color);
+		}
+		return;
+	}
+
+	// сектор > 180: запрещенный отрезок [lo..hi], остается не больше двух частей
+	if (lo > hi || hi < a || lo > b)
+	{
+		ST7789_DrawHLine(x0 + a, y, b - a + 1, color);
+		return;
+	}
+
+	if (lo > a)
+	{
+		ST7789_DrawHLine(x0 + a, y, lo - a, color);
+	}
+
+	if (hi < b)
+	{
+		ST7789_DrawHLine(x0 + hi + 1, y, b - hi, color);
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура рисования сегмента кольца ( радиусы r_in .. r_out включительно )
+// углы в градусах, от start до end по часовой стрелке, 0 = на 3 часа
+// каждая строка выводится отрезками, один отрезок - одно окно и один пакет
+//==============================================================================
+void ST7789_DrawRingSegment(int16_t x0, int16_t y0, int16_t r_in, int16_t r_out, int16_t start, int16_t end, uint16_t color)
+{
+
+	int32_t sweep = end - start;
+	uint8_t Full = 0, Wide = 0;
+	q31_t c0 = 0, s0 = 0, c1 = 0, s1 = 0;
+
+	ST77XX_TRACE_BEGIN(ST77XX_TR_RING);
+
+	if (r_in < 0)
+	{
+		r_in = 0;
+	}
+
+	if (r_out < r_in || sweep == 0)
+	{
+		return;
+	}
+
+	if (sweep >= 360 || sweep <= -360)
+	{
+		Full = 1;
+	}
+	else
+	{
+		if (sweep < 0)
+		{
+			sweep += 360;
+		}
+		Wide = (sweep > 180);
+
+		// границы сектора считаем один раз на всю фигуру
+		ST7789_AngleToRay(start, &c0, &s0);
+		ST7789_AngleToRay(end, &c1, &s1);
+	}
+
+	// точка ( dx, dy ) в кольце если r_in^2 - r_in < dx^2 + dy^2 <= r_out^2 + r_out
+	const int32_t outer2 = (int32_t)r_out * r_out + r_out;
+	const int32_t inner2 = (int32_t)r_in * r_in - r_in;
+
+	for (int32_t dy = -r_out; dy <= r_out; dy++)
+	{
+
+		const int32_t dy2 = dy * dy;
+		const int32_t xo = (int32_t)ST7789_isqrt(outer2 - dy2);
+		int32_t xi = -1;
+		int32_t lo = INT16_MIN, hi = INT16_MAX;
+
+		if (r_in > 0 && inner2 >= dy2)
+		{
+			xi = (int32_t)ST7789_isqrt(inner2 - dy2);
+		}
+
+		if (!Full)
+		{
+			int32_t lo0, hi0, lo1, hi1;
+
+			// после начального луча: c0*dy - s0*dx >= 0, до конечного: s1*dx - c1*dy >= 0
+			if (!Wide)
 			{
-			case 0xD0:
+				ST7789_HalfPlaneSpan((int64_t)c0 * dy, s0, &lo0, &hi0);
+				ST7789_HalfPlaneSpan(-(int64_t)c1 * dy, -(int64_t)s1, &lo1, &hi1);
+			}
+			else
 			{
-				// увеличиваем массив так как нам нужен второй байт
-				str++;
-				// проверяем второй байт там сам символ
-				if ((uint8_t)*str == 0x81)
-				{
-					buff_char = 0xA8;
-					break;
-				} // байт символа Ё ( если нужнф еще символы добавляем тут и в функции DrawChar() )
-				if ((uint8_t)*str >= 0x90 && (uint8_t)*str <= 0xBF)
-				{
-					buff_char = (*str) + 0x30;
-				} // байт символов А...Я а...п  делаем здвиг на +48
-				break;
+				// дополнения полуплоскостей: A - B*dx < 0  <=>  (-A - 1) + B*dx >= 0
+				ST7789_HalfPlaneSpan(-(int64_t)c0 * dy - 1, -(int64_t)s0, &lo0, &hi0);
+				ST7789_HalfPlaneSpan((int64_t)c1 * dy - 1, s1, &lo1, &hi1);
 			}
-			case 0xD1:
+
+			lo = (lo0 > lo1) ? lo0 : lo1;
+			hi = (hi0 < hi1) ? hi0 : hi1;
+
+			if (!Wide && lo > hi)
 			{
-				// увеличиваем массив так как нам нужен второй байт
-				str++;
-				// проверяем второй байт там сам символ
-				if ((uint8_t)*str == 0x91)
-				{
-					buff_char = 0xB8;
-					break;
-				} // байт символа ё ( если нужнф еще символы добавляем тут и в функции DrawChar() )
-				if ((uint8_t)*str >= 0x80 && (uint8_t)*str <= 0x8F)
-				{
-					buff_char = (*str) + 0x70;
-				} // байт символов п...я	елаем здвиг на +112
-				break;
+				continue;
+			}
+		}
+
+		if (xi < 0)
+		{
+			ST7789_RingSpan(x0, y0 + dy, -xo, xo, Wide, lo, hi, color);
+		}
+		else
+		{
+			ST7789_RingSpan(x0, y0 + dy, -xo, -xi - 1, Wide, lo, hi, color);
+			ST7789_RingSpan(x0, y0 + dy, xi + 1, xo, Wide, lo, hi, color);
+		}
+	}
+
+	ST77XX_TRACE_END();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура рисования дуги заданной толщины ( внешний радиус radius )
+//==============================================================================
+void ST7789_DrawArc(int16_t x0, int16_t y0, int16_t radius, int16_t thickness, int16_t start, int16_t end, uint16_t color)
+{
+
+	if (thickness < 1)
+	{
+		thickness = 1;
+	}
+
+	ST7789_DrawRingSegment(x0, y0, radius - thickness + 1, radius, start, end, color);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура обновления кольцевой шкалы ( перерисовывается только изменившийся участок )
+//==============================================================================
+void ST7789_UpdateRingGauge(int16_t x0, int16_t y0, int16_t r_in, int16_t r_out, int16_t start, int16_t old_end, int16_t new_end, uint16_t color, uint16_t bgcolor)
+{
+
+	if (new_end > old_end)
+	{
+		ST7789_DrawRingSegment(x0, y0, r_in, r_out, (old_end > start) ? old_end : start, new_end, color);
+	}
+	else if (new_end < old_end)
+	{
+		ST7789_DrawRingSegment(x0, y0, r_in, r_out, (new_end > start) ? new_end : start, old_end, bgcolor);
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вспомогательная - отступ скругления для строки row ( 0 = крайняя строка )
+//==============================================================================
+static int16_t ST7789_RoundInset(int16_t r, int16_t row)
+{
+
+	const int32_t oy = r - row;
+
+	return r - (int16_t)ST7789_isqrt((int32_t)r * r + r - oy * oy);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вспомогательная - радиус скругления не больше половины стороны
+//==============================================================================
+static int16_t ST7789_RoundRadius(int16_t w, int16_t h, int16_t r)
+{
+
+	if (r > (w - 1) / 2)
+	{
+		r = (w - 1) / 2;
+	}
+
+	if (r > (h - 1) / 2)
+	{
+		r = (h - 1) / 2;
+	}
+
+	return (r < 0) ? 0 : r;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура рисования прямоугольника со скругленными углами ( заполненый )
+//==============================================================================
+void ST7789_DrawRoundRectFilled(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t fillcolor)
+{
+
+	ST77XX_TRACE_BEGIN(ST77XX_TR_ROUNDRECTFILLED);
+
+	if (w <= 0 || h <= 0)
+	{
+		return;
+	}
+
+	r = ST7789_RoundRadius(w, h, r);
+
+	for (int16_t i = 0; i < r; i++)
+	{
+		const int16_t inset = ST7789_RoundInset(r, i);
+
+		ST7789_DrawHLine(x + inset, y + i, w - 2 * inset, fillcolor);
+		ST7789_DrawHLine(x + inset, y + h - 1 - i, w - 2 * inset, fillcolor);
+	}
+
+	// середина без скруглений - одним окном
+	ST7789_FillRect(x, y + r, w, h - 2 * r, fillcolor);
+
+	ST77XX_TRACE_END();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура рисования прямоугольника со скругленными углами ( пустотелый )
+//==============================================================================
+void ST7789_DrawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+{
+
+	int16_t prev;
+
+	ST77XX_TRACE_BEGIN(ST77XX_TR_ROUNDRECT);
+
+	if (w <= 0 || h <= 0)
+	{
+		return;
+	}
+
+	r = ST7789_RoundRadius(w, h, r);
+	prev = ST7789_RoundInset(r, 0);
+
+	// верхняя и нижняя стороны
+	ST7789_DrawHLine(x + prev, y, w - 2 * prev, color);
+	ST7789_DrawHLine(x + prev, y + h - 1, w - 2 * prev, color);
+
+	// углы: в каждой строке отрезок от текущего отступа до отступа предыдущей строки
+	for (int16_t i = 1; i < r; i++)
+	{
+		const int16_t inset = ST7789_RoundInset(r, i);
+		const int16_t len = (prev - inset > 1) ? (prev - inset) : 1;
+
+		ST7789_DrawHLine(x + inset, y + i, len, color);
+		ST7789_DrawHLine(x + w - inset - len, y + i, len, color);
+		ST7789_DrawHLine(x + inset, y + h - 1 - i, len, color);
+		ST7789_DrawHLine(x + w - inset - len, y + h - 1 - i, len, color);
+
+		prev = inset;
+	}
+
+	// боковые стороны - вертикальными окнами
+	ST7789_FillRect(x, y + r, 1, h - 2 * r, color);
+	ST7789_FillRect(x + w - 1, y + r, 1, h - 2 * r, color);
+
+	ST77XX_TRACE_END();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура рисования символа ( 1 буква или знак )
+//==============================================================================
+void ST7789_DrawChar(uint16_t x, uint16_t y, uint16_t TextColor, uint16_t BgColor, uint8_t TransparentBg, FontDef_t *Font, uint8_t multiplier, unsigned char ch)
+{
+
+	uint32_t i, b, j;
+
+	uint32_t X = x, Y = y;
+
+	uint8_t xx, yy;
+
+	ST77XX_TRACE_BEGIN(ST77XX_TR_CHAR);
+
+	if (multiplier < 1)
+	{
+		multiplier = 1;
+	}
+
+	/* Check available space in LCD */
+	if (ST7789_Width >= (x + Font->FontWidth) || ST7789_Height >= (y + Font->FontHeight))
+	{
+
+		/* Go through font */
+		for (i = 0; i < Font->FontHeight; i++)
+		{
+
+			if (ch < 127)
+			{
+				b = Font->data[(ch - 32) * Font->FontHeight + i];
+			}
+
+			else if ((uint8_t)ch > 191)
+			{
+				// +96 это так как латинские символы и знаки в шрифтах занимают 96 позиций
+				// и если в шрифте который содержит сперва латиницу и спец символы и потом
+				// только кирилицу то нужно добавлять 95 если шрифт
+				// содержит только кирилицу то +96 не нужно
+				b = Font->data[((ch - 192) + 96) * Font->FontHeight + i];
 			}
+
+			else if ((uint8_t)ch == 168)
+			{ // 168 символ по ASCII - Ё
+				// 160 эллемент ( символ Ё )
+				b = Font->data[(160) * Font->FontHeight + i];
 			}
-			// уменьшаем еще переменную так как израсходывали 2 байта для кириллицы
-			len--;
 
-			ST7789_DrawChar(x, y, TextColor, BgColor, TransparentBg, Font, multiplier, buff_char);
-		}
-		//---------------------------------------------------------------------
-		else
-		{
-			ST7789_DrawChar(x, y, TextColor, BgColor, TransparentBg, Font, multiplier, *str);
-		}
+			else if ((uint8_t)ch == 184)
+			{ // 184 символ по ASCII - ё
+				// 161 эллемент  ( символ ё )
+				b = Font->data[(161) * Font->FontHeight + i];
+			}
+			//-------------------------------------------------------------------
+
+			for (j = 0; j < Font->FontWidth; j++)
+			{
+
+				if ((b << j) & 0x8000)
+				{
+
+					for (yy = 0; yy < multiplier; yy++)
+					{
+						for (xx = 0; xx < multiplier; xx++)
+						{
+							ST7789_DrawPixel(X + xx, Y + yy, TextColor);
+						}
+					}
+				}
+				else if (TransparentBg)
+				{
+
+					for (yy = 0; yy < multiplier; yy++)
+					{
+						for (xx = 0; xx < multiplier; xx++)
+						{
+							ST7789_DrawPixel(X + xx, Y + yy, BgColor);
+						}
+					}
+				}
+				X = X + multiplier;
+			}
+			X = x;
+			Y = Y + multiplier;
+		}
+	}
+
+	ST77XX_TRACE_END();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура рисования строки
+//==============================================================================
+void ST7789_print(uint16_t x, uint16_t y, uint16_t TextColor, uint16_t BgColor, uint8_t TransparentBg, FontDef_t *Font, uint8_t multiplier, char *str)
+{
+
+	if (multiplier < 1)
+	{
+		multiplier = 1;
+	}
+
+	unsigned char buff_char;
+
+	uint16_t len = strlen(str);
+
+	ST77XX_TRACE_BEGIN(ST77XX_TR_PRINT);
+
+	while (len--)
+	{
+
+		//---------------------------------------------------------------------
+		// проверка на кириллицу UTF-8, если латиница то пропускаем if
+		// Расширенные символы ASCII Win-1251 кириллица (код символа 128-255)
+		// проверяем первый байт из двух ( так как UTF-8 ето два байта )
+		// если он больше либо равен 0xC0 ( первый байт в кириллеце будет равен 0xD0 либо 0xD1 именно в алфавите )
+		if ((uint8_t)*str >= 0xC0)
+		{ // код 0xC0 соответствует символу кириллица 'A' по ASCII Win-1251
+
+			// проверяем какой именно байт первый 0xD0 либо 0xD1
+			switch ((uint8_t)*str)
+			{
+			case 0xD0:
+			{
+				// увеличиваем массив так как нам нужен второй байт
+				str++;
+				// проверяем второй байт там сам символ
+				if ((uint8_t)*str == 0x81)
+				{
+					buff_char = 0xA8;
+					break;
+				} // байт символа Ё ( если нужнф еще символы добавляем тут и в функции DrawChar() )
+				if ((uint8_t)*str >= 0x90 && (uint8_t)*str <= 0xBF)
+				{
+					buff_char = (*str) + 0x30;
+				} // байт символов А...Я а...п  делаем здвиг на +48
+				break;
+			}
+			case 0xD1:
+			{
+				// увеличиваем массив так как нам нужен второй байт
+				str++;
+				// проверяем второй байт там сам символ
+				if ((uint8_t)*str == 0x91)
+				{
+					buff_char = 0xB8;
+					break;
+				} // байт символа ё ( если нужнф еще символы добавляем тут и в функции DrawChar() )
+				if ((uint8_t)*str >= 0x80 && (uint8_t)*str <= 0x8F)
+				{
+					buff_char = (*str) + 0x70;
+				} // байт символов п...я	елаем здвиг на +112
+				break;
+			}
+			}
+			// уменьшаем еще переменную так как израсходывали 2 байта для кириллицы
+			len--;
+
+			ST7789_DrawChar(x, y, TextColor, BgColor, TransparentBg, Font, multiplier, buff_char);
+		}
+		//---------------------------------------------------------------------
+		else
+		{
+			ST7789_DrawChar(x, y, TextColor, BgColor, TransparentBg, Font, multiplier, *str);
+		}
+
+		x = x + (Font->FontWidth * multiplier);
+		/* Increase string pointer */
+		str++;
+	}
+
+	ST77XX_TRACE_END();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура ротации ( положение ) дисплея
+//==============================================================================
+// па умолчанию 1 режим ( всего 1, 2, 3, 4 )
+void ST7789_rotation(uint8_t rotation)
+{
+
+	ST7789_Select();
+
+	ST7789_SendCmd(ST7789_MADCTL);
+
+	// длайвер расчитан на экран 320 х 240 (  максимальный размер )
+	// для подгона под любой другой нужно отнимать разницу пикселей
+
+	switch (rotation)
+	{
+
+	case 1:
+//== 1.13" 135 x 240 ST7789 =================================================
+#ifdef ST7789_IS_135X240
+		ST7789_SendData(ST7789_MADCTL_RGB);
+		ST7789_Width = 135;
+		ST7789_Height = 240;
+		ST7789_X_Start = 52;
+		ST7789_Y_Start = 40;
+		ST7789_FillScreen(0);
+#endif
+//==========================================================================
+
+//== 1.3" 240 x 240 ST7789 =================================================
+#ifdef ST7789_IS_240X240
+		ST7789_SendData(ST7789_MADCTL_RGB);
+		ST7789_Width = 240;
+		ST7789_Height = 240;
+		ST7789_X_Start = 0;
+		ST7789_Y_Start = 0;
+		ST7789_FillScreen(0);
+#endif
+//==========================================================================
+
+//== 2" 240 x 320 ST7789 =================================================
+#ifdef ST7789_IS_240X320
+		ST7789_SendData(ST7789_MADCTL_RGB);
+		ST7789_Width = 240;
+		ST7789_Height = 320;
+		ST7789_X_Start = 0;
+		ST7789_Y_Start = 0;
+		ST7789_FillScreen(0);
+#endif
+		//==========================================================================
+		break;
+
+	case 2:
+//== 1.13" 135 x 240 ST7789 =================================================
+#ifdef ST7789_IS_135X240
+		ST7789_SendData(ST7789_MADCTL_MX | ST7789_MADCTL_MV | ST7789_MADCTL_RGB);
+		ST7789_Width = 240;
+		ST7789_Height = 135;
+		ST7789_X_Start = 40;
+		ST7789_Y_Start = 53;
+		ST7789_FillScreen(0);
+#endif
+//==========================================================================
+
+//== 1.3" 240 x 240 ST7789 =================================================
+#ifdef ST7789_IS_240X240
+		ST7789_SendData(ST7789_MADCTL_MX | ST7789_MADCTL_MV | ST7789_MADCTL_RGB);
+		ST7789_Width = 240;
+		ST7789_Height = 240;
+		ST7789_X_Start = 0;
+		ST7789_Y_Start = 0;
+		ST7789_FillScreen(0);
+#endif
+//==========================================================================
+
+//== 2" 240 x 320 ST7789 =================================================
+#ifdef ST7789_IS_240X320
+		ST7789_SendData(ST7789_MADCTL_MX | ST7789_MADCTL_MV | ST7789_MADCTL_RGB);
+		ST7789_Width = 320;
+		ST7789_Height = 240;
+		ST7789_X_Start = 0;
+		ST7789_Y_Start = 0;
+		ST7789_FillScreen(0);
+#endif
+		//==========================================================================
+		break;
+
+	case 3:
+		//== 1.13" 135 x 240 ST7789 =================================================
+#ifdef ST7789_IS_135X240
+		ST7789_SendData(ST7789_MADCTL_MX | ST7789_MADCTL_MY | ST7789_MADCTL_RGB);
+		ST7789_Width = 135;
+		ST7789_Height = 240;
+		ST7789_X_Start = 53;
+		ST7789_Y_Start = 40;
+		ST7789_FillScreen(0);
+#endif
+//==========================================================================
+
+//== 1.3" 240 x 240 ST7789 =================================================
+#ifdef ST7789_IS_240X240
+		ST7789_SendData(ST7789_MADCTL_MX | ST7789_MADCTL_MY | ST7789_MADCTL_RGB);
+		ST7789_Width = 240;
+		ST7789_Height = 240;
+		ST7789_X_Start = 0;
+		ST7789_Y_Start = 80;
+		ST7789_FillScreen(0);
+#endif
+//==========================================================================
+
+//== 2" 240 x 320 ST7789 =================================================
+#ifdef ST7789_IS_240X320
+		ST7789_SendData(ST7789_MADCTL_MX | ST7789_MADCTL_MY | ST7789_MADCTL_RGB);
+		ST7789_Width = 240;
+		ST7789_Height = 320;
+		ST7789_X_Start = 0;
+		ST7789_Y_Start = 0;
+		ST7789_FillScreen(0);
+#endif
+		//==========================================================================
+
+		break;
+
+	case 4:
+		//== 1.13" 135 x 240 ST7789 =================================================
+#ifdef ST7789_IS_135X240
+		ST7789_SendData(ST7789_MADCTL_MY | ST7789_MADCTL_MV | ST7789_MADCTL_RGB);
+		ST7789_Width = 240;
+		ST7789_Height = 135;
+		ST7789_X_Start = 40;
+		ST7789_Y_Start = 52;
+		ST7789_FillScreen(0);
+#endif
+//==========================================================================
+
+//== 1.3" 240 x 240 ST7789 =================================================
+#ifdef ST7789_IS_240X240
+		ST7789_SendData(ST7789_MADCTL_MY | ST7789_MADCTL_MV | ST7789_MADCTL_RGB);
+		ST7789_Width = 240;
+		ST7789_Height = 240;
+		ST7789_X_Start = 80;
+		ST7789_Y_Start = 0;
+		ST7789_FillScreen(0);
+#endif
+//==========================================================================
+
+//== 2" 240 x 320 ST7789 =================================================
+#ifdef ST7789_IS_240X320
+		ST7789_SendData(ST7789_MADCTL_MY | ST7789_MADCTL_MV | ST7789_MADCTL_RGB);
+		ST7789_Width = 320;
+		ST7789_Height = 240;
+		ST7789_X_Start = 0;
+		ST7789_Y_Start = 0;
+		ST7789_FillScreen(0);
+#endif
+		//==========================================================================
+		break;
+
+	default:
+		break;
+	}
+
+	ST7789_Unselect();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура рисования иконки монохромной
+//==============================================================================
+void ST7789_DrawBitmap(int16_t x, int16_t y, const unsigned char *bitmap, int16_t w, int16_t h, uint16_t color)
+{
+
+	int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
+	uint8_t byte = 0;
+
+	ST77XX_TRACE_BEGIN(ST77XX_TR_BITMAP);
+
+	for (int16_t j = 0; j < h; j++, y++)
+	{
+
+		for (int16_t i = 0; i < w; i++)
+		{
+
+			if (i & 7)
+			{
+				byte <<= 1;
+			}
+			else
+			{
+				byte = (*(const unsigned char *)(&bitmap[j * byteWidth + i / 8]));
+			}
+
+			if (byte & 0x80)
+			{
+				ST7789_DrawPixel(x + i, y, color);
+			}
+		}
+	}
+
+	ST77XX_TRACE_END();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вспомогательная - смешивание двух цветов RGB565 ( f = 0..32 )
+// каналы раздвигаются в 32 бита ( 0x07E0F81F ) и смешиваются одним умножением
+//==============================================================================
+static uint16_t ST7789_Blend565(uint16_t a, uint16_t b, uint32_t f)
+{
+
+	uint32_t A = (a | ((uint32_t)a << 16)) & 0x07E0F81F;
+	uint32_t B = (b | ((uint32_t)b << 16)) & 0x07E0F81F;
+
+	A = (A + (((B - A) * f) >> 5)) & 0x07E0F81F;
+
+	return (uint16_t)(A | (A >> 16));
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вспомогательная - выборка пикселя исходной картинки ( u, v в 16.16 )
+// картинка хранится в порядке байт для дисплея, как и для ST7789_DrawImage
+//==============================================================================
+static uint16_t ST7789_SamplePixel(const uint16_t *data, uint16_t sw, uint16_t sh, int32_t u, int32_t v, uint8_t mode, uint16_t bgcolor)
+{
+
+	// пиксели за пределами картинки закрашиваем фоном ( уже в порядке байт дисплея )
+	if (u < -0x8000 || v < -0x8000 || u >= ((int32_t)sw << 16) - 0x8000 || v >= ((int32_t)sh << 16) - 0x8000)
+	{
+		return (uint16_t)((bgcolor >> 8) | (bgcolor << 8));
+	}
+
+	if (mode == ST7789_BLIT_NEAREST)
+	{
+		return data[((v + 0x8000) >> 16) * sw + ((u + 0x8000) >> 16)];
+	}
+
+	// билинейная: четыре соседа, доли по 5 бит
+	if (u < 0)
+	{
+		u = 0;
+	}
+	if (v < 0)
+	{
+		v = 0;
+	}
+
+	const int32_t x0 = u >> 16, y0 = v >> 16;
+	const int32_t x1 = (x0 + 1 < sw) ? x0 + 1 : x0;
+	const int32_t y1 = (y0 + 1 < sh) ? y0 + 1 : y0;
+	const uint32_t fx = (u & 0xFFFF) >> 11, fy = (v & 0xFFFF) >> 11;
+
+	const uint16_t *row0 = &data[y0 * sw];
+	const uint16_t *row1 = &data[y1 * sw];
+
+	uint16_t p00 = row0[x0], p01 = row0[x1], p10 = row1[x0], p11 = row1[x1];
+
+	p00 = (p00 >> 8) | (p00 << 8);
+	p01 = (p01 >> 8) | (p01 << 8);
+	p10 = (p10 >> 8) | (p10 << 8);
+	p11 = (p11 >> 8) | (p11 << 8);
+
+	uint16_t c = ST7789_Blend565(ST7789_Blend565(p00, p01, fx), ST7789_Blend565(p10, p11, fx), fy);
+
+	return (uint16_t)((c >> 8) | (c << 8));
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вывода картинки с масштабом и поворотом ( обратное отображение )
+// окно x, y, w, h на экране; картинка sw x sh поворачивается на angle градусов
+// ( по часовой ) вокруг центра и масштабируется scale ( 16.16, 0x10000 = 1:1 )
+// строки считаются в буфер и сразу отправляются в дисплей
+//==============================================================================
+void ST7789_DrawImageAffine(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *data, uint16_t sw, uint16_t sh, int16_t angle, uint32_t scale, uint8_t mode, uint16_t bgcolor)
+{
+
+	q31_t c, s;
+	int16_t i0 = 0, j0 = 0, i1 = w, j1 = h;
+
+	ST77XX_TRACE_BEGIN(ST77XX_TR_IMAGEAFFINE);
+
+	if (scale == 0 || w == 0 || h == 0)
+	{
+		return;
+	}
+
+	// отсекаем окно по краям экрана
+	if (x < 0)
+	{
+		i0 = -x;
+	}
+	if (y < 0)
+	{
+		j0 = -y;
+	}
+	if (x + i1 > ST7789_Width)
+	{
+		i1 = ST7789_Width - x;
+	}
+	if (y + j1 > ST7789_Height)
+	{
+		j1 = ST7789_Height - y;
+	}
+	if (i0 >= i1 || j0 >= j1 || (i1 - i0) > ST7789_LINE_BUFF_SIZE)
+	{
+		return;
+	}
+
+	ST7789_AngleToRay(angle, &c, &s);
+
+	// шаги по источнику на один пиксель экрана вдоль строки и вдоль столбца ( 16.16 )
+	// с округлением, иначе cos( 0 ) = 0x7FFFFFFF дает накопление ошибки вдоль строки
+	const int32_t du_dx = (int32_t)((((int64_t)c << 1) + ((c < 0) ? -(int64_t)(scale >> 1) : (int64_t)(scale >> 1))) / scale);
+	const int32_t dv_dx = (int32_t)((-((int64_t)s << 1) + ((s > 0) ? -(int64_t)(scale >> 1) : (int64_t)(scale >> 1))) / scale);
+	const int32_t du_dy = -dv_dx;
+	const int32_t dv_dy = du_dx;
+
+	// центры окна и картинки ( 16.16 )
+	const int32_t cxd = ((int32_t)w - 1) << 15, cyd = ((int32_t)h - 1) << 15;
+	const int32_t cxs = ((int32_t)sw - 1) << 15, cys = ((int32_t)sh - 1) << 15;
+
+	const int32_t dx0 = ((int32_t)i0 << 16) - cxd;
+
+	ST7789_SetWindow(x + i0, y + j0, x + i1 - 1, y + j1 - 1);
+
+	for (int16_t j = j0; j < j1; j++)
+	{
+
+		const int32_t dy = ((int32_t)j << 16) - cyd;
+
+		int32_t u = cxs + (int32_t)(((int64_t)du_dx * dx0 + (int64_t)du_dy * dy) >> 16);
+		int32_t v = cys + (int32_t)(((int64_t)dv_dx * dx0 + (int64_t)dv_dy * dy) >> 16);
+
+		for (int16_t i = 0; i < i1 - i0; i++)
+		{
+			ST7789_LineBuff[i] = ST7789_SamplePixel(data, sw, sh, u, v, mode, bgcolor);
+			u += du_dx;
+			v += dv_dx;
+		}
+
+		ST7789_Select();
+		ST7789_SendDataMASS((uint8_t *)ST7789_LineBuff, sizeof(uint16_t) * (i1 - i0));
+		ST7789_Unselect();
+	}
+
+	ST77XX_TRACE_END();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вывода картинки с масштабированием в окно w x h ( без поворота )
+//==============================================================================
+void ST7789_DrawImageScaled(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *data, uint16_t sw, uint16_t sh, uint8_t mode)
+{
+
+	int16_t i0 = 0, j0 = 0, i1 = w, j1 = h;
+
+	ST77XX_TRACE_BEGIN(ST77XX_TR_IMAGESCALED);
+
+	if (w == 0 || h == 0)
+	{
+		return;
+	}
+
+	if (x < 0)
+	{
+		i0 = -x;
+	}
+	if (y < 0)
+	{
+		j0 = -y;
+	}
+	if (x + i1 > ST7789_Width)
+	{
+		i1 = ST7789_Width - x;
+	}
+	if (y + j1 > ST7789_Height)
+	{
+		j1 = ST7789_Height - y;
+	}
+	if (i0 >= i1 || j0 >= j1 || (i1 - i0) > ST7789_LINE_BUFF_SIZE)
+	{
+		return;
+	}
+
+	// шаг по источнику ( 16.16 ), выборка в центрах пикселей
+	const int32_t du = (int32_t)(((uint32_t)sw << 16) / w);
+	const int32_t dv = (int32_t)(((uint32_t)sh << 16) / h);
+	const int32_t u0 = (du >> 1) - 0x8000 + i0 * du;
+
+	ST7789_SetWindow(x + i0, y + j0, x + i1 - 1, y + j1 - 1);
+
+	for (int16_t j = j0; j < j1; j++)
+	{
+
+		const int32_t v = (dv >> 1) - 0x8000 + j * dv;
+		int32_t u = u0;
+
+		for (int16_t i = 0; i < i1 - i0; i++)
+		{
+			ST7789_LineBuff[i] = ST7789_SamplePixel(data, sw, sh, u, v, mode, 0);
+			u += du;
+		}
+
+		ST7789_Select();
+		ST7789_SendDataMASS((uint8_t *)ST7789_LineBuff, sizeof(uint16_t) * (i1 - i0));
+		ST7789_Unselect();
+	}
+
+	ST77XX_TRACE_END();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вспомогательная - установка делителя SPI ( биты BR регистра CR1 )
+//==============================================================================
+static void ST7789_SetPrescaler(uint32_t Prescaler)
+{
+
+#ifdef ST7789_SPI_HAL
+	SPI_TypeDef *spi = ST7789_SPI_HAL.Instance;
+#endif
+#ifdef ST7789_SPI_CMSIS
+	SPI_TypeDef *spi = ST7789_SPI_CMSIS;
+#endif
+
+	while ((spi->SR & SPI_SR_BSY) != RESET)
+	{
+	};
+
+	CLEAR_BIT(spi->CR1, SPI_CR1_SPE);
+
+	MODIFY_REG(spi->CR1, SPI_CR1_BR, Prescaler);
+
+	SET_BIT(spi->CR1, SPI_CR1_SPE);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вспомогательная - переключение SPI на скорость чтения и обратно
+// чтение GRAM у контроллера медленнее записи
+//==============================================================================
+static void ST7789_ReadSpeed(uint8_t Read)
+{
+
+	static uint32_t WriteBR;
+
+#ifdef ST7789_SPI_HAL
+	SPI_TypeDef *spi = ST7789_SPI_HAL.Instance;
+#endif
+#ifdef ST7789_SPI_CMSIS
+	SPI_TypeDef *spi = ST7789_SPI_CMSIS;
+#endif
+
+	if (Read)
+	{
+		WriteBR = spi->CR1 & SPI_CR1_BR;
+		ST7789_SetPrescaler(ST7789_ReadBR);
+	}
+	else
+	{
+		ST7789_SetPrescaler(WriteBR);
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура чтения окна GRAM в буфер ( RGB565, родной порядок байт )
+// после RAMRD контроллер выдает пустой байт, затем пиксели в 18-битном
+// формате: по байту на канал, значимы старшие 6 бит
+//==============================================================================
+void ST7789_ReadWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t *pBuff)
+{
+
+	uint8_t rgb[3 * 16];
+	uint32_t Len = (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+
+	ST77XX_TRACE_BEGIN(ST77XX_TR_READ);
+
+	if ((x0 > x1) || (y0 > y1) || (x1 >= ST7789_Width) || (y1 >= ST7789_Height))
+	{
+		return;
+	}
+
+	ST7789_Select();
+
+	ST7789_ColumnSet(x0, x1);
+	ST7789_RowSet(y0, y1);
+	ST7789_SendCmd(ST7789_RAMRD);
+
+	ST7789_ReadSpeed(1);
+
+	// пустой байт
+	ST7789_ReceiveDataMASS(rgb, 1);
+
+	while (Len)
+	{
+		uint32_t n = (Len > 16) ? 16 : Len;
+
+		ST7789_ReceiveDataMASS(rgb, 3 * n);
+
+		for (uint32_t i = 0; i < n; i++)
+		{
+			*pBuff++ = RGB565(rgb[3 * i], rgb[3 * i + 1], rgb[3 * i + 2]);
+		}
+
+		Len -= n;
+	}
+
+	ST7789_ReadSpeed(0);
+
+	// CS вверх - завершение чтения
+	ST7789_Unselect();
+
+	ST77XX_TRACE_END();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вспомогательная - операция над одним пикселем
+//==============================================================================
+static uint16_t ST7789_BlendOp(uint16_t pix, uint16_t color, uint32_t a, uint8_t op)
+{
+
+	switch (op)
+	{
 
-		x = x + (Font->FontWidth * multiplier);
-		/* Increase string pointer */
-		str++;
+	case ST7789_BLEND_XOR:
+		return pix ^ color;
+
+	case ST7789_BLEND_TINT:
+	{
+		// умножение по каналам, затем смешивание с исходным по альфе
+		uint32_t r = ((uint32_t)(pix >> 11) * (color >> 11)) / 31;
+		uint32_t g = ((uint32_t)((pix >> 5) & 0x3F) * ((color >> 5) & 0x3F)) / 63;
+		uint32_t b = ((uint32_t)(pix & 0x1F) * (color & 0x1F)) / 31;
+
+		return ST7789_Blend565(pix, (uint16_t)((r << 11) | (g << 5) | b), a);
+	}
+
+	default:
+		return ST7789_Blend565(pix, color, a);
 	}
 }
 //==============================================================================
 
 //==============================================================================
-// Процедура ротации ( положение ) дисплея
+// Процедура вспомогательная - чтение-изменение-запись прямоугольника по строкам
+// data != NULL: цвет берется из картинки ( порядок байт дисплея ), иначе color
 //==============================================================================
-// па умолчанию 1 режим ( всего 1, 2, 3, 4 )
-void ST7789_rotation(uint8_t rotation)
+static void ST7789_BlendArea(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *data, uint16_t color, uint8_t alpha, uint8_t op)
 {
 
-	ST7789_Select();
+	int16_t i0 = 0, j0 = 0, i1 = w, j1 = h;
 
-	ST7789_SendCmd(ST7789_MADCTL);
+	if (x < 0)
+	{
+		i0 = -x;
+	}
+	if (y < 0)
+	{
+		j0 = -y;
+	}
+	if (x + i1 > ST7789_Width)
+	{
+		i1 = ST7789_Width - x;
+	}
+	if (y + j1 > ST7789_Height)
+	{
+		j1 = ST7789_Height - y;
+	}
+	if (i0 >= i1 || j0 >= j1 || (i1 - i0) > ST7789_LINE_BUFF_SIZE)
+	{
+		return;
+	}
 
-	// длайвер расчитан на экран 320 х 240 (  максимальный размер )
-	// для подгона под любой другой нужно отнимать разницу пикселей
+	// альфа 0..255 -> 0..32 для смешивания
+	const uint32_t a = ((uint32_t)alpha + 4) >> 3;
+	const uint16_t n = i1 - i0;
 
-	switch (rotation)
+	for (int16_t j = j0; j < j1; j++)
 	{
 
-	case 1:
-//== 1.13" 135 x 240 ST7789 =================================================
-#ifdef ST7789_IS_135X240
-		ST7789_SendData(ST7789_MADCTL_RGB);
-		ST7789_Width = 135;
-		ST7789_Height = 240;
-		ST7789_X_Start = 52;
-		ST7789_Y_Start = 40;
-		ST7789_FillScreen(0);
-#endif
-//==========================================================================
+		ST7789_ReadWindow(x + i0, y + j, x + i1 - 1, y + j, ST7789_LineBuff);
 
-//== 1.3" 240 x 240 ST7789 =================================================
-#ifdef ST7789_IS_240X240
-		ST7789_SendData(ST7789_MADCTL_RGB);
-		ST7789_Width = 240;
-		ST7789_Height = 240;
-		ST7789_X_Start = 0;
-		ST7789_Y_Start = 0;
-		ST7789_FillScreen(0);
-#endif
-//==========================================================================
+		for (uint16_t i = 0; i < n; i++)
+		{
+			uint16_t c = color;
 
-//== 2" 240 x 320 ST7789 =================================================
-#ifdef ST7789_IS_240X320
-		ST7789_SendData(ST7789_MADCTL_RGB);
-		ST7789_Width = 240;
-		ST7789_Height = 320;
-		ST7789_X_Start = 0;
-		ST7789_Y_Start = 0;
-		ST7789_FillScreen(0);
-#endif
-		//==========================================================================
-		break;
+			if (data)
+			{
+				c = data[j * w + i0 + i];
+				c = (c >> 8) | (c << 8);
+			}
 
-	case 2:
-//== 1.13" 135 x 240 ST7789 =================================================
-#ifdef ST7789_IS_135X240
-		ST7789_SendData(ST7789_MADCTL_MX | ST7789_MADCTL_MV | ST7789_MADCTL_RGB);
-		ST7789_Width = 240;
-		ST7789_Height = 135;
-		ST7789_X_Start = 40;
-		ST7789_Y_Start = 53;
-		ST7789_FillScreen(0);
-#endif
-//==========================================================================
+			c = ST7789_BlendOp(ST7789_LineBuff[i], c, a, op);
 
-//== 1.3" 240 x 240 ST7789 =================================================
-#ifdef ST7789_IS_240X240
-		ST7789_SendData(ST7789_MADCTL_MX | ST7789_MADCTL_MV | ST7789_MADCTL_RGB);
-		ST7789_Width = 240;
-		ST7789_Height = 240;
-		ST7789_X_Start = 0;
-		ST7789_Y_Start = 0;
-		ST7789_FillScreen(0);
-#endif
-//==========================================================================
+			// обратно в порядок байт дисплея
+			ST7789_LineBuff[i] = (c >> 8) | (c << 8);
+		}
 
-//== 2" 240 x 320 ST7789 =================================================
-#ifdef ST7789_IS_240X320
-		ST7789_SendData(ST7789_MADCTL_MX | ST7789_MADCTL_MV | ST7789_MADCTL_RGB);
-		ST7789_Width = 320;
-		ST7789_Height = 240;
-		ST7789_X_Start = 0;
-		ST7789_Y_Start = 0;
-		ST7789_FillScreen(0);
-#endif
-		//==========================================================================
-		break;
+		ST7789_SetWindow(x + i0, y + j, x + i1 - 1, y + j);
 
-	case 3:
-		//== 1.13" 135 x 240 ST7789 =================================================
-#ifdef ST7789_IS_135X240
-		ST7789_SendData(ST7789_MADCTL_MX | ST7789_MADCTL_MY | ST7789_MADCTL_RGB);
-		ST7789_Width = 135;
-		ST7789_Height = 240;
-		ST7789_X_Start = 53;
-		ST7789_Y_Start = 40;
-		ST7789_FillScreen(0);
-#endif
-//==========================================================================
+		ST7789_Select();
+		ST7789_SendDataMASS((uint8_t *)ST7789_LineBuff, sizeof(uint16_t) * n);
+		ST7789_Unselect();
+	}
+}
+//==============================================================================
 
-//== 1.3" 240 x 240 ST7789 =================================================
-#ifdef ST7789_IS_240X240
-		ST7789_SendData(ST7789_MADCTL_MX | ST7789_MADCTL_MY | ST7789_MADCTL_RGB);
-		ST7789_Width = 240;
-		ST7789_Height = 240;
-		ST7789_X_Start = 0;
-		ST7789_Y_Start = 80;
-		ST7789_FillScreen(0);
-#endif
-//==========================================================================
+//==============================================================================
+// Процедура наложения цвета на прямоугольник без буфера кадра
+// op: ST7789_BLEND_ALPHA / ST7789_BLEND_XOR / ST7789_BLEND_TINT, alpha 0..255
+//==============================================================================
+void ST7789_BlendRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint8_t alpha, uint8_t op)
+{
 
-//== 2" 240 x 320 ST7789 =================================================
-#ifdef ST7789_IS_240X320
-		ST7789_SendData(ST7789_MADCTL_MX | ST7789_MADCTL_MY | ST7789_MADCTL_RGB);
-		ST7789_Width = 240;
-		ST7789_Height = 320;
-		ST7789_X_Start = 0;
-		ST7789_Y_Start = 0;
-		ST7789_FillScreen(0);
-#endif
-		//==========================================================================
+	ST77XX_TRACE_BEGIN(ST77XX_TR_BLEND);
 
-		break;
+	ST7789_BlendArea(x, y, w, h, NULL, color, alpha, op);
 
-	case 4:
-		//== 1.13" 135 x 240 ST7789 =================================================
-#ifdef ST7789_IS_135X240
-		ST7789_SendData(ST7789_MADCTL_MY | ST7789_MADCTL_MV | ST7789_MADCTL_RGB);
-		ST7789_Width = 240;
-		ST7789_Height = 135;
-		ST7789_X_Start = 40;
-		ST7789_Y_Start = 52;
-		ST7789_FillScreen(0);
-#endif
-//==========================================================================
+	ST77XX_TRACE_END();
+}
+//==============================================================================
 
-//== 1.3" 240 x 240 ST7789 =================================================
-#ifdef ST7789_IS_240X240
-		ST7789_SendData(ST7789_MADCTL_MY | ST7789_MADCTL_MV | ST7789_MADCTL_RGB);
-		ST7789_Width = 240;
-		ST7789_Height = 240;
-		ST7789_X_Start = 80;
-		ST7789_Y_Start = 0;
-		ST7789_FillScreen(0);
-#endif
-//==========================================================================
+//==============================================================================
+// Процедура наложения картинки с прозрачностью alpha ( 0..255 ) поверх экрана
+//==============================================================================
+void ST7789_BlendImage(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *data, uint8_t alpha)
+{
 
-//== 2" 240 x 320 ST7789 =================================================
-#ifdef ST7789_IS_240X320
-		ST7789_SendData(ST7789_MADCTL_MY | ST7789_MADCTL_MV | ST7789_MADCTL_RGB);
-		ST7789_Width = 320;
-		ST7789_Height = 240;
-		ST7789_X_Start = 0;
-		ST7789_Y_Start = 0;
-		ST7789_FillScreen(0);
-#endif
-		//==========================================================================
-		break;
+	ST77XX_TRACE_BEGIN(ST77XX_TR_BLEND);
 
-	default:
-		break;
+	ST7789_BlendArea(x, y, w, h, data, 0, alpha, ST7789_BLEND_ALPHA);
+
+	ST77XX_TRACE_END();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вспомогательная - запись образца в окно калибровки на текущей
+// скорости и чтение обратно на скорости ST7789_ReadBR, 1 - совпало
+//==============================================================================
+static uint8_t ST7789_CalCheck(uint32_t Seed)
+{
+
+	static uint16_t Read[ST7789_CAL_W * ST7789_CAL_H];
+	uint32_t i, rnd = Seed;
+	uint16_t c;
+
+	for (i = 0; i < ST7789_CAL_W * ST7789_CAL_H; i++)
+	{
+		// первые пиксели - чередование бит ( самый тяжелый случай для линии ), дальше псевдослучайные
+		rnd = rnd * 1664525 + 1013904223;
+		c = (i < 4) ? ((i & 1) ? 0xAAAA : 0x5555) : (uint16_t)(rnd >> 16);
+		ST7789_LineBuff[i] = (c >> 8) | (c << 8);
 	}
 
+	ST7789_SetWindow(0, 0, ST7789_CAL_W - 1, ST7789_CAL_H - 1);
+
+	ST7789_Select();
+	ST7789_SendDataMASS((uint8_t *)ST7789_LineBuff, sizeof(uint16_t) * ST7789_CAL_W * ST7789_CAL_H);
 	ST7789_Unselect();
+
+	ST7789_ReadWindow(0, 0, ST7789_CAL_W - 1, ST7789_CAL_H - 1, Read);
+
+	for (i = 0; i < ST7789_CAL_W * ST7789_CAL_H; i++)
+	{
+		c = (ST7789_LineBuff[i] >> 8) | (ST7789_LineBuff[i] << 8);
+		if (Read[i] != c)
+		{
+			return 0;
+		}
+	}
+
+	return 1;
 }
 //==============================================================================
 
 //==============================================================================
-// Процедура рисования иконки монохромной
+// Процедура вспомогательная - несколько проверок подряд
 //==============================================================================
-void ST7789_DrawBitmap(int16_t x, int16_t y, const unsigned char *bitmap, int16_t w, int16_t h, uint16_t color)
+static uint8_t ST7789_CalPass(void)
 {
 
-	int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
-	uint8_t byte = 0;
+	uint8_t k;
 
-	for (int16_t j = 0; j < h; j++, y++)
+	for (k = 0; k < ST7789_CAL_REPEAT; k++)
 	{
+		if (!ST7789_CalCheck(k + 1))
+		{
+			return 0;
+		}
+	}
 
-		for (int16_t i = 0; i < w; i++)
+	return 1;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура калибровки скорости SPI: запись образца и чтение обратно
+// на возрастающих частотах, выбираются самые быстрые надежные делители
+// сначала для чтения ( образец пишется медленно ), затем для записи
+// 0 - чтение не работает ни на одной скорости ( нет MISO ), скорости не изменены
+//==============================================================================
+uint8_t ST7789_CalibrateSPI(ST7789_SpiCal_t *cal)
+{
+
+	// от быстрого к медленному
+	static const uint32_t Prescalers[] = {SPI_BAUDRATEPRESCALER_2, SPI_BAUDRATEPRESCALER_4, SPI_BAUDRATEPRESCALER_8,
+										  SPI_BAUDRATEPRESCALER_16, SPI_BAUDRATEPRESCALER_32};
+	const int8_t Slowest = sizeof(Prescalers) / sizeof(Prescalers[0]) - 1;
+	int8_t i, r = -1, w = -1;
+	uint32_t Clock;
+
+#ifdef ST7789_SPI_HAL
+	SPI_TypeDef *spi = ST7789_SPI_HAL.Instance;
+#endif
+#ifdef ST7789_SPI_CMSIS
+	SPI_TypeDef *spi = ST7789_SPI_CMSIS;
+#endif
+
+	uint32_t OldWriteBR = spi->CR1 & SPI_CR1_BR;
+	uint32_t OldReadBR = ST7789_ReadBR;
+
+	ST7789_WaitDMA();
+
+	// чтение: запись на самой медленной скорости
+	ST7789_SetPrescaler(Prescalers[Slowest]);
+
+	for (i = Slowest; i >= 0; i--)
+	{
+		ST7789_ReadBR = Prescalers[i];
+		if (!ST7789_CalPass())
 		{
+			break;
+		}
+		r = i;
+	}
 
-			if (i & 7)
-			{
-				byte <<= 1;
-			}
-			else
-			{
-				byte = (*(const unsigned char *)(&bitmap[j * byteWidth + i / 8]));
-			}
+	if (r < 0)
+	{
+		ST7789_ReadBR = OldReadBR;
+		ST7789_SetPrescaler(OldWriteBR);
+		ST7789_FillRect(0, 0, ST7789_CAL_W, ST7789_CAL_H, ST7789_BLACK);
+		return 0;
+	}
 
-			if (byte & 0x80)
-			{
-				ST7789_DrawPixel(x + i, y, color);
-			}
+	r = (r + ST7789_CAL_MARGIN > Slowest) ? Slowest : r + ST7789_CAL_MARGIN;
+	ST7789_ReadBR = Prescalers[r];
+
+	// запись: проверка чтением на уже найденной скорости
+	for (i = Slowest; i >= 0; i--)
+	{
+		ST7789_SetPrescaler(Prescalers[i]);
+		if (!ST7789_CalPass())
+		{
+			break;
 		}
+		w = i;
+	}
+
+	w = (w < 0) ? Slowest : ((w + ST7789_CAL_MARGIN > Slowest) ? Slowest : w + ST7789_CAL_MARGIN);
+
+	ST7789_SetPrescaler(Prescalers[w]);
+
+#ifdef ST7789_SPI_HAL
+	// чтобы повторный HAL_SPI_Init не вернул старую скорость
+	ST7789_SPI_HAL.Init.BaudRatePrescaler = Prescalers[w];
+#endif
+
+	ST7789_FillRect(0, 0, ST7789_CAL_W, ST7789_CAL_H, ST7789_BLACK);
+
+	if (cal)
+	{
+		Clock = (spi == SPI1) ? HAL_RCC_GetPCLK2Freq() : HAL_RCC_GetPCLK1Freq();
+
+		cal->write_prescaler = Prescalers[w];
+		cal->read_prescaler = Prescalers[r];
+		cal->write_hz = Clock >> ((Prescalers[w] >> SPI_CR1_BR_Pos) + 1);
+		cal->read_hz = Clock >> ((Prescalers[r] >> SPI_CR1_BR_Pos) + 1);
 	}
+
+	return 1;
 }
 //==============================================================================
 
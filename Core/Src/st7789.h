@@ -4,12 +4,13 @@
 
 /* C++ detection */
 #ifdef __cplusplus
-extern C {
+extern "C" {
 #endif
 
 /* 必须包括“main.h”,为了避免单独连接与MK和标准库相关的文件 */
 #include "stm32f1xx.h"
 #include "st77xx_spi.h"
+#include "st77xx_bl.h"
 #include "st77xx_fonts.h"
 #include "stdlib.h"
 #include "string.h"
@@ -86,6 +87,7 @@ extern uint16_t ST7789_Y_Start;
 #define ST7789_CASET   0x2A
 #define ST7789_RASET   0x2B
 #define ST7789_RAMWR   0x2C
+#define ST7789_RAMRD   0x2E
 #define ST7789_COLMOD  0x3A
 #define ST7789_MADCTL  0x36
 /* ------------------------------------------------ */
@@ -93,6 +95,35 @@ extern uint16_t ST7789_Y_Start;
 #define DELAY 0x80
 /* ------------------------------------------------ */
 
+/* 行缓冲区大小（像素），按驱动支持的最大宽度 320 */
+#define ST7789_LINE_BUFF_SIZE	320
+/* ------------------------------------------------ */
+
+/* 读取 GRAM 时的 SPI 分频（控制器读时钟比写时钟慢），校准前的默认值 */
+#define ST7789_READ_PRESCALER	SPI_BAUDRATEPRESCALER_8
+/* ------------------------------------------------ */
+
+/* SPI 速度校准：ST7789_Init() 结束时在左上角 ST7789_CAL_W x ST7789_CAL_H 的窗口
+   写入并读回测试图案，从慢到快试分频，写和读分别取最快的可靠分频（需要 MISO）。
+   ST7789_CAL_MARGIN 为额外放慢的档数 */
+#define ST7789_SPI_AUTOCAL
+#define ST7789_CAL_W			16
+#define ST7789_CAL_H			4
+#define ST7789_CAL_REPEAT		4		/* 每个速度连续通过的次数 */
+#define ST7789_CAL_MARGIN		0
+/* ------------------------------------------------ */
+
+/* 读-改-写叠加方式 */
+#define ST7789_BLEND_ALPHA		0	/* 按 alpha 与颜色混合 */
+#define ST7789_BLEND_XOR		1	/* 与颜色异或（光标），再次调用即恢复 */
+#define ST7789_BLEND_TINT		2	/* 按通道相乘着色，再按 alpha 混合 */
+/* ------------------------------------------------ */
+
+/* 图像缩放/旋转的插值方式 */
+#define ST7789_BLIT_NEAREST		0
+#define ST7789_BLIT_BILINEAR	1
+/* ------------------------------------------------ */
+
 /* 1.3" 240 x 240 ST7789  display, default orientation */
 #ifdef ST7789_IS_240X240
 	
@@ -151,6 +182,15 @@ void ST7789_SendData(uint8_t Data );
 /* 向Mass显示屏发送数据（参数）的过程 */
 void ST7789_SendDataMASS(uint8_t* buff, size_t buff_size);
 
+/* 从显示屏接收数据的过程（读取 GRAM） */
+void ST7789_ReceiveDataMASS(uint8_t* buff, size_t buff_size);
+
+/* 通过DMA发送数据（不等待完成） */
+void ST7789_SendDataDMA(uint8_t* buff, size_t buff_size);
+
+/* 等待DMA传输完成 */
+void ST7789_WaitDMA(void);
+
 /* 睡眠模式启动程序 */
 void ST7789_SleepModeEnter( void );
 
@@ -181,6 +221,9 @@ void ST7789_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 /* 将数据写入显示器的过程 */
 void ST7789_RamWrite(uint16_t *pBuff, uint32_t Len);
 
+/* 用一种颜色填充窗口的过程（每 ST7789_LINE_BUFF_SIZE 像素一个包） */
+void ST7789_RamFill(uint16_t color, uint32_t Len);
+
 /* 设置列的起始和结束地址的过程 */
 static void ST7789_ColumnSet(uint16_t ColumnStart, uint16_t ColumnEnd);
 
@@ -223,6 +266,24 @@ void ST7789_DrawCircleFilled(int16_t x0, int16_t y0, int16_t radius, uint16_t fi
 /* 绘制圆的过程（空心） */
 void ST7789_DrawCircle(int16_t x0, int16_t y0, int16_t radius, uint16_t color);
 
+/* 绘制水平线段的过程（一个窗口一次发送） */
+void ST7789_DrawHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+
+/* 绘制圆环扇段的过程（半径 r_in..r_out，角度按顺时针，0 = 3 点钟方向） */
+void ST7789_DrawRingSegment(int16_t x0, int16_t y0, int16_t r_in, int16_t r_out, int16_t start, int16_t end, uint16_t color);
+
+/* 绘制指定粗细圆弧的过程（radius 为外半径） */
+void ST7789_DrawArc(int16_t x0, int16_t y0, int16_t radius, int16_t thickness, int16_t start, int16_t end, uint16_t color);
+
+/* 更新环形仪表的过程（只重画变化的弧段） */
+void ST7789_UpdateRingGauge(int16_t x0, int16_t y0, int16_t r_in, int16_t r_out, int16_t start, int16_t old_end, int16_t new_end, uint16_t color, uint16_t bgcolor);
+
+/* 绘制圆角矩形的过程（空心） */
+void ST7789_DrawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+
+/* 绘制圆角矩形的过程（填充） */
+void ST7789_DrawRoundRectFilled(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t fillcolor);
+
 /* 绘制符号的过程（1个字母或符号） */
 void ST7789_DrawChar(uint16_t x, uint16_t y, uint16_t TextColor, uint16_t BgColor, uint8_t TransparentBg, FontDef_t* Font, uint8_t multiplier, unsigned char ch);
 
@@ -236,6 +297,30 @@ void ST7789_rotation( uint8_t rotation );
 /* 单色图标绘制程序 */
 void ST7789_DrawBitmap(int16_t x, int16_t y, const unsigned char* bitmap, int16_t w, int16_t h, uint16_t color);
 
+/* 图像缩放输出过程（不旋转），源图 sw x sh 缩放到窗口 w x h */
+void ST7789_DrawImageScaled(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *data, uint16_t sw, uint16_t sh, uint8_t mode);
+
+/* 图像缩放并旋转输出过程（逆映射，scale 为 16.16 定点，0x10000 = 1:1） */
+void ST7789_DrawImageAffine(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *data, uint16_t sw, uint16_t sh, int16_t angle, uint32_t scale, uint8_t mode, uint16_t bgcolor);
+
+/* 校准结果 */
+typedef struct {
+	uint32_t write_prescaler, read_prescaler;	/* SPI_BAUDRATEPRESCALER_x */
+	uint32_t write_hz, read_hz;
+} ST7789_SpiCal_t;
+
+/* SPI 速度校准（见 ST7789_SPI_AUTOCAL），cal 可为 NULL；读不回数据时返回 0，速度不变 */
+uint8_t ST7789_CalibrateSPI(ST7789_SpiCal_t *cal);
+
+/* 读取窗口 GRAM 到缓冲区的过程（RGB565，本机字节序） */
+void ST7789_ReadWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t *pBuff);
+
+/* 无帧缓冲的矩形叠加过程（读-改-写，op 见 ST7789_BLEND_xxx，alpha 0..255） */
+void ST7789_BlendRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint8_t alpha, uint8_t op);
+
+/* 半透明图像叠加过程（alpha 0..255） */
+void ST7789_BlendImage(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *data, uint8_t alpha);
+
 /* C++ detection */
 #ifdef __cplusplus
 }
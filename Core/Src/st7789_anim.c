@@ -0,0 +1,206 @@
+#include "st7789_anim.h"
+
+//==============================================================================
+// Процедура открытия анимации
+//==============================================================================
+uint8_t ST7789_Anim_Open(ST7789_Anim_t *a, const uint16_t *data, uint16_t x, uint16_t y, uint8_t loop)
+{
+
+	memset(a, 0, sizeof(ST7789_Anim_t));
+
+	if ((data[0] != ST7789_ANIM_MAGIC) || ((data[1] & 0xFF) != ST7789_ANIM_VERSION) || (data[4] == 0))
+	{
+		return 0;
+	}
+
+	a->width = data[2];
+	a->height = data[3];
+
+	if ((x + a->width > ST7789_Width) || (y + a->height > ST7789_Height))
+	{
+		return 0;
+	}
+
+	a->data = data;
+	a->x = x;
+	a->y = y;
+	a->frames = data[4];
+	a->flags = (uint8_t)(data[1] >> 8);
+	a->loop = (loop && (a->flags & ST7789_ANIM_FLAG_LOOP)) ? 1 : 0;
+
+	ST77XX_CYCLES_INIT();
+
+	ST7789_Anim_Rewind(a);
+
+	return 1;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура перехода к началу
+//==============================================================================
+void ST7789_Anim_Rewind(ST7789_Anim_t *a)
+{
+
+	if (a->data == NULL)
+	{
+		return;
+	}
+
+	a->pFrame = a->data + ST7789_ANIM_HEADER_WORDS;
+	a->index = 0;
+	a->playing = 1;
+	a->due = HAL_GetTick();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вывода следующего кадра: прямоугольники RAW уходят по DMA прямо
+// из FLASH, следующий SetWindow дожидается окончания предыдущей передачи
+//==============================================================================
+uint16_t ST7789_Anim_DrawFrame(ST7789_Anim_t *a)
+{
+
+	const uint16_t *p = a->pFrame;
+	uint16_t delay, n, x, y, w, h, type;
+	uint32_t t0, size;
+
+	if (!a->playing)
+	{
+		return 0;
+	}
+
+	t0 = ST77XX_CYCLES();
+
+	delay = *p++;
+	n = *p++;
+
+	a->stats.rects += n;
+
+	while (n--)
+	{
+		x = a->x + p[0];
+		y = a->y + p[1];
+		w = p[2];
+		h = p[3] & 0x0FFF;
+		type = p[3] >> 12;
+		p += 4;
+
+		if (type == ST7789_ANIM_RECT_FILL)
+		{
+			ST7789_FillRect(x, y, w, h, *p++);
+			a->stats.fills++;
+		}
+		else
+		{
+			size = (uint32_t)w * h;
+
+			ST7789_SetWindow(x, y, x + w - 1, y + h - 1);
+
+			ST7789_Select();
+
+			ST7789_SendDataDMA((uint8_t *)p, sizeof(uint16_t) * size);
+
+			p += size;
+		}
+
+		a->stats.pixels += (uint32_t)w * h;
+	}
+
+	ST7789_WaitDMA();
+
+	ST7789_Unselect();
+
+	a->stats.cycles = ST77XX_CYCLES() - t0;
+	a->stats.cycles_sum += a->stats.cycles;
+	if (a->stats.cycles > a->stats.cycles_max)
+	{
+		a->stats.cycles_max = a->stats.cycles;
+	}
+	a->stats.raw_pixels += (uint32_t)a->width * a->height;
+	a->stats.frames++;
+
+	// следующий кадр: 0, 1 ... frames - 1, [ кадр возврата, 1 ... ]
+	if (a->index == 0)
+	{
+		a->pLoop = p;
+	}
+
+	if (a->index == a->frames)
+	{
+		a->pFrame = a->pLoop;
+		a->index = 1;
+	}
+	else if ((a->index == a->frames - 1) && !a->loop)
+	{
+		a->playing = 0;
+		a->index = a->frames;
+	}
+	else
+	{
+		a->pFrame = p;
+		a->index++;
+	}
+
+	return delay;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура проигрывания по времени ( из основного цикла )
+//==============================================================================
+uint8_t ST7789_Anim_Process(ST7789_Anim_t *a)
+{
+
+	uint32_t now = HAL_GetTick();
+	uint16_t delay;
+
+	if (!a->playing || ((int32_t)(now - a->due) < 0))
+	{
+		return 0;
+	}
+
+	delay = ST7789_Anim_DrawFrame(a);
+
+	// опоздание больше чем на кадр - не догоняем, а начинаем отсчет заново
+	if (now - a->due >= delay)
+	{
+		if (a->stats.frames > 1)
+		{
+			a->stats.late++;
+		}
+		a->due = now + delay;
+	}
+	else
+	{
+		a->due += delay;
+	}
+
+	return 1;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура проигрывания до конца
+//==============================================================================
+void ST7789_Anim_Play(ST7789_Anim_t *a, uint16_t loops)
+{
+
+	uint16_t pass = 1;
+
+	while (a->playing)
+	{
+		// следующим будет кадр возврата - проход закончен
+		if (ST7789_Anim_Process(a) && a->loop && (a->index == a->frames))
+		{
+			if (loops && (pass >= loops))
+			{
+				a->playing = 0;
+			}
+			pass++;
+		}
+	}
+}
+//==============================================================================
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
@@ -0,0 +1,87 @@
+#ifndef _ST7789_ANIM_H
+#define _ST7789_ANIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "st7789.h"
+#include "st77xx_cycles.h"
+
+/* 差分动画：每一帧只保存相对上一帧变化的矩形，
+   由主机端工具 Tools/st7789_animenc.c 从 PPM 帧序列生成 const uint16_t 数组。
+
+   数据格式（全部为 uint16_t）：
+     文件头：  'AN'(0x4E41)  版本 | 标志 << 8  宽  高  帧数  0
+     每一帧：  延时(ms)  矩形数
+     每个矩形：x  y  w  h | 类型 << 12  数据
+               类型 RAW  - w * h 个像素（发送字节序，与 bitmap.h 中的图像相同），
+                           一次 SetWindow 后直接从 FLASH 用 DMA 发送
+               类型 FILL - 1 个颜色（RGB565），用 ST7789_FillRect 填充
+   第 0 帧是完整的关键帧。带 ST7789_ANIM_FLAG_LOOP 标志时最后还有一帧
+   “回绕帧”（从最后一帧到第 0 帧的差分），循环播放时接着播放第 1 帧。
+
+   定时：每帧的显示时刻 = 上一帧时刻 + 上一帧延时（不累积误差），
+   迟到超过一帧时重新同步并计入 late。 */
+
+#define ST7789_ANIM_MAGIC			0x4E41
+#define ST7789_ANIM_VERSION			1
+#define ST7789_ANIM_FLAG_LOOP		0x01
+
+#define ST7789_ANIM_RECT_RAW		0
+#define ST7789_ANIM_RECT_FILL		1
+
+#define ST7789_ANIM_HEADER_WORDS	6
+/* ------------------------------------------------ */
+
+/* 播放统计（基准测试） */
+typedef struct {
+	uint32_t frames;
+	uint32_t rects;
+	uint32_t fills;				/* 其中 FILL 矩形 */
+	uint32_t pixels;			/* 写入的像素 */
+	uint32_t raw_pixels;		/* 每帧整幅 DrawImage 需要写入的像素 */
+	uint32_t cycles;			/* 最后一帧的绘制时间，CPU 周期 */
+	uint32_t cycles_max;
+	uint32_t cycles_sum;
+	uint32_t late;				/* 迟到超过一帧的次数 */
+} ST7789_AnimStats_t;
+
+typedef struct {
+	const uint16_t *data;		/* 文件头 */
+	const uint16_t *pFrame;		/* 下一帧 */
+	const uint16_t *pLoop;		/* 第 1 帧（回绕帧之后从这里继续） */
+	uint16_t x, y;
+	uint16_t width, height;
+	uint16_t frames;
+	uint16_t index;				/* 下一帧的编号 */
+	uint8_t flags;
+	uint8_t loop;				/* 循环播放 */
+	uint8_t playing;
+	uint32_t due;				/* 下一帧的显示时刻，HAL_GetTick() */
+	ST7789_AnimStats_t stats;
+} ST7789_Anim_t;
+
+/* 打开动画（不绘制），位置超出屏幕或文件头错误时返回 0
+   loop 只对带回绕帧的动画有效 */
+uint8_t ST7789_Anim_Open(ST7789_Anim_t *a, const uint16_t *data, uint16_t x, uint16_t y, uint8_t loop);
+
+/* 立即绘制下一帧，返回该帧的延时（ms）；播放结束后不再绘制 */
+uint16_t ST7789_Anim_DrawFrame(ST7789_Anim_t *a);
+
+/* 主循环中调用：到时刻时绘制下一帧，返回 1 */
+uint8_t ST7789_Anim_Process(ST7789_Anim_t *a);
+
+/* 阻塞播放到结束（循环动画播放 loops 遍） */
+void ST7789_Anim_Play(ST7789_Anim_t *a, uint16_t loops);
+
+/* 从第 0 帧重新开始 */
+void ST7789_Anim_Rewind(ST7789_Anim_t *a);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ST7789_ANIM_H */
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
@@ -0,0 +1,569 @@
+#include "st7789_band.h"
+
+// типы записанных примитивов
+#define BAND_CMD_FILLRECT		0
+#define BAND_CMD_LINE			1
+#define BAND_CMD_CIRCLE			2
+#define BAND_CMD_IMAGE			3
+#define BAND_CMD_TEXT			4
+
+typedef struct {
+	uint8_t type;
+	uint8_t flags;				// TransparentBg для текста
+	uint8_t mult;				// множитель шрифта
+	int16_t x, y, w, h;			// для линии w, h - вторая точка, для круга w - радиус
+	uint16_t color, color2;		// уже в порядке байт дисплея
+	const void *p;				// изображение или строка
+	FontDef_t *font;
+} ST7789_BandCmd_t;
+
+static ST7789_BandCmd_t ST7789_BandList[ST7789_BAND_MAX_CMDS];
+static uint16_t ST7789_BandCount, ST7789_BandDropped;
+static uint16_t ST7789_BandBg;
+
+// два буфера полосы: один рисуется, другой уходит по DMA
+static uint16_t ST7789_BandBuff[2][ST7789_BAND_PIXELS];
+
+// текущая полоса при растеризации
+static uint16_t *ST7789_BandPtr;
+static int16_t ST7789_BandY, ST7789_BandH, ST7789_BandW;
+
+#define BAND_SWAP(c) ((uint16_t)(((c) >> 8) | ((c) << 8)))
+
+//==============================================================================
+// Процедура добавления примитива в список
+//==============================================================================
+static ST7789_BandCmd_t *ST7789_Band_Add(uint8_t type)
+{
+
+	ST7789_BandCmd_t *cmd;
+
+	if (ST7789_BandCount >= ST7789_BAND_MAX_CMDS)
+	{
+		ST7789_BandDropped++;
+		return NULL;
+	}
+
+	cmd = &ST7789_BandList[ST7789_BandCount++];
+	cmd->type = type;
+
+	return cmd;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура начала кадра
+//==============================================================================
+void ST7789_Band_Begin(uint16_t bgcolor)
+{
+
+	ST7789_BandCount = 0;
+	ST7789_BandDropped = 0;
+	ST7789_BandBg = BAND_SWAP(bgcolor);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедуры записи примитивов
+//==============================================================================
+void ST7789_Band_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+
+	ST7789_BandCmd_t *cmd;
+
+	if ((w <= 0) || (h <= 0))
+	{
+		return;
+	}
+
+	cmd = ST7789_Band_Add(BAND_CMD_FILLRECT);
+	if (cmd)
+	{
+		cmd->x = x;
+		cmd->y = y;
+		cmd->w = w;
+		cmd->h = h;
+		cmd->color = BAND_SWAP(color);
+	}
+}
+
+void ST7789_Band_DrawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+
+	ST7789_Band_DrawHLine(x, y, w, color);
+	ST7789_Band_DrawHLine(x, y + h - 1, w, color);
+	ST7789_Band_DrawVLine(x, y + 1, h - 2, color);
+	ST7789_Band_DrawVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void ST7789_Band_DrawHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+
+	ST7789_Band_FillRect(x, y, w, 1, color);
+}
+
+void ST7789_Band_DrawVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+
+	ST7789_Band_FillRect(x, y, 1, h, color);
+}
+
+void ST7789_Band_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
+{
+
+	ST7789_BandCmd_t *cmd = ST7789_Band_Add(BAND_CMD_LINE);
+
+	if (cmd)
+	{
+		cmd->x = x1;
+		cmd->y = y1;
+		cmd->w = x2;
+		cmd->h = y2;
+		cmd->color = BAND_SWAP(color);
+	}
+}
+
+void ST7789_Band_DrawCircleFilled(int16_t x0, int16_t y0, int16_t radius, uint16_t fillcolor)
+{
+
+	ST7789_BandCmd_t *cmd;
+
+	if (radius < 0)
+	{
+		return;
+	}
+
+	cmd = ST7789_Band_Add(BAND_CMD_CIRCLE);
+	if (cmd)
+	{
+		cmd->x = x0;
+		cmd->y = y0;
+		cmd->w = radius;
+		cmd->color = BAND_SWAP(fillcolor);
+	}
+}
+
+void ST7789_Band_DrawImage(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *data)
+{
+
+	ST7789_BandCmd_t *cmd;
+
+	if ((w <= 0) || (h <= 0))
+	{
+		return;
+	}
+
+	cmd = ST7789_Band_Add(BAND_CMD_IMAGE);
+	if (cmd)
+	{
+		cmd->x = x;
+		cmd->y = y;
+		cmd->w = w;
+		cmd->h = h;
+		cmd->p = data;
+	}
+}
+
+void ST7789_Band_print(int16_t x, int16_t y, uint16_t TextColor, uint16_t BgColor, uint8_t TransparentBg, FontDef_t *Font, uint8_t multiplier, char *str)
+{
+
+	ST7789_BandCmd_t *cmd = ST7789_Band_Add(BAND_CMD_TEXT);
+
+	if (cmd)
+	{
+		cmd->x = x;
+		cmd->y = y;
+		cmd->color = BAND_SWAP(TextColor);
+		cmd->color2 = BAND_SWAP(BgColor);
+		cmd->flags = TransparentBg;
+		cmd->mult = (multiplier < 1) ? 1 : multiplier;
+		cmd->font = Font;
+		cmd->p = str;
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура заливки отрезка строки полосы ( row - строка экрана )
+//==============================================================================
+static void ST7789_Band_Span(int16_t x, int16_t row, int16_t w, uint16_t color)
+{
+
+	uint16_t *p;
+
+	if (x < 0)
+	{
+		w += x;
+		x = 0;
+	}
+	if (w > ST7789_BandW - x)
+	{
+		w = ST7789_BandW - x;
+	}
+	if (w <= 0)
+	{
+		return;
+	}
+
+	p = ST7789_BandPtr + (row - ST7789_BandY) * ST7789_BandW + x;
+
+	while (w--)
+	{
+		*p++ = color;
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура пересечения отрезка строк [y, y + h) с полосой
+//==============================================================================
+static uint8_t ST7789_Band_Rows(int16_t y, int16_t h, int16_t *pFirst, int16_t *pEnd)
+{
+
+	int32_t first = y, end = (int32_t)y + h;
+
+	if (first < ST7789_BandY)
+	{
+		first = ST7789_BandY;
+	}
+	if (end > ST7789_BandY + ST7789_BandH)
+	{
+		end = ST7789_BandY + ST7789_BandH;
+	}
+
+	*pFirst = (int16_t)first;
+	*pEnd = (int16_t)end;
+
+	return (first < end);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура целочисленного квадратного корня
+//==============================================================================
+static int16_t ST7789_Band_isqrt(uint32_t value)
+{
+
+	uint32_t root = 0, bit = 1UL << 30;
+
+	while (bit > value)
+	{
+		bit >>= 2;
+	}
+
+	while (bit)
+	{
+		if (value >= root + bit)
+		{
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return (int16_t)root;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура растеризации линии в текущую полосу ( Брезенхем, точки вне полосы пропускаются )
+//==============================================================================
+static void ST7789_Band_Line(const ST7789_BandCmd_t *cmd)
+{
+
+	int16_t x = cmd->x, y = cmd->y;
+	int16_t dx = abs(cmd->w - cmd->x), sx = (cmd->x < cmd->w) ? 1 : -1;
+	int16_t dy = -abs(cmd->h - cmd->y), sy = (cmd->y < cmd->h) ? 1 : -1;
+	int32_t err = dx + dy, e2;
+	int16_t ylo = (cmd->y < cmd->h) ? cmd->y : cmd->h;
+	int16_t yhi = (cmd->y < cmd->h) ? cmd->h : cmd->y;
+
+	if ((yhi < ST7789_BandY) || (ylo >= ST7789_BandY + ST7789_BandH))
+	{
+		return;
+	}
+
+	for (;;)
+	{
+		if ((y >= ST7789_BandY) && (y < ST7789_BandY + ST7789_BandH) && (x >= 0) && (x < ST7789_BandW))
+		{
+			ST7789_BandPtr[(y - ST7789_BandY) * ST7789_BandW + x] = cmd->color;
+		}
+		else if ((sy > 0) ? (y >= ST7789_BandY + ST7789_BandH) : (y < ST7789_BandY))
+		{
+			// дальше линия уходит от полосы
+			return;
+		}
+
+		if ((x == cmd->w) && (y == cmd->h))
+		{
+			return;
+		}
+
+		e2 = 2 * err;
+		if (e2 >= dy)
+		{
+			err += dy;
+			x += sx;
+		}
+		if (e2 <= dx)
+		{
+			err += dx;
+			y += sy;
+		}
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура растеризации текста в текущую полосу ( раскладка шрифта как в ST7789_DrawChar )
+//==============================================================================
+static void ST7789_Band_Text(const ST7789_BandCmd_t *cmd)
+{
+
+	const unsigned char *str = (const unsigned char *)cmd->p;
+	FontDef_t *Font = cmd->font;
+	int16_t m = cmd->mult, x = cmd->x;
+	int16_t row, first, end;
+	const uint16_t *pGlyph;
+	uint32_t b, j;
+	unsigned char ch;
+
+	if (!ST7789_Band_Rows(cmd->y, Font->FontHeight * m, &first, &end))
+	{
+		return;
+	}
+
+	while (*str)
+	{
+		ch = *str++;
+
+		// кириллица UTF-8: первый байт 0xD0 / 0xD1, символ во втором
+		if ((ch == 0xD0) && *str)
+		{
+			ch = *str++;
+			ch = (ch == 0x81) ? 0xA8 : (unsigned char)(ch + 0x30);
+		}
+		else if ((ch == 0xD1) && *str)
+		{
+			ch = *str++;
+			ch = (ch == 0x91) ? 0xB8 : (unsigned char)(ch + 0x70);
+		}
+
+		if (ch < 127)
+		{
+			pGlyph = &Font->data[(ch - 32) * Font->FontHeight];
+		}
+		else if (ch > 191)
+		{
+			pGlyph = &Font->data[((ch - 192) + 96) * Font->FontHeight];
+		}
+		else if (ch == 168)
+		{
+			pGlyph = &Font->data[160 * Font->FontHeight];
+		}
+		else if (ch == 184)
+		{
+			pGlyph = &Font->data[161 * Font->FontHeight];
+		}
+		else
+		{
+			pGlyph = NULL;
+		}
+
+		if (pGlyph && (x < ST7789_BandW) && (x + Font->FontWidth * m > 0))
+		{
+			for (row = first; row < end; row++)
+			{
+				b = pGlyph[(row - cmd->y) / m];
+
+				for (j = 0; j < Font->FontWidth; j++)
+				{
+					if ((b << j) & 0x8000)
+					{
+						ST7789_Band_Span(x + j * m, row, m, cmd->color);
+					}
+					else if (cmd->flags)
+					{
+						ST7789_Band_Span(x + j * m, row, m, cmd->color2);
+					}
+				}
+			}
+		}
+
+		x += Font->FontWidth * m;
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура растеризации всего списка в полосу [y0, y0 + h)
+//==============================================================================
+static void ST7789_Band_Render(uint16_t *pBuff, int16_t y0, int16_t h)
+{
+
+	const ST7789_BandCmd_t *cmd;
+	int16_t row, first, end, dy, dx, x, w;
+	uint32_t i, n;
+
+	ST7789_BandPtr = pBuff;
+	ST7789_BandY = y0;
+	ST7789_BandH = h;
+
+	// фон
+	n = (uint32_t)ST7789_BandW * h;
+	for (i = 0; i < n; i++)
+	{
+		pBuff[i] = ST7789_BandBg;
+	}
+
+	for (i = 0; i < ST7789_BandCount; i++)
+	{
+		cmd = &ST7789_BandList[i];
+
+		switch (cmd->type)
+		{
+		case BAND_CMD_FILLRECT:
+			if (ST7789_Band_Rows(cmd->y, cmd->h, &first, &end))
+			{
+				for (row = first; row < end; row++)
+				{
+					ST7789_Band_Span(cmd->x, row, cmd->w, cmd->color);
+				}
+			}
+			break;
+
+		case BAND_CMD_LINE:
+			ST7789_Band_Line(cmd);
+			break;
+
+		case BAND_CMD_CIRCLE:
+			if (ST7789_Band_Rows(cmd->y - cmd->w, 2 * cmd->w + 1, &first, &end))
+			{
+				for (row = first; row < end; row++)
+				{
+					dy = row - cmd->y;
+					dx = ST7789_Band_isqrt((uint32_t)cmd->w * cmd->w - (int32_t)dy * dy);
+					ST7789_Band_Span(cmd->x - dx, row, 2 * dx + 1, cmd->color);
+				}
+			}
+			break;
+
+		case BAND_CMD_IMAGE:
+			if (ST7789_Band_Rows(cmd->y, cmd->h, &first, &end))
+			{
+				// отсечение по горизонтали
+				x = cmd->x;
+				w = cmd->w;
+				dx = 0;
+				if (x < 0)
+				{
+					dx = -x;
+					w += x;
+					x = 0;
+				}
+				if (w > ST7789_BandW - x)
+				{
+					w = ST7789_BandW - x;
+				}
+				if (w > 0)
+				{
+					for (row = first; row < end; row++)
+					{
+						memcpy(pBuff + (row - y0) * ST7789_BandW + x,
+							   (const uint16_t *)cmd->p + (uint32_t)(row - cmd->y) * cmd->w + dx,
+							   sizeof(uint16_t) * w);
+					}
+				}
+			}
+			break;
+
+		case BAND_CMD_TEXT:
+			ST7789_Band_Text(cmd);
+			break;
+		}
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вывода кадра: полоса N+1 рисуется, пока DMA передает полосу N
+//==============================================================================
+void ST7789_Band_End(ST7789_BandStats_t *stats)
+{
+
+	ST7789_BandStats_t st;
+	uint32_t t0, t1, tFrame, tRender;
+	int16_t y, h, bandH;
+	uint8_t buf = 0;
+
+	// счетчик тактов ядра
+	ST77XX_CYCLES_INIT();
+
+	memset(&st, 0, sizeof(st));
+
+	ST7789_BandW = ST7789_Width;
+	bandH = ST7789_BAND_PIXELS / ST7789_BandW;
+	if (bandH > ST7789_Height)
+	{
+		bandH = ST7789_Height;
+	}
+
+	st.cmds = ST7789_BandCount;
+	st.dropped = ST7789_BandDropped;
+	st.band_h = bandH;
+
+	tFrame = ST77XX_CYCLES();
+
+	// полосы идут подряд на всю ширину - окно задается один раз на весь экран
+	ST7789_SetWindow(0, 0, ST7789_Width - 1, ST7789_Height - 1);
+
+	ST7789_Select();
+
+	for (y = 0; y < ST7789_Height; y += bandH)
+	{
+		h = (y + bandH > ST7789_Height) ? (ST7789_Height - y) : bandH;
+
+		t0 = ST77XX_CYCLES();
+		ST7789_Band_Render(ST7789_BandBuff[buf], y, h);
+		t1 = ST77XX_CYCLES();
+
+		tRender = t1 - t0;
+		st.render_sum += tRender;
+		if (tRender > st.render_max)
+		{
+			st.render_max = tRender;
+		}
+
+		// ждем предыдущую полосу - это и есть простой CPU из-за SPI
+		ST7789_WaitDMA();
+		st.stall_sum += ST77XX_CYCLES() - t1;
+
+		ST7789_SendDataDMA((uint8_t *)ST7789_BandBuff[buf], sizeof(uint16_t) * ST7789_BandW * h);
+
+		st.bands++;
+		buf ^= 1;
+	}
+
+	// последняя полоса передается без параллельной работы - по ней меряем SPI
+	t0 = ST77XX_CYCLES();
+	ST7789_WaitDMA();
+	t1 = ST77XX_CYCLES();
+
+	ST7789_Unselect();
+
+	st.frame = t1 - tFrame;
+	st.xfer_band = (uint32_t)(((uint64_t)(t1 - t0) * bandH) / h);
+
+	if (stats)
+	{
+		*stats = st;
+	}
+}
+//==============================================================================
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
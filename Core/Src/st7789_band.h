@@ -0,0 +1,62 @@
+#ifndef _ST7789_BAND_H
+#define _ST7789_BAND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "st7789.h"
+#include "st77xx_cycles.h"
+
+/* 条带渲染：一帧的图元先记录到列表中，ST7789_Band_End() 时按条带（整行宽度）
+   逐条在 RAM 中光栅化。两个条带缓冲交替使用：CPU 绘制第 N+1 条时，
+   DMA 正在发送第 N 条。整帧只设置一次窗口。
+
+   条带高度 = ST7789_BAND_PIXELS / 屏幕宽度，
+   240 宽时为 16 行，320 宽时为 12 行。
+
+   记录的图像和字符串指针在 ST7789_Band_End() 返回之前必须保持有效。 */
+
+#define ST7789_BAND_PIXELS			(240 * 16)		/* 每个条带缓冲的像素数 */
+#define ST7789_BAND_MAX_CMDS		64				/* 每帧图元数量上限 */
+
+/* 一帧的统计（单位：CPU 周期，除以 SystemCoreClock / 1000000 得到微秒）
+   render_max / render_sum - 每个条带的光栅化时间
+   stall_sum   - 绘制完成后等待上一条 DMA 的时间，>0 说明 SPI 是瓶颈
+   xfer_band   - 一个完整条带的传输时间（由最后一条单独测得，按像素数折算）
+   render_sum / bands 小于 xfer_band 时 SPI 是瓶颈，可以减小条带节省 RAM；反之 CPU 是瓶颈 */
+typedef struct {
+	uint16_t cmds;				/* 本帧记录的图元数 */
+	uint16_t dropped;			/* 列表已满而丢弃的图元数 */
+	uint16_t bands;				/* 条带数 */
+	uint16_t band_h;			/* 条带高度，行 */
+	uint32_t render_max;
+	uint32_t render_sum;
+	uint32_t stall_sum;
+	uint32_t xfer_band;
+	uint32_t frame;				/* 整帧时间 */
+} ST7789_BandStats_t;
+
+/* 开始一帧，清空图元列表，bgcolor 为每个条带的底色 */
+void ST7789_Band_Begin(uint16_t bgcolor);
+
+/* 记录图元（坐标为屏幕坐标） */
+void ST7789_Band_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void ST7789_Band_DrawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void ST7789_Band_DrawHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+void ST7789_Band_DrawVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+void ST7789_Band_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+void ST7789_Band_DrawCircleFilled(int16_t x0, int16_t y0, int16_t radius, uint16_t fillcolor);
+void ST7789_Band_DrawImage(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *data);
+void ST7789_Band_print(int16_t x, int16_t y, uint16_t TextColor, uint16_t BgColor, uint8_t TransparentBg, FontDef_t *Font, uint8_t multiplier, char *str);
+
+/* 渲染并发送整帧，stats 可以为 NULL */
+void ST7789_Band_End(ST7789_BandStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ST7789_BAND_H */
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
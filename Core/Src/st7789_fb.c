@@ -0,0 +1,475 @@
+#include "st7789_fb.h"
+
+// две строки для поочередной работы: одна развертывается, другая уходит по DMA
+static uint16_t ST7789_FB_LineBuff[2][ST7789_LINE_BUFF_SIZE];
+
+//==============================================================================
+// Процедура инициализации буфера
+//==============================================================================
+void ST7789_FB_Init(ST7789_FB_t *fb, uint8_t bpp, uint16_t width, uint16_t height, uint8_t *pixels)
+{
+
+	if (bpp != ST7789_FB_4BPP)
+	{
+		bpp = ST7789_FB_8BPP;
+	}
+
+	if (width > ST7789_LINE_BUFF_SIZE)
+	{
+		width = ST7789_LINE_BUFF_SIZE;
+	}
+
+	fb->bpp = bpp;
+	fb->x0 = 0;
+	fb->y0 = 0;
+	fb->width = width;
+	fb->height = height;
+	fb->stride = ST7789_FB_STRIDE(width, bpp);
+	fb->pixels = pixels;
+
+	memset(fb->palette, 0, sizeof(fb->palette));
+	memset(fb->pixels, 0, ST7789_FB_SIZE(width, height, bpp));
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура установки положения буфера на экране
+//==============================================================================
+void ST7789_FB_SetOrigin(ST7789_FB_t *fb, uint16_t x0, uint16_t y0)
+{
+
+	fb->x0 = x0;
+	fb->y0 = y0;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура загрузки палитры ( цвета храним сразу в порядке байт дисплея )
+//==============================================================================
+void ST7789_FB_SetPalette(ST7789_FB_t *fb, uint16_t first, uint16_t count, const uint16_t *colors)
+{
+
+	uint16_t size = (uint16_t)1 << fb->bpp;
+
+	if (first >= size)
+	{
+		return;
+	}
+
+	if (count > size - first)
+	{
+		count = size - first;
+	}
+
+	while (count--)
+	{
+		fb->palette[first++] = (uint16_t)((*colors >> 8) | (*colors << 8));
+		colors++;
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура изменения одного цвета палитры
+//==============================================================================
+void ST7789_FB_SetColor(ST7789_FB_t *fb, uint8_t index, uint16_t color)
+{
+
+	ST7789_FB_SetPalette(fb, index, 1, &color);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура заливки всего буфера одним индексом
+//==============================================================================
+void ST7789_FB_Fill(ST7789_FB_t *fb, uint8_t index)
+{
+
+	if (fb->bpp == ST7789_FB_4BPP)
+	{
+		index = (uint8_t)((index & 0x0F) * 0x11);
+	}
+
+	memset(fb->pixels, index, (uint32_t)fb->stride * fb->height);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура рисования пикселя в буфере
+//==============================================================================
+void ST7789_FB_DrawPixel(ST7789_FB_t *fb, int16_t x, int16_t y, uint8_t index)
+{
+
+	uint8_t *p;
+
+	x -= fb->x0;
+	y -= fb->y0;
+
+	if ((x < 0) || (y < 0) || (x >= fb->width) || (y >= fb->height))
+	{
+		return;
+	}
+
+	if (fb->bpp == ST7789_FB_8BPP)
+	{
+		fb->pixels[(uint32_t)y * fb->stride + x] = index;
+		return;
+	}
+
+	p = &fb->pixels[(uint32_t)y * fb->stride + (x >> 1)];
+
+	if (x & 1)
+	{
+		*p = (uint8_t)((*p & 0xF0) | (index & 0x0F));
+	}
+	else
+	{
+		*p = (uint8_t)((*p & 0x0F) | (index << 4));
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура чтения индекса пикселя из буфера ( вне буфера - 0 )
+//==============================================================================
+uint8_t ST7789_FB_GetPixel(ST7789_FB_t *fb, int16_t x, int16_t y)
+{
+
+	uint8_t b;
+
+	x -= fb->x0;
+	y -= fb->y0;
+
+	if ((x < 0) || (y < 0) || (x >= fb->width) || (y >= fb->height))
+	{
+		return 0;
+	}
+
+	if (fb->bpp == ST7789_FB_8BPP)
+	{
+		return fb->pixels[(uint32_t)y * fb->stride + x];
+	}
+
+	b = fb->pixels[(uint32_t)y * fb->stride + (x >> 1)];
+
+	return (x & 1) ? (b & 0x0F) : (b >> 4);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура заливки прямоугольника в буфере
+// для 4 бит крайние полубайты пишутся отдельно, середина - memset
+//==============================================================================
+void ST7789_FB_FillRect(ST7789_FB_t *fb, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t index)
+{
+
+	uint8_t *pRow;
+	int16_t x1, y1;
+	uint8_t pair;
+
+	// в координаты буфера и отсечение
+	x -= fb->x0;
+	y -= fb->y0;
+	x1 = x + w;
+	y1 = y + h;
+
+	if (x < 0)
+	{
+		x = 0;
+	}
+	if (y < 0)
+	{
+		y = 0;
+	}
+	if (x1 > fb->width)
+	{
+		x1 = fb->width;
+	}
+	if (y1 > fb->height)
+	{
+		y1 = fb->height;
+	}
+
+	if ((x >= x1) || (y >= y1))
+	{
+		return;
+	}
+
+	pRow = &fb->pixels[(uint32_t)y * fb->stride];
+
+	if (fb->bpp == ST7789_FB_8BPP)
+	{
+		for (; y < y1; y++, pRow += fb->stride)
+		{
+			memset(pRow + x, index, x1 - x);
+		}
+		return;
+	}
+
+	index &= 0x0F;
+	pair = (uint8_t)(index * 0x11);
+
+	for (; y < y1; y++, pRow += fb->stride)
+	{
+		int16_t xs = x, xe = x1;
+
+		if (xs & 1)
+		{
+			pRow[xs >> 1] = (uint8_t)((pRow[xs >> 1] & 0xF0) | index);
+			xs++;
+		}
+		if ((xe & 1) && (xe > xs))
+		{
+			xe--;
+			pRow[xe >> 1] = (uint8_t)((pRow[xe >> 1] & 0x0F) | (index << 4));
+		}
+		if (xe > xs)
+		{
+			memset(pRow + (xs >> 1), pair, (xe - xs) >> 1);
+		}
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедуры рисования горизонтальной и вертикальной линии в буфере
+//==============================================================================
+void ST7789_FB_DrawHLine(ST7789_FB_t *fb, int16_t x, int16_t y, int16_t w, uint8_t index)
+{
+
+	ST7789_FB_FillRect(fb, x, y, w, 1, index);
+}
+
+void ST7789_FB_DrawVLine(ST7789_FB_t *fb, int16_t x, int16_t y, int16_t h, uint8_t index)
+{
+
+	ST7789_FB_FillRect(fb, x, y, 1, h, index);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура рисования символа в буфере ( раскладка шрифта как в ST7789_DrawChar )
+//==============================================================================
+void ST7789_FB_DrawChar(ST7789_FB_t *fb, int16_t x, int16_t y, uint8_t TextIndex, uint8_t BgIndex, uint8_t TransparentBg, FontDef_t *Font, uint8_t multiplier, unsigned char ch)
+{
+
+	uint32_t i, j, b = 0;
+	const uint16_t *pGlyph;
+
+	if (multiplier < 1)
+	{
+		multiplier = 1;
+	}
+
+	if (ch < 127)
+	{
+		pGlyph = &Font->data[(ch - 32) * Font->FontHeight];
+	}
+	else if (ch > 191)
+	{
+		pGlyph = &Font->data[((ch - 192) + 96) * Font->FontHeight];
+	}
+	else if (ch == 168)
+	{ // Ё
+		pGlyph = &Font->data[160 * Font->FontHeight];
+	}
+	else if (ch == 184)
+	{ // ё
+		pGlyph = &Font->data[161 * Font->FontHeight];
+	}
+	else
+	{
+		return;
+	}
+
+	for (i = 0; i < Font->FontHeight; i++)
+	{
+		b = pGlyph[i];
+
+		for (j = 0; j < Font->FontWidth; j++)
+		{
+			if ((b << j) & 0x8000)
+			{
+				ST7789_FB_FillRect(fb, x + j * multiplier, y + i * multiplier, multiplier, multiplier, TextIndex);
+			}
+			else if (TransparentBg)
+			{
+				ST7789_FB_FillRect(fb, x + j * multiplier, y + i * multiplier, multiplier, multiplier, BgIndex);
+			}
+		}
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вывода строки в буфер ( UTF-8 кириллица как в ST7789_print )
+//==============================================================================
+void ST7789_FB_print(ST7789_FB_t *fb, int16_t x, int16_t y, uint8_t TextIndex, uint8_t BgIndex, uint8_t TransparentBg, FontDef_t *Font, uint8_t multiplier, char *str)
+{
+
+	unsigned char ch;
+
+	if (multiplier < 1)
+	{
+		multiplier = 1;
+	}
+
+	while (*str)
+	{
+		ch = (unsigned char)*str++;
+
+		// кириллица: первый байт 0xD0 / 0xD1, символ во втором
+		if ((ch == 0xD0) && *str)
+		{
+			ch = (unsigned char)*str++;
+			ch = (ch == 0x81) ? 0xA8 : (unsigned char)(ch + 0x30);
+		}
+		else if ((ch == 0xD1) && *str)
+		{
+			ch = (unsigned char)*str++;
+			ch = (ch == 0x91) ? 0xB8 : (unsigned char)(ch + 0x70);
+		}
+
+		ST7789_FB_DrawChar(fb, x, y, TextIndex, BgIndex, TransparentBg, Font, multiplier, ch);
+
+		x += Font->FontWidth * multiplier;
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура развертки части строки буфера через палитру в строку RGB565
+//==============================================================================
+static void ST7789_FB_ExpandRow(ST7789_FB_t *fb, const uint8_t *pRow, int16_t x, int16_t w, uint16_t *pDst)
+{
+
+	const uint16_t *pal = fb->palette;
+	const uint8_t *pSrc;
+	uint8_t b;
+
+	if (fb->bpp == ST7789_FB_8BPP)
+	{
+		pSrc = pRow + x;
+
+		// по 4 пикселя за проход
+		while (w >= 4)
+		{
+			pDst[0] = pal[pSrc[0]];
+			pDst[1] = pal[pSrc[1]];
+			pDst[2] = pal[pSrc[2]];
+			pDst[3] = pal[pSrc[3]];
+			pDst += 4;
+			pSrc += 4;
+			w -= 4;
+		}
+		while (w--)
+		{
+			*pDst++ = pal[*pSrc++];
+		}
+		return;
+	}
+
+	pSrc = pRow + (x >> 1);
+
+	// нечетное начало - правый полубайт первого байта
+	if ((x & 1) && w)
+	{
+		*pDst++ = pal[*pSrc++ & 0x0F];
+		w--;
+	}
+
+	while (w >= 2)
+	{
+		b = *pSrc++;
+		pDst[0] = pal[b >> 4];
+		pDst[1] = pal[b & 0x0F];
+		pDst += 2;
+		w -= 2;
+	}
+
+	if (w)
+	{
+		*pDst = pal[*pSrc >> 4];
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вывода области буфера на дисплей
+// окно задается один раз, строка N уходит по DMA пока развертывается N+1
+//==============================================================================
+void ST7789_FB_FlushRect(ST7789_FB_t *fb, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+
+	int16_t x1, y1, row;
+	uint8_t buf = 0;
+
+	// в координаты буфера и отсечение
+	x -= fb->x0;
+	y -= fb->y0;
+	x1 = x + w;
+	y1 = y + h;
+
+	if (x < 0)
+	{
+		x = 0;
+	}
+	if (y < 0)
+	{
+		y = 0;
+	}
+	if (x1 > fb->width)
+	{
+		x1 = fb->width;
+	}
+	if (y1 > fb->height)
+	{
+		y1 = fb->height;
+	}
+	if (x1 > (int16_t)(ST7789_Width - fb->x0))
+	{
+		x1 = ST7789_Width - fb->x0;
+	}
+	if (y1 > (int16_t)(ST7789_Height - fb->y0))
+	{
+		y1 = ST7789_Height - fb->y0;
+	}
+
+	if ((x >= x1) || (y >= y1))
+	{
+		return;
+	}
+
+	w = x1 - x;
+
+	ST7789_SetWindow(fb->x0 + x, fb->y0 + y, fb->x0 + x1 - 1, fb->y0 + y1 - 1);
+
+	ST7789_Select();
+
+	for (row = y; row < y1; row++)
+	{
+		// буфер buf был отправлен две строки назад - SendDataDMA уже дождался его
+		ST7789_FB_ExpandRow(fb, &fb->pixels[(uint32_t)row * fb->stride], x, w, ST7789_FB_LineBuff[buf]);
+
+		ST7789_SendDataDMA((uint8_t *)ST7789_FB_LineBuff[buf], sizeof(uint16_t) * w);
+
+		buf ^= 1;
+	}
+
+	ST7789_WaitDMA();
+
+	ST7789_Unselect();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вывода всего буфера на дисплей
+//==============================================================================
+void ST7789_FB_Flush(ST7789_FB_t *fb)
+{
+
+	ST7789_FB_FlushRect(fb, fb->x0, fb->y0, fb->width, fb->height);
+}
+//==============================================================================
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
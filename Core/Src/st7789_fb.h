@@ -0,0 +1,68 @@
+#ifndef _ST7789_FB_H
+#define _ST7789_FB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "st7789.h"
+
+/* 索引色帧缓冲：每个像素 4 位或 8 位，保存的是调色板索引，
+   输出时经调色板查表展开为 RGB565 写入 DMA 行缓冲。
+   修改调色板后重新 Flush 即可改变整个界面的颜色，无需重绘。
+
+   4 位 240x320 整屏只需 38400 字节；8 位整屏需 76800 字节，
+   超出 F103 的 RAM，此时用较小的缓冲按条带绘制（SetOrigin 后重绘再 Flush）。
+
+   4 位模式：每字节两个像素，高半字节为左边的像素。
+   绘图坐标均为屏幕坐标，超出缓冲区的部分被裁剪。 */
+
+#define ST7789_FB_4BPP			4
+#define ST7789_FB_8BPP			8
+
+/* 缓冲区字节数 */
+#define ST7789_FB_STRIDE(w, bpp)		((((uint32_t)(w) * (bpp)) + 7) / 8)
+#define ST7789_FB_SIZE(w, h, bpp)		(ST7789_FB_STRIDE(w, bpp) * (uint32_t)(h))
+/* ------------------------------------------------ */
+
+typedef struct {
+	uint8_t bpp;				/* 4 或 8 */
+	uint16_t x0, y0;			/* 缓冲区左上角在屏幕上的位置 */
+	uint16_t width, height;		/* 像素，width 不超过 ST7789_LINE_BUFF_SIZE */
+	uint16_t stride;			/* 每行字节数 */
+	uint8_t *pixels;			/* 用户提供的缓冲区，ST7789_FB_SIZE 字节 */
+	uint16_t palette[256];		/* 已按发送顺序（高字节在前）保存 */
+} ST7789_FB_t;
+
+/* 初始化，调色板清零，缓冲区填充索引 0 */
+void ST7789_FB_Init(ST7789_FB_t *fb, uint8_t bpp, uint16_t width, uint16_t height, uint8_t *pixels);
+
+/* 设置缓冲区在屏幕上的位置（条带模式下逐条移动） */
+void ST7789_FB_SetOrigin(ST7789_FB_t *fb, uint16_t x0, uint16_t y0);
+
+/* 设置调色板，colors 为普通 RGB565 */
+void ST7789_FB_SetPalette(ST7789_FB_t *fb, uint16_t first, uint16_t count, const uint16_t *colors);
+void ST7789_FB_SetColor(ST7789_FB_t *fb, uint8_t index, uint16_t color);
+
+/* 在缓冲区中绘图，参数为调色板索引 */
+void ST7789_FB_Fill(ST7789_FB_t *fb, uint8_t index);
+void ST7789_FB_DrawPixel(ST7789_FB_t *fb, int16_t x, int16_t y, uint8_t index);
+uint8_t ST7789_FB_GetPixel(ST7789_FB_t *fb, int16_t x, int16_t y);
+void ST7789_FB_FillRect(ST7789_FB_t *fb, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t index);
+void ST7789_FB_DrawHLine(ST7789_FB_t *fb, int16_t x, int16_t y, int16_t w, uint8_t index);
+void ST7789_FB_DrawVLine(ST7789_FB_t *fb, int16_t x, int16_t y, int16_t h, uint8_t index);
+void ST7789_FB_DrawChar(ST7789_FB_t *fb, int16_t x, int16_t y, uint8_t TextIndex, uint8_t BgIndex, uint8_t TransparentBg, FontDef_t *Font, uint8_t multiplier, unsigned char ch);
+void ST7789_FB_print(ST7789_FB_t *fb, int16_t x, int16_t y, uint8_t TextIndex, uint8_t BgIndex, uint8_t TransparentBg, FontDef_t *Font, uint8_t multiplier, char *str);
+
+/* 将缓冲区（或其中一块区域）经调色板展开后发送到显示屏，
+   一行展开的同时上一行由 DMA 发送 */
+void ST7789_FB_Flush(ST7789_FB_t *fb);
+void ST7789_FB_FlushRect(ST7789_FB_t *fb, int16_t x, int16_t y, int16_t w, int16_t h);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ST7789_FB_H */
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
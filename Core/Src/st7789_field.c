@@ -0,0 +1,156 @@
+#include "st7789_field.h"
+
+//==============================================================================
+// Процедура инициализации поля
+//==============================================================================
+void ST7789_Field_Init(ST7789_Field_t *f, uint16_t x, uint16_t y, uint8_t cells, uint8_t align, FontDef_t *Font, uint8_t multiplier, uint16_t TextColor, uint16_t BgColor)
+{
+
+	if (cells > ST7789_FIELD_MAX_CELLS)
+	{
+		cells = ST7789_FIELD_MAX_CELLS;
+	}
+
+	f->x = x;
+	f->y = y;
+	f->cells = cells;
+	f->align = align;
+	f->Font = Font;
+	f->multiplier = (multiplier < 1) ? 1 : multiplier;
+	f->TextColor = TextColor;
+	f->BgColor = BgColor;
+
+	ST7789_Field_Invalidate(f);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура смены цвета поля
+//==============================================================================
+void ST7789_Field_SetColor(ST7789_Field_t *f, uint16_t TextColor, uint16_t BgColor)
+{
+
+	if ((f->TextColor != TextColor) || (f->BgColor != BgColor))
+	{
+		f->TextColor = TextColor;
+		f->BgColor = BgColor;
+		ST7789_Field_Invalidate(f);
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура сброса запомненного содержимого
+//==============================================================================
+void ST7789_Field_Invalidate(ST7789_Field_t *f)
+{
+
+	memset(f->shown, 0, sizeof(f->shown));
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вывода строки в поле: перерисовываются только изменившиеся ячейки
+//==============================================================================
+uint8_t ST7789_Field_Set(ST7789_Field_t *f, const char *str)
+{
+
+	unsigned char text[ST7789_FIELD_MAX_CELLS];
+	uint8_t len = 0, i, pad, redrawn = 0, overflow = 0;
+	uint16_t step = f->Font->FontWidth * f->multiplier;
+	unsigned char ch;
+
+	// разбор строки в коды шрифта
+	while (*str)
+	{
+		ch = ST7789_NextChar(&str);
+
+		if (len == f->cells)
+		{
+			// не помещается - показываем прочерки
+			memset(text, '-', f->cells);
+			overflow = 1;
+			break;
+		}
+
+#ifdef FONT_16x28
+		// шрифт только с цифрами
+		if ((f->Font == &Font_16x28) && ((ch < ' ') || (ch > '9')))
+		{
+			ch = ' ';
+		}
+#endif
+		text[len++] = ch;
+	}
+
+	if (overflow)
+	{
+		len = f->cells;
+	}
+
+	// выравнивание
+	pad = f->cells - len;
+	if (f->align == ST7789_FIELD_ALIGN_RIGHT)
+	{
+		memmove(text + pad, text, len);
+		memset(text, ' ', pad);
+	}
+	else
+	{
+		memset(text + len, ' ', pad);
+	}
+
+	for (i = 0; i < f->cells; i++)
+	{
+		if (text[i] != f->shown[i])
+		{
+			ST7789_DrawCharCached(f->x + i * step, f->y, f->TextColor, f->BgColor, f->Font, f->multiplier, text[i]);
+			f->shown[i] = text[i];
+			redrawn++;
+		}
+	}
+
+	return redrawn;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вывода числа с фиксированной точкой
+//==============================================================================
+uint8_t ST7789_Field_SetInt(ST7789_Field_t *f, int32_t value, uint8_t decimals)
+{
+
+	char buff[16];
+	char *p = &buff[sizeof(buff) - 1];
+	uint32_t v = (value < 0) ? (uint32_t)(-(value + 1)) + 1 : (uint32_t)value;
+	uint8_t digits = 0;
+
+	if (decimals > 9)
+	{
+		decimals = 9;
+	}
+
+	*p = 0;
+
+	// цифры справа налево, точка после decimals цифр, минимум одна цифра до точки
+	do
+	{
+		if (decimals && (digits == decimals))
+		{
+			*--p = '.';
+		}
+		*--p = (char)('0' + v % 10);
+		v /= 10;
+		digits++;
+	} while (v || (digits <= decimals));
+
+	if (value < 0)
+	{
+		*--p = '-';
+	}
+
+	return ST7789_Field_Set(f, p);
+}
+//==============================================================================
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
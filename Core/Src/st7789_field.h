@@ -0,0 +1,53 @@
+#ifndef _ST7789_FIELD_H
+#define _ST7789_FIELD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "st7789_glyph.h"
+
+/* 数字显示字段：记住上一次显示的每个字符单元，更新时只重绘变化的单元
+   （通过字形缓存 ST7789_DrawCharCached）。
+   字段宽度固定为 cells 个字符，按 align 左对齐或右对齐，空位用空格填充；
+   文字超过宽度时整个字段显示为 '-'，避免截断后显示错误的数值。
+   Font_16x28 只有 ' ' ... '9'，其余字符显示为空格。 */
+
+#define ST7789_FIELD_MAX_CELLS		12
+
+#define ST7789_FIELD_ALIGN_LEFT		0
+#define ST7789_FIELD_ALIGN_RIGHT	1
+/* ------------------------------------------------ */
+
+typedef struct {
+	uint16_t x, y;
+	FontDef_t *Font;
+	uint8_t multiplier;
+	uint8_t cells;
+	uint8_t align;
+	uint16_t TextColor, BgColor;
+	unsigned char shown[ST7789_FIELD_MAX_CELLS];	/* 屏幕上当前的字符，0 表示未绘制 */
+} ST7789_Field_t;
+
+/* 初始化字段（不绘制） */
+void ST7789_Field_Init(ST7789_Field_t *f, uint16_t x, uint16_t y, uint8_t cells, uint8_t align, FontDef_t *Font, uint8_t multiplier, uint16_t TextColor, uint16_t BgColor);
+
+/* 更换颜色，下一次更新时全部重绘 */
+void ST7789_Field_SetColor(ST7789_Field_t *f, uint16_t TextColor, uint16_t BgColor);
+
+/* 屏幕被其他内容覆盖后调用，下一次更新时全部重绘 */
+void ST7789_Field_Invalidate(ST7789_Field_t *f);
+
+/* 显示字符串，返回重绘的单元数 */
+uint8_t ST7789_Field_Set(ST7789_Field_t *f, const char *str);
+
+/* 显示定点数：value = 12345, decimals = 1 显示 "1234.5"（不使用 printf） */
+uint8_t ST7789_Field_SetInt(ST7789_Field_t *f, int32_t value, uint8_t decimals);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ST7789_FIELD_H */
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
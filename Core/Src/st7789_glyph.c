@@ -0,0 +1,324 @@
+#include "st7789_glyph.h"
+
+#define GLYPH_FREE		0xFF
+
+typedef struct {
+	FontDef_t *font;			// NULL - запись свободна
+	uint16_t fg, bg;
+	uint8_t ch;
+	uint8_t mult;
+	uint8_t slot;				// первый слот
+	uint8_t nslots;
+	uint32_t stamp;				// время последнего использования
+} ST7789_GlyphEntry_t;
+
+// область хранения ячеек ( выровнена под uint16_t )
+static uint16_t ST7789_GlyphArena[ST7789_GLYPH_SLOTS][ST7789_GLYPH_SLOT_BYTES / 2];
+// какой записи принадлежит слот
+static uint8_t ST7789_GlyphOwner[ST7789_GLYPH_SLOTS];
+static ST7789_GlyphEntry_t ST7789_GlyphTable[ST7789_GLYPH_SLOTS];
+
+static uint32_t ST7789_GlyphClock;
+static ST7789_GlyphStats_t ST7789_GlyphStats;
+static uint8_t ST7789_GlyphReady;
+
+//==============================================================================
+// Процедура очистки кэша
+//==============================================================================
+void ST7789_GlyphCache_Init(void)
+{
+
+	memset(ST7789_GlyphTable, 0, sizeof(ST7789_GlyphTable));
+	memset(ST7789_GlyphOwner, GLYPH_FREE, sizeof(ST7789_GlyphOwner));
+	memset(&ST7789_GlyphStats, 0, sizeof(ST7789_GlyphStats));
+	ST7789_GlyphClock = 0;
+	ST7789_GlyphReady = 1;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура чтения статистики
+//==============================================================================
+void ST7789_GlyphCache_GetStats(ST7789_GlyphStats_t *stats)
+{
+
+	*stats = ST7789_GlyphStats;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура получения строк символа из шрифта ( раскладка как в ST7789_DrawChar )
+//==============================================================================
+const uint16_t *ST7789_GlyphRows(FontDef_t *Font, unsigned char ch)
+{
+
+	if ((ch >= 32) && (ch < 127))
+	{
+		return &Font->data[(ch - 32) * Font->FontHeight];
+	}
+	if (ch > 191)
+	{
+		return &Font->data[((ch - 192) + 96) * Font->FontHeight];
+	}
+	if (ch == 168)
+	{ // Ё
+		return &Font->data[160 * Font->FontHeight];
+	}
+	if (ch == 184)
+	{ // ё
+		return &Font->data[161 * Font->FontHeight];
+	}
+
+	return NULL;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура разбора следующего символа строки ( кириллица UTF-8 как в ST7789_print )
+//==============================================================================
+unsigned char ST7789_NextChar(const char **pStr)
+{
+
+	const unsigned char *str = (const unsigned char *)*pStr;
+	unsigned char ch = *str++;
+
+	if ((ch == 0xD0) && *str)
+	{
+		ch = *str++;
+		ch = (ch == 0x81) ? 0xA8 : (unsigned char)(ch + 0x30); // Ё, А...Я а...п
+	}
+	else if ((ch == 0xD1) && *str)
+	{
+		ch = *str++;
+		ch = (ch == 0x91) ? 0xB8 : (unsigned char)(ch + 0x70); // ё, р...я
+	}
+
+	*pStr = (const char *)str;
+
+	return ch;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура освобождения записи и ее слотов
+//==============================================================================
+static void ST7789_Glyph_Evict(uint8_t e)
+{
+
+	ST7789_GlyphEntry_t *pEntry = &ST7789_GlyphTable[e];
+
+	memset(&ST7789_GlyphOwner[pEntry->slot], GLYPH_FREE, pEntry->nslots);
+	pEntry->font = NULL;
+
+	ST7789_GlyphStats.evictions++;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура выделения n подряд идущих слотов
+// выбирается окно, у которого самое свежее использование наиболее старое ( LRU ),
+// свободный слот считается самым старым
+//==============================================================================
+static uint8_t ST7789_Glyph_Alloc(uint8_t n)
+{
+
+	uint8_t best = 0, s, k, owner;
+	uint32_t bestAge = 0xFFFFFFFF, age, stamp;
+
+	for (s = 0; s + n <= ST7789_GLYPH_SLOTS; s++)
+	{
+		age = 0;
+		for (k = 0; k < n; k++)
+		{
+			owner = ST7789_GlyphOwner[s + k];
+			stamp = (owner == GLYPH_FREE) ? 0 : ST7789_GlyphTable[owner].stamp;
+			if (stamp > age)
+			{
+				age = stamp;
+			}
+		}
+
+		if (age < bestAge)
+		{
+			bestAge = age;
+			best = s;
+			if (age == 0)
+			{
+				break;
+			}
+		}
+	}
+
+	// выселяем все записи, задевающие окно
+	for (k = 0; k < n; k++)
+	{
+		owner = ST7789_GlyphOwner[best + k];
+		if (owner != GLYPH_FREE)
+		{
+			ST7789_Glyph_Evict(owner);
+		}
+	}
+
+	return best;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура растеризации символа в ячейку ( RGB565, порядок байт дисплея )
+//==============================================================================
+static void ST7789_Glyph_Render(uint16_t *pCell, const uint16_t *pRows, uint8_t fw, uint8_t fh, uint8_t m, uint16_t fg, uint16_t bg)
+{
+
+	uint32_t i, j, b;
+	uint16_t *pLine;
+	uint8_t xx, yy;
+
+	for (i = 0; i < fh; i++)
+	{
+		pLine = pCell;
+		b = pRows[i];
+
+		for (j = 0; j < fw; j++)
+		{
+			uint16_t c = ((b << j) & 0x8000) ? fg : bg;
+
+			for (xx = 0; xx < m; xx++)
+			{
+				*pCell++ = c;
+			}
+		}
+
+		// повтор строки по вертикали
+		for (yy = 1; yy < m; yy++)
+		{
+			memcpy(pCell, pLine, sizeof(uint16_t) * fw * m);
+			pCell += fw * m;
+		}
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вывода символа через кэш
+//==============================================================================
+void ST7789_DrawCharCached(uint16_t x, uint16_t y, uint16_t TextColor, uint16_t BgColor, FontDef_t *Font, uint8_t multiplier, unsigned char ch)
+{
+
+	const uint16_t *pRows;
+	ST7789_GlyphEntry_t *pEntry = NULL;
+	uint32_t bytes;
+	uint16_t w, h;
+	uint8_t e, n, s;
+
+	if (!ST7789_GlyphReady)
+	{
+		ST7789_GlyphCache_Init();
+	}
+
+	if (multiplier < 1)
+	{
+		multiplier = 1;
+	}
+
+	w = Font->FontWidth * multiplier;
+	h = Font->FontHeight * multiplier;
+	bytes = (uint32_t)w * h * sizeof(uint16_t);
+
+	pRows = ST7789_GlyphRows(Font, ch);
+	if (pRows == NULL)
+	{
+		return;
+	}
+
+	// не помещается в кэш или на экран - обычный путь
+	if ((bytes > sizeof(ST7789_GlyphArena)) || (x + w > ST7789_Width) || (y + h > ST7789_Height))
+	{
+		ST7789_GlyphStats.bypass++;
+		ST7789_DrawChar(x, y, TextColor, BgColor, 1, Font, multiplier, ch);
+		return;
+	}
+
+	// поиск
+	for (e = 0; e < ST7789_GLYPH_SLOTS; e++)
+	{
+		ST7789_GlyphEntry_t *p = &ST7789_GlyphTable[e];
+
+		if ((p->font == Font) && (p->ch == ch) && (p->fg == TextColor) && (p->bg == BgColor) && (p->mult == multiplier))
+		{
+			pEntry = p;
+			break;
+		}
+	}
+
+	if (pEntry)
+	{
+		ST7789_GlyphStats.hits++;
+	}
+	else
+	{
+		ST7789_GlyphStats.misses++;
+
+		n = (uint8_t)((bytes + ST7789_GLYPH_SLOT_BYTES - 1) / ST7789_GLYPH_SLOT_BYTES);
+
+		// сначала слоты: после выделения занято меньше слотов, чем всего записей,
+		// значит свободная запись найдется
+		s = ST7789_Glyph_Alloc(n);
+
+		for (e = 0; e < ST7789_GLYPH_SLOTS; e++)
+		{
+			if (ST7789_GlyphTable[e].font == NULL)
+			{
+				break;
+			}
+		}
+
+		pEntry = &ST7789_GlyphTable[e];
+		pEntry->slot = s;
+		pEntry->nslots = n;
+		pEntry->font = Font;
+		pEntry->ch = ch;
+		pEntry->fg = TextColor;
+		pEntry->bg = BgColor;
+		pEntry->mult = multiplier;
+		memset(&ST7789_GlyphOwner[pEntry->slot], e, n);
+
+		ST7789_Glyph_Render(ST7789_GlyphArena[pEntry->slot], pRows, Font->FontWidth, Font->FontHeight, multiplier,
+							(uint16_t)((TextColor >> 8) | (TextColor << 8)), (uint16_t)((BgColor >> 8) | (BgColor << 8)));
+	}
+
+	pEntry->stamp = ++ST7789_GlyphClock;
+
+	// одно окно, одна передача из RAM
+	ST7789_SetWindow(x, y, x + w - 1, y + h - 1);
+
+	ST7789_Select();
+
+	ST7789_SendDataMASS((uint8_t *)ST7789_GlyphArena[pEntry->slot], bytes);
+
+	ST7789_Unselect();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вывода строки через кэш
+//==============================================================================
+void ST7789_printCached(uint16_t x, uint16_t y, uint16_t TextColor, uint16_t BgColor, FontDef_t *Font, uint8_t multiplier, char *str)
+{
+
+	const char *p = str;
+
+	if (multiplier < 1)
+	{
+		multiplier = 1;
+	}
+
+	while (*p)
+	{
+		ST7789_DrawCharCached(x, y, TextColor, BgColor, Font, multiplier, ST7789_NextChar(&p));
+
+		x = x + (Font->FontWidth * multiplier);
+	}
+}
+//==============================================================================
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
@@ -0,0 +1,53 @@
+#ifndef _ST7789_GLYPH_H
+#define _ST7789_GLYPH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "st7789.h"
+
+/* 字形缓存：按 (字体, 字符, 前景色, 背景色, 倍数) 保存已展开的 RGB565 字符单元
+   （发送顺序，高字节在前）。命中时只需设置一次窗口并从 RAM 直接发送。
+
+   缓存区分为 ST7789_GLYPH_SLOTS 个 ST7789_GLYPH_SLOT_BYTES 字节的槽，
+   一个字符单元占用连续的若干槽，空间不足时淘汰最久未使用的连续槽（LRU）。
+   Font_16x28 的数字（896 字节）占 2 个槽，倍数 2 时占 7 个槽。
+   超过整个缓存区或超出屏幕的字符直接用 ST7789_DrawChar 绘制（bypass）。
+
+   缓存的字符总是带背景绘制（不支持透明背景）。 */
+
+#define ST7789_GLYPH_SLOT_BYTES		512
+#define ST7789_GLYPH_SLOTS			32			/* 共 16 KB */
+/* ------------------------------------------------ */
+
+typedef struct {
+	uint32_t hits;
+	uint32_t misses;
+	uint32_t evictions;
+	uint32_t bypass;
+} ST7789_GlyphStats_t;
+
+/* 清空缓存和统计 */
+void ST7789_GlyphCache_Init(void);
+
+/* 读取统计 */
+void ST7789_GlyphCache_GetStats(ST7789_GlyphStats_t *stats);
+
+/* 通过缓存绘制字符 / 字符串（UTF-8 西里尔字母处理与 ST7789_print 相同） */
+void ST7789_DrawCharCached(uint16_t x, uint16_t y, uint16_t TextColor, uint16_t BgColor, FontDef_t *Font, uint8_t multiplier, unsigned char ch);
+void ST7789_printCached(uint16_t x, uint16_t y, uint16_t TextColor, uint16_t BgColor, FontDef_t *Font, uint8_t multiplier, char *str);
+
+/* 字体中字符的点阵行（每行一个 uint16_t，最高位为最左边的像素），字体中没有时返回 NULL */
+const uint16_t *ST7789_GlyphRows(FontDef_t *Font, unsigned char ch);
+
+/* 从 UTF-8 字符串取出一个字符（转换为字体编码），并移动指针 */
+unsigned char ST7789_NextChar(const char **pStr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ST7789_GLYPH_H */
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
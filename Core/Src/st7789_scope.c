@@ -0,0 +1,261 @@
+#include "st7789_scope.h"
+
+#define SCOPE_EMPTY_MIN		0xFFFF
+#define SCOPE_EMPTY_MAX		0
+
+// выход дециматора и два буфера столбцов: столбец N собирается, пока по DMA уходит N - 1
+static q15_t ST7789_Scope_Block[ST7789_SCOPE_BLOCK];
+static uint16_t ST7789_Scope_ColBuff[2][ST7789_LINE_BUFF_SIZE];
+
+// состояние разбора кадра: предыдущая точка
+static int32_t ST7789_Scope_LastX, ST7789_Scope_LastY;
+
+//==============================================================================
+// Процедура пометки всех столбцов пустыми
+//==============================================================================
+static void ST7789_Scope_Empty(uint16_t *pMin, uint16_t *pMax, uint16_t w)
+{
+
+	uint16_t c;
+
+	for (c = 0; c < w; c++)
+	{
+		pMin[c] = SCOPE_EMPTY_MIN;
+		pMax[c] = SCOPE_EMPTY_MAX;
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура инициализации
+//==============================================================================
+void ST7789_Scope_Init(ST7789_Scope_t *s, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t TraceColor, uint16_t BgColor)
+{
+
+	if (w > ST7789_SCOPE_MAX_COLS)
+	{
+		w = ST7789_SCOPE_MAX_COLS;
+	}
+	if (h > ST7789_LINE_BUFF_SIZE)
+	{
+		h = ST7789_LINE_BUFF_SIZE;
+	}
+
+	s->x = x;
+	s->y = y;
+	s->w = w;
+	s->h = h;
+	s->TraceColor = TraceColor;
+	s->BgColor = BgColor;
+	s->decimation = 1;
+
+	ST7789_Scope_Invalidate(s);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура настройки децимации
+//==============================================================================
+arm_status ST7789_Scope_SetDecimation(ST7789_Scope_t *s, uint8_t M, uint16_t numTaps, const q15_t *pCoeffs)
+{
+
+	arm_status status;
+
+	if (M <= 1)
+	{
+		s->decimation = 1;
+		return ARM_MATH_SUCCESS;
+	}
+
+	if ((numTaps == 0) || (numTaps > ST7789_SCOPE_MAX_TAPS))
+	{
+		return ARM_MATH_ARGUMENT_ERROR;
+	}
+
+	status = arm_fir_decimate_init_q15(&s->fir, numTaps, M, (q15_t *)pCoeffs, s->firState, ST7789_SCOPE_BLOCK);
+	if (status == ARM_MATH_SUCCESS)
+	{
+		s->decimation = M;
+	}
+
+	return status;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура добавления точки y в столбец c
+//==============================================================================
+static void ST7789_Scope_Extend(ST7789_Scope_t *s, int32_t c, int32_t y)
+{
+
+	if (y < s->newMin[c])
+	{
+		s->newMin[c] = (uint16_t)y;
+	}
+	if (y > s->newMax[c])
+	{
+		s->newMax[c] = (uint16_t)y;
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура добавления точки кадра: столбцы между предыдущей и новой точкой
+// получают отрезки соединяющей линии, точки в одном столбце дают огибающую
+//==============================================================================
+static void ST7789_Scope_Point(ST7789_Scope_t *s, uint32_t p, uint32_t points, q15_t v)
+{
+
+	int32_t x, y, c, dx, dy;
+
+	x = (points > 1) ? (int32_t)((p * (s->w - 1)) / (points - 1)) : 0;
+	y = (int32_t)(((uint32_t)(32767 - v) * (s->h - 1)) / 65535);
+
+	if ((p == 0) || (x == ST7789_Scope_LastX))
+	{
+		ST7789_Scope_Extend(s, x, y);
+	}
+	else
+	{
+		dx = x - ST7789_Scope_LastX;
+		dy = y - ST7789_Scope_LastY;
+
+		for (c = ST7789_Scope_LastX; c < x; c++)
+		{
+			ST7789_Scope_Extend(s, c, ST7789_Scope_LastY + dy * (c - ST7789_Scope_LastX) / dx);
+			ST7789_Scope_Extend(s, c, ST7789_Scope_LastY + dy * (c + 1 - ST7789_Scope_LastX) / dx);
+		}
+		ST7789_Scope_Extend(s, x, y);
+	}
+
+	ST7789_Scope_LastX = x;
+	ST7789_Scope_LastY = y;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вывода новых отрезков: в каждом изменившемся столбце одна
+// вертикальная передача, покрывающая старый и новый отрезок
+//==============================================================================
+static uint16_t ST7789_Scope_Render(ST7789_Scope_t *s)
+{
+
+	uint16_t c, lo, hi, row, nmin, nmax, omin, omax;
+	uint16_t trace = (uint16_t)((s->TraceColor >> 8) | (s->TraceColor << 8));
+	uint16_t bg = (uint16_t)((s->BgColor >> 8) | (s->BgColor << 8));
+	uint16_t *pCol;
+	uint16_t redrawn = 0;
+	uint8_t buf = 0;
+
+	for (c = 0; c < s->w; c++)
+	{
+		nmin = s->newMin[c];
+		nmax = s->newMax[c];
+		omin = s->shownMin[c];
+		omax = s->shownMax[c];
+
+		if ((nmin == omin) && (nmax == omax))
+		{
+			continue;
+		}
+
+		lo = (nmin < omin) ? nmin : omin;
+		hi = (nmax > omax) ? nmax : omax;
+
+		// буфер buf был отправлен два столбца назад - SetWindow дождется текущей передачи
+		pCol = ST7789_Scope_ColBuff[buf];
+		for (row = lo; row <= hi; row++)
+		{
+			*pCol++ = ((row >= nmin) && (row <= nmax)) ? trace : bg;
+		}
+
+		ST7789_SetWindow(s->x + c, s->y + lo, s->x + c, s->y + hi);
+
+		ST7789_Select();
+
+		ST7789_SendDataDMA((uint8_t *)ST7789_Scope_ColBuff[buf], sizeof(uint16_t) * (hi - lo + 1));
+
+		buf ^= 1;
+
+		s->shownMin[c] = nmin;
+		s->shownMax[c] = nmax;
+		redrawn++;
+	}
+
+	ST7789_WaitDMA();
+
+	ST7789_Unselect();
+
+	return redrawn;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура вывода кадра
+//==============================================================================
+uint16_t ST7789_Scope_Draw(ST7789_Scope_t *s, const q15_t *pSamples, uint32_t count)
+{
+
+	uint32_t points, p = 0, n, i;
+	uint8_t M = s->decimation;
+
+	count -= count % M;
+	points = count / M;
+
+	ST7789_Scope_Empty(s->newMin, s->newMax, s->w);
+
+	if (M == 1)
+	{
+		for (p = 0; p < points; p++)
+		{
+			ST7789_Scope_Point(s, p, points, pSamples[p]);
+		}
+	}
+	else
+	{
+		while (count)
+		{
+			n = (count > ST7789_SCOPE_BLOCK) ? ST7789_SCOPE_BLOCK : count;
+			n -= n % M;
+
+			arm_fir_decimate_q15(&s->fir, (q15_t *)pSamples, ST7789_Scope_Block, n);
+
+			for (i = 0; i < n / M; i++)
+			{
+				ST7789_Scope_Point(s, p++, points, ST7789_Scope_Block[i]);
+			}
+
+			pSamples += n;
+			count -= n;
+		}
+	}
+
+	return ST7789_Scope_Render(s);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура стирания кривой
+//==============================================================================
+void ST7789_Scope_Clear(ST7789_Scope_t *s)
+{
+
+	ST7789_Scope_Empty(s->newMin, s->newMax, s->w);
+
+	ST7789_Scope_Render(s);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура полной перерисовки фона
+//==============================================================================
+void ST7789_Scope_Invalidate(ST7789_Scope_t *s)
+{
+
+	ST7789_Scope_Empty(s->shownMin, s->shownMax, s->w);
+
+	ST7789_FillRect(s->x, s->y, s->w, s->h, s->BgColor);
+}
+//==============================================================================
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
@@ -0,0 +1,60 @@
+#ifndef _ST7789_SCOPE_H
+#define _ST7789_SCOPE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "st7789.h"
+#include "arm_math.h"
+
+/* 示波器波形显示：
+   每一列记住屏幕上当前波形的竖线段 [min, max]，新一帧只在变化的列上
+   发送一条竖线（旧线段和新线段的并集：新线段内为波形颜色，其余为背景色），
+   不需要清屏，也不逐点 DrawPixel。240 列的波形最多 240 次短传输。
+
+   输入为 q15 样本（-1.0 ... 1.0 对应区域的下边 ... 上边），
+   可以先经 arm_fir_decimate_q15 抽取（ST7789_Scope_SetDecimation）。
+   一帧的样本（抽取后）均匀分布在全部列上：样本多于列数时每列显示包络，
+   少于列数时相邻样本之间连线。 */
+
+#define ST7789_SCOPE_MAX_COLS		320
+#define ST7789_SCOPE_MAX_TAPS		32			/* 抽取滤波器最大阶数 */
+#define ST7789_SCOPE_BLOCK			64			/* 每次抽取的输入样本数 */
+/* ------------------------------------------------ */
+
+typedef struct {
+	uint16_t x, y, w, h;
+	uint16_t TraceColor, BgColor;
+	uint16_t shownMin[ST7789_SCOPE_MAX_COLS];	/* 屏幕上的线段，min > max 表示空 */
+	uint16_t shownMax[ST7789_SCOPE_MAX_COLS];
+	uint16_t newMin[ST7789_SCOPE_MAX_COLS];		/* 正在生成的一帧 */
+	uint16_t newMax[ST7789_SCOPE_MAX_COLS];
+	uint8_t decimation;							/* 1 - 不抽取 */
+	arm_fir_decimate_instance_q15 fir;
+	q15_t firState[ST7789_SCOPE_MAX_TAPS + ST7789_SCOPE_BLOCK - 1];
+} ST7789_Scope_t;
+
+/* 初始化并用背景色清除区域，w 不超过 ST7789_SCOPE_MAX_COLS，h 不超过 ST7789_LINE_BUFF_SIZE */
+void ST7789_Scope_Init(ST7789_Scope_t *s, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t TraceColor, uint16_t BgColor);
+
+/* 设置抽取：M 倍，numTaps 个系数（不超过 ST7789_SCOPE_MAX_TAPS，ST7789_SCOPE_BLOCK 须为 M 的倍数）
+   M = 1 取消抽取。系数数组在使用期间必须有效。 */
+arm_status ST7789_Scope_SetDecimation(ST7789_Scope_t *s, uint8_t M, uint16_t numTaps, const q15_t *pCoeffs);
+
+/* 显示一帧 count 个样本（抽取时只用到 M 的整数倍），返回重绘的列数 */
+uint16_t ST7789_Scope_Draw(ST7789_Scope_t *s, const q15_t *pSamples, uint32_t count);
+
+/* 擦除波形（只重绘有波形的列） */
+void ST7789_Scope_Clear(ST7789_Scope_t *s);
+
+/* 屏幕被其他内容覆盖后调用：清除区域，下一帧全部重绘 */
+void ST7789_Scope_Invalidate(ST7789_Scope_t *s);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ST7789_SCOPE_H */
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
@@ -0,0 +1,532 @@
+#include "st7789_spectrum.h"
+#include <math.h>
+
+ADC_HandleTypeDef hadc1;
+DMA_HandleTypeDef hdma_adc1;
+TIM_HandleTypeDef htim4;
+
+#define SPEC_N		ST7789_SPECTRUM_FFT_LEN
+#define SPEC_BINS	(SPEC_N / 2)
+
+// тип отсчетов и функции CMSIS-DSP для выбранного формата
+#ifdef ST7789_SPECTRUM_Q31
+typedef q31_t spec_t;
+static arm_rfft_instance_q31 SpecRfft;
+#define SPEC_SHIFT			20					// 12 бит АЦП -> 1.31
+#define SPEC_SAT(v)			(v)
+#define SPEC_RFFT_INIT		arm_rfft_init_q31
+#define SPEC_RFFT			arm_rfft_q31
+#define SPEC_MULT			arm_mult_q31
+#define SPEC_POWER(re, im)	((uint32_t)(((uint64_t)((q63_t)(re) * (re)) + (uint64_t)((q63_t)(im) * (im))) >> 32))
+#else
+typedef q15_t spec_t;
+static arm_rfft_instance_q15 SpecRfft;
+#define SPEC_SHIFT			4					// 12 бит АЦП -> 1.15
+#define SPEC_SAT(v)			__SSAT((v), 16)
+#define SPEC_RFFT_INIT		arm_rfft_init_q15
+#define SPEC_RFFT			arm_rfft_q15
+#define SPEC_MULT			arm_mult_q15
+#define SPEC_POWER(re, im)	((uint32_t)((int32_t)(re) * (re)) + (uint32_t)((int32_t)(im) * (im)))
+#endif
+
+// отсчеты АЦП: две половины по очереди заполняются DMA
+static uint16_t SpecAdc[2 * SPEC_N];
+static volatile uint8_t SpecReady;			// 1 - готова первая половина, 2 - вторая
+
+static spec_t SpecWin[SPEC_N];				// окно Ханна
+static spec_t SpecIn[SPEC_N];				// вход FFT ( портится ), затем дБ
+static spec_t SpecOut[2 * SPEC_N] __ALIGNED(4);	// выход RFFT, затем мощности ( uint32_t )
+static int16_t SpecRef;						// уровень полной шкалы, 1/8 дБ
+
+// полосы: бины [SpecEdge[b], SpecEdge[b + 1])
+static uint16_t SpecEdge[ST7789_SPECTRUM_BARS + 1];
+
+// что сейчас на экране
+static int16_t SpecHeight[ST7789_SPECTRUM_BARS];
+static int16_t SpecPeak[ST7789_SPECTRUM_BARS];
+static int16_t SpecPeakShown[ST7789_SPECTRUM_BARS];
+static uint8_t SpecHold[ST7789_SPECTRUM_BARS];
+
+static uint16_t SpecX, SpecY, SpecW, SpecH, SpecBarW, SpecMaxH;
+static uint16_t SpecBarColor, SpecPeakColor, SpecBgColor;
+
+static ST7789_SpectrumStats_t SpecStats;
+
+//==============================================================================
+// Процедура перевода мощности в дБ: 10 * log10( v ) в единицах 1/8 дБ
+// log2 по номеру старшего бита и 8 битам мантиссы ( линейно, ошибка < 0.3 дБ )
+//==============================================================================
+static int32_t ST7789_Spectrum_Db8(uint32_t v)
+{
+
+	uint32_t n, frac;
+
+	if (v == 0)
+	{
+		return -32767;
+	}
+
+	n = 31 - __CLZ(v);
+	frac = (n >= 8) ? (v >> (n - 8)) : (v << (8 - n));
+
+	// ( n * 256 + frac ) - log2 в Q8, 3.0103 дБ на октаву * 8 / 256 = 193 / 2048
+	return (int32_t)((((n << 8) | (frac & 0xFF)) * 193) >> 11);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура обработки: окно, RFFT, квадрат модуля, дБ относительно полной шкалы
+// результат в SpecIn[ 0 ... SPEC_BINS ) как int16 1/8 дБ
+// ( arm_cmplx_mag_q15 отбрасывает 17 младших бит квадрата, и слабые
+//   составляющие пропадают, поэтому мощность считается здесь без корня )
+//==============================================================================
+static void ST7789_Spectrum_Analyze(const uint16_t *pSamples, int16_t *pDb)
+{
+
+	uint32_t t0, t1, i;
+	int32_t mean = 0, db;
+
+	t0 = ST77XX_CYCLES();
+
+	// постоянная составляющая
+	for (i = 0; i < SPEC_N; i++)
+	{
+		mean += pSamples[i];
+	}
+	mean /= SPEC_N;
+
+	for (i = 0; i < SPEC_N; i++)
+	{
+		SpecIn[i] = (spec_t)SPEC_SAT(((int32_t)pSamples[i] - mean) << SPEC_SHIFT);
+	}
+
+	SPEC_MULT(SpecIn, SpecWin, SpecIn, SPEC_N);
+
+	t1 = ST77XX_CYCLES();
+	SpecStats.window = t1 - t0;
+	t0 = t1;
+
+	SPEC_RFFT(&SpecRfft, SpecIn, SpecOut);
+
+	t1 = ST77XX_CYCLES();
+	SpecStats.fft = t1 - t0;
+	t0 = t1;
+
+	// мощности на место выхода RFFT ( бин i читается из [2i, 2i + 1] раньше записи )
+	for (i = 0; i < SPEC_BINS; i++)
+	{
+		((uint32_t *)SpecOut)[i] = SPEC_POWER(SpecOut[2 * i], SpecOut[2 * i + 1]);
+	}
+
+	t1 = ST77XX_CYCLES();
+	SpecStats.mag = t1 - t0;
+	t0 = t1;
+
+	for (i = 0; i < SPEC_BINS; i++)
+	{
+		db = ST7789_Spectrum_Db8(((uint32_t *)SpecOut)[i]) - SpecRef;
+		pDb[i] = (int16_t)((db < -32767) ? -32767 : db);
+	}
+
+	t1 = ST77XX_CYCLES();
+	SpecStats.log = t1 - t0;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура заливки высот [a, c) полосы b ( высота считается от нижнего края )
+//==============================================================================
+static void ST7789_Spectrum_Span(uint8_t b, int16_t a, int16_t c, uint16_t color)
+{
+
+	if (c > SpecH)
+	{
+		c = SpecH;
+	}
+
+	if (c > a)
+	{
+		ST7789_FillRect(SpecX + b * (SpecBarW + ST7789_SPECTRUM_GAP), SpecY + SpecH - c, SpecBarW, c - a, color);
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура обновления полосы: перерисовываются только изменившиеся участки
+//==============================================================================
+static void ST7789_Spectrum_Bar(uint8_t b, int16_t nh)
+{
+
+	int16_t oh = SpecHeight[b];
+	int16_t op = SpecPeakShown[b], np;
+
+	// столбик
+	if (nh > oh)
+	{
+		ST7789_Spectrum_Span(b, oh, nh, SpecBarColor);
+	}
+	else if (nh < oh)
+	{
+		ST7789_Spectrum_Span(b, nh, oh, SpecBgColor);
+	}
+	SpecHeight[b] = nh;
+
+	// пик: удержание, затем падение
+	if (nh >= SpecPeak[b])
+	{
+		SpecPeak[b] = nh;
+		SpecHold[b] = ST7789_SPECTRUM_PEAK_HOLD;
+	}
+	else if (SpecHold[b])
+	{
+		SpecHold[b]--;
+	}
+	else
+	{
+		SpecPeak[b] -= ST7789_SPECTRUM_PEAK_FALL;
+		if (SpecPeak[b] < nh)
+		{
+			SpecPeak[b] = nh;
+		}
+	}
+
+	np = SpecPeak[b];
+
+	if (np != op)
+	{
+		// старая линия пика: ниже нового столбика - цвет столбика, выше - фон
+		if (op >= 0)
+		{
+			ST7789_Spectrum_Span(b, op, (op + ST7789_SPECTRUM_PEAK_H < nh) ? op + ST7789_SPECTRUM_PEAK_H : nh, SpecBarColor);
+			ST7789_Spectrum_Span(b, (op > nh) ? op : nh, op + ST7789_SPECTRUM_PEAK_H, SpecBgColor);
+		}
+
+		ST7789_Spectrum_Span(b, np, np + ST7789_SPECTRUM_PEAK_H, SpecPeakColor);
+		SpecPeakShown[b] = np;
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура обработки и вывода одного кадра
+//==============================================================================
+void ST7789_Spectrum_Frame(const uint16_t *pSamples)
+{
+
+	int16_t *pDb = (int16_t *)SpecIn;
+	uint32_t t0, t1;
+	int32_t v, px;
+	uint16_t k;
+	uint8_t b;
+
+	t0 = ST77XX_CYCLES();
+
+	ST7789_Spectrum_Analyze(pSamples, pDb);
+
+	t1 = ST77XX_CYCLES();
+
+	for (b = 0; b < ST7789_SPECTRUM_BARS; b++)
+	{
+		// максимум по бинам полосы
+		v = -32767;
+		for (k = SpecEdge[b]; k < SpecEdge[b + 1]; k++)
+		{
+			if (pDb[k] > v)
+			{
+				v = pDb[k];
+			}
+		}
+
+		px = ((v + ST7789_SPECTRUM_DB_RANGE * 8) * SpecMaxH) / (ST7789_SPECTRUM_DB_RANGE * 8);
+		if (px < 0)
+		{
+			px = 0;
+		}
+		if (px > SpecMaxH)
+		{
+			px = SpecMaxH;
+		}
+
+		ST7789_Spectrum_Bar(b, (int16_t)px);
+	}
+
+	SpecStats.render = ST77XX_CYCLES() - t1;
+	SpecStats.total = ST77XX_CYCLES() - t0;
+	SpecStats.frames++;
+
+#define SPEC_MAX(f) if (SpecStats.f > SpecStats.f##_max) SpecStats.f##_max = SpecStats.f
+	SPEC_MAX(window);
+	SPEC_MAX(fft);
+	SPEC_MAX(mag);
+	SPEC_MAX(log);
+	SPEC_MAX(render);
+	SPEC_MAX(total);
+#undef SPEC_MAX
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура инициализации обработки и области вывода
+//==============================================================================
+void ST7789_Spectrum_Init(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t BarColor, uint16_t PeakColor, uint16_t BgColor)
+{
+
+	static uint16_t test[SPEC_N];
+	int16_t *pDb = (int16_t *)SpecIn;
+	float32_t ratio, edge;
+	uint32_t i;
+	uint8_t b;
+
+	ST77XX_CYCLES_INIT();
+
+	SPEC_RFFT_INIT(&SpecRfft, SPEC_N, 0, 1);
+
+	// окно Ханна: 0.5 - 0.5 * cos( 2 * pi * i / N )
+	for (i = 0; i < SPEC_N; i++)
+	{
+#ifdef ST7789_SPECTRUM_Q31
+		SpecWin[i] = clip_q63_to_q31((q63_t)0x40000000 - (arm_cos_q31((q31_t)(((uint64_t)i << 31) / SPEC_N)) >> 1));
+#else
+		SpecWin[i] = (q15_t)__SSAT(0x4000 - (arm_cos_q15((q15_t)((i << 15) / SPEC_N)) >> 1), 16);
+#endif
+	}
+
+	// опорный уровень: синус полной шкалы в центре бина N / 8
+	SpecRef = 0;
+	for (i = 0; i < SPEC_N; i++)
+	{
+		test[i] = 2048 + ((arm_cos_q15((q15_t)((((i * (SPEC_N / 8)) % SPEC_N) << 15) / SPEC_N)) * 2047) >> 15);
+	}
+	ST7789_Spectrum_Analyze(test, pDb);
+	SpecRef = pDb[SPEC_N / 8];
+
+	// логарифмические полосы от бина 1 до SPEC_BINS, не меньше бина на полосу
+	ratio = powf((float32_t)SPEC_BINS, 1.0f / ST7789_SPECTRUM_BARS);
+	edge = 1.0f;
+	SpecEdge[0] = 1;
+	for (b = 1; b <= ST7789_SPECTRUM_BARS; b++)
+	{
+		edge *= ratio;
+		SpecEdge[b] = (uint16_t)(edge + 0.5f);
+		if (SpecEdge[b] <= SpecEdge[b - 1])
+		{
+			SpecEdge[b] = SpecEdge[b - 1] + 1;
+		}
+		if (SpecEdge[b] > SPEC_BINS)
+		{
+			SpecEdge[b] = SPEC_BINS;
+		}
+	}
+	SpecEdge[ST7789_SPECTRUM_BARS] = SPEC_BINS;
+
+	// геометрия
+	SpecX = x;
+	SpecY = y;
+	SpecW = w;
+	SpecH = h;
+	SpecBarW = (w + ST7789_SPECTRUM_GAP) / ST7789_SPECTRUM_BARS - ST7789_SPECTRUM_GAP;
+	SpecMaxH = h - ST7789_SPECTRUM_PEAK_H;
+	SpecBarColor = BarColor;
+	SpecPeakColor = PeakColor;
+	SpecBgColor = BgColor;
+
+	for (b = 0; b < ST7789_SPECTRUM_BARS; b++)
+	{
+		SpecHeight[b] = 0;
+		SpecPeak[b] = 0;
+		SpecPeakShown[b] = -1;
+		SpecHold[b] = 0;
+	}
+
+	ST7789_FillRect(x, y, w, h, BgColor);
+
+	ST7789_Spectrum_ResetStats();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура запуска оцифровки: TIM4_CC4 -> ADC1 ( PA1 ) -> DMA1 channel 1
+//==============================================================================
+void ST7789_Spectrum_Start(void)
+{
+
+	GPIO_InitTypeDef GPIO_InitStruct = {0};
+	RCC_PeriphCLKInitTypeDef PeriphClkInit = {0};
+	ADC_ChannelConfTypeDef sConfig = {0};
+	TIM_OC_InitTypeDef sConfigOC = {0};
+	uint32_t period = SystemCoreClock / ST7789_SPECTRUM_RATE;
+	uint32_t prescaler = 1;
+
+	__HAL_RCC_GPIOA_CLK_ENABLE();
+	__HAL_RCC_ADC1_CLK_ENABLE();
+	__HAL_RCC_TIM4_CLK_ENABLE();
+	__HAL_RCC_DMA1_CLK_ENABLE();
+
+	/* ADC 72 / 6 = 12 MHz ( не больше 14 ) */
+	PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_ADC;
+	PeriphClkInit.AdcClockSelection = RCC_ADCPCLK2_DIV6;
+	HAL_RCCEx_PeriphCLKConfig(&PeriphClkInit);
+
+	GPIO_InitStruct.Pin = GPIO_PIN_1;
+	GPIO_InitStruct.Mode = GPIO_MODE_ANALOG;
+	HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+	hadc1.Instance = ADC1;
+	hadc1.Init.ScanConvMode = ADC_SCAN_DISABLE;
+	hadc1.Init.ContinuousConvMode = DISABLE;
+	hadc1.Init.DiscontinuousConvMode = DISABLE;
+	hadc1.Init.ExternalTrigConv = ADC_EXTERNALTRIGCONV_T4_CC4;
+	hadc1.Init.DataAlign = ADC_DATAALIGN_RIGHT;
+	hadc1.Init.NbrOfConversion = 1;
+	if (HAL_ADC_Init(&hadc1) != HAL_OK)
+	{
+		Error_Handler();
+	}
+
+	sConfig.Channel = ADC_CHANNEL_1;
+	sConfig.Rank = ADC_REGULAR_RANK_1;
+	sConfig.SamplingTime = ADC_SAMPLETIME_28CYCLES_5;
+	if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+	{
+		Error_Handler();
+	}
+
+	/* ADC1 DMA: DMA1 channel 1, кольцевой режим, две половины буфера */
+	hdma_adc1.Instance = DMA1_Channel1;
+	hdma_adc1.Init.Direction = DMA_PERIPH_TO_MEMORY;
+	hdma_adc1.Init.PeriphInc = DMA_PINC_DISABLE;
+	hdma_adc1.Init.MemInc = DMA_MINC_ENABLE;
+	hdma_adc1.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+	hdma_adc1.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+	hdma_adc1.Init.Mode = DMA_CIRCULAR;
+	hdma_adc1.Init.Priority = DMA_PRIORITY_MEDIUM;
+	if (HAL_DMA_Init(&hdma_adc1) != HAL_OK)
+	{
+		Error_Handler();
+	}
+
+	__HAL_LINKDMA(&hadc1, DMA_Handle, hdma_adc1);
+
+	HAL_NVIC_SetPriority(DMA1_Channel1_IRQn, 2, 0);
+	HAL_NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+
+	HAL_ADCEx_Calibration_Start(&hadc1);
+
+	/* TIM4: частота дискретизации, событие CC4 запускает преобразование */
+	while (period > 0x10000)
+	{
+		prescaler++;
+		period = SystemCoreClock / ST7789_SPECTRUM_RATE / prescaler;
+	}
+
+	htim4.Instance = TIM4;
+	htim4.Init.Prescaler = prescaler - 1;
+	htim4.Init.CounterMode = TIM_COUNTERMODE_UP;
+	htim4.Init.Period = period - 1;
+	htim4.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+	htim4.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+	if (HAL_TIM_PWM_Init(&htim4) != HAL_OK)
+	{
+		Error_Handler();
+	}
+
+	sConfigOC.OCMode = TIM_OCMODE_PWM1;
+	sConfigOC.Pulse = period / 2;
+	sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
+	sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
+	if (HAL_TIM_PWM_ConfigChannel(&htim4, &sConfigOC, TIM_CHANNEL_4) != HAL_OK)
+	{
+		Error_Handler();
+	}
+
+	SpecReady = 0;
+
+	HAL_ADC_Start_DMA(&hadc1, (uint32_t *)SpecAdc, 2 * SPEC_N);
+	HAL_TIM_PWM_Start(&htim4, TIM_CHANNEL_4);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура остановки оцифровки
+//==============================================================================
+void ST7789_Spectrum_Stop(void)
+{
+
+	HAL_TIM_PWM_Stop(&htim4, TIM_CHANNEL_4);
+	HAL_ADC_Stop_DMA(&hadc1);
+	SpecReady = 0;
+}
+//==============================================================================
+
+//==============================================================================
+// Прерывания DMA АЦП: готова первая / вторая половина буфера
+//==============================================================================
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+
+	if (hadc->Instance != ADC1)
+	{
+		return;
+	}
+
+	if (SpecReady)
+	{
+		SpecStats.overruns++;
+	}
+	SpecReady = 1;
+}
+
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+
+	if (hadc->Instance != ADC1)
+	{
+		return;
+	}
+
+	if (SpecReady)
+	{
+		SpecStats.overruns++;
+	}
+	SpecReady = 2;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура обработки готовой половины буфера ( из основного цикла )
+//==============================================================================
+uint8_t ST7789_Spectrum_Process(void)
+{
+
+	uint8_t half = SpecReady;
+
+	if (!half)
+	{
+		return 0;
+	}
+
+	SpecReady = 0;
+
+	ST7789_Spectrum_Frame(&SpecAdc[(half - 1) * SPEC_N]);
+
+	return 1;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедуры статистики
+//==============================================================================
+void ST7789_Spectrum_GetStats(ST7789_SpectrumStats_t *stats)
+{
+
+	*stats = SpecStats;
+}
+
+void ST7789_Spectrum_ResetStats(void)
+{
+
+	memset(&SpecStats, 0, sizeof(SpecStats));
+}
+//==============================================================================
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
@@ -0,0 +1,69 @@
+#ifndef _ST7789_SPECTRUM_H
+#define _ST7789_SPECTRUM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "st7789.h"
+#include "st77xx_cycles.h"
+#include "arm_math.h"
+
+/* 实时频谱显示：
+   1. 采集：ADC1 通道 1（PA1）由 TIM4_CC4 按采样率触发，DMA1 通道 1 循环写入
+      2 x FFT_LEN 的缓冲区，半满 / 全满中断交替给出一帧（乒乓）。
+   2. 处理：去直流、Hann 窗、arm_rfft_q15（定义 ST7789_SPECTRUM_Q31 时为 q31）、
+      模的平方（不开方）、整数 log2 换算为 dB（单位 1/8 dB）。
+      0 dB 为满量程正弦波，初始化时用合成信号标定。
+   3. 显示：频点按对数间隔分到 ST7789_SPECTRUM_BARS 个柱，带峰值保持；
+      只用 FillRect 重绘柱高和峰值线变化的部分。
+   每一级的耗时（CPU 周期）记录在 ST7789_SpectrumStats_t 中。 */
+
+//#define ST7789_SPECTRUM_Q31						/* 使用 q31 处理（精度更高，约慢一倍） */
+
+#define ST7789_SPECTRUM_FFT_LEN		256				/* 32...2048, 2 的幂 */
+#define ST7789_SPECTRUM_BARS		32
+#define ST7789_SPECTRUM_RATE		8000			/* 采样率，Hz */
+#define ST7789_SPECTRUM_DB_RANGE	60				/* 显示范围：0...-60 dB */
+#define ST7789_SPECTRUM_PEAK_H		2				/* 峰值线高度，像素 */
+#define ST7789_SPECTRUM_PEAK_HOLD	15				/* 峰值保持帧数 */
+#define ST7789_SPECTRUM_PEAK_FALL	2				/* 之后每帧下降的像素 */
+#define ST7789_SPECTRUM_GAP			1				/* 柱之间的间隔，像素 */
+
+extern ADC_HandleTypeDef hadc1;
+extern DMA_HandleTypeDef hdma_adc1;
+extern TIM_HandleTypeDef htim4;
+
+/* 每一级的耗时（最后一帧 / 最大值），CPU 周期
+   一帧的采集时间为 FFT_LEN / RATE 秒，total 必须小于它才能保证刷新率 */
+typedef struct {
+	uint32_t window, fft, mag, log, render, total;
+	uint32_t window_max, fft_max, mag_max, log_max, render_max, total_max;
+	uint32_t frames;
+	uint32_t overruns;		/* 处理不及时而丢弃的帧 */
+} ST7789_SpectrumStats_t;
+
+/* 初始化处理和显示区域（不启动采集） */
+void ST7789_Spectrum_Init(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t BarColor, uint16_t PeakColor, uint16_t BgColor);
+
+/* 初始化 ADC / DMA / TIM4 并开始采集 */
+void ST7789_Spectrum_Start(void);
+void ST7789_Spectrum_Stop(void);
+
+/* 主循环中调用：有新的一帧时处理并显示，返回 1 */
+uint8_t ST7789_Spectrum_Process(void);
+
+/* 处理一帧已有的样本（12 位 ADC 值，FFT_LEN 个），可不用 ADC 单独使用 */
+void ST7789_Spectrum_Frame(const uint16_t *pSamples);
+
+/* 读取 / 清除统计 */
+void ST7789_Spectrum_GetStats(ST7789_SpectrumStats_t *stats);
+void ST7789_Spectrum_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ST7789_SPECTRUM_H */
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
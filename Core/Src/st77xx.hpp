@@ -0,0 +1,255 @@
+#ifndef _ST77XX_HPP
+#define _ST77XX_HPP
+
+/* 编译期特化的 ST77xx 驱动（仅头文件）：
+       St77xx<Panel, Bus, Pins>
+   Panel - 尺寸、偏移、MADCTL（与 ST7789_rotation() 中的表相同），全部是编译期常量，
+           裁剪比较和窗口偏移在编译时折叠，不再读取 ST7789_Width / ST7789_X_Start；
+   Bus   - SPI 寄存器地址为模板参数，直接操作 SR / DR（与 ST7789_SPI_CMSIS 路径相同）；
+   Pins  - 端口地址和引脚掩码为模板参数，每次引脚切换编译为一次 BSRR 写入。
+   所有函数都是 static inline，没有对象和虚函数。
+   C++11 时常量为 constexpr；ARMCC 5 默认的 C++03 下为 static const（同样在编译时折叠）。
+
+   GPIO / SPI 的时钟和引脚配置仍由 ST77XX_GPIO_Init() / ST77XX_SPI_Init() 完成。
+   与 C 驱动共用同一个 SPI：调用前 C 驱动的 DMA 传输必须已结束（ST7789_WaitDMA）。
+   C 代码通过 st77xx_t.h 中的包装函数使用。 */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "main.h"
+
+#if __cplusplus >= 201103L
+	#define ST77XX_CONSTEXPR	constexpr
+#else
+	#define ST77XX_CONSTEXPR	const
+#endif
+
+namespace st77xx
+{
+
+/* 面板：逻辑尺寸（旋转后）、GRAM 偏移、MADCTL */
+template <uint16_t W, uint16_t H, uint16_t XS, uint16_t YS, uint8_t MADCTL>
+struct Panel
+{
+	static ST77XX_CONSTEXPR int16_t width = W;
+	static ST77XX_CONSTEXPR int16_t height = H;
+	static ST77XX_CONSTEXPR uint16_t xstart = XS;
+	static ST77XX_CONSTEXPR uint16_t ystart = YS;
+	static ST77XX_CONSTEXPR uint8_t madctl = MADCTL;
+};
+
+/* MADCTL 位 */
+enum { MY = 0x80, MX = 0x40, MV = 0x20, RGB = 0x00 };
+
+/* ST7789_rotation() 的 1...4 */
+template <uint8_t Rotation> struct ST7789_135x240;
+template <> struct ST7789_135x240<1> : Panel<135, 240, 52, 40, RGB> {};
+template <> struct ST7789_135x240<2> : Panel<240, 135, 40, 53, MX | MV | RGB> {};
+template <> struct ST7789_135x240<3> : Panel<135, 240, 53, 40, MX | MY | RGB> {};
+template <> struct ST7789_135x240<4> : Panel<240, 135, 40, 52, MY | MV | RGB> {};
+
+template <uint8_t Rotation> struct ST7789_240x240;
+template <> struct ST7789_240x240<1> : Panel<240, 240, 0, 0, RGB> {};
+template <> struct ST7789_240x240<2> : Panel<240, 240, 0, 0, MX | MV | RGB> {};
+template <> struct ST7789_240x240<3> : Panel<240, 240, 0, 80, MX | MY | RGB> {};
+template <> struct ST7789_240x240<4> : Panel<240, 240, 80, 0, MY | MV | RGB> {};
+
+template <uint8_t Rotation> struct ST7789_240x320;
+template <> struct ST7789_240x320<1> : Panel<240, 320, 0, 0, RGB> {};
+template <> struct ST7789_240x320<2> : Panel<320, 240, 0, 0, MX | MV | RGB> {};
+template <> struct ST7789_240x320<3> : Panel<240, 320, 0, 0, MX | MY | RGB> {};
+template <> struct ST7789_240x320<4> : Panel<320, 240, 0, 0, MY | MV | RGB> {};
+/* ------------------------------------------------ */
+
+/* 引脚：CS、DC、RST（端口基地址 + 掩码） */
+template <uint32_t CsPort, uint16_t CsPin, uint32_t DcPort, uint16_t DcPin, uint32_t RstPort, uint16_t RstPin>
+struct Pins
+{
+	static inline GPIO_TypeDef *port(uint32_t base) { return reinterpret_cast<GPIO_TypeDef *>(base); }
+
+	static inline void select(void) { port(CsPort)->BSRR = (uint32_t)CsPin << 16; }
+	static inline void unselect(void) { port(CsPort)->BSRR = CsPin; }
+	static inline void command(void) { port(DcPort)->BSRR = (uint32_t)DcPin << 16; }
+	static inline void data(void) { port(DcPort)->BSRR = DcPin; }
+	static inline void reset(bool active) { port(RstPort)->BSRR = active ? ((uint32_t)RstPin << 16) : RstPin; }
+};
+/* ------------------------------------------------ */
+
+/* SPI 总线（F1 系列寄存器，8 位帧） */
+template <uint32_t SpiBase>
+struct SpiBus
+{
+	static inline SPI_TypeDef *spi(void) { return reinterpret_cast<SPI_TypeDef *>(SpiBase); }
+
+	static inline void enable(void)
+	{
+		if ((spi()->CR1 & SPI_CR1_SPE) != SPI_CR1_SPE)
+		{
+			spi()->CR1 |= SPI_CR1_SPE;
+		}
+	}
+
+	static inline void write8(uint8_t b)
+	{
+		while ((spi()->SR & SPI_SR_TXE) == 0)
+		{
+		}
+		*((__IO uint8_t *)&spi()->DR) = b;
+	}
+
+	static inline void write16(uint16_t v)
+	{
+		write8((uint8_t)(v >> 8));
+		write8((uint8_t)v);
+	}
+
+	static inline void repeat16(uint16_t v, uint32_t n)
+	{
+		const uint8_t hi = (uint8_t)(v >> 8), lo = (uint8_t)v;
+
+		while (n--)
+		{
+			write8(hi);
+			write8(lo);
+		}
+	}
+
+	static inline void write(const uint8_t *p, size_t n)
+	{
+		while (n--)
+		{
+			write8(*p++);
+		}
+	}
+
+	/* 等待最后一个字节移出（切换 DC / CS 之前） */
+	static inline void flush(void)
+	{
+		while ((spi()->SR & (SPI_SR_TXE | SPI_SR_BSY)) != SPI_SR_TXE)
+		{
+		}
+	}
+};
+/* ------------------------------------------------ */
+
+template <class P, class Bus, class Pin>
+struct St77xx
+{
+	static ST77XX_CONSTEXPR int16_t width = P::width;
+	static ST77XX_CONSTEXPR int16_t height = P::height;
+
+	static inline void cmd(uint8_t c)
+	{
+		Bus::flush();
+		Pin::command();
+		Bus::write8(c);
+		Bus::flush();
+		Pin::data();
+	}
+
+	/* 设置窗口并开始写 GRAM（调用前已 select） */
+	static inline void window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+	{
+		cmd(0x2A);		/* CASET */
+		Bus::write16(x0 + P::xstart);
+		Bus::write16(x1 + P::xstart);
+		cmd(0x2B);		/* RASET */
+		Bus::write16(y0 + P::ystart);
+		Bus::write16(y1 + P::ystart);
+		cmd(0x2C);		/* RAMWR */
+	}
+
+	static void init(void)
+	{
+		Bus::enable();
+		Pin::select();
+
+		Pin::reset(true);
+		HAL_Delay(20);
+		Pin::reset(false);
+
+		cmd(0x01);		/* SWRESET */
+		HAL_Delay(150);
+		cmd(0x11);		/* SLPOUT */
+		HAL_Delay(500);
+		cmd(0x3A);		/* COLMOD: 65K, 16 bit */
+		Bus::write8(0x55);
+		HAL_Delay(10);
+		cmd(0x36);		/* MADCTL */
+		Bus::write8(P::madctl);
+		cmd(0x21);		/* INVON */
+		HAL_Delay(10);
+		cmd(0x13);		/* NORON */
+		HAL_Delay(10);
+		cmd(0x29);		/* DISPON */
+		HAL_Delay(10);
+
+		Bus::flush();
+		Pin::unselect();
+	}
+
+	static inline void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+	{
+		if (x < 0) { w += x; x = 0; }
+		if (y < 0) { h += y; y = 0; }
+		if (x + w > width) { w = width - x; }
+		if (y + h > height) { h = height - y; }
+		if ((w <= 0) || (h <= 0))
+		{
+			return;
+		}
+
+		Pin::select();
+		window(x, y, x + w - 1, y + h - 1);
+		Bus::repeat16(color, (uint32_t)w * h);
+		Bus::flush();
+		Pin::unselect();
+	}
+
+	static inline void fillScreen(uint16_t color)
+	{
+		Pin::select();
+		window(0, 0, width - 1, height - 1);
+		Bus::repeat16(color, (uint32_t)width * height);
+		Bus::flush();
+		Pin::unselect();
+	}
+
+	static inline void drawPixel(int16_t x, int16_t y, uint16_t color)
+	{
+		if (((uint16_t)x >= (uint16_t)width) || ((uint16_t)y >= (uint16_t)height))
+		{
+			return;
+		}
+
+		Pin::select();
+		window(x, y, x, y);
+		Bus::write16(color);
+		Bus::flush();
+		Pin::unselect();
+	}
+
+	static inline void drawHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { fillRect(x, y, w, 1, color); }
+	static inline void drawVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { fillRect(x, y, 1, h, color); }
+
+	/* 图像（发送字节序，与 ST7789_DrawImage 相同），必须完全在屏幕内 */
+	static inline void drawImage(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *data)
+	{
+		if ((x < 0) || (y < 0) || (w <= 0) || (h <= 0) || (x + w > width) || (y + h > height))
+		{
+			return;
+		}
+
+		Pin::select();
+		window(x, y, x + w - 1, y + h - 1);
+		Bus::write((const uint8_t *)data, sizeof(uint16_t) * (uint32_t)w * h);
+		Bus::flush();
+		Pin::unselect();
+	}
+};
+
+} /* namespace st77xx */
+
+#endif /* _ST77XX_HPP */
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
@@ -0,0 +1,359 @@
+#include "st77xx_bl.h"
+#include "st77xx_spi.h"
+
+TIM_HandleTypeDef htim2;
+TIM_HandleTypeDef htim3;
+DMA_HandleTypeDef hdma_tim3_up;
+
+// уровень 0...255 -> скважность 0...1000, светлота CIE L* ( равномерно для глаза )
+static const uint16_t ST77XX_BL_Gamma[256] = {
+	   0,    1,    1,    1,    2,    2,    3,    3,    3,    4,    4,    5,    5,    6,    6,    7,
+	   7,    7,    8,    8,    9,    9,   10,   10,   11,   11,   12,   12,   13,   13,   14,   14,
+	  15,   16,   16,   17,   18,   18,   19,   20,   20,   21,   22,   23,   24,   24,   25,   26,
+	  27,   28,   29,   30,   31,   32,   33,   34,   35,   36,   37,   38,   40,   41,   42,   43,
+	  44,   46,   47,   48,   50,   51,   53,   54,   55,   57,   58,   60,   62,   63,   65,   66,
+	  68,   70,   72,   73,   75,   77,   79,   81,   83,   84,   86,   88,   90,   93,   95,   97,
+	  99,  101,  103,  106,  108,  110,  113,  115,  117,  120,  122,  125,  127,  130,  132,  135,
+	 138,  141,  143,  146,  149,  152,  155,  158,  161,  164,  167,  170,  173,  176,  179,  183,
+	 186,  189,  193,  196,  199,  203,  206,  210,  214,  217,  221,  225,  228,  232,  236,  240,
+	 244,  248,  252,  256,  260,  264,  268,  273,  277,  281,  286,  290,  294,  299,  304,  308,
+	 313,  318,  322,  327,  332,  337,  342,  347,  352,  357,  362,  367,  372,  378,  383,  388,
+	 394,  399,  405,  410,  416,  422,  427,  433,  439,  445,  451,  457,  463,  469,  475,  481,
+	 487,  494,  500,  507,  513,  520,  526,  533,  539,  546,  553,  560,  567,  574,  581,  588,
+	 595,  602,  610,  617,  624,  632,  639,  647,  654,  662,  670,  678,  685,  693,  701,  709,
+	 717,  726,  734,  742,  750,  759,  767,  776,  784,  793,  802,  811,  819,  828,  837,  846,
+	 855,  865,  874,  883,  893,  902,  911,  921,  931,  940,  950,  960,  970,  980,  990, 1000};
+
+// ступени плавного изменения, их забирает DMA
+static uint16_t ST77XX_BL_Ramp[ST77XX_BL_RAMP_LEN];
+
+static volatile uint8_t ST77XX_BL_Level;		// текущий уровень ( по окончании плавного изменения )
+static volatile uint8_t ST77XX_BL_Fading;
+static uint8_t ST77XX_BL_From, ST77XX_BL_To;
+static uint16_t ST77XX_BL_Steps;
+
+// автоматическое притушение
+#define BL_STATE_ACTIVE		0
+#define BL_STATE_DIM		1
+#define BL_STATE_OFF		2
+
+static uint8_t ST77XX_BL_Active = 255;			// уровень, заданный пользователем
+static uint8_t ST77XX_BL_State = BL_STATE_ACTIVE;
+static uint32_t ST77XX_BL_DimMs, ST77XX_BL_OffMs;
+static uint8_t ST77XX_BL_DimLevel;
+static uint32_t ST77XX_BL_LastActivity;
+
+//==============================================================================
+// Процедура остановки / запуска ШИМ ( при уровне 0 таймер выключаем )
+//==============================================================================
+static void ST77XX_BL_Power(uint8_t On)
+{
+
+	if (On)
+	{
+		if ((htim2.Instance->CR1 & TIM_CR1_CEN) == 0)
+		{
+			HAL_TIM_PWM_Start(&htim2, TIM_CHANNEL_1);
+		}
+	}
+	else
+	{
+		__HAL_TIM_SET_COMPARE(&htim2, TIM_CHANNEL_1, 0);
+		HAL_TIM_PWM_Stop(&htim2, TIM_CHANNEL_1);
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура окончания плавного изменения ( из прерывания DMA )
+//==============================================================================
+static void ST77XX_BL_FadeDone(DMA_HandleTypeDef *hdma)
+{
+
+	// вызывается только как hdma_tim3_up.XferCpltCallback
+	(void)hdma;
+
+	__HAL_TIM_DISABLE(&htim3);
+	__HAL_TIM_DISABLE_DMA(&htim3, TIM_DMA_UPDATE);
+
+	ST77XX_BL_Level = ST77XX_BL_To;
+	ST77XX_BL_Fading = 0;
+
+	if (ST77XX_BL_Level == 0)
+	{
+		ST77XX_BL_Power(0);
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура инициализации подсветки
+//==============================================================================
+void ST77XX_BL_Init(void)
+{
+
+	GPIO_InitTypeDef GPIO_InitStruct = {0};
+	TIM_OC_InitTypeDef sConfigOC = {0};
+
+	__HAL_RCC_GPIOA_CLK_ENABLE();
+	__HAL_RCC_TIM2_CLK_ENABLE();
+	__HAL_RCC_TIM3_CLK_ENABLE();
+	__HAL_RCC_DMA1_CLK_ENABLE();
+
+	/* TIM2 CH1 -> BLK */
+	GPIO_InitStruct.Pin = BLK_Pin;
+	GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+	HAL_GPIO_Init(BLK_GPIO_Port, &GPIO_InitStruct);
+
+	/* TIM2: PWM */
+	htim2.Instance = TIM2;
+	htim2.Init.Prescaler = 2;
+	htim2.Init.CounterMode = TIM_COUNTERMODE_UP;
+	htim2.Init.Period = ST77XX_BL_PWM_MAX - 1;
+	htim2.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+	htim2.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+	if (HAL_TIM_PWM_Init(&htim2) != HAL_OK)
+	{
+		Error_Handler();
+	}
+
+	sConfigOC.OCMode = TIM_OCMODE_PWM1;
+	sConfigOC.Pulse = ST77XX_BL_Gamma[255];
+	sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
+	sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
+	if (HAL_TIM_PWM_ConfigChannel(&htim2, &sConfigOC, TIM_CHANNEL_1) != HAL_OK)
+	{
+		Error_Handler();
+	}
+
+	/* TIM3: шаг плавного изменения, такт 10 кГц */
+	htim3.Instance = TIM3;
+	htim3.Init.Prescaler = (SystemCoreClock / 10000) - 1;
+	htim3.Init.CounterMode = TIM_COUNTERMODE_UP;
+	htim3.Init.Period = 9;
+	htim3.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+	htim3.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+	if (HAL_TIM_Base_Init(&htim3) != HAL_OK)
+	{
+		Error_Handler();
+	}
+
+	/* TIM3_UP DMA: DMA1 channel 3, ступени -> TIM2->CCR1 */
+	hdma_tim3_up.Instance = DMA1_Channel3;
+	hdma_tim3_up.Init.Direction = DMA_MEMORY_TO_PERIPH;
+	hdma_tim3_up.Init.PeriphInc = DMA_PINC_DISABLE;
+	hdma_tim3_up.Init.MemInc = DMA_MINC_ENABLE;
+	hdma_tim3_up.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+	hdma_tim3_up.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+	hdma_tim3_up.Init.Mode = DMA_NORMAL;
+	hdma_tim3_up.Init.Priority = DMA_PRIORITY_LOW;
+	if (HAL_DMA_Init(&hdma_tim3_up) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	hdma_tim3_up.XferCpltCallback = ST77XX_BL_FadeDone;
+
+	HAL_NVIC_SetPriority(DMA1_Channel3_IRQn, 3, 0);
+	HAL_NVIC_EnableIRQ(DMA1_Channel3_IRQn);
+
+	ST77XX_BL_Level = 255;
+	ST77XX_BL_Active = 255;
+	ST77XX_BL_State = BL_STATE_ACTIVE;
+	ST77XX_BL_LastActivity = HAL_GetTick();
+
+	HAL_TIM_PWM_Start(&htim2, TIM_CHANNEL_1);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура остановки идущего плавного изменения, уровень - по числу пройденных ступеней
+//==============================================================================
+static void ST77XX_BL_Stop(void)
+{
+
+	uint16_t done;
+
+	if (!ST77XX_BL_Fading)
+	{
+		return;
+	}
+
+	__HAL_TIM_DISABLE(&htim3);
+	__HAL_TIM_DISABLE_DMA(&htim3, TIM_DMA_UPDATE);
+	HAL_DMA_Abort(&hdma_tim3_up);
+
+	done = ST77XX_BL_Steps - __HAL_DMA_GET_COUNTER(&hdma_tim3_up);
+
+	ST77XX_BL_Level = (uint8_t)(ST77XX_BL_From + ((int32_t)ST77XX_BL_To - ST77XX_BL_From) * done / ST77XX_BL_Steps);
+	ST77XX_BL_Fading = 0;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура запуска плавного изменения ( без изменения состояния автопритушения )
+//==============================================================================
+static void ST77XX_BL_StartFade(uint8_t level, uint16_t ms)
+{
+
+	uint32_t ticks = (uint32_t)ms * 10;		// такты TIM3 ( 10 кГц )
+	uint16_t n = ST77XX_BL_RAMP_LEN, i;
+	uint32_t period;
+
+	ST77XX_BL_Stop();
+
+	if ((ticks < 2) || (level == ST77XX_BL_Level))
+	{
+		if (level)
+		{
+			__HAL_TIM_SET_COMPARE(&htim2, TIM_CHANNEL_1, ST77XX_BL_Gamma[level]);
+		}
+		ST77XX_BL_Power(level != 0);
+		ST77XX_BL_Level = level;
+		return;
+	}
+
+	// не короче 2 тактов на ступень
+	if (ticks < 2 * n)
+	{
+		n = ticks / 2;
+	}
+	period = ticks / n;
+	if (period > 0x10000)
+	{
+		period = 0x10000;
+	}
+
+	ST77XX_BL_From = ST77XX_BL_Level;
+	ST77XX_BL_To = level;
+	ST77XX_BL_Steps = n;
+
+	for (i = 0; i < n; i++)
+	{
+		ST77XX_BL_Ramp[i] = ST77XX_BL_Gamma[ST77XX_BL_From + ((int32_t)level - ST77XX_BL_From) * (i + 1) / n];
+	}
+
+	ST77XX_BL_Power(1);
+	ST77XX_BL_Fading = 1;
+
+	__HAL_TIM_SET_AUTORELOAD(&htim3, period - 1);
+	__HAL_TIM_SET_COUNTER(&htim3, 0);
+	__HAL_TIM_CLEAR_FLAG(&htim3, TIM_FLAG_UPDATE);
+
+	HAL_DMA_Start_IT(&hdma_tim3_up, (uint32_t)ST77XX_BL_Ramp, (uint32_t)&htim2.Instance->CCR1, n);
+
+	__HAL_TIM_ENABLE_DMA(&htim3, TIM_DMA_UPDATE);
+	__HAL_TIM_ENABLE(&htim3);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура установки яркости сразу
+//==============================================================================
+void ST77XX_BL_Set(uint8_t level)
+{
+
+	ST77XX_BL_Fade(level, 0);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура плавного изменения яркости ( уровень пользователя )
+//==============================================================================
+void ST77XX_BL_Fade(uint8_t level, uint16_t ms)
+{
+
+	ST77XX_BL_Active = level;
+	ST77XX_BL_State = BL_STATE_ACTIVE;
+	ST77XX_BL_LastActivity = HAL_GetTick();
+
+	ST77XX_BL_StartFade(level, ms);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура чтения текущей яркости
+//==============================================================================
+uint8_t ST77XX_BL_Get(void)
+{
+
+	uint16_t done;
+
+	if (!ST77XX_BL_Fading)
+	{
+		return ST77XX_BL_Level;
+	}
+
+	done = ST77XX_BL_Steps - __HAL_DMA_GET_COUNTER(&hdma_tim3_up);
+
+	return (uint8_t)(ST77XX_BL_From + ((int32_t)ST77XX_BL_To - ST77XX_BL_From) * done / ST77XX_BL_Steps);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура проверки идущего плавного изменения
+//==============================================================================
+uint8_t ST77XX_BL_IsFading(void)
+{
+
+	return ST77XX_BL_Fading;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура настройки автоматического притушения
+//==============================================================================
+void ST77XX_BL_AutoDim(uint32_t dim_ms, uint8_t dim_level, uint32_t off_ms)
+{
+
+	ST77XX_BL_DimMs = dim_ms;
+	ST77XX_BL_DimLevel = dim_level;
+	ST77XX_BL_OffMs = off_ms;
+	ST77XX_BL_LastActivity = HAL_GetTick();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура отметки действия пользователя
+//==============================================================================
+void ST77XX_BL_Activity(void)
+{
+
+	ST77XX_BL_LastActivity = HAL_GetTick();
+
+	if (ST77XX_BL_State != BL_STATE_ACTIVE)
+	{
+		ST77XX_BL_State = BL_STATE_ACTIVE;
+		ST77XX_BL_StartFade(ST77XX_BL_Active, ST77XX_BL_WAKE_FADE_MS);
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура автоматического притушения ( вызывать в основном цикле )
+//==============================================================================
+void ST77XX_BL_Process(void)
+{
+
+	uint32_t idle = HAL_GetTick() - ST77XX_BL_LastActivity;
+
+	if (ST77XX_BL_OffMs && (idle >= ST77XX_BL_OffMs))
+	{
+		if (ST77XX_BL_State != BL_STATE_OFF)
+		{
+			ST77XX_BL_State = BL_STATE_OFF;
+			ST77XX_BL_StartFade(0, ST77XX_BL_DIM_FADE_MS);
+		}
+	}
+	else if (ST77XX_BL_DimMs && (idle >= ST77XX_BL_DimMs))
+	{
+		if ((ST77XX_BL_State == BL_STATE_ACTIVE) && (ST77XX_BL_DimLevel < ST77XX_BL_Active))
+		{
+			ST77XX_BL_State = BL_STATE_DIM;
+			ST77XX_BL_StartFade(ST77XX_BL_DimLevel, ST77XX_BL_DIM_FADE_MS);
+		}
+	}
+}
+//==============================================================================
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
@@ -0,0 +1,60 @@
+#ifndef _ST77XX_BL_H
+#define _ST77XX_BL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* 背光：BLK（PA0）= TIM2_CH1 PWM，24 kHz，占空比 0...ST77XX_BL_PWM_MAX。
+   亮度等级 0...255 经 CIE L* 感知伽马表转换为占空比。
+
+   渐变：预先计算的占空比序列由 DMA（DMA1 通道 3，TIM3_UP 触发）
+   逐步写入 TIM2->CCR1，TIM3 决定每一步的时间，渐变过程中 CPU 不参与。
+   亮度为 0 时停止 PWM 定时器，BLK 保持低电平。
+
+   自动调暗：无操作 dim_ms 后渐变到 dim_level，off_ms 后关闭；
+   ST77XX_BL_Activity() 恢复亮度。ST77XX_BL_Process() 在主循环中调用。 */
+
+#define ST77XX_BL_PWM_MAX			1000		/* 72 MHz / 3 / 1000 = 24 kHz */
+#define ST77XX_BL_RAMP_LEN			64			/* 渐变的最大步数 */
+#define ST77XX_BL_DIM_FADE_MS		1000		/* 自动调暗 / 关闭的渐变时间 */
+#define ST77XX_BL_WAKE_FADE_MS		150			/* 恢复亮度的渐变时间 */
+/* ------------------------------------------------ */
+
+extern TIM_HandleTypeDef htim2;
+extern TIM_HandleTypeDef htim3;
+extern DMA_HandleTypeDef hdma_tim3_up;
+
+/* 初始化 PWM、渐变定时器和 DMA，亮度为最大 */
+void ST77XX_BL_Init(void);
+
+/* 立即设置亮度 0...255 */
+void ST77XX_BL_Set(uint8_t level);
+
+/* 在 ms 毫秒内渐变到 level，立即返回；正在进行的渐变被中断，从当前亮度继续 */
+void ST77XX_BL_Fade(uint8_t level, uint16_t ms);
+
+/* 当前亮度（渐变过程中为当前步） */
+uint8_t ST77XX_BL_Get(void);
+
+/* 渐变是否在进行 */
+uint8_t ST77XX_BL_IsFading(void);
+
+/* 自动调暗：0 表示不使用该阶段 */
+void ST77XX_BL_AutoDim(uint32_t dim_ms, uint8_t dim_level, uint32_t off_ms);
+
+/* 用户操作（按键、触摸），恢复亮度并重新计时 */
+void ST77XX_BL_Activity(void);
+
+/* 自动调暗处理，在主循环中调用 */
+void ST77XX_BL_Process(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ST77XX_BL_H */
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
@@ -0,0 +1,125 @@
+#include "st77xx_color.h"
+#include "arm_math.h"
+
+// пороги упорядоченного дизеринга 4x4 ( Bayer ), 0..15
+static const uint8_t ST77XX_Bayer4x4[4][4] = {
+	{ 0,  8,  2, 10},
+	{12,  4, 14,  6},
+	{ 3, 11,  1,  9},
+	{15,  7, 13,  5}};
+
+// перестановка байт в обеих половинах слова ( на Cortex-M собирается в REV16 )
+#define ST77XX_SWAP_PAIR(v) ((((v) >> 8) & 0x00FF00FFUL) | (((v) << 8) & 0xFF00FF00UL))
+
+//==============================================================================
+// Процедура вспомогательная - упаковка 8-битных каналов в RGB565
+// d - порог дизеринга 0..15: 5-битные каналы получают d/2, 6-битный зеленый d/4
+//==============================================================================
+static __INLINE uint32_t ST77XX_Pack565(uint32_t r, uint32_t g, uint32_t b, uint32_t d)
+{
+
+	if (d)
+	{
+		r += d >> 1;
+		g += d >> 2;
+		b += d >> 1;
+
+		if (r > 255)
+		{
+			r = 255;
+		}
+		if (g > 255)
+		{
+			g = 255;
+		}
+		if (b > 255)
+		{
+			b = 255;
+		}
+	}
+
+	return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+//==============================================================================
+
+//==============================================================================
+// Общий цикл преобразования: по два пикселя, упакованных в одно слово ( __PKHBT ),
+// перестановка байт для дисплея делается сразу для пары
+//==============================================================================
+#define ST77XX_CONV_LOOP(STEP, R0, G0, B0, R1, G1, B1)                                       \
+	{                                                                                        \
+		const uint8_t *pBayer = ST77XX_Bayer4x4[y & 3];                                      \
+		const uint32_t dither = (flags & ST77XX_CONV_DITHER);                                 \
+		uint32_t c0, c1, pair;                                                               \
+                                                                                             \
+		while (count >= 2)                                                                   \
+		{                                                                                    \
+			c0 = ST77XX_Pack565(R0, G0, B0, dither ? pBayer[x & 3] : 0);                     \
+			c1 = ST77XX_Pack565(R1, G1, B1, dither ? pBayer[(x + 1) & 3] : 0);               \
+                                                                                             \
+			pair = (uint32_t)__PKHBT(c0, c1, 16);                                            \
+			if (flags & ST77XX_CONV_SWAP)                                                    \
+			{                                                                                \
+				pair = ST77XX_SWAP_PAIR(pair);                                               \
+			}                                                                                \
+			*__SIMD32(pDst)++ = (int32_t)pair;                                               \
+                                                                                             \
+			pSrc += 2 * (STEP);                                                              \
+			x += 2;                                                                          \
+			count -= 2;                                                                      \
+		}                                                                                    \
+                                                                                             \
+		if (count)                                                                           \
+		{                                                                                    \
+			c0 = ST77XX_Pack565(R0, G0, B0, dither ? pBayer[x & 3] : 0);                     \
+			if (flags & ST77XX_CONV_SWAP)                                                    \
+			{                                                                                \
+				c0 = ((c0 >> 8) | (c0 << 8)) & 0xFFFF;                                       \
+			}                                                                                \
+			*pDst = (uint16_t)c0;                                                            \
+		}                                                                                    \
+	}
+
+//==============================================================================
+// Процедура преобразования RGB888 ( R, G, B по байту ) в RGB565
+//==============================================================================
+void ST77XX_ConvRGB888(const uint8_t *pSrc, uint16_t *pDst, uint32_t count, uint16_t x, uint16_t y, uint8_t flags)
+{
+
+	ST77XX_CONV_LOOP(3, pSrc[0], pSrc[1], pSrc[2], pSrc[3], pSrc[4], pSrc[5])
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура преобразования BGR888 ( порядок BMP ) в RGB565
+//==============================================================================
+void ST77XX_ConvBGR888(const uint8_t *pSrc, uint16_t *pDst, uint32_t count, uint16_t x, uint16_t y, uint8_t flags)
+{
+
+	ST77XX_CONV_LOOP(3, pSrc[2], pSrc[1], pSrc[0], pSrc[5], pSrc[4], pSrc[3])
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура преобразования ARGB8888 в RGB565 ( альфа отбрасывается )
+//==============================================================================
+void ST77XX_ConvARGB8888(const uint32_t *pSrc, uint16_t *pDst, uint32_t count, uint16_t x, uint16_t y, uint8_t flags)
+{
+
+	ST77XX_CONV_LOOP(1,
+					 (pSrc[0] >> 16) & 0xFF, (pSrc[0] >> 8) & 0xFF, pSrc[0] & 0xFF,
+					 (pSrc[1] >> 16) & 0xFF, (pSrc[1] >> 8) & 0xFF, pSrc[1] & 0xFF)
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура преобразования 8-битных оттенков серого в RGB565
+//==============================================================================
+void ST77XX_ConvGray8(const uint8_t *pSrc, uint16_t *pDst, uint32_t count, uint16_t x, uint16_t y, uint8_t flags)
+{
+
+	ST77XX_CONV_LOOP(1, pSrc[0], pSrc[0], pSrc[0], pSrc[1], pSrc[1], pSrc[1])
+}
+//==============================================================================
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
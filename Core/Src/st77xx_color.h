@@ -0,0 +1,32 @@
+#ifndef _ST77XX_COLOR_H
+#define _ST77XX_COLOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* 转换选项 */
+#define ST77XX_CONV_SWAP		0x01	/* 输出按发送顺序（高字节在前），可直接交给 SendDataMASS */
+#define ST77XX_CONV_DITHER		0x02	/* 4x4 有序抖动（Bayer） */
+/* ------------------------------------------------ */
+
+/* 批量颜色转换为 RGB565
+   x, y 为第一个像素在屏幕上的坐标，只用于抖动矩阵定位 */
+void ST77XX_ConvRGB888(const uint8_t *pSrc, uint16_t *pDst, uint32_t count, uint16_t x, uint16_t y, uint8_t flags);
+void ST77XX_ConvBGR888(const uint8_t *pSrc, uint16_t *pDst, uint32_t count, uint16_t x, uint16_t y, uint8_t flags);
+
+/* ARGB8888（每像素一个 uint32_t），alpha 通道被忽略 */
+void ST77XX_ConvARGB8888(const uint32_t *pSrc, uint16_t *pDst, uint32_t count, uint16_t x, uint16_t y, uint8_t flags);
+
+/* 8 位灰度 */
+void ST77XX_ConvGray8(const uint8_t *pSrc, uint16_t *pDst, uint32_t count, uint16_t x, uint16_t y, uint8_t flags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ST77XX_COLOR_H */
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
@@ -0,0 +1,24 @@
+#ifndef _ST77XX_CYCLES_H
+#define _ST77XX_CYCLES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+/* 计时用的周期计数器（Cortex-M3 DWT，SystemCoreClock），
+   各模块的耗时统计共用，可在编译选项中替换 */
+#ifndef ST77XX_CYCLES
+	#define ST77XX_CYCLES_INIT()	do { CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk; } while (0)
+	#define ST77XX_CYCLES()			(DWT->CYCCNT)
+#endif
+/* ------------------------------------------------ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ST77XX_CYCLES_H */
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
@@ -20,6 +20,7 @@ extern "C" {
 #define BLK_Pin			GPIO_PIN_0
 
 extern SPI_HandleTypeDef hspi2;
+extern DMA_HandleTypeDef hdma_spi2_tx;
 
 void ST77XX_SPI_Init(void);
 void ST77XX_GPIO_Init(void);
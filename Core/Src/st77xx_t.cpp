@@ -0,0 +1,158 @@
+#include "st77xx_t.h"
+#include "st77xx.hpp"
+
+// выводы те же, что в st77xx_spi.h ( параметрам шаблона нужны адреса портов, а не указатели )
+typedef st77xx::Pins<GPIOA_BASE, CS_Pin, GPIOA_BASE, DC_Pin, GPIOA_BASE, RST_Pin> ST77XX_T_Pins;
+typedef st77xx::SpiBus<SPI2_BASE> ST77XX_T_Bus;
+
+#if defined(ST7789_IS_135X240)
+typedef st77xx::ST7789_135x240<2> ST77XX_T_Panel;
+#elif defined(ST7789_IS_240X240)
+typedef st77xx::ST7789_240x240<2> ST77XX_T_Panel;
+#elif defined(ST7789_IS_240X320)
+typedef st77xx::ST7789_240x320<2> ST77XX_T_Panel;
+#endif
+
+typedef st77xx::St77xx<ST77XX_T_Panel, ST77XX_T_Bus, ST77XX_T_Pins> Display;
+
+//==============================================================================
+// Процедура инициализации
+//==============================================================================
+void ST77XX_T_Init(void)
+{
+
+	ST77XX_GPIO_Init();
+	ST77XX_SPI_Init();
+
+	ST77XX_BL_Init();
+	HAL_Delay(300);
+
+	Display::init();
+	Display::fillScreen(0);
+
+	// глобальные размеры для функций C-драйвера, которые их читают
+	ST7789_Width = Display::width;
+	ST7789_Height = Display::height;
+	ST7789_X_Start = ST77XX_T_Panel::xstart;
+	ST7789_Y_Start = ST77XX_T_Panel::ystart;
+}
+//==============================================================================
+
+//==============================================================================
+// Обертки для C
+//==============================================================================
+void ST77XX_T_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+
+	Display::fillRect(x, y, w, h, color);
+}
+
+void ST77XX_T_FillScreen(uint16_t color)
+{
+
+	Display::fillScreen(color);
+}
+
+void ST77XX_T_DrawPixel(int16_t x, int16_t y, uint16_t color)
+{
+
+	Display::drawPixel(x, y, color);
+}
+
+void ST77XX_T_DrawHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+
+	Display::drawHLine(x, y, w, color);
+}
+
+void ST77XX_T_DrawVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+
+	Display::drawVLine(x, y, h, color);
+}
+
+void ST77XX_T_DrawImage(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *data)
+{
+
+	Display::drawImage(x, y, w, h, data);
+}
+
+uint16_t ST77XX_T_Width(void)
+{
+
+	return Display::width;
+}
+
+uint16_t ST77XX_T_Height(void)
+{
+
+	return Display::height;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура сравнения C-драйвера и шаблона ( одинаковые операции, циклы CPU )
+//==============================================================================
+void ST77XX_T_Benchmark(ST77XX_T_Bench_t *bench)
+{
+
+	uint32_t t0;
+	int16_t i;
+
+	ST77XX_CYCLES_INIT();
+
+	ST7789_WaitDMA();
+
+	t0 = ST77XX_CYCLES();
+	for (i = 0; i < 1000; i++)
+	{
+		ST7789_DrawPixel(i % Display::width, i % Display::height, ST7789_WHITE);
+	}
+	bench->c_pixels = ST77XX_CYCLES() - t0;
+
+	t0 = ST77XX_CYCLES();
+	for (i = 0; i < 1000; i++)
+	{
+		Display::drawPixel(i % Display::width, i % Display::height, ST7789_WHITE);
+	}
+	bench->t_pixels = ST77XX_CYCLES() - t0;
+
+	t0 = ST77XX_CYCLES();
+	for (i = 0; i < 100; i++)
+	{
+		ST7789_FillRect((i * 8) % (Display::width - 8), (i * 4) % (Display::height - 8), 8, 8, ST7789_RED);
+	}
+	bench->c_small = ST77XX_CYCLES() - t0;
+
+	t0 = ST77XX_CYCLES();
+	for (i = 0; i < 100; i++)
+	{
+		Display::fillRect((i * 8) % (Display::width - 8), (i * 4) % (Display::height - 8), 8, 8, ST7789_RED);
+	}
+	bench->t_small = ST77XX_CYCLES() - t0;
+
+	t0 = ST77XX_CYCLES();
+	for (i = 0; i < 100; i++)
+	{
+		ST7789_DrawHLine(0, i % Display::height, 64, ST7789_GREEN);
+	}
+	bench->c_hline = ST77XX_CYCLES() - t0;
+
+	t0 = ST77XX_CYCLES();
+	for (i = 0; i < 100; i++)
+	{
+		Display::drawHLine(0, i % Display::height, 64, ST7789_GREEN);
+	}
+	bench->t_hline = ST77XX_CYCLES() - t0;
+
+	t0 = ST77XX_CYCLES();
+	ST7789_FillRect(0, 0, Display::width, Display::height, ST7789_BLUE);
+	bench->c_screen = ST77XX_CYCLES() - t0;
+
+	t0 = ST77XX_CYCLES();
+	Display::fillRect(0, 0, Display::width, Display::height, ST7789_BLUE);
+	bench->t_screen = ST77XX_CYCLES() - t0;
+}
+//==============================================================================
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
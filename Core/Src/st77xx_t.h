@@ -0,0 +1,49 @@
+#ifndef _ST77XX_T_H
+#define _ST77XX_T_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "st7789.h"
+#include "st77xx_cycles.h"
+
+/* C 语言使用的 St77xx<Panel, Bus, Pins>（st77xx.hpp）包装函数，实现在 st77xx_t.cpp。
+   面板与 st7789.h 中选择的 ST7789_IS_xxx 相同，方向与 ST7789_Init() 相同（rotation 2），
+   引脚与 st77xx_spi.h 相同，SPI 直接使用寄存器。
+
+   生成代码大小在链接 map 文件的 Image Symbol Table 中比较：
+   ST77XX_T_FillRect / ST77XX_T_DrawPixel 与 ST7789_FillRect / ST7789_DrawPixel
+   （以及后者调用的 ST7789_SetWindow、ST7789_RamFill、ST7789_SendCmd ...）。 */
+
+/* 初始化 GPIO / SPI 和显示器（代替 ST7789_Init） */
+void ST77XX_T_Init(void);
+
+void ST77XX_T_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void ST77XX_T_FillScreen(uint16_t color);
+void ST77XX_T_DrawPixel(int16_t x, int16_t y, uint16_t color);
+void ST77XX_T_DrawHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+void ST77XX_T_DrawVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+void ST77XX_T_DrawImage(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *data);
+
+/* 逻辑尺寸（编译时常数） */
+uint16_t ST77XX_T_Width(void);
+uint16_t ST77XX_T_Height(void);
+
+/* 基准测试：同样的操作分别用 C 驱动（ST7789_xxx）和模板执行，单位 CPU 周期 */
+typedef struct {
+	uint32_t c_pixels, t_pixels;			/* 1000 次 DrawPixel */
+	uint32_t c_small, t_small;				/* 100 次 FillRect 8 x 8 */
+	uint32_t c_screen, t_screen;			/* 1 次整屏 FillRect */
+	uint32_t c_hline, t_hline;				/* 100 次 DrawHLine 64 像素 */
+} ST77XX_T_Bench_t;
+
+void ST77XX_T_Benchmark(ST77XX_T_Bench_t *bench);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ST77XX_T_H */
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
@@ -0,0 +1,297 @@
+#include "st77xx_trace.h"
+
+#ifdef ST77XX_TRACE
+
+#include <string.h>
+
+#if !defined(__arm__)
+	#include <time.h>
+#endif
+
+ST77XX_TraceBus_t ST77XX_Trace_Bus;
+
+static ST77XX_TraceCounter_t ST77XX_Trace_Counters[ST77XX_TR_COUNT];
+static ST77XX_TraceRec_t ST77XX_Trace_Ring[ST77XX_TRACE_RING];
+static uint32_t ST77XX_Trace_Head;			// всего записей ( индекс = Head % RING )
+static uint32_t ST77XX_Trace_Mask = 0xFFFFFFFF;
+static uint8_t ST77XX_Trace_On = 1;
+static uint8_t ST77XX_Trace_Started;
+
+static const char ST77XX_Trace_Names[ST77XX_TR_COUNT][16] = {
+	"FillRect", "FillScreen", "DrawPixel", "DrawLine", "DrawHLine", "DrawRectangle", "RectFilled",
+	"DrawTriangle", "TriangleFilled", "DrawCircle", "CircleFilled", "DrawRoundRect", "RoundRectFilled",
+	"DrawRing", "DrawChar", "print", "DrawImage", "ImageScaled", "ImageAffine", "DrawBitmap",
+	"Blend", "ReadWindow"};
+
+#if !defined(__arm__)
+//==============================================================================
+// Процедура часов для симуляции на ПК ( наносекунды )
+//==============================================================================
+uint32_t ST77XX_Trace_HostClock(void)
+{
+
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+//==============================================================================
+#endif
+
+//==============================================================================
+// Процедура вспомогательная - номер корзины гистограммы ( floor(log2(dt)) )
+//==============================================================================
+static uint32_t ST77XX_Trace_Bucket(uint32_t dt)
+{
+
+	uint32_t b;
+
+	if (dt == 0)
+	{
+		return 0;
+	}
+
+#if defined(__arm__)
+	b = 31 - __CLZ(dt);
+#else
+	b = 0;
+	while (dt >>= 1)
+	{
+		b++;
+	}
+#endif
+
+	return (b >= ST77XX_TRACE_HIST) ? (ST77XX_TRACE_HIST - 1) : b;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура начала примитива - снимок счетчиков шины и времени
+//==============================================================================
+void ST77XX_Trace_Begin(ST77XX_TraceMark_t *m, uint8_t id)
+{
+
+	if (!ST77XX_Trace_On || (id >= ST77XX_TR_COUNT))
+	{
+		m->id = ST77XX_TR_NONE;
+		return;
+	}
+
+	if (!ST77XX_Trace_Started)
+	{
+		ST77XX_TRACE_CLOCK_INIT();
+		ST77XX_Trace_Started = 1;
+	}
+
+	ST77XX_Trace_Counters[id].calls++;
+
+	m->id = id;
+	m->bytes = ST77XX_Trace_Bus.bytes;
+	m->xfers = ST77XX_Trace_Bus.xfers;
+	m->windows = ST77XX_Trace_Bus.windows;
+	m->gram_bytes = ST77XX_Trace_Bus.gram_bytes;
+	m->t0 = ST77XX_TRACE_CLOCK();
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура конца примитива - разности счетчиков, гистограмма, запись в кольцо
+//==============================================================================
+void ST77XX_Trace_End(ST77XX_TraceMark_t *m)
+{
+
+	uint32_t dt = ST77XX_TRACE_CLOCK() - m->t0;
+	uint32_t pixels, windows;
+	ST77XX_TraceCounter_t *c;
+	ST77XX_TraceRec_t *r;
+
+	if (m->id == ST77XX_TR_NONE)
+	{
+		return;
+	}
+
+	c = &ST77XX_Trace_Counters[m->id];
+
+	pixels = (ST77XX_Trace_Bus.gram_bytes - m->gram_bytes) / 2;
+	windows = ST77XX_Trace_Bus.windows - m->windows;
+
+	c->pixels += pixels;
+	c->bytes += ST77XX_Trace_Bus.bytes - m->bytes;
+	c->xfers += ST77XX_Trace_Bus.xfers - m->xfers;
+	c->windows += windows;
+	c->cycles += dt;
+	if (dt > c->cycles_max)
+	{
+		c->cycles_max = dt;
+	}
+	c->hist[ST77XX_Trace_Bucket(dt)]++;
+
+	if (ST77XX_Trace_Mask & (1UL << m->id))
+	{
+		r = &ST77XX_Trace_Ring[ST77XX_Trace_Head & (ST77XX_TRACE_RING - 1)];
+		r->t0 = m->t0;
+		r->dt = dt;
+		r->id = m->id;
+		r->windows = (windows > 0xFF) ? 0xFF : (uint8_t)windows;
+		r->pixels = (pixels > 0xFFFF) ? 0xFFFF : (uint16_t)pixels;
+		ST77XX_Trace_Head++;
+	}
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура сброса
+//==============================================================================
+void ST77XX_Trace_Reset(void)
+{
+
+	memset(ST77XX_Trace_Counters, 0, sizeof(ST77XX_Trace_Counters));
+	memset(&ST77XX_Trace_Bus, 0, sizeof(ST77XX_Trace_Bus));
+	ST77XX_Trace_Head = 0;
+	ST77XX_Trace_On = 1;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура паузы / продолжения
+//==============================================================================
+void ST77XX_Trace_Enable(uint8_t on)
+{
+
+	ST77XX_Trace_On = on;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура выбора примитивов для кольцевого буфера
+//==============================================================================
+void ST77XX_Trace_Filter(uint32_t mask)
+{
+
+	ST77XX_Trace_Mask = mask;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура чтения счетчиков примитива
+//==============================================================================
+const ST77XX_TraceCounter_t *ST77XX_Trace_Get(uint8_t id)
+{
+
+	return (id < ST77XX_TR_COUNT) ? &ST77XX_Trace_Counters[id] : NULL;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура имени примитива
+//==============================================================================
+const char *ST77XX_Trace_Name(uint8_t id)
+{
+
+	return (id < ST77XX_TR_COUNT) ? ST77XX_Trace_Names[id] : "?";
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура оценки процентиля задержки по гистограмме
+//==============================================================================
+uint32_t ST77XX_Trace_Percentile(uint8_t id, uint8_t pct)
+{
+
+	const ST77XX_TraceCounter_t *c = ST77XX_Trace_Get(id);
+	uint32_t total = 0, need, sum = 0, k;
+
+	if (c == NULL)
+	{
+		return 0;
+	}
+
+	for (k = 0; k < ST77XX_TRACE_HIST; k++)
+	{
+		total += c->hist[k];
+	}
+
+	if (total == 0)
+	{
+		return 0;
+	}
+
+	need = (uint32_t)(((uint64_t)total * pct + 99) / 100);
+
+	for (k = 0; k < ST77XX_TRACE_HIST - 1; k++)
+	{
+		sum += c->hist[k];
+		if (sum >= need)
+		{
+			return (2UL << k) - 1;
+		}
+	}
+
+	// последняя корзина не ограничена сверху
+	return c->cycles_max;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура выгрузки: заголовок, таблица счетчиков, кольцо от старых к новым
+//==============================================================================
+uint32_t ST77XX_Trace_Dump(ST77XX_TraceWrite_t write, void *ctx)
+{
+
+	ST77XX_TraceHeader_t h;
+	uint32_t i, first, n, idx, len = 0;
+	uint8_t on = ST77XX_Trace_On;
+
+	ST77XX_Trace_On = 0;
+
+	n = (ST77XX_Trace_Head > ST77XX_TRACE_RING) ? ST77XX_TRACE_RING : ST77XX_Trace_Head;
+	first = ST77XX_Trace_Head - n;
+
+	memset(&h, 0, sizeof(h));
+	h.magic = ST77XX_TRACE_MAGIC;
+	h.version = ST77XX_TRACE_VERSION;
+	h.count = ST77XX_TR_COUNT;
+	h.hist = ST77XX_TRACE_HIST;
+	h.counter_size = sizeof(ST77XX_TraceCounter_t);
+	h.rec_size = sizeof(ST77XX_TraceRec_t);
+	h.hz = ST77XX_TRACE_HZ;
+	h.records = n;
+	h.dropped = first;
+
+	write(&h, sizeof(h), ctx);
+	len += sizeof(h);
+
+	for (i = 0; i < ST77XX_TR_COUNT; i++)
+	{
+		write(ST77XX_Trace_Names[i], sizeof(ST77XX_Trace_Names[i]), ctx);
+		write(&ST77XX_Trace_Counters[i], sizeof(ST77XX_TraceCounter_t), ctx);
+		len += sizeof(ST77XX_Trace_Names[i]) + sizeof(ST77XX_TraceCounter_t);
+	}
+
+	// кольцо может переходить через конец массива - не больше двух кусков
+	while (n)
+	{
+		idx = first & (ST77XX_TRACE_RING - 1);
+		i = ST77XX_TRACE_RING - idx;
+		if (i > n)
+		{
+			i = n;
+		}
+
+		write(&ST77XX_Trace_Ring[idx], i * sizeof(ST77XX_TraceRec_t), ctx);
+		len += i * sizeof(ST77XX_TraceRec_t);
+
+		first += i;
+		n -= i;
+	}
+
+	ST77XX_Trace_On = on;
+
+	return len;
+}
+//==============================================================================
+
+#endif /* ST77XX_TRACE */
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
@@ -0,0 +1,196 @@
+#ifndef _ST77XX_TRACE_H
+#define _ST77XX_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+#include "st77xx_cycles.h"
+
+/* 绘图 API 统计和跟踪（可选，编译时打开）。
+
+   定义 ST77XX_TRACE 后，ST7789 / ST7735 驱动的每个图元统计：
+     calls    - 调用次数（包括因超出屏幕被丢弃的调用）
+     pixels   - 写入 GRAM 的像素（RAMWR 之后的数据字节 / 2）
+     bytes    - SPI 字节（命令 + 参数 + 数据，读 GRAM 也计入）
+     xfers    - SPI 传输次数（每次 SendCmd / SendData / SendDataMASS / DMA 启动）
+     windows  - SetWindow 次数（CASET + RASET + RAMWR 往返）
+     cycles   - 时钟计数，另有 log2 延时直方图
+   统计包含嵌套调用：DrawCircle 的数字包括它调用的 DrawPixel，DrawPixel 也单独计数。
+   ST7789 和 ST7735 共用同一张表。
+
+   每次调用另外写入二进制环形缓冲区（12 字节一条，满了覆盖最旧的），
+   ST77XX_Trace_Filter() 可以只记录部分图元。
+
+   时钟：目标板上为 ST77XX_CYCLES()（st77xx_cycles.h，DWT->CYCCNT），主机仿真时为 clock_gettime 纳秒；
+   可在编译选项中替换 ST77XX_TRACE_CLOCK / ST77XX_TRACE_HZ。
+
+   导出：ST77XX_Trace_Dump() 把文件头、统计表和环形缓冲区依次交给写函数
+   （UART：HAL_UART_Transmit；主机：fwrite），Tools/st77xx_tracedump.c 把它转换成表格 / CSV。
+
+   未定义 ST77XX_TRACE 时钩子宏为空，st77xx_trace.c 不产生代码。 */
+
+//#define ST77XX_TRACE
+
+#define ST77XX_TRACE_RING			256			/* 环形缓冲区条数，2 的幂 */
+#define ST77XX_TRACE_HIST			20			/* 直方图：桶 k = [2^k, 2^(k+1)) 个时钟，最后一个桶不封顶 */
+#define ST77XX_TRACE_MAGIC			0x52543753	/* "S7TR" */
+#define ST77XX_TRACE_VERSION		1
+/* ------------------------------------------------ */
+
+/* 图元编号（导出文件中同时带名字） */
+enum {
+	ST77XX_TR_FILLRECT = 0,
+	ST77XX_TR_FILLSCREEN,
+	ST77XX_TR_PIXEL,
+	ST77XX_TR_LINE,
+	ST77XX_TR_HLINE,
+	ST77XX_TR_RECT,
+	ST77XX_TR_RECTFILLED,
+	ST77XX_TR_TRIANGLE,
+	ST77XX_TR_TRIANGLEFILLED,
+	ST77XX_TR_CIRCLE,
+	ST77XX_TR_CIRCLEFILLED,
+	ST77XX_TR_ROUNDRECT,
+	ST77XX_TR_ROUNDRECTFILLED,
+	ST77XX_TR_RING,
+	ST77XX_TR_CHAR,
+	ST77XX_TR_PRINT,
+	ST77XX_TR_IMAGE,
+	ST77XX_TR_IMAGESCALED,
+	ST77XX_TR_IMAGEAFFINE,
+	ST77XX_TR_BITMAP,
+	ST77XX_TR_BLEND,
+	ST77XX_TR_READ,
+	ST77XX_TR_COUNT,
+	ST77XX_TR_NONE = 0xFF
+};
+/* ------------------------------------------------ */
+
+#ifdef ST77XX_TRACE
+
+#ifndef ST77XX_TRACE_CLOCK
+	#if defined(__arm__)
+		#define ST77XX_TRACE_CLOCK_INIT()	ST77XX_CYCLES_INIT()
+		#define ST77XX_TRACE_CLOCK()		ST77XX_CYCLES()
+		#define ST77XX_TRACE_HZ				(SystemCoreClock)
+	#else
+		uint32_t ST77XX_Trace_HostClock(void);
+		#define ST77XX_TRACE_CLOCK_INIT()	do { } while (0)
+		#define ST77XX_TRACE_CLOCK()		ST77XX_Trace_HostClock()
+		#define ST77XX_TRACE_HZ				1000000000UL
+	#endif
+#endif
+/* ------------------------------------------------ */
+
+/* 总线计数（驱动的发送函数累加，不区分图元） */
+typedef struct {
+	uint32_t bytes;
+	uint32_t xfers;
+	uint32_t windows;
+	uint32_t gram_bytes;		/* RAMWR 之后的数据字节 */
+	uint8_t gram;				/* 最后一条命令是 RAMWR */
+} ST77XX_TraceBus_t;
+
+/* 一个图元的统计 */
+typedef struct {
+	uint32_t calls;
+	uint32_t pixels;
+	uint32_t bytes;
+	uint32_t xfers;
+	uint32_t windows;
+	uint32_t cycles_max;
+	uint64_t cycles;
+	uint32_t hist[ST77XX_TRACE_HIST];
+} ST77XX_TraceCounter_t;
+
+/* 环形缓冲区中的一条记录 */
+typedef struct {
+	uint32_t t0;				/* 开始时刻 */
+	uint32_t dt;				/* 持续时间 */
+	uint8_t id;
+	uint8_t windows;			/* 饱和到 255 */
+	uint16_t pixels;			/* 饱和到 65535 */
+} ST77XX_TraceRec_t;
+
+/* 导出文件头，后面是 count 个 { char name[16]; ST77XX_TraceCounter_t; }
+   和 records 条 ST77XX_TraceRec_t（从旧到新），全部小端 */
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t count;				/* 图元数 */
+	uint16_t hist;				/* 直方图桶数 */
+	uint16_t counter_size;		/* sizeof(ST77XX_TraceCounter_t) */
+	uint16_t rec_size;			/* sizeof(ST77XX_TraceRec_t) */
+	uint16_t reserved;
+	uint32_t hz;				/* 时钟频率 */
+	uint32_t records;
+	uint32_t dropped;			/* 被覆盖的记录 */
+} ST77XX_TraceHeader_t;
+
+/* 图元开始时的快照（在图元函数的栈上） */
+typedef struct {
+	uint32_t t0;
+	uint32_t bytes;
+	uint32_t xfers;
+	uint32_t windows;
+	uint32_t gram_bytes;
+	uint8_t id;
+} ST77XX_TraceMark_t;
+
+/* 写函数：导出时按顺序调用 */
+typedef void (*ST77XX_TraceWrite_t)(const void *data, uint32_t len, void *ctx);
+
+extern ST77XX_TraceBus_t ST77XX_Trace_Bus;
+
+void ST77XX_Trace_Begin(ST77XX_TraceMark_t *m, uint8_t id);
+void ST77XX_Trace_End(ST77XX_TraceMark_t *m);
+
+/* 驱动中的钩子。提前 return（完全在屏幕外）时不调用 END，只计入 calls */
+#define ST77XX_TRACE_BEGIN(id)		ST77XX_TraceMark_t st77xx_mark; ST77XX_Trace_Begin(&st77xx_mark, (id))
+#define ST77XX_TRACE_END()			ST77XX_Trace_End(&st77xx_mark)
+#define ST77XX_TRACE_CMD(Cmd, RamWr)	do { ST77XX_Trace_Bus.bytes++; ST77XX_Trace_Bus.xfers++; ST77XX_Trace_Bus.gram = ((Cmd) == (RamWr)); } while (0)
+#define ST77XX_TRACE_DATA(n)		do { ST77XX_Trace_Bus.bytes += (n); ST77XX_Trace_Bus.xfers++; if (ST77XX_Trace_Bus.gram) ST77XX_Trace_Bus.gram_bytes += (n); } while (0)
+#define ST77XX_TRACE_RX(n)			do { ST77XX_Trace_Bus.bytes += (n); ST77XX_Trace_Bus.xfers++; } while (0)
+#define ST77XX_TRACE_WINDOW()		do { ST77XX_Trace_Bus.windows++; } while (0)
+
+/* 清零统计和缓冲区并开始计数 */
+void ST77XX_Trace_Reset(void);
+
+/* 暂停 / 继续（导出时自动暂停） */
+void ST77XX_Trace_Enable(uint8_t on);
+
+/* 环形缓冲区只记录 mask 中的图元（位 = 编号），默认全部；统计表不受影响 */
+void ST77XX_Trace_Filter(uint32_t mask);
+
+/* 一个图元的统计，编号无效时返回 NULL */
+const ST77XX_TraceCounter_t *ST77XX_Trace_Get(uint8_t id);
+
+/* 图元名字 */
+const char *ST77XX_Trace_Name(uint8_t id);
+
+/* 延时的百分位（0...100），由直方图估计，返回桶的上界（时钟数） */
+uint32_t ST77XX_Trace_Percentile(uint8_t id, uint8_t pct);
+
+/* 导出，返回写出的字节数 */
+uint32_t ST77XX_Trace_Dump(ST77XX_TraceWrite_t write, void *ctx);
+
+#else
+
+#define ST77XX_TRACE_BEGIN(id)
+#define ST77XX_TRACE_END()
+#define ST77XX_TRACE_CMD(Cmd, RamWr)
+#define ST77XX_TRACE_DATA(n)
+#define ST77XX_TRACE_RX(n)
+#define ST77XX_TRACE_WINDOW()
+
+#endif /* ST77XX_TRACE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ST77XX_TRACE_H */
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
@@ -0,0 +1,64 @@
+#ifndef _JTEST_CLOCK_H_
+#define _JTEST_CLOCK_H_
+
+/*--------------------------------------------------------------------------------*/
+/* Purpose */
+/*--------------------------------------------------------------------------------*/
+/* jtest_clock.h Pluggable clock used by JTEST_COUNT_CYCLES() when the framework
+ * is built for the host (JTEST_HOST). On target builds SysTick is used as
+ * before and this header is not needed. */
+
+/*--------------------------------------------------------------------------------*/
+/* Includes */
+/*--------------------------------------------------------------------------------*/
+
+#include <stdint.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Type Definitions */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  A clock source: returns a free running tick count.
+ */
+typedef uint64_t (* JTEST_CLOCK_FN_t)(void);
+
+/*--------------------------------------------------------------------------------*/
+/* Macros and Defines */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Evaluate to the current tick count of the selected clock.
+ */
+#define JTEST_CLOCK_NOW()                       \
+    (jtest_clock_fn())
+
+/*--------------------------------------------------------------------------------*/
+/* Declare Module Variables */
+/*--------------------------------------------------------------------------------*/
+extern JTEST_CLOCK_FN_t jtest_clock_fn;
+extern uint64_t         jtest_clock_hz;
+extern const char *     jtest_clock_name;
+
+/*--------------------------------------------------------------------------------*/
+/* Function Prototypes */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Install a clock source running at hz ticks per second.
+ */
+void jtest_clock_set(JTEST_CLOCK_FN_t fn, uint64_t hz, const char * name);
+
+/**
+ *  Select one of the built-in clocks by name: "mono" (CLOCK_MONOTONIC, ns,
+ *  default), "cpu" (CLOCK_PROCESS_CPUTIME_ID, ns) or "tsc" (x86 time stamp
+ *  counter, rate calibrated against "mono"). Returns 0 for an unknown name.
+ */
+int jtest_clock_select(const char * name);
+
+/**
+ *  Convert a tick count of the current clock to nanoseconds.
+ */
+double jtest_clock_to_ns(uint64_t ticks);
+
+#endif /* _JTEST_CLOCK_H_ */
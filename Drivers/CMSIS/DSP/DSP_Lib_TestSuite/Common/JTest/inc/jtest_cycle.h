@@ -8,6 +8,8 @@
 #include "jtest_fw.h"           /* JTEST_DUMP_STRF() */
 #include "jtest_systick.h"
 #include "jtest_util.h"         /* STR() */
+#include "jtest_clock.h"        /* JTEST_CLOCK_NOW() */
+#include "jtest_report.h"       /* JTEST_REPORT_TIME() */
 
 /*--------------------------------------------------------------------------------*/
 /* Declare Module Variables */
@@ -43,6 +45,33 @@ extern const char * JTEST_CYCLE_STRF;
                          __jtest_cycle_end_count));     \
     } while (0)
 */
+#ifdef JTEST_HOST
+
+/**
+ *  Host variant: time fn_call with the selected jtest_clock, add it to the
+ *  report and print the tick count in the usual "Cycles:" line.
+ */
+#define JTEST_COUNT_CYCLES(fn_call)                     \
+    do                                                  \
+    {                                                   \
+        uint64_t __jtest_cycle_start_count;             \
+        uint64_t __jtest_cycle_ticks;                   \
+                                                        \
+        __jtest_cycle_start_count = JTEST_CLOCK_NOW();  \
+                                                        \
+        fn_call;                                        \
+                                                        \
+        __jtest_cycle_ticks =                           \
+            JTEST_CLOCK_NOW() -                         \
+            __jtest_cycle_start_count;                  \
+                                                        \
+        JTEST_REPORT_TIME(__jtest_cycle_ticks);         \
+        JTEST_DUMP_STRF(JTEST_CYCLE_STRF,               \
+                        (uint32_t) __jtest_cycle_ticks);\
+    } while (0)
+
+#else
+
 #define JTEST_COUNT_CYCLES(fn_call)                     \
     do                                                  \
     {                                                   \
@@ -62,4 +91,6 @@ extern const char * JTEST_CYCLE_STRF;
                          __jtest_cycle_end_count));     \
     } while (0)
 
+#endif /* JTEST_HOST */
+
 #endif /* _JTEST_CYCLE_H_ */
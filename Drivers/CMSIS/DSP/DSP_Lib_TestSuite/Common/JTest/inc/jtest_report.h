@@ -0,0 +1,103 @@
+#ifndef _JTEST_REPORT_H_
+#define _JTEST_REPORT_H_
+
+/*--------------------------------------------------------------------------------*/
+/* Purpose */
+/*--------------------------------------------------------------------------------*/
+/* jtest_report.h Machine-readable accuracy/speed report for host builds
+ * (JTEST_HOST). For every test and every block size the report collects the
+ * time of the function-under-test calls (JTEST_COUNT_CYCLES) and the worst
+ * SNR of the comparisons against the reference library, and writes one JSON
+ * object per line:
+ *
+ *   {"test":"arm_fir_f32_test","fut":"arm_fir_f32","size":32,"runs":2,
+ *    "ns_per_call":812.0,"ns_min":790.0,"ns_per_sample":25.38,
+ *    "snr_db":139.72,"snr_nan":0,"status":"pass","clock":"mono"}
+ *
+ * "size" is the block size taken from the lines the tests already print:
+ * "Block Size:", rows*cols for "Matrix Dimensions:", the output length for
+ * conv/correlate ("Input A/B Length:", "Number of Output Points:"); 0 when
+ * the test has no size; "ns_per_sample" is then null. "snr_db" is the worst
+ * SNR, 999 when every SNR comparison was exact and null for tests that
+ * compare bit-exactly instead of by SNR. "snr_nan" counts comparisons whose
+ * SNR was NaN (all-zero reference and result); they are not in "snr_db".
+ *
+ * On target builds all JTEST_REPORT_* macros are empty. */
+
+/*--------------------------------------------------------------------------------*/
+/* Includes */
+/*--------------------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Macros and Defines */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  SNR written for exact results (infinite SNR).
+ */
+#define JTEST_REPORT_SNR_EXACT 999.0
+
+/**
+ *  Maximum number of distinct sizes recorded per test.
+ */
+#define JTEST_REPORT_MAX_SIZES 64
+
+#ifdef JTEST_HOST
+
+#define JTEST_REPORT_TEST_BEGIN(test_str, fut_str)      \
+    jtest_report_test_begin(test_str, fut_str)
+
+#define JTEST_REPORT_TEST_END(passed)                   \
+    jtest_report_test_end(passed)
+
+#define JTEST_REPORT_TIME(ticks)                        \
+    jtest_report_time(ticks)
+
+#define JTEST_REPORT_SNR(snr)                           \
+    jtest_report_snr(snr)
+
+#define JTEST_REPORT_PARSE(str)                         \
+    jtest_report_parse(str)
+
+#else
+
+#define JTEST_REPORT_TEST_BEGIN(test_str, fut_str)
+#define JTEST_REPORT_TEST_END(passed)
+#define JTEST_REPORT_TIME(ticks)
+#define JTEST_REPORT_SNR(snr)
+#define JTEST_REPORT_PARSE(str)
+
+#endif /* JTEST_HOST */
+
+/*--------------------------------------------------------------------------------*/
+/* Declare Module Variables */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Non-zero (default): host builds echo the dumped strings to stdout.
+ */
+extern int jtest_report_echo;
+
+/*--------------------------------------------------------------------------------*/
+/* Function Prototypes */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Direct the report to f (NULL disables it).
+ */
+void jtest_report_open(FILE * f);
+
+void jtest_report_test_begin(const char * test_str, const char * fut_str);
+void jtest_report_test_end(int passed);
+void jtest_report_time(uint64_t ticks);
+void jtest_report_snr(double snr);
+
+/**
+ *  Pick up the current block size from a string dumped by the test.
+ */
+void jtest_report_parse(const char * str);
+
+#endif /* _JTEST_REPORT_H_ */
@@ -5,6 +5,9 @@
 /* Includes */
 /*--------------------------------------------------------------------------------*/
 
+/* Host builds (JTEST_HOST) time with jtest_clock.h instead of SysTick. */
+#ifndef JTEST_HOST
+
 /* Get access to the SysTick structure. */
 #if   defined ARMCM0
   #include "ARMCM0.h"
@@ -89,5 +92,7 @@
  */
 #define JTEST_SYSTICK_VALUE(systick_ptr)        \
     ((systick_ptr)->VAL)
+
+#endif /* JTEST_HOST */
            
 #endif /* _JTEST_SYSTICK_H_ */
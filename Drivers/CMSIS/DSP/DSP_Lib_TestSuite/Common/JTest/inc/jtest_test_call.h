@@ -7,6 +7,7 @@
 #include "jtest_test.h"
 #include "jtest_test_define.h"
 #include "jtest_fw.h"
+#include "jtest_report.h"
 
 /*--------------------------------------------------------------------------------*/
 /* Macros and Defines */
@@ -23,6 +24,8 @@
         JTEST_DUMP_STR(JTEST_TEST_STRUCT_NAME(test_fn).test_fn_str);    \
         JTEST_DUMP_STR("Function Under Test:\n");                       \
         JTEST_DUMP_STR(JTEST_TEST_STRUCT_NAME(test_fn).fut_str);        \
+        JTEST_REPORT_TEST_BEGIN(JTEST_TEST_STRUCT_NAME(test_fn).test_fn_str, \
+                                JTEST_TEST_STRUCT_NAME(test_fn).fut_str);    \
         retval = JTEST_TEST_STRUCT_NAME(test_fn).test_fn_ptr();         \
     } while (0)
 
@@ -114,6 +117,8 @@
             JTEST_TEST_UPDATE_PARENT_GROUP_OR_FW_PF(__jtest_test_ret);  \
                                                                         \
             JTEST_TEST_DUMP_RESULTS(__jtest_test_ret);                  \
+            JTEST_REPORT_TEST_END(                                      \
+                __jtest_test_ret == JTEST_TEST_PASSED);                 \
             JTEST_ACT_TEST_END();                                       \
         }                                                               \
     } while (0)
@@ -0,0 +1,105 @@
+#include "../inc/jtest_clock.h"
+
+#ifdef JTEST_HOST
+
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/*--------------------------------------------------------------------------------*/
+/* Built-in Clocks */
+/*--------------------------------------------------------------------------------*/
+
+static uint64_t jtest_clock_posix(clockid_t id)
+{
+    struct timespec ts;
+
+    clock_gettime(id, &ts);
+
+    return (uint64_t) ts.tv_sec * UINT64_C(1000000000) + (uint64_t) ts.tv_nsec;
+}
+
+static uint64_t jtest_clock_mono(void)
+{
+    return jtest_clock_posix(CLOCK_MONOTONIC);
+}
+
+static uint64_t jtest_clock_cpu(void)
+{
+    return jtest_clock_posix(CLOCK_PROCESS_CPUTIME_ID);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+static uint64_t jtest_clock_tsc(void)
+{
+    return __rdtsc();
+}
+#endif
+
+/*--------------------------------------------------------------------------------*/
+/* Define Module Variables */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_CLOCK_FN_t jtest_clock_fn   = jtest_clock_mono;
+uint64_t         jtest_clock_hz   = UINT64_C(1000000000);
+const char *     jtest_clock_name = "mono";
+
+/*--------------------------------------------------------------------------------*/
+/* Functions */
+/*--------------------------------------------------------------------------------*/
+
+void jtest_clock_set(JTEST_CLOCK_FN_t fn, uint64_t hz, const char * name)
+{
+    jtest_clock_fn   = fn;
+    jtest_clock_hz   = hz;
+    jtest_clock_name = name;
+}
+
+int jtest_clock_select(const char * name)
+{
+    if (strcmp(name, "mono") == 0)
+    {
+        jtest_clock_set(jtest_clock_mono, UINT64_C(1000000000), "mono");
+        return 1;
+    }
+
+    if (strcmp(name, "cpu") == 0)
+    {
+        jtest_clock_set(jtest_clock_cpu, UINT64_C(1000000000), "cpu");
+        return 1;
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    if (strcmp(name, "tsc") == 0)
+    {
+        /* Calibrate the TSC rate over ~50 ms of the monotonic clock. */
+        uint64_t ns0  = jtest_clock_mono();
+        uint64_t tsc0 = jtest_clock_tsc();
+        uint64_t ns1;
+        uint64_t tsc1;
+
+        do
+        {
+            ns1  = jtest_clock_mono();
+            tsc1 = jtest_clock_tsc();
+        } while (ns1 - ns0 < UINT64_C(50000000));
+
+        jtest_clock_set(jtest_clock_tsc,
+                        (uint64_t) ((double) (tsc1 - tsc0) * 1e9 / (double) (ns1 - ns0)),
+                        "tsc");
+        return 1;
+    }
+#endif
+
+    return 0;
+}
+
+double jtest_clock_to_ns(uint64_t ticks)
+{
+    return (double) ticks * 1e9 / (double) jtest_clock_hz;
+}
+
+#endif /* JTEST_HOST */
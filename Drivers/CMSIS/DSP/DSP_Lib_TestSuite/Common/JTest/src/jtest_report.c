@@ -0,0 +1,252 @@
+#include "../inc/jtest_report.h"
+#include "../inc/jtest_clock.h"
+
+#ifdef JTEST_HOST
+
+#include <math.h>
+#include <string.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Type Definitions */
+/*--------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    uint32_t size;
+    uint32_t runs;
+    uint64_t ticks;
+    uint64_t ticks_min;
+    uint32_t snr_count;
+    uint32_t snr_nan;
+    double   snr_min;
+} JTEST_REPORT_ENTRY_t;
+
+/*--------------------------------------------------------------------------------*/
+/* Define Module Variables */
+/*--------------------------------------------------------------------------------*/
+
+int                         jtest_report_echo = 1;
+
+static FILE *               jtest_report_file;
+static const char *         jtest_report_test;
+static const char *         jtest_report_fut;
+static uint32_t             jtest_report_size;
+static JTEST_REPORT_ENTRY_t jtest_report_entries[JTEST_REPORT_MAX_SIZES];
+static uint32_t             jtest_report_count;
+
+/*--------------------------------------------------------------------------------*/
+/* Functions */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Entry of the current size, created on first use.
+ */
+static JTEST_REPORT_ENTRY_t * jtest_report_entry(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < jtest_report_count; ++i)
+    {
+        if (jtest_report_entries[i].size == jtest_report_size)
+        {
+            return &jtest_report_entries[i];
+        }
+    }
+
+    if (jtest_report_count == JTEST_REPORT_MAX_SIZES)
+    {
+        return NULL;
+    }
+
+    memset(&jtest_report_entries[i], 0, sizeof(JTEST_REPORT_ENTRY_t));
+    jtest_report_entries[i].size = jtest_report_size;
+    jtest_report_entries[i].ticks_min = UINT64_MAX;
+    jtest_report_count++;
+
+    return &jtest_report_entries[i];
+}
+
+/**
+ *  Write str as a JSON string. Test and function names carry the trailing
+ *  newline of the log, so control characters are dropped.
+ */
+static void jtest_report_put_str(const char * str)
+{
+    fputc('"', jtest_report_file);
+    for (; *str; ++str)
+    {
+        if ((*str == '"') || (*str == '\\'))
+        {
+            fputc('\\', jtest_report_file);
+        }
+        if ((unsigned char) *str >= ' ')
+        {
+            fputc(*str, jtest_report_file);
+        }
+    }
+    fputc('"', jtest_report_file);
+}
+
+void jtest_report_open(FILE * f)
+{
+    jtest_report_file = f;
+}
+
+void jtest_report_test_begin(const char * test_str, const char * fut_str)
+{
+    jtest_report_test  = test_str;
+    jtest_report_fut   = fut_str;
+    jtest_report_size  = 0;
+    jtest_report_count = 0;
+}
+
+void jtest_report_test_end(int passed)
+{
+    uint32_t i;
+
+    if (jtest_report_file == NULL)
+    {
+        return;
+    }
+
+    for (i = 0; i < jtest_report_count; ++i)
+    {
+        const JTEST_REPORT_ENTRY_t * e = &jtest_report_entries[i];
+        double ns = e->runs ? jtest_clock_to_ns(e->ticks) / e->runs : 0.0;
+
+        /* Sizes that were announced but never timed or compared. */
+        if ((e->runs == 0) && (e->snr_count == 0) && (e->snr_nan == 0))
+        {
+            continue;
+        }
+
+        fprintf(jtest_report_file, "{\"test\":");
+        jtest_report_put_str(jtest_report_test);
+        fprintf(jtest_report_file, ",\"fut\":");
+        jtest_report_put_str(jtest_report_fut);
+        fprintf(jtest_report_file, ",\"size\":%u,\"runs\":%u,",
+                (unsigned) e->size, (unsigned) e->runs);
+
+        if (e->runs)
+        {
+            fprintf(jtest_report_file, "\"ns_per_call\":%.1f,\"ns_min\":%.1f,",
+                    ns, jtest_clock_to_ns(e->ticks_min));
+        }
+        else
+        {
+            fprintf(jtest_report_file, "\"ns_per_call\":null,\"ns_min\":null,");
+        }
+
+        if (e->runs && e->size)
+        {
+            fprintf(jtest_report_file, "\"ns_per_sample\":%.3f,", ns / e->size);
+        }
+        else
+        {
+            fprintf(jtest_report_file, "\"ns_per_sample\":null,");
+        }
+
+        if (e->snr_count)
+        {
+            fprintf(jtest_report_file, "\"snr_db\":%.2f,", e->snr_min);
+        }
+        else
+        {
+            fprintf(jtest_report_file, "\"snr_db\":null,");
+        }
+        fprintf(jtest_report_file, "\"snr_nan\":%u,", (unsigned) e->snr_nan);
+
+        fprintf(jtest_report_file, "\"status\":\"%s\",\"clock\":\"%s\"}\n",
+                passed ? "pass" : "fail", jtest_clock_name);
+    }
+
+    fflush(jtest_report_file);
+}
+
+void jtest_report_time(uint64_t ticks)
+{
+    JTEST_REPORT_ENTRY_t * e = jtest_report_entry();
+
+    if (e == NULL)
+    {
+        return;
+    }
+
+    e->runs++;
+    e->ticks += ticks;
+    if (ticks < e->ticks_min)
+    {
+        e->ticks_min = ticks;
+    }
+}
+
+void jtest_report_snr(double snr)
+{
+    JTEST_REPORT_ENTRY_t * e = jtest_report_entry();
+
+    if (e == NULL)
+    {
+        return;
+    }
+
+    if (isinf(snr) && (snr > 0))
+    {
+        snr = JTEST_REPORT_SNR_EXACT;
+    }
+
+    if (isnan(snr))
+    {
+        e->snr_nan++;
+        return;
+    }
+
+    if ((e->snr_count == 0) || (snr < e->snr_min))
+    {
+        e->snr_min = snr;
+    }
+    e->snr_count++;
+}
+
+void jtest_report_parse(const char * str)
+{
+    unsigned a;
+    unsigned b;
+
+    /* Tests dump several "Name: value" lines in one string. */
+    while (str != NULL)
+    {
+        if (sscanf(str, "Block Size: %u", &a) == 1)
+        {
+            jtest_report_size = a;
+        }
+        else if (sscanf(str, "Input A Length: %u", &a) == 1)
+        {
+            jtest_report_size = a;
+        }
+        else if (sscanf(str, "Input B Length: %u", &b) == 1)
+        {
+            /* Full convolution / correlation output length. */
+            jtest_report_size = jtest_report_size + b - 1;
+        }
+        else if (sscanf(str, "Number of Output Points: %u", &a) == 1)
+        {
+            jtest_report_size = a;
+        }
+        else if (sscanf(str, "Matrix Dimensions: A %ux%u", &a, &b) == 2)
+        {
+            jtest_report_size = a * b;
+        }
+        else if (sscanf(str, "Matrix Dimensions: %ux%u", &a, &b) == 2)
+        {
+            jtest_report_size = a * b;
+        }
+
+        str = strchr(str, '\n');
+        if (str != NULL)
+        {
+            str++;
+        }
+    }
+}
+
+#endif /* JTEST_HOST */
@@ -1,5 +1,6 @@
 
 #include "jtest_fw.h"
+#include "jtest_report.h"
 
 void test_start    (void) {
 //  ;
@@ -24,6 +25,14 @@ void group_end     (void) {
 void dump_str      (void) {
 //  ;
   JTEST_FW.dump_str++;
+#ifdef JTEST_HOST
+  /* No debugger on the host: print the segment and feed the report. */
+  if (jtest_report_echo)
+  {
+    printf("%.*s", JTEST_STR_MAX_OUTPUT_SIZE, JTEST_FW.str_buffer);
+  }
+  JTEST_REPORT_PARSE(JTEST_FW.str_buffer);
+#endif
 }
 
 void dump_data     (void) {
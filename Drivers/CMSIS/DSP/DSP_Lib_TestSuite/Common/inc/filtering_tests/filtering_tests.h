@@ -7,6 +7,7 @@
 
 JTEST_DECLARE_GROUP(biquad_tests);
 JTEST_DECLARE_GROUP(conv_tests);
+JTEST_DECLARE_GROUP(conv_fft_tests);
 JTEST_DECLARE_GROUP(correlate_tests);
 JTEST_DECLARE_GROUP(fir_tests);
 JTEST_DECLARE_GROUP(iir_tests);
@@ -115,6 +115,7 @@
     do                                                              \
     {                                                               \
         float32_t snr = arm_snr_f32(ref_ptr, tst_ptr, block_size);  \
+        JTEST_REPORT_SNR(snr);                                      \
         if ( snr <= threshold)                                       \
         {                                                           \
             JTEST_DUMP_STRF("SNR: %f\n", snr);                      \
@@ -130,6 +131,7 @@
     do                                                              \
     {                                                               \
         float64_t snr = arm_snr_f64(ref_ptr, tst_ptr, block_size);  \
+        JTEST_REPORT_SNR(snr);                                      \
         if ( snr <= threshold)                                       \
         {                                                           \
             JTEST_DUMP_STRF("SNR: %f\n", snr);                      \
@@ -23,6 +23,12 @@
 #define DCT4_TRANSFORM_SNR_THRESHOLD_q31_t     75
 #define DCT4_TRANSFORM_SNR_THRESHOLD_q15_t     11
 
+/* The f32 Goertzel recursion values grow with the square of the block size
+ * near the frequency 0, and so does their rounding error. */
+#define GOERTZEL_TRANSFORM_SNR_THRESHOLD_float32_t 75
+#define GOERTZEL_TRANSFORM_SNR_THRESHOLD_q31_t     90
+#define GOERTZEL_TRANSFORM_SNR_THRESHOLD_q15_t     30
+
 /**
  *  Compare the outputs from the function under test and the reference
  *  function using SNR.
@@ -61,6 +67,25 @@
             );                                           \
     } while (0)                                           \
 
+/**
+ *  Compare the complex bins from the Goertzel function under test and the
+ *  reference function using SNR.
+ */
+#define GOERTZEL_TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(num_bins,        \
+                                                       output_type)     \
+    do                                                                  \
+    {                                                                   \
+        TEST_CONVERT_AND_ASSERT_SNR(                                    \
+            transform_fft_output_f32_ref,                               \
+            (output_type *) transform_fft_output_ref,                   \
+            transform_fft_output_f32_fut,                               \
+            (output_type *) transform_fft_output_fut,                   \
+            (num_bins) * 2,                                             \
+            output_type,                                                \
+            GOERTZEL_TRANSFORM_SNR_THRESHOLD_##output_type              \
+            );                                                          \
+    } while (0)
+
 /**
  *  Specialization on #TRANSFORM_SNR_COMPARE_INTERFACE() to fix the block_size
  *  for complex datasets.
@@ -9,5 +9,8 @@ JTEST_DECLARE_GROUP(cfft_family_tests);
 JTEST_DECLARE_GROUP(dct4_tests);
 JTEST_DECLARE_GROUP(rfft_tests);
 JTEST_DECLARE_GROUP(rfft_fast_tests);
+JTEST_DECLARE_GROUP(cfft_mixed_tests);
+JTEST_DECLARE_GROUP(fft_tables_tests);
+JTEST_DECLARE_GROUP(dft_bins_tests);
 
 #endif /* _TRANSFORM_TESTS_H_ */
@@ -113,6 +113,191 @@
    }
 
 
+#define BIQUAD_MULTI_DEFINE_TEST(layout)                                               \
+   JTEST_DEFINE_TEST(arm_biquad_cascade_df1_multi##layout##_q15_test,                  \
+         arm_biquad_cascade_df1_multi##layout##_q15)                                   \
+   {                                                                                   \
+      arm_biquad_casd_df1_multi_inst_q15 biquad_inst_fut = { 0 };                      \
+      arm_biquad_casd_df1_multi_inst_q15 biquad_inst_ref = { 0 };                      \
+                                                                                       \
+      TEMPLATE_DO_ARR_DESC(                                                            \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes                   \
+            ,                                                                          \
+         TEMPLATE_DO_ARR_DESC(                                                         \
+               numstages_idx, uint16_t, numStages, filtering_numstages                 \
+               ,                                                                       \
+            TEMPLATE_DO_ARR_DESC(                                                      \
+                  postshifts_idx, uint8_t, postShift, filtering_postshifts             \
+                  ,                                                                    \
+               TEMPLATE_DO_ARR_DESC(                                                   \
+                     numch_idx, uint16_t, numChannels, filtering_numchannels           \
+                     ,                                                                 \
+                     /* Display test parameter values */                               \
+                     JTEST_DUMP_STRF("Block Size: %d\n"                                \
+                                     "Number of Stages: %d\n"                          \
+                                     "Post Shift: %d\n"                                \
+                                     "Number of Channels: %d\n",                       \
+                                     (int)blockSize,                                   \
+                                     (int)numStages,                                   \
+                                     (int)postShift,                                   \
+                                     (int)numChannels);                                \
+                                                                                       \
+                     /* Initialize the BIQUAD Instances */                             \
+                     arm_biquad_cascade_df1_multi_init_q15(                            \
+                           &biquad_inst_fut, numStages, numChannels,                   \
+                           (q15_t*)filtering_coeffs_b_q15,                             \
+                           (void *) filtering_pState, postShift);                      \
+                                                                                       \
+                     JTEST_COUNT_CYCLES(                                               \
+                           arm_biquad_cascade_df1_multi##layout##_q15(                 \
+                                 &biquad_inst_fut,                                     \
+                                 (void *) filtering_q15_inputs,                        \
+                                 (void *) filtering_output_fut,                        \
+                                 blockSize));                                          \
+                                                                                       \
+                     arm_biquad_cascade_df1_multi_init_q15(                            \
+                           &biquad_inst_ref, numStages, numChannels,                   \
+                           (q15_t*)filtering_coeffs_b_q15,                             \
+                           (void *) filtering_pState, postShift);                      \
+                                                                                       \
+                     ref_biquad_cascade_df1_multi##layout##_q15(                       \
+                           &biquad_inst_ref,                                           \
+                           (void *) filtering_q15_inputs,                              \
+                           (void *) filtering_output_ref,                              \
+                           blockSize);                                                 \
+                                                                                       \
+                     /* Each channel must match a single channel cascade */            \
+                     TEST_ASSERT_BUFFERS_EQUAL(                                        \
+                           filtering_output_ref,                                       \
+                           filtering_output_fut,                                       \
+                           blockSize * numChannels * sizeof(q15_t))))));               \
+                                                                                       \
+            return JTEST_TEST_PASSED;                                                  \
+   }
+
+/*
+ *  Multi-channel benchmark: BIQUAD_MULTI_BENCH_BLOCKSIZE samples of each
+ *  channel of a planar block are filtered once with
+ *  arm_biquad_cascade_df1_multi_planar_q15() and once with one
+ *  arm_biquad_cascade_df1_q15() call per channel.
+ */
+#define BIQUAD_MULTI_BENCH_BLOCKSIZE 32
+#define BIQUAD_MULTI_BENCH_NUMSTAGES 4
+#define BIQUAD_MULTI_BENCH_POSTSHIFT 1
+
+static arm_biquad_casd_df1_inst_q15 biquad_multi_bench_inst[FILTERING_MAX_NUMCHANNELS];
+
+ARR_DESC_DEFINE(uint16_t,
+                biquad_multi_bench_numchannels,
+                3,
+                CURLY(
+                    2,
+                    4,
+                    FILTERING_MAX_NUMCHANNELS
+                    ));
+
+/**
+ *  Independent single channel cascades equivalent to
+ *  arm_biquad_cascade_df1_multi_planar_q15(), as timed by the benchmark.
+ */
+static void biquad_multi_separate_q15(
+      uint16_t numChannels,
+      q15_t * pSrc,
+      q15_t * pDst,
+      uint32_t blockSize)
+{
+   uint16_t ch;
+
+   for (ch = 0; ch < numChannels; ch++)
+   {
+      arm_biquad_cascade_df1_q15(&biquad_multi_bench_inst[ch],
+                                 pSrc + ch * blockSize,
+                                 pDst + ch * blockSize,
+                                 blockSize);
+   }
+}
+
+#define BIQUAD_MULTI_BENCH_DEFINE_TEST(separate)                                       \
+   JTEST_DEFINE_TEST(arm_biquad_cascade_df1_multi_bench##separate##_q15_test,          \
+         arm_biquad_cascade_df1_multi##separate##_q15)                                 \
+   {                                                                                   \
+      arm_biquad_casd_df1_multi_inst_q15 biquad_inst_ref = { 0 };                      \
+      uint32_t blockSize = BIQUAD_MULTI_BENCH_BLOCKSIZE;                               \
+      uint16_t numStages = BIQUAD_MULTI_BENCH_NUMSTAGES;                               \
+      uint8_t postShift = BIQUAD_MULTI_BENCH_POSTSHIFT;                                \
+                                                                                       \
+      TEMPLATE_DO_ARR_DESC(                                                            \
+            numch_idx, uint16_t, numChannels, biquad_multi_bench_numchannels           \
+            ,                                                                          \
+            /* Display test parameter values */                                        \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                         \
+                            "Number of Stages: %d\n"                                   \
+                            "Number of Channels: %d\n",                                \
+                            (int)blockSize,                                            \
+                            (int)numStages,                                            \
+                            (int)numChannels);                                         \
+                                                                                       \
+            BIQUAD_MULTI_BENCH_CALL##separate();                                       \
+                                                                                       \
+            arm_biquad_cascade_df1_multi_init_q15(                                     \
+                  &biquad_inst_ref, numStages, numChannels,                            \
+                  (q15_t*)filtering_coeffs_b_q15,                                      \
+                  (void *) filtering_pState, postShift);                               \
+                                                                                       \
+            ref_biquad_cascade_df1_multi_planar_q15(                                   \
+                  &biquad_inst_ref,                                                    \
+                  (void *) filtering_q15_inputs,                                       \
+                  (void *) filtering_output_ref,                                       \
+                  blockSize);                                                          \
+                                                                                       \
+            TEST_ASSERT_BUFFERS_EQUAL(                                                 \
+                  filtering_output_ref,                                                \
+                  filtering_output_fut,                                                \
+                  blockSize * numChannels * sizeof(q15_t)));                           \
+                                                                                       \
+      return JTEST_TEST_PASSED;                                                        \
+   }
+
+#define BIQUAD_MULTI_BENCH_CALL()                                                      \
+   do                                                                                  \
+   {                                                                                   \
+      arm_biquad_casd_df1_multi_inst_q15 biquad_inst_fut = { 0 };                      \
+                                                                                       \
+      arm_biquad_cascade_df1_multi_init_q15(                                           \
+            &biquad_inst_fut, numStages, numChannels,                                  \
+            (q15_t*)filtering_coeffs_b_q15,                                            \
+            (void *) filtering_pState, postShift);                                     \
+                                                                                       \
+      JTEST_COUNT_CYCLES(                                                              \
+            arm_biquad_cascade_df1_multi_planar_q15(                                   \
+                  &biquad_inst_fut,                                                    \
+                  (void *) filtering_q15_inputs,                                       \
+                  (void *) filtering_output_fut,                                       \
+                  blockSize));                                                         \
+   } while (0)
+
+#define BIQUAD_MULTI_BENCH_CALL_separate()                                             \
+   do                                                                                  \
+   {                                                                                   \
+      uint16_t ch;                                                                     \
+                                                                                       \
+      for (ch = 0; ch < numChannels; ch++)                                             \
+      {                                                                                \
+         arm_biquad_cascade_df1_init_q15(                                              \
+               &biquad_multi_bench_inst[ch], numStages,                                \
+               (q15_t*)filtering_coeffs_b_q15,                                         \
+               (q15_t *) filtering_pState + ch * 4 * numStages,                        \
+               postShift);                                                             \
+      }                                                                                \
+                                                                                       \
+      TEST_CALL_FUT(                                                                   \
+            biquad_multi_separate_q15,                                                 \
+            (numChannels,                                                              \
+             (q15_t *) filtering_q15_inputs,                                           \
+             (q15_t *) filtering_output_fut,                                           \
+             blockSize));                                                              \
+   } while (0)
+
 JTEST_DEFINE_TEST(arm_biquad_cas_df1_32x64_q31_test,
       arm_biquad_cas_df1_32x64_q31)
 {
@@ -222,6 +407,10 @@ BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q31,df1,,q31_t);
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q15,df1,,q15_t);
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q31,df1,_fast,q31_t);
 BIQUAD_WITH_POSTSHIFT_DEFINE_TEST(q15,df1,_fast,q15_t);
+BIQUAD_MULTI_DEFINE_TEST();
+BIQUAD_MULTI_DEFINE_TEST(_planar);
+BIQUAD_MULTI_BENCH_DEFINE_TEST();
+BIQUAD_MULTI_BENCH_DEFINE_TEST(_separate);
 
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
@@ -241,4 +430,8 @@ JTEST_DEFINE_GROUP(biquad_tests)
    JTEST_TEST_CALL(arm_biquad_cascade_df1_fast_q31_test);
    JTEST_TEST_CALL(arm_biquad_cascade_df1_fast_q15_test);
    JTEST_TEST_CALL(arm_biquad_cas_df1_32x64_q31_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_df1_multi_q15_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_df1_multi_planar_q15_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_df1_multi_bench_q15_test);
+   JTEST_TEST_CALL(arm_biquad_cascade_df1_multi_bench_separate_q15_test);
 }
@@ -0,0 +1,531 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Header Stuff */
+/*--------------------------------------------------------------------------------*/
+
+/* Longest signal and kernel; the full convolution must fit the
+ * filtering_output_* buffers (LMS_MAX_BLOCKSIZE * 2 elements). */
+#define CONV_FFT_MAX_SIGNAL_ELTS  512
+#define CONV_FFT_MAX_KERNEL_ELTS  256
+
+/* Offset of the kernels in the common input arrays, so that the signal and
+ * the kernel differ. */
+#define CONV_FFT_KERNEL_OFFSET    (CONV_FFT_MAX_SIGNAL_ELTS + 1)
+
+/* Kernel spectra plus engine scratch, in float32_t / q31_t elements: the Q31
+ * engines need 2*fftLen spectrum and 4*fftLen scratch elements for a single
+ * partition at the largest FFT length. */
+#define CONV_FFT_MAX_SCRATCH_ELTS 6144
+
+/* Number of blocks filtered by the streaming tests. */
+#define CONV_FFT_FIR_NUM_BLOCKS   4
+
+static float32_t conv_fft_scratch[CONV_FFT_MAX_SCRATCH_ELTS];
+static float32_t conv_fft_state[CONV_FFT_MAX_SIGNAL_ELTS + CONV_FFT_MAX_KERNEL_ELTS];
+static float32_t conv_fft_coeffs[CONV_FFT_MAX_KERNEL_ELTS];
+
+/* Q31 inputs scaled down so that the convolutions do not overflow the 1.31
+ * output format, in which case ref_conv_q31() would wrap around. */
+#define CONV_FFT_Q31_INPUT_SHIFT  (-4)
+
+static q31_t conv_fft_q31_inputs[CONV_FFT_KERNEL_OFFSET + CONV_FFT_MAX_KERNEL_ELTS];
+
+#define CONV_FFT_f32_INPUTS filtering_f32_inputs
+#define CONV_FFT_q31_INPUTS conv_fft_scaled_q31_inputs()
+
+/*--------------------------------------------------------------------------------*/
+/* Lengths */
+/*--------------------------------------------------------------------------------*/
+
+/*
+ *  The conv_fft_lens_a and conv_fft_lens_b #ARR_DESC_t objects are accessed in
+ *  parallel: a is the signal, b the kernel. With the FFT lengths below they
+ *  cover single and partitioned kernels, kernels longer than the signal and
+ *  blocks that end inside the signal.
+ */
+ARR_DESC_DEFINE(uint32_t,
+                conv_fft_lens_a,
+                6,
+                CURLY(
+                    1,
+                    50,
+                    17,
+                    200,
+                    CONV_FFT_MAX_SIGNAL_ELTS,
+                    CONV_FFT_MAX_SIGNAL_ELTS
+                    ));
+
+ARR_DESC_DEFINE(uint32_t,
+                conv_fft_lens_b,
+                6,
+                CURLY(
+                    1,
+                    7,
+                    100,
+                    33,
+                    16,
+                    CONV_FFT_MAX_KERNEL_ELTS
+                    ));
+
+ARR_DESC_DEFINE(uint32_t,
+                conv_fft_fft_lens_f32,
+                3,
+                CURLY(
+                    32,
+                    128,
+                    1024
+                    ));
+
+ARR_DESC_DEFINE(uint32_t,
+                conv_fft_fft_lens_q31,
+                3,
+                CURLY(
+                    16,
+                    128,
+                    1024
+                    ));
+
+/*
+ *  Kernel lengths of the crossover benchmark against a signal of
+ *  CONV_FFT_MAX_SIGNAL_ELTS samples.
+ */
+ARR_DESC_DEFINE(uint32_t,
+                conv_fft_bench_lens,
+                7,
+                CURLY(
+                    4,
+                    8,
+                    16,
+                    32,
+                    64,
+                    128,
+                    CONV_FFT_MAX_KERNEL_ELTS
+                    ));
+
+/*--------------------------------------------------------------------------------*/
+/* Helpers */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Fill conv_fft_q31_inputs from filtering_q31_inputs and return it.
+ */
+static q31_t * conv_fft_scaled_q31_inputs(void)
+{
+    arm_shift_q31((q31_t *) filtering_q31_inputs, CONV_FFT_Q31_INPUT_SHIFT,
+                  conv_fft_q31_inputs,
+                  CONV_FFT_KERNEL_OFFSET + CONV_FFT_MAX_KERNEL_ELTS);
+
+    return conv_fft_q31_inputs;
+}
+
+/*
+ *  arm_conv_fft_init_xxx() takes a scratch buffer only for f32.
+ */
+#define CONV_FFT_INIT_SCRATCH_f32(ptr) , (ptr)
+#define CONV_FFT_INIT_SCRATCH_q31(ptr)
+
+/**
+ *  FFT length used to benchmark the FFT form: a single partition with at least
+ *  as many output samples per block as kernel samples.
+ */
+static uint16_t conv_fft_bench_fft_len(uint32_t kernel_len, uint32_t min_len)
+{
+    uint32_t fft_len = min_len;
+
+    while (fft_len < 2 * kernel_len)
+    {
+        fft_len <<= 1;
+    }
+
+    return (uint16_t) fft_len;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Engine Tests */
+/*--------------------------------------------------------------------------------*/
+
+/*
+ *  The engines are called through an instance initialized with a given FFT
+ *  length, so that the FFT path is taken whatever the cost model says.
+ */
+#define CONV_FFT_ENGINE_TEST_TEMPLATE(suffix, output_type, spec_factor)         \
+    JTEST_DEFINE_TEST(arm_conv_fft_engines_##suffix##_test,                     \
+                      arm_conv_fft_add_##suffix)                                \
+    {                                                                           \
+        arm_conv_fft_instance_##suffix conv_fft_inst;                           \
+        output_type * signal_ptr = (output_type *) CONV_FFT_##suffix##_INPUTS;  \
+        output_type * kernel_ptr =                                              \
+            (output_type *) CONV_FFT_##suffix##_INPUTS + CONV_FFT_KERNEL_OFFSET; \
+        output_type * scratch_ptr = (output_type *) conv_fft_scratch;           \
+                                                                                \
+        TEMPLATE_DO_ARR_DESC(                                                   \
+            fft_len_idx, uint32_t, fft_len, conv_fft_fft_lens_##suffix          \
+            ,                                                                   \
+            TEMPLATE_DO_ARR_DESC(                                               \
+                len_idx, uint32_t, signal_len, conv_fft_lens_a                  \
+                ,                                                               \
+                uint32_t kernel_len =                                           \
+                    ARR_DESC_ELT(uint32_t, len_idx, &(conv_fft_lens_b));        \
+                uint32_t out_len = signal_len + kernel_len - 1;                 \
+                uint32_t first_index = kernel_len / 2;                          \
+                output_type * work_ptr = scratch_ptr + (spec_factor) *          \
+                    ARM_CONV_FFT_NUM_PARTS(kernel_len, fft_len) * fft_len;      \
+                                                                                \
+                JTEST_DUMP_STRF("Input A Length: %d\n"                          \
+                                "Input B Length: %d\n"                          \
+                                "FFT Length: %d\n",                             \
+                                (int)signal_len,                                \
+                                (int)kernel_len,                                \
+                                (int)fft_len);                                  \
+                                                                                \
+                arm_conv_fft_init_##suffix(&conv_fft_inst, kernel_ptr,          \
+                                           kernel_len, 0, fft_len,              \
+                                           scratch_ptr                          \
+                                           CONV_FFT_INIT_SCRATCH_##suffix(      \
+                                               work_ptr));                      \
+                                                                                \
+                /* Overlap-add: full convolution */                            \
+                memset(filtering_output_fut, 0,                                 \
+                       out_len * sizeof(output_type));                          \
+                TEST_CALL_FUT(                                                  \
+                    arm_conv_fft_add_##suffix,                                  \
+                    (&conv_fft_inst, signal_ptr, signal_len, 0,                 \
+                     (output_type *) filtering_output_fut, work_ptr));          \
+                ref_conv_##suffix(signal_ptr, signal_len,                       \
+                                  kernel_ptr, kernel_len,                       \
+                                  (output_type *) filtering_output_ref);        \
+                FILTERING_SNR_COMPARE_INTERFACE(out_len, output_type);          \
+                                                                                \
+                /* Overlap-save: samples from first_index to the end */         \
+                arm_conv_fft_save_##suffix(                                     \
+                    &conv_fft_inst, signal_ptr, signal_len, 0,                  \
+                    first_index, out_len - first_index,                         \
+                    (output_type *) filtering_output_fut + first_index,         \
+                    work_ptr);                                                  \
+                FILTERING_SNR_COMPARE_INTERFACE_OFFSET(                         \
+                    first_index, out_len - first_index, output_type)));         \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+CONV_FFT_ENGINE_TEST_TEMPLATE(f32, float32_t, 1);
+CONV_FFT_ENGINE_TEST_TEMPLATE(q31, q31_t, 2);
+
+/*--------------------------------------------------------------------------------*/
+/* Automatic Selection Tests */
+/*--------------------------------------------------------------------------------*/
+
+/*
+ *  The public functions either run the FFT form or fall back to the direct
+ *  form, depending on the lengths; both cases are covered by conv_fft_lens_*.
+ */
+#define CONV_FFT_AUTO_TEST_TEMPLATE(suffix, output_type)                        \
+    JTEST_DEFINE_TEST(arm_conv_fft_##suffix##_test,                             \
+                      arm_conv_fft_##suffix)                                    \
+    {                                                                           \
+        output_type * a_ptr = (output_type *) CONV_FFT_##suffix##_INPUTS;       \
+        output_type * b_ptr =                                                   \
+            (output_type *) CONV_FFT_##suffix##_INPUTS + CONV_FFT_KERNEL_OFFSET; \
+        output_type * scratch_ptr = (output_type *) conv_fft_scratch;           \
+                                                                                \
+        TEMPLATE_DO_ARR_DESC(                                                   \
+            len_idx, uint32_t, a_len, conv_fft_lens_a                           \
+            ,                                                                   \
+            uint32_t b_len = ARR_DESC_ELT(uint32_t, len_idx, &(conv_fft_lens_b)); \
+            uint32_t out_len = a_len + b_len - 1;                               \
+            uint32_t corr_len = 2 * ((a_len > b_len) ? a_len : b_len) - 1;      \
+            uint32_t first_index = out_len / 3;                                 \
+            uint32_t num_points = out_len / 2 + 1;                              \
+                                                                                \
+            if ((arm_conv_fft_scratch_size_##suffix(                            \
+                     a_len, b_len, 0, out_len) > CONV_FFT_MAX_SCRATCH_ELTS) ||  \
+                (arm_conv_fft_scratch_size_##suffix(                            \
+                     a_len, b_len, first_index, num_points) >                   \
+                 CONV_FFT_MAX_SCRATCH_ELTS))                                    \
+            {                                                                   \
+                JTEST_DUMP_STR("Scratch buffer too small.\n");                  \
+                return JTEST_TEST_FAILED;                                       \
+            }                                                                   \
+                                                                                \
+            JTEST_DUMP_STRF("Input A Length: %d\n"                              \
+                            "Input B Length: %d\n"                              \
+                            "FFT Length: %d\n",                                 \
+                            (int)a_len,                                         \
+                            (int)b_len,                                         \
+                            (int)arm_conv_fft_len_##suffix(a_len, b_len, 0, out_len)); \
+                                                                                \
+            /* Convolution, both argument orders */                            \
+            TEST_CALL_FUT_AND_REF(                                              \
+                arm_conv_fft_##suffix,                                          \
+                (a_ptr, a_len, b_ptr, b_len,                                    \
+                 (output_type *) filtering_output_fut, scratch_ptr),            \
+                ref_conv_##suffix,                                              \
+                (a_ptr, a_len, b_ptr, b_len,                                    \
+                 (output_type *) filtering_output_ref));                        \
+            FILTERING_SNR_COMPARE_INTERFACE(out_len, output_type);              \
+                                                                                \
+            arm_conv_fft_##suffix(b_ptr, b_len, a_ptr, a_len,                   \
+                                  (output_type *) filtering_output_fut,         \
+                                  scratch_ptr);                                 \
+            FILTERING_SNR_COMPARE_INTERFACE(out_len, output_type);              \
+                                                                                \
+            /* Partial convolution */                                          \
+            if (arm_conv_partial_fft_##suffix(                                  \
+                    a_ptr, a_len, b_ptr, b_len,                                 \
+                    (output_type *) filtering_output_fut,                       \
+                    first_index, num_points, scratch_ptr) != ARM_MATH_SUCCESS)  \
+            {                                                                   \
+                JTEST_DUMP_STR("FUT raised an error.\n");                       \
+                return JTEST_TEST_FAILED;                                       \
+            }                                                                   \
+            FILTERING_SNR_COMPARE_INTERFACE_OFFSET(                             \
+                first_index, num_points, output_type);                          \
+                                                                                \
+            if (arm_conv_partial_fft_##suffix(                                  \
+                    a_ptr, a_len, b_ptr, b_len,                                 \
+                    (output_type *) filtering_output_fut,                       \
+                    out_len, 1, scratch_ptr) != ARM_MATH_ARGUMENT_ERROR)        \
+            {                                                                   \
+                JTEST_DUMP_STR("FUT failed to raise error.\n");                 \
+                return JTEST_TEST_FAILED;                                       \
+            }                                                                   \
+                                                                                \
+            /* Correlation, both argument orders */                            \
+            memset(filtering_output_fut, 0, corr_len * sizeof(output_type));    \
+            memset(filtering_output_ref, 0, corr_len * sizeof(output_type));    \
+            arm_correlate_fft_##suffix(a_ptr, a_len, b_ptr, b_len,              \
+                                       (output_type *) filtering_output_fut,    \
+                                       scratch_ptr);                            \
+            ref_correlate_##suffix(a_ptr, a_len, b_ptr, b_len,                  \
+                                   (output_type *) filtering_output_ref);       \
+            FILTERING_SNR_COMPARE_INTERFACE(corr_len, output_type);             \
+                                                                                \
+            memset(filtering_output_fut, 0, corr_len * sizeof(output_type));    \
+            memset(filtering_output_ref, 0, corr_len * sizeof(output_type));    \
+            arm_correlate_fft_##suffix(b_ptr, b_len, a_ptr, a_len,              \
+                                       (output_type *) filtering_output_fut,    \
+                                       scratch_ptr);                            \
+            ref_correlate_##suffix(b_ptr, b_len, a_ptr, a_len,                  \
+                                   (output_type *) filtering_output_ref);       \
+            FILTERING_SNR_COMPARE_INTERFACE(corr_len, output_type));            \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+CONV_FFT_AUTO_TEST_TEMPLATE(f32, float32_t);
+CONV_FFT_AUTO_TEST_TEMPLATE(q31, q31_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Streaming FIR Tests */
+/*--------------------------------------------------------------------------------*/
+
+/*
+ *  Filters CONV_FFT_FIR_NUM_BLOCKS consecutive blocks and compares the output
+ *  with the convolution of the whole input with the filter, once with the FFT
+ *  length chosen by arm_fir_fft_len_xxx() and once with a short FFT that
+ *  partitions the filter.
+ */
+#define CONV_FFT_FIR_TEST_TEMPLATE(suffix, output_type, spec_factor, min_fft_len) \
+    JTEST_DEFINE_TEST(arm_fir_fft_##suffix##_test,                              \
+                      arm_fir_fft_##suffix)                                     \
+    {                                                                           \
+        arm_fir_fft_instance_##suffix fir_fft_inst;                             \
+        output_type * input_ptr = (output_type *) CONV_FFT_##suffix##_INPUTS;   \
+        output_type * coeffs_ptr = (output_type *) conv_fft_coeffs;             \
+        output_type * scratch_ptr = (output_type *) conv_fft_scratch;           \
+        uint32_t block_size = CONV_FFT_MAX_SIGNAL_ELTS / CONV_FFT_FIR_NUM_BLOCKS; \
+        uint32_t num_taps = 2 * block_size;                                     \
+        uint32_t pass;                                                          \
+        uint32_t i;                                                             \
+                                                                                \
+        /* Filter b[k] = input[CONV_FFT_KERNEL_OFFSET + k], time reversed */    \
+        for (i = 0; i < num_taps; i++)                                          \
+        {                                                                       \
+            coeffs_ptr[i] = input_ptr[CONV_FFT_KERNEL_OFFSET + num_taps - 1 - i]; \
+        }                                                                       \
+                                                                                \
+        ref_conv_##suffix(input_ptr, CONV_FFT_MAX_SIGNAL_ELTS,                  \
+                          input_ptr + CONV_FFT_KERNEL_OFFSET, num_taps,         \
+                          (output_type *) filtering_output_ref);                \
+                                                                                \
+        for (pass = 0; pass < 3; pass++)                                        \
+        {                                                                       \
+            uint16_t fft_len =                                                  \
+                (pass == 0) ? arm_fir_fft_len_##suffix(num_taps, block_size) :  \
+                (pass == 1) ? (min_fft_len) : 0;                                \
+            uint32_t spec_len =                                                 \
+                (fft_len == 0) ? 0 : ((spec_factor) *                           \
+                    ARM_CONV_FFT_NUM_PARTS(num_taps, fft_len) * fft_len);       \
+                                                                                \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                  \
+                            "FFT Length: %d\n",                                 \
+                            (int)block_size,                                    \
+                            (int)fft_len);                                      \
+                                                                                \
+            if (arm_fir_fft_init_##suffix(&fir_fft_inst, num_taps, coeffs_ptr,  \
+                                          (output_type *) conv_fft_state,       \
+                                          block_size, fft_len, scratch_ptr,     \
+                                          scratch_ptr + spec_len)               \
+                != ARM_MATH_SUCCESS)                                            \
+            {                                                                   \
+                JTEST_DUMP_STR("FUT raised an error.\n");                       \
+                return JTEST_TEST_FAILED;                                       \
+            }                                                                   \
+                                                                                \
+            for (i = 0; i < CONV_FFT_FIR_NUM_BLOCKS; i++)                       \
+            {                                                                   \
+                TEST_CALL_FUT(                                                  \
+                    arm_fir_fft_##suffix,                                       \
+                    (&fir_fft_inst, input_ptr + i * block_size,                 \
+                     (output_type *) filtering_output_fut + i * block_size,     \
+                     block_size));                                              \
+            }                                                                   \
+                                                                                \
+            FILTERING_SNR_COMPARE_INTERFACE(CONV_FFT_MAX_SIGNAL_ELTS,           \
+                                            output_type);                       \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+CONV_FFT_FIR_TEST_TEMPLATE(f32, float32_t, 1, 64);
+CONV_FFT_FIR_TEST_TEMPLATE(q31, q31_t, 2, 64);
+
+/*--------------------------------------------------------------------------------*/
+/* Crossover Benchmark */
+/*--------------------------------------------------------------------------------*/
+
+/*
+ *  Convolves a signal of CONV_FFT_MAX_SIGNAL_ELTS samples with kernels of
+ *  conv_fft_bench_lens samples, with the direct form, with the FFT form and
+ *  with the automatic selection. The three tests print the same "Input A/B
+ *  Length" lines, so their timings line up per size in the cycle log and in
+ *  the host report: the crossover is the first kernel length for which the FFT
+ *  form is faster. The FFT form is only checked for accuracy here; the
+ *  automatic function should track the faster of the two.
+ */
+/**
+ *  FFT form of a one-shot convolution with a given FFT length, as timed by the
+ *  crossover benchmark: kernel transform, clearing of the output and overlap-add.
+ */
+#define CONV_FFT_DEFINE_BENCH_FN(suffix, output_type, spec_factor)              \
+    static void conv_fft_bench_##suffix(                                        \
+        arm_conv_fft_instance_##suffix * inst,                                  \
+        output_type * signal_ptr, uint32_t signal_len,                          \
+        output_type * kernel_ptr, uint32_t kernel_len,                          \
+        uint16_t fft_len, output_type * out_ptr, output_type * scratch_ptr)     \
+    {                                                                           \
+        output_type * work_ptr = scratch_ptr + (spec_factor) *                  \
+            ARM_CONV_FFT_NUM_PARTS(kernel_len, fft_len) * fft_len;              \
+                                                                                \
+        arm_conv_fft_init_##suffix(inst, kernel_ptr, kernel_len, 0, fft_len,    \
+                                   scratch_ptr                                  \
+                                   CONV_FFT_INIT_SCRATCH_##suffix(work_ptr));   \
+        memset(out_ptr, 0, (signal_len + kernel_len - 1) * sizeof(output_type)); \
+        arm_conv_fft_add_##suffix(inst, signal_ptr, signal_len, 0,              \
+                                  out_ptr, work_ptr);                           \
+    }
+
+CONV_FFT_DEFINE_BENCH_FN(f32, float32_t, 1);
+CONV_FFT_DEFINE_BENCH_FN(q31, q31_t, 2);
+
+#define CONV_FFT_BENCH_DIRECT 0
+#define CONV_FFT_BENCH_FFT    1
+#define CONV_FFT_BENCH_AUTO   2
+
+#define CONV_FFT_BENCH_TEST_TEMPLATE(suffix, output_type, mode, fut_name,      \
+                                     min_fft_len)                               \
+    JTEST_DEFINE_TEST(arm_conv_fft_bench_##fut_name##_test, fut_name)           \
+    {                                                                           \
+        arm_conv_fft_instance_##suffix conv_fft_inst;                           \
+        output_type * signal_ptr = (output_type *) CONV_FFT_##suffix##_INPUTS;  \
+        output_type * kernel_ptr =                                              \
+            (output_type *) CONV_FFT_##suffix##_INPUTS + CONV_FFT_KERNEL_OFFSET; \
+        output_type * scratch_ptr = (output_type *) conv_fft_scratch;           \
+        uint32_t signal_len = CONV_FFT_MAX_SIGNAL_ELTS;                         \
+                                                                                \
+        TEMPLATE_DO_ARR_DESC(                                                   \
+            len_idx, uint32_t, kernel_len, conv_fft_bench_lens                  \
+            ,                                                                   \
+            uint32_t out_len = signal_len + kernel_len - 1;                     \
+            uint16_t fft_len = conv_fft_bench_fft_len(kernel_len, min_fft_len); \
+                                                                                \
+            JTEST_DUMP_STRF("Input A Length: %d\n"                              \
+                            "Input B Length: %d\n",                             \
+                            (int)signal_len,                                    \
+                            (int)kernel_len);                                   \
+                                                                                \
+            if ((mode) == CONV_FFT_BENCH_DIRECT)                                \
+            {                                                                   \
+                TEST_CALL_FUT(                                                  \
+                    arm_conv_##suffix,                                          \
+                    (signal_ptr, signal_len, kernel_ptr, kernel_len,            \
+                     (output_type *) filtering_output_fut));                    \
+            }                                                                   \
+            else if ((mode) == CONV_FFT_BENCH_FFT)                              \
+            {                                                                   \
+                JTEST_DUMP_STRF("FFT Length: %d\n", (int)fft_len);              \
+                                                                                \
+                /* One-shot cost: kernel transform included */                  \
+                TEST_CALL_FUT(                                                  \
+                    conv_fft_bench_##suffix,                                    \
+                    (&conv_fft_inst, signal_ptr, signal_len,                    \
+                     kernel_ptr, kernel_len, fft_len,                           \
+                     (output_type *) filtering_output_fut, scratch_ptr));       \
+            }                                                                   \
+            else                                                                \
+            {                                                                   \
+                JTEST_DUMP_STRF("FFT Length: %d\n",                             \
+                                (int)arm_conv_fft_len_##suffix(                 \
+                                    signal_len, kernel_len, 0, out_len));       \
+                TEST_CALL_FUT(                                                  \
+                    arm_conv_fft_##suffix,                                      \
+                    (signal_ptr, signal_len, kernel_ptr, kernel_len,            \
+                     (output_type *) filtering_output_fut, scratch_ptr));       \
+            }                                                                   \
+                                                                                \
+            ref_conv_##suffix(signal_ptr, signal_len, kernel_ptr, kernel_len,   \
+                              (output_type *) filtering_output_ref);            \
+            FILTERING_SNR_COMPARE_INTERFACE(out_len, output_type));             \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+CONV_FFT_BENCH_TEST_TEMPLATE(f32, float32_t, CONV_FFT_BENCH_DIRECT, arm_conv_f32, 32);
+CONV_FFT_BENCH_TEST_TEMPLATE(f32, float32_t, CONV_FFT_BENCH_FFT, arm_conv_fft_add_f32, 32);
+CONV_FFT_BENCH_TEST_TEMPLATE(f32, float32_t, CONV_FFT_BENCH_AUTO, arm_conv_fft_f32, 32);
+CONV_FFT_BENCH_TEST_TEMPLATE(q31, q31_t, CONV_FFT_BENCH_DIRECT, arm_conv_q31, 16);
+CONV_FFT_BENCH_TEST_TEMPLATE(q31, q31_t, CONV_FFT_BENCH_FFT, arm_conv_fft_add_q31, 16);
+CONV_FFT_BENCH_TEST_TEMPLATE(q31, q31_t, CONV_FFT_BENCH_AUTO, arm_conv_fft_q31, 16);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(conv_fft_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_conv_fft_engines_f32_test);
+    JTEST_TEST_CALL(arm_conv_fft_f32_test);
+    JTEST_TEST_CALL(arm_fir_fft_f32_test);
+    JTEST_TEST_CALL(arm_conv_fft_engines_q31_test);
+    JTEST_TEST_CALL(arm_conv_fft_q31_test);
+    JTEST_TEST_CALL(arm_fir_fft_q31_test);
+
+    JTEST_TEST_CALL(arm_conv_fft_bench_arm_conv_f32_test);
+    JTEST_TEST_CALL(arm_conv_fft_bench_arm_conv_fft_add_f32_test);
+    JTEST_TEST_CALL(arm_conv_fft_bench_arm_conv_fft_f32_test);
+    JTEST_TEST_CALL(arm_conv_fft_bench_arm_conv_q31_test);
+    JTEST_TEST_CALL(arm_conv_fft_bench_arm_conv_fft_add_q31_test);
+    JTEST_TEST_CALL(arm_conv_fft_bench_arm_conv_fft_q31_test);
+}
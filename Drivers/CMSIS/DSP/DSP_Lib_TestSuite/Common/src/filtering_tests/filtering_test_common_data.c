@@ -590,6 +590,12 @@ ARR_DESC_DEFINE(uint8_t,
                 CURLY(
                       1, 2, 4, 7, 11, FILTERING_MAX_M));
 
+ARR_DESC_DEFINE(uint16_t,
+                filtering_numchannels,
+                5,
+                CURLY(
+                      1, 2, 3, 4, FILTERING_MAX_NUMCHANNELS));
+
 
 /*--------------------------------------------------------------------------------*/
 /* Coefficient Lists */
@@ -112,6 +112,401 @@
             return JTEST_TEST_PASSED;                                         \
    }
 
+#define FIR_RESAMPLE_DEFINE_TEST(suffix, output_type)                         \
+   JTEST_DEFINE_TEST(arm_fir_resample_##suffix##_test,                        \
+         arm_fir_resample_##suffix)                                           \
+   {                                                                          \
+      arm_fir_resample_instance_##suffix fir_inst_fut = { 0 };                \
+      arm_fir_resample_instance_##suffix fir_inst_ref = { 0 };                \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes          \
+            ,                                                                 \
+         TEMPLATE_DO_ARR_DESC(                                                \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps2             \
+               ,                                                              \
+            TEMPLATE_DO_ARR_DESC(                                             \
+                  L_idx, uint8_t, L, filtering_Ls                             \
+                  ,                                                           \
+               TEMPLATE_DO_ARR_DESC(                                          \
+                     M_idx, uint8_t, M, filtering_Ms                          \
+                     ,                                                        \
+                     if (blockSize % M == 0)                                  \
+                     {                                                        \
+                        /* Display test parameter values */                   \
+                        JTEST_DUMP_STRF("Block Size: %d\n"                    \
+                                        "Number of Taps: %d\n"                \
+                                        "Upsample factor: %d\n"               \
+                                        "Decimation Factor: %d\n",            \
+                                        (int)blockSize,                       \
+                                        (int)numTaps,                         \
+                                        (int)L,                               \
+                                        (int)M);                              \
+                                                                              \
+                        /* Initialize the FIR Instances */                    \
+                        arm_fir_resample_init_##suffix(                       \
+                              &fir_inst_fut, L, M, numTaps,                   \
+                              (output_type*)filtering_coeffs_##suffix,        \
+                              (void *) filtering_pState, blockSize);          \
+                                                                              \
+                        JTEST_COUNT_CYCLES(                                   \
+                              arm_fir_resample_##suffix(                      \
+                                    &fir_inst_fut,                            \
+                                    (void *) filtering_##suffix##_inputs,     \
+                                    (void *) filtering_output_fut,            \
+                                    blockSize));                              \
+                                                                              \
+                        arm_fir_resample_init_##suffix(                       \
+                              &fir_inst_ref, L, M, numTaps,                   \
+                              (output_type*)filtering_coeffs_##suffix,        \
+                              (void *) filtering_pState, blockSize);          \
+                                                                              \
+                        ref_fir_resample_##suffix(                            \
+                              &fir_inst_ref,                                  \
+                              (void *) filtering_##suffix##_inputs,           \
+                              (void *) filtering_output_ref,                  \
+                              blockSize);                                     \
+                                                                              \
+                        FILTERING_SNR_COMPARE_INTERFACE(                      \
+                              blockSize * (uint32_t)L / M,                    \
+                              output_type);                                   \
+                     }))));                                                   \
+                                                                              \
+            return JTEST_TEST_PASSED;                                         \
+   }
+
+/*
+ *  Resampler benchmark: a block of FIR_RESAMPLE_BENCH_BLOCKSIZE samples is
+ *  resampled by the ratios of fir_resample_bench_Ls / fir_resample_bench_Ms,
+ *  once with arm_fir_resample_xxx() and once with arm_fir_interpolate_xxx()
+ *  followed by arm_fir_decimate_xxx() with a single unit tap, which keeps
+ *  every M-th interpolated sample. Both tests print the same parameter lines,
+ *  so their timings line up in the cycle log and in the host report.
+ */
+#define FIR_RESAMPLE_BENCH_BLOCKSIZE 240
+#define FIR_RESAMPLE_BENCH_NUMTAPS   24
+#define FIR_RESAMPLE_BENCH_MAX_L     6
+
+static float32_t fir_resample_bench_up[FIR_RESAMPLE_BENCH_BLOCKSIZE * FIR_RESAMPLE_BENCH_MAX_L];
+static float32_t fir_resample_bench_state[FIR_RESAMPLE_BENCH_BLOCKSIZE * FIR_RESAMPLE_BENCH_MAX_L];
+
+static float32_t fir_resample_bench_unit_f32 = 1.0f;
+static q31_t fir_resample_bench_unit_q31 = 0x7FFFFFFF;
+static q15_t fir_resample_bench_unit_q15 = 0x7FFF;
+
+/*
+ *  The fir_resample_bench_Ls and fir_resample_bench_Ms #ARR_DESC_t objects are
+ *  accessed in parallel.
+ */
+ARR_DESC_DEFINE(uint8_t,
+                fir_resample_bench_Ls,
+                5,
+                CURLY(
+                    3,
+                    2,
+                    4,
+                    3,
+                    FIR_RESAMPLE_BENCH_MAX_L
+                    ));
+
+ARR_DESC_DEFINE(uint8_t,
+                fir_resample_bench_Ms,
+                5,
+                CURLY(
+                    2,
+                    3,
+                    3,
+                    4,
+                    5
+                    ));
+
+/**
+ *  Interpolator and decimator cascade equivalent to arm_fir_resample_xxx(), as
+ *  timed by the benchmark: with a single unit tap the decimator keeps the
+ *  samples 0, M, 2M, ... of the interpolated block.
+ */
+#define FIR_RESAMPLE_DEFINE_CASCADE_FN(suffix, output_type)                   \
+   static void fir_resample_cascade_##suffix(                                 \
+         arm_fir_interpolate_instance_##suffix * interp_inst,                 \
+         arm_fir_decimate_instance_##suffix * decim_inst,                     \
+         output_type * pSrc,                                                  \
+         output_type * pDst,                                                  \
+         uint32_t blockSize)                                                  \
+   {                                                                          \
+      arm_fir_interpolate_##suffix(                                           \
+            interp_inst, pSrc,                                                \
+            (output_type *) fir_resample_bench_up, blockSize);                \
+      arm_fir_decimate_##suffix(                                              \
+            decim_inst, (output_type *) fir_resample_bench_up,                \
+            pDst, blockSize * interp_inst->L);                                \
+   }
+
+FIR_RESAMPLE_DEFINE_CASCADE_FN(f32, float32_t);
+FIR_RESAMPLE_DEFINE_CASCADE_FN(q31, q31_t);
+FIR_RESAMPLE_DEFINE_CASCADE_FN(q15, q15_t);
+
+#define FIR_RESAMPLE_BENCH_DEFINE_TEST(suffix, output_type, cascade)          \
+   JTEST_DEFINE_TEST(arm_fir_resample_bench##cascade##_##suffix##_test,       \
+         arm_fir_resample##cascade##_##suffix)                                \
+   {                                                                          \
+      arm_fir_resample_instance_##suffix fir_inst_ref = { 0 };                \
+      uint32_t blockSize = FIR_RESAMPLE_BENCH_BLOCKSIZE;                      \
+      uint16_t numTaps = FIR_RESAMPLE_BENCH_NUMTAPS;                          \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            L_idx, uint8_t, L, fir_resample_bench_Ls                          \
+            ,                                                                 \
+            uint8_t M = ARR_DESC_ELT(uint8_t, L_idx, &(fir_resample_bench_Ms)); \
+                                                                              \
+            /* Display test parameter values */                               \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                \
+                            "Number of Taps: %d\n"                            \
+                            "Upsample factor: %d\n"                           \
+                            "Decimation Factor: %d\n",                        \
+                            (int)blockSize,                                   \
+                            (int)numTaps,                                     \
+                            (int)L,                                           \
+                            (int)M);                                          \
+                                                                              \
+            FIR_RESAMPLE_BENCH_CALL##cascade(suffix, output_type);            \
+                                                                              \
+            arm_fir_resample_init_##suffix(                                   \
+                  &fir_inst_ref, L, M, numTaps,                               \
+                  (output_type*)filtering_coeffs_##suffix,                    \
+                  (void *) filtering_pState, blockSize);                      \
+                                                                              \
+            ref_fir_resample_##suffix(                                        \
+                  &fir_inst_ref,                                              \
+                  (void *) filtering_##suffix##_inputs,                       \
+                  (void *) filtering_output_ref,                              \
+                  blockSize);                                                 \
+                                                                              \
+            FILTERING_SNR_COMPARE_INTERFACE(                                  \
+                  blockSize * (uint32_t)L / M,                                \
+                  output_type));                                              \
+                                                                              \
+      return JTEST_TEST_PASSED;                                               \
+   }
+
+#define FIR_RESAMPLE_BENCH_CALL(suffix, output_type)                          \
+   do                                                                         \
+   {                                                                          \
+      arm_fir_resample_instance_##suffix fir_inst_fut = { 0 };                \
+                                                                              \
+      arm_fir_resample_init_##suffix(                                         \
+            &fir_inst_fut, L, M, numTaps,                                     \
+            (output_type*)filtering_coeffs_##suffix,                          \
+            (void *) filtering_pState, blockSize);                            \
+                                                                              \
+      JTEST_COUNT_CYCLES(                                                     \
+            arm_fir_resample_##suffix(                                        \
+                  &fir_inst_fut,                                              \
+                  (void *) filtering_##suffix##_inputs,                       \
+                  (void *) filtering_output_fut,                              \
+                  blockSize));                                                \
+   } while (0)
+
+#define FIR_RESAMPLE_BENCH_CALL_cascade(suffix, output_type)                  \
+   do                                                                         \
+   {                                                                          \
+      arm_fir_interpolate_instance_##suffix interp_inst = { 0 };              \
+      arm_fir_decimate_instance_##suffix decim_inst = { 0 };                  \
+                                                                              \
+      arm_fir_interpolate_init_##suffix(                                      \
+            &interp_inst, L, numTaps,                                         \
+            (output_type*)filtering_coeffs_##suffix,                          \
+            (void *) filtering_pState, blockSize);                            \
+      arm_fir_decimate_init_##suffix(                                         \
+            &decim_inst, 1, M,                                                \
+            &fir_resample_bench_unit_##suffix,                                \
+            (void *) fir_resample_bench_state, blockSize * L);                \
+                                                                              \
+      TEST_CALL_FUT(                                                          \
+            fir_resample_cascade_##suffix,                                    \
+            (&interp_inst, &decim_inst,                                       \
+             (output_type *) filtering_##suffix##_inputs,                     \
+             (output_type *) filtering_output_fut,                            \
+             blockSize));                                                     \
+   } while (0)
+
+#define FIR_MULTI_DEFINE_TEST(layout)                                         \
+   JTEST_DEFINE_TEST(arm_fir_multi##layout##_q15_test,                        \
+         arm_fir_multi##layout##_q15)                                         \
+   {                                                                          \
+      arm_fir_multi_instance_q15 fir_inst_fut = { 0 };                        \
+      arm_fir_multi_instance_q15 fir_inst_ref = { 0 };                        \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes          \
+            ,                                                                 \
+         TEMPLATE_DO_ARR_DESC(                                                \
+               numtaps_idx, uint16_t, numTaps, filtering_numtaps              \
+               ,                                                              \
+            TEMPLATE_DO_ARR_DESC(                                             \
+                  numch_idx, uint16_t, numChannels, filtering_numchannels     \
+                  ,                                                           \
+                  /* Display test parameter values */                         \
+                  JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                                  "Number of Taps: %d\n"                      \
+                                  "Number of Channels: %d\n",                 \
+                                  (int)blockSize,                             \
+                                  (int)numTaps,                               \
+                                  (int)numChannels);                          \
+                                                                              \
+                  /* Initialize the FIR Instances */                          \
+                  arm_fir_multi_init_q15(                                     \
+                        &fir_inst_fut, numTaps, numChannels,                  \
+                        (q15_t*)filtering_coeffs_q15,                         \
+                        (void *) filtering_pState, blockSize);                \
+                                                                              \
+                  JTEST_COUNT_CYCLES(                                         \
+                        arm_fir_multi##layout##_q15(                          \
+                              &fir_inst_fut,                                  \
+                              (void *) filtering_q15_inputs,                  \
+                              (void *) filtering_output_fut,                  \
+                              blockSize));                                    \
+                                                                              \
+                  arm_fir_multi_init_q15(                                     \
+                        &fir_inst_ref, numTaps, numChannels,                  \
+                        (q15_t*)filtering_coeffs_q15,                         \
+                        (void *) filtering_pState, blockSize);                \
+                                                                              \
+                  ref_fir_multi##layout##_q15(                                \
+                        &fir_inst_ref,                                        \
+                        (void *) filtering_q15_inputs,                        \
+                        (void *) filtering_output_ref,                        \
+                        blockSize);                                           \
+                                                                              \
+                  /* Each channel must match a single channel filter */       \
+                  TEST_ASSERT_BUFFERS_EQUAL(                                  \
+                        filtering_output_ref,                                 \
+                        filtering_output_fut,                                 \
+                        blockSize * numChannels * sizeof(q15_t)))));          \
+                                                                              \
+            return JTEST_TEST_PASSED;                                         \
+   }
+
+/*
+ *  Multi-channel benchmark: FIR_MULTI_BENCH_BLOCKSIZE samples of each channel
+ *  of a planar block are filtered once with arm_fir_multi_planar_q15() and once
+ *  with one arm_fir_q15() call per channel. Both tests print the same
+ *  parameter lines, so their timings line up in the cycle log.
+ */
+#define FIR_MULTI_BENCH_BLOCKSIZE 32
+#define FIR_MULTI_BENCH_NUMTAPS   32
+
+static arm_fir_instance_q15 fir_multi_bench_inst[FILTERING_MAX_NUMCHANNELS];
+
+ARR_DESC_DEFINE(uint16_t,
+                fir_multi_bench_numchannels,
+                3,
+                CURLY(
+                    2,
+                    4,
+                    FILTERING_MAX_NUMCHANNELS
+                    ));
+
+/**
+ *  Independent single channel filters equivalent to
+ *  arm_fir_multi_planar_q15(), as timed by the benchmark.
+ */
+static void fir_multi_separate_q15(
+      uint16_t numChannels,
+      q15_t * pSrc,
+      q15_t * pDst,
+      uint32_t blockSize)
+{
+   uint16_t ch;
+
+   for (ch = 0; ch < numChannels; ch++)
+   {
+      arm_fir_q15(&fir_multi_bench_inst[ch],
+                  pSrc + ch * blockSize,
+                  pDst + ch * blockSize,
+                  blockSize);
+   }
+}
+
+#define FIR_MULTI_BENCH_DEFINE_TEST(separate)                                 \
+   JTEST_DEFINE_TEST(arm_fir_multi_bench##separate##_q15_test,                \
+         arm_fir_multi##separate##_q15)                                       \
+   {                                                                          \
+      arm_fir_multi_instance_q15 fir_inst_ref = { 0 };                        \
+      uint32_t blockSize = FIR_MULTI_BENCH_BLOCKSIZE;                         \
+      uint16_t numTaps = FIR_MULTI_BENCH_NUMTAPS;                             \
+                                                                              \
+      TEMPLATE_DO_ARR_DESC(                                                   \
+            numch_idx, uint16_t, numChannels, fir_multi_bench_numchannels     \
+            ,                                                                 \
+            /* Display test parameter values */                               \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                \
+                            "Number of Taps: %d\n"                            \
+                            "Number of Channels: %d\n",                       \
+                            (int)blockSize,                                   \
+                            (int)numTaps,                                     \
+                            (int)numChannels);                                \
+                                                                              \
+            FIR_MULTI_BENCH_CALL##separate();                                 \
+                                                                              \
+            arm_fir_multi_init_q15(                                           \
+                  &fir_inst_ref, numTaps, numChannels,                        \
+                  (q15_t*)filtering_coeffs_q15,                               \
+                  (void *) filtering_pState, blockSize);                      \
+                                                                              \
+            ref_fir_multi_planar_q15(                                         \
+                  &fir_inst_ref,                                              \
+                  (void *) filtering_q15_inputs,                              \
+                  (void *) filtering_output_ref,                              \
+                  blockSize);                                                 \
+                                                                              \
+            TEST_ASSERT_BUFFERS_EQUAL(                                        \
+                  filtering_output_ref,                                       \
+                  filtering_output_fut,                                       \
+                  blockSize * numChannels * sizeof(q15_t)));                  \
+                                                                              \
+      return JTEST_TEST_PASSED;                                               \
+   }
+
+#define FIR_MULTI_BENCH_CALL()                                                \
+   do                                                                         \
+   {                                                                          \
+      arm_fir_multi_instance_q15 fir_inst_fut = { 0 };                        \
+                                                                              \
+      arm_fir_multi_init_q15(                                                 \
+            &fir_inst_fut, numTaps, numChannels,                              \
+            (q15_t*)filtering_coeffs_q15,                                     \
+            (void *) filtering_pState, blockSize);                            \
+                                                                              \
+      JTEST_COUNT_CYCLES(                                                     \
+            arm_fir_multi_planar_q15(                                         \
+                  &fir_inst_fut,                                              \
+                  (void *) filtering_q15_inputs,                              \
+                  (void *) filtering_output_fut,                              \
+                  blockSize));                                                \
+   } while (0)
+
+#define FIR_MULTI_BENCH_CALL_separate()                                       \
+   do                                                                         \
+   {                                                                          \
+      uint16_t ch;                                                            \
+                                                                              \
+      for (ch = 0; ch < numChannels; ch++)                                    \
+      {                                                                       \
+         arm_fir_init_q15(                                                    \
+               &fir_multi_bench_inst[ch], numTaps,                            \
+               (q15_t*)filtering_coeffs_q15,                                  \
+               (q15_t *) filtering_pState + ch * (numTaps + blockSize),       \
+               blockSize);                                                    \
+      }                                                                       \
+                                                                              \
+      TEST_CALL_FUT(                                                          \
+            fir_multi_separate_q15,                                           \
+            (numChannels,                                                     \
+             (q15_t *) filtering_q15_inputs,                                  \
+             (q15_t *) filtering_output_fut,                                  \
+             blockSize));                                                     \
+   } while (0)
+
 #define FIR_DECIMATE_DEFINE_TEST(suffix, config_suffix, output_type)       \
    JTEST_DEFINE_TEST(arm_fir_decimate##config_suffix##_##suffix##_test,    \
          arm_fir_decimate##config_suffix##_##suffix)                       \
@@ -354,6 +749,23 @@ FIR_INTERPOLATE_DEFINE_TEST(f32,float32_t);
 FIR_INTERPOLATE_DEFINE_TEST(q31,q31_t);
 FIR_INTERPOLATE_DEFINE_TEST(q15,q15_t);
 
+FIR_RESAMPLE_DEFINE_TEST(f32,float32_t);
+FIR_RESAMPLE_DEFINE_TEST(q31,q31_t);
+FIR_RESAMPLE_DEFINE_TEST(q15,q15_t);
+
+FIR_RESAMPLE_BENCH_DEFINE_TEST(f32,float32_t,);
+FIR_RESAMPLE_BENCH_DEFINE_TEST(q31,q31_t,);
+FIR_RESAMPLE_BENCH_DEFINE_TEST(q15,q15_t,);
+FIR_RESAMPLE_BENCH_DEFINE_TEST(f32,float32_t,_cascade);
+FIR_RESAMPLE_BENCH_DEFINE_TEST(q31,q31_t,_cascade);
+FIR_RESAMPLE_BENCH_DEFINE_TEST(q15,q15_t,_cascade);
+
+FIR_MULTI_DEFINE_TEST();
+FIR_MULTI_DEFINE_TEST(_planar);
+
+FIR_MULTI_BENCH_DEFINE_TEST();
+FIR_MULTI_BENCH_DEFINE_TEST(_separate);
+
 FIR_DECIMATE_DEFINE_TEST(f32,,float32_t);
 FIR_DECIMATE_DEFINE_TEST(q31,,q31_t);
 FIR_DECIMATE_DEFINE_TEST(q15,,q15_t);
@@ -389,6 +801,23 @@ JTEST_DEFINE_GROUP(fir_tests)
    JTEST_TEST_CALL(arm_fir_interpolate_q31_test);
    JTEST_TEST_CALL(arm_fir_interpolate_q15_test);
 
+   JTEST_TEST_CALL(arm_fir_resample_f32_test);
+   JTEST_TEST_CALL(arm_fir_resample_q31_test);
+   JTEST_TEST_CALL(arm_fir_resample_q15_test);
+
+   JTEST_TEST_CALL(arm_fir_resample_bench_f32_test);
+   JTEST_TEST_CALL(arm_fir_resample_bench_cascade_f32_test);
+   JTEST_TEST_CALL(arm_fir_resample_bench_q31_test);
+   JTEST_TEST_CALL(arm_fir_resample_bench_cascade_q31_test);
+   JTEST_TEST_CALL(arm_fir_resample_bench_q15_test);
+   JTEST_TEST_CALL(arm_fir_resample_bench_cascade_q15_test);
+
+   JTEST_TEST_CALL(arm_fir_multi_q15_test);
+   JTEST_TEST_CALL(arm_fir_multi_planar_q15_test);
+
+   JTEST_TEST_CALL(arm_fir_multi_bench_q15_test);
+   JTEST_TEST_CALL(arm_fir_multi_bench_separate_q15_test);
+
    JTEST_TEST_CALL(arm_fir_decimate_f32_test);
    JTEST_TEST_CALL(arm_fir_decimate_q31_test);
    JTEST_TEST_CALL(arm_fir_decimate_q15_test);
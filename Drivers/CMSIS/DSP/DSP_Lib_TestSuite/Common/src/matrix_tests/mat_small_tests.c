@@ -0,0 +1,352 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Header Stuff */
+/*--------------------------------------------------------------------------------*/
+
+/* The fixed-size kernels cover 2x2 to 6x6 matrices; 1x1 and 7x7 matrices go
+ * through the generic functions. */
+#define MAT_SMALL_MAX_SIZE 7
+#define MAT_SMALL_MAX_ELTS (MAT_SMALL_MAX_SIZE * MAT_SMALL_MAX_SIZE)
+
+/* The Q31 Cholesky decomposition is limited by the precision of arm_sqrt_q31(). */
+#define MAT_SMALL_CHOLESKY_SNR_THRESHOLD_q31_t 100
+
+ARR_DESC_DEFINE(uint16_t,
+                mat_small_sizes,
+                7,
+                CURLY(
+                    1,
+                    2,
+                    3,
+                    4,
+                    5,
+                    6,
+                    7
+                    ));
+
+/* Values in [-1 1) from which the inputs are built. */
+static const float32_t mat_small_values[2 * MAT_SMALL_MAX_ELTS] =
+{
+    -0.0049f, -0.4677f, 0.2748f, -0.5150f, -0.0537f, 0.9407f, -0.8296f,
+    -0.3652f, 0.3529f, -0.8295f, -0.6934f, 0.6505f, 0.9594f, -0.3613f,
+    -0.6221f, 0.9448f, -0.3422f, 0.2076f, 0.2150f, 0.2700f, 0.8308f,
+    0.9249f, 0.3863f, 0.6498f, 0.5877f, 0.2862f, -0.1394f, -0.5456f,
+    -0.4676f, 0.8600f, 0.4001f, -0.7884f, 0.8216f, -0.4578f, 0.3849f,
+    -0.0800f, -0.4607f, -0.5815f, 0.1582f, -0.1765f, 0.2489f, 0.3920f,
+    0.6389f, 0.7064f, 0.2509f, 0.9328f, -0.0078f, 0.7751f, 0.6300f,
+    0.6351f, -0.7498f, 0.1409f, 0.0332f, -0.8137f, -0.2645f, 0.0335f,
+    -0.9865f, -0.9820f, 0.1740f, -0.1781f, 0.9567f, 0.7005f, 0.6576f,
+    0.6056f, -0.5516f, 0.4517f, -0.8042f, -0.7263f, -0.2478f, -0.5085f,
+    -0.9330f, 0.0357f, 0.9316f, -0.8425f, -0.5258f, 0.8526f, 0.0567f,
+    -0.0699f, -0.1635f, 0.6419f, -0.0596f, -0.1938f, -0.2750f, 0.5504f,
+    -0.9616f, -0.1129f, 0.2788f, -0.9823f, -0.3664f, -0.3064f, 0.2899f,
+    0.0389f, -0.0044f, -0.3970f, -0.1405f, 0.8530f, -0.7754f, -0.8242f
+};
+
+/* Inputs and outputs, in float32_t or q31_t elements. */
+static float32_t mat_small_a[MAT_SMALL_MAX_ELTS];
+static float32_t mat_small_b[MAT_SMALL_MAX_ELTS];
+static float32_t mat_small_fut[MAT_SMALL_MAX_ELTS];
+static float32_t mat_small_gen[MAT_SMALL_MAX_ELTS];
+static float32_t mat_small_ref[MAT_SMALL_MAX_ELTS];
+
+/* Float conversions of the outputs for the SNR comparisons. */
+static float32_t mat_small_f32_fut[MAT_SMALL_MAX_ELTS];
+static float32_t mat_small_f32_ref[MAT_SMALL_MAX_ELTS];
+
+/**
+ *  Fill pDst with n x n matrices of the given kind, converted to the output
+ *  type.
+ */
+typedef enum
+{
+    MAT_SMALL_PLAIN,            /* The values, scaled by 1/8 for Q31 */
+    MAT_SMALL_INVERTIBLE,       /* The values plus 2 on the diagonal */
+    MAT_SMALL_POSITIVE          /* V*V'/(2n) + I/4, below 1 */
+} mat_small_kind;
+
+static void mat_small_build(
+    void * pDst,
+    const float32_t * pValues,
+    uint32_t n,
+    mat_small_kind kind,
+    int is_q31)
+{
+    float32_t m[MAT_SMALL_MAX_ELTS];
+    float32_t sum;
+    uint32_t i, j, k;
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            switch (kind)
+            {
+            case MAT_SMALL_INVERTIBLE:
+                m[i*n + j] = pValues[i*n + j] + ((i == j) ? 2.0f : 0.0f);
+                break;
+
+            case MAT_SMALL_POSITIVE:
+                sum = 0.0f;
+                for (k = 0; k < n; k++)
+                {
+                    sum += pValues[i*n + k] * pValues[j*n + k];
+                }
+                m[i*n + j] = (sum / (2.0f * n)) + ((i == j) ? 0.25f : 0.0f);
+                break;
+
+            default:
+                m[i*n + j] = is_q31 ? (pValues[i*n + j] / 8.0f) : pValues[i*n + j];
+                break;
+            }
+        }
+    }
+
+    for (i = 0; i < n*n; i++)
+    {
+        if (is_q31)
+        {
+            ((q31_t *) pDst)[i] = (q31_t) (m[i] * 2147483648.0f);
+        }
+        else
+        {
+            ((float32_t *) pDst)[i] = m[i];
+        }
+    }
+}
+
+/**
+ *  Set up the n x n instances of the inputs and outputs.
+ */
+#define MAT_SMALL_CONFIG(suffix, n)                                          \
+    do                                                                       \
+    {                                                                        \
+        arm_mat_init_##suffix(&mat_a, n, n, (void *) mat_small_a);           \
+        arm_mat_init_##suffix(&mat_b, n, n, (void *) mat_small_b);           \
+        arm_mat_init_##suffix(&mat_fut, n, n, (void *) mat_small_fut);       \
+        arm_mat_init_##suffix(&mat_gen, n, n, (void *) mat_small_gen);       \
+        arm_mat_init_##suffix(&mat_ref, n, n, (void *) mat_small_ref);       \
+                                                                             \
+        JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n", (int)n, (int)n);       \
+    } while (0)
+
+/**
+ *  Compare the output of the function under test with the reference output:
+ *  by SNR for f32, exactly for Q31.
+ */
+#define MAT_SMALL_COMPARE_f32(n)                                             \
+    TEST_CONVERT_AND_ASSERT_SNR(                                             \
+        mat_small_f32_ref, (float32_t *) mat_small_ref,                      \
+        mat_small_f32_fut, (float32_t *) mat_small_fut,                      \
+        (n) * (n), float32_t, MATRIX_SNR_THRESHOLD)
+
+#define MAT_SMALL_COMPARE_q31(n)                                             \
+    TEST_ASSERT_BUFFERS_EQUAL(                                               \
+        mat_small_ref, mat_small_fut, (n) * (n) * sizeof(q31_t))
+
+/*--------------------------------------------------------------------------------*/
+/* Multiplication, Addition and Transpose */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Test template of the two-input functions. The cycles of the function under
+  test are displayed first, then those of the generic function.
+*/
+#define MAT_SMALL_ELT2_DEFINE_TEST(fn_name, suffix)                          \
+    JTEST_DEFINE_TEST(arm_mat_##fn_name##_small_##suffix##_test,             \
+                      arm_mat_##fn_name##_small_##suffix)                    \
+    {                                                                        \
+        arm_matrix_instance_##suffix mat_a, mat_b;                           \
+        arm_matrix_instance_##suffix mat_fut, mat_gen, mat_ref;              \
+        arm_status status;                                                   \
+                                                                             \
+        TEMPLATE_DO_ARR_DESC(                                                \
+            size_idx, uint16_t, n, mat_small_sizes                           \
+            ,                                                                \
+            mat_small_build(mat_small_a, mat_small_values, n,                \
+                            MAT_SMALL_PLAIN, IS_Q31_##suffix);               \
+            mat_small_build(mat_small_b, mat_small_values + (n * n), n,      \
+                            MAT_SMALL_PLAIN, IS_Q31_##suffix);               \
+            MAT_SMALL_CONFIG(suffix, n);                                     \
+                                                                             \
+            JTEST_COUNT_CYCLES(                                              \
+                status = arm_mat_##fn_name##_small_##suffix(                 \
+                    &mat_a, &mat_b, &mat_fut));                              \
+            JTEST_COUNT_CYCLES(                                              \
+                arm_mat_##fn_name##_##suffix(&mat_a, &mat_b, &mat_gen));     \
+                                                                             \
+            ref_mat_##fn_name##_##suffix(&mat_a, &mat_b, &mat_ref);          \
+                                                                             \
+            TEST_ASSERT_EQUAL(status, ARM_MATH_SUCCESS);                     \
+            MAT_SMALL_COMPARE_##suffix(n));                                  \
+                                                                             \
+        return JTEST_TEST_PASSED;                                            \
+    }
+
+#define IS_Q31_f32 0
+#define IS_Q31_q31 1
+
+MAT_SMALL_ELT2_DEFINE_TEST(mult, f32);
+MAT_SMALL_ELT2_DEFINE_TEST(mult, q31);
+MAT_SMALL_ELT2_DEFINE_TEST(add, f32);
+MAT_SMALL_ELT2_DEFINE_TEST(add, q31);
+
+#define MAT_SMALL_TRANS_DEFINE_TEST(suffix)                                  \
+    JTEST_DEFINE_TEST(arm_mat_trans_small_##suffix##_test,                   \
+                      arm_mat_trans_small_##suffix)                          \
+    {                                                                        \
+        arm_matrix_instance_##suffix mat_a, mat_b;                           \
+        arm_matrix_instance_##suffix mat_fut, mat_gen, mat_ref;              \
+        arm_status status;                                                   \
+                                                                             \
+        TEMPLATE_DO_ARR_DESC(                                                \
+            size_idx, uint16_t, n, mat_small_sizes                           \
+            ,                                                                \
+            mat_small_build(mat_small_a, mat_small_values, n,                \
+                            MAT_SMALL_PLAIN, IS_Q31_##suffix);               \
+            MAT_SMALL_CONFIG(suffix, n);                                     \
+                                                                             \
+            JTEST_COUNT_CYCLES(                                              \
+                status = arm_mat_trans_small_##suffix(&mat_a, &mat_fut));    \
+            JTEST_COUNT_CYCLES(                                              \
+                arm_mat_trans_##suffix(&mat_a, &mat_gen));                   \
+                                                                             \
+            ref_mat_trans_##suffix(&mat_a, &mat_ref);                        \
+                                                                             \
+            TEST_ASSERT_EQUAL(status, ARM_MATH_SUCCESS);                     \
+            MAT_SMALL_COMPARE_##suffix(n));                                  \
+                                                                             \
+        (void) mat_b;                                                        \
+        return JTEST_TEST_PASSED;                                            \
+    }
+
+MAT_SMALL_TRANS_DEFINE_TEST(f32);
+MAT_SMALL_TRANS_DEFINE_TEST(q31);
+
+/*--------------------------------------------------------------------------------*/
+/* Inverse */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_TEST(arm_mat_inverse_small_f32_test, arm_mat_inverse_small_f32)
+{
+    arm_matrix_instance_f32 mat_a, mat_b;
+    arm_matrix_instance_f32 mat_fut, mat_gen, mat_ref;
+    arm_status status;
+
+    TEMPLATE_DO_ARR_DESC(
+        size_idx, uint16_t, n, mat_small_sizes
+        ,
+        mat_small_build(mat_small_a, mat_small_values, n,
+                        MAT_SMALL_INVERTIBLE, 0);
+        MAT_SMALL_CONFIG(f32, n);
+
+        /* arm_mat_inverse_f32() modifies its source input, and so does
+         * arm_mat_inverse_small_f32() for the sizes it passes on. Both get
+         * a copy of the intended input. */
+        memcpy(mat_small_b, mat_small_a, n * n * sizeof(float32_t));
+        JTEST_COUNT_CYCLES(status = arm_mat_inverse_small_f32(&mat_b, &mat_fut));
+
+        memcpy(mat_small_b, mat_small_a, n * n * sizeof(float32_t));
+        JTEST_COUNT_CYCLES(arm_mat_inverse_f32(&mat_b, &mat_gen));
+
+        ref_mat_inverse_f32(&mat_a, &mat_ref);
+
+        TEST_ASSERT_EQUAL(status, ARM_MATH_SUCCESS);
+        MAT_SMALL_COMPARE_f32(n);
+
+        /* A zero matrix is singular */
+        memset(mat_small_b, 0, n * n * sizeof(float32_t));
+        status = arm_mat_inverse_small_f32(&mat_b, &mat_fut);
+        TEST_ASSERT_EQUAL(status, ARM_MATH_SINGULAR));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Cholesky Decomposition */
+/*--------------------------------------------------------------------------------*/
+
+#define MAT_SMALL_CHOLESKY_SNR_THRESHOLD_float32_t MATRIX_SNR_THRESHOLD
+
+/*
+  Cholesky decomposition test template. The dispatch and the generic function
+  are both compared with the reference, and must reject a matrix with a
+  negative diagonal term.
+*/
+#define MAT_SMALL_CHOLESKY_DEFINE_TEST(suffix, output_type)                  \
+    JTEST_DEFINE_TEST(arm_mat_cholesky_small_##suffix##_test,                \
+                      arm_mat_cholesky_small_##suffix)                       \
+    {                                                                        \
+        arm_matrix_instance_##suffix mat_a, mat_b;                           \
+        arm_matrix_instance_##suffix mat_fut, mat_gen, mat_ref;              \
+        arm_status status, status_gen;                                       \
+                                                                             \
+        TEMPLATE_DO_ARR_DESC(                                                \
+            size_idx, uint16_t, n, mat_small_sizes                           \
+            ,                                                                \
+            mat_small_build(mat_small_a, mat_small_values, n,                \
+                            MAT_SMALL_POSITIVE, IS_Q31_##suffix);            \
+            MAT_SMALL_CONFIG(suffix, n);                                     \
+                                                                             \
+            JTEST_COUNT_CYCLES(                                              \
+                status = arm_mat_cholesky_small_##suffix(&mat_a, &mat_fut)); \
+            JTEST_COUNT_CYCLES(                                              \
+                status_gen = arm_mat_cholesky_##suffix(&mat_a, &mat_gen));   \
+                                                                             \
+            ref_mat_cholesky_##suffix(&mat_a, &mat_ref);                     \
+                                                                             \
+            TEST_ASSERT_EQUAL(status, ARM_MATH_SUCCESS);                     \
+            TEST_ASSERT_EQUAL(status_gen, ARM_MATH_SUCCESS);                 \
+            TEST_CONVERT_AND_ASSERT_SNR(                                     \
+                mat_small_f32_ref, (output_type *) mat_small_ref,            \
+                mat_small_f32_fut, (output_type *) mat_small_fut,            \
+                n * n, output_type,                                          \
+                MAT_SMALL_CHOLESKY_SNR_THRESHOLD_##output_type);             \
+            TEST_CONVERT_AND_ASSERT_SNR(                                     \
+                mat_small_f32_ref, (output_type *) mat_small_ref,            \
+                mat_small_f32_fut, (output_type *) mat_small_gen,            \
+                n * n, output_type,                                          \
+                MAT_SMALL_CHOLESKY_SNR_THRESHOLD_##output_type);             \
+                                                                             \
+            /* A negative diagonal term is not positive definite */          \
+            ((output_type *) mat_small_a)[n * n - 1] =                       \
+                -((output_type *) mat_small_a)[n * n - 1];                   \
+            status = arm_mat_cholesky_small_##suffix(&mat_a, &mat_fut);      \
+            status_gen = arm_mat_cholesky_##suffix(&mat_a, &mat_gen);        \
+            TEST_ASSERT_EQUAL(status, ARM_MATH_SINGULAR);                    \
+            TEST_ASSERT_EQUAL(status_gen, ARM_MATH_SINGULAR));               \
+                                                                             \
+        (void) mat_b;                                                        \
+        return JTEST_TEST_PASSED;                                            \
+    }
+
+MAT_SMALL_CHOLESKY_DEFINE_TEST(f32, float32_t);
+MAT_SMALL_CHOLESKY_DEFINE_TEST(q31, q31_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_small_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mat_mult_small_f32_test);
+    JTEST_TEST_CALL(arm_mat_mult_small_q31_test);
+    JTEST_TEST_CALL(arm_mat_add_small_f32_test);
+    JTEST_TEST_CALL(arm_mat_add_small_q31_test);
+    JTEST_TEST_CALL(arm_mat_trans_small_f32_test);
+    JTEST_TEST_CALL(arm_mat_trans_small_q31_test);
+    JTEST_TEST_CALL(arm_mat_inverse_small_f32_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_small_f32_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_small_q31_test);
+}
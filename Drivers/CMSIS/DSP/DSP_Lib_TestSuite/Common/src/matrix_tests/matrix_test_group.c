@@ -15,5 +15,6 @@ JTEST_DEFINE_GROUP(matrix_tests)
     JTEST_GROUP_CALL(mat_sub_tests);
     JTEST_GROUP_CALL(mat_trans_tests);
     JTEST_GROUP_CALL(mat_scale_tests);
+    JTEST_GROUP_CALL(mat_small_tests);
     return;
 }
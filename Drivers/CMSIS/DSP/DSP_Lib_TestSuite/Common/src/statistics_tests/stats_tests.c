@@ -0,0 +1,260 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+
+/**
+ *  Compare one value of two arm_stats_result_xxx structures using SNR.
+ */
+#define STATS_SNR_COMPARE_FIELD(result_ref, result_fut, field, output_type)   \
+    do                                                                        \
+    {                                                                         \
+        *(output_type *) statistics_output_ref.data_ptr = (result_ref).field; \
+        *(output_type *) statistics_output_fut.data_ptr = (result_fut).field; \
+        STATISTICS_SNR_COMPARE_INTERFACE(1, output_type);                     \
+    } while (0)
+
+/**
+ *  Compare a value that may differ by a few LSBs, which the SNR does not
+ *  tolerate when the value is close to 0.
+ */
+#define STATS_SNR_OR_LSB_COMPARE_FIELD(result_ref, result_fut, field,         \
+                                       output_type, lsb)                      \
+    do                                                                        \
+    {                                                                         \
+        if ((((result_ref).field - (result_fut).field) > (lsb)) ||            \
+            (((result_fut).field - (result_ref).field) > (lsb)))              \
+        {                                                                     \
+            STATS_SNR_COMPARE_FIELD(result_ref, result_fut, field,            \
+                                    output_type);                             \
+        }                                                                     \
+    } while (0)
+
+/**
+ *  Compare the minimum and maximum values and indexes.
+ */
+#define STATS_COMPARE_EXTREMA(result_ref, result_fut)                         \
+    do                                                                        \
+    {                                                                         \
+        TEST_ASSERT_EQUAL((result_ref).min, (result_fut).min);                \
+        TEST_ASSERT_EQUAL((result_ref).max, (result_fut).max);                \
+        TEST_ASSERT_EQUAL((result_ref).minIndex, (result_fut).minIndex);      \
+        TEST_ASSERT_EQUAL((result_ref).maxIndex, (result_fut).maxIndex);      \
+    } while (0)
+
+/**
+ *  Compare the mean, variance, RMS value and power. The fixed-point power is
+ *  an exact sum and is compared for equality. The Q31 variance is derived from
+ *  the power while ref_var_q31() truncates the samples to 1.23 format, so small
+ *  variances can differ by one LSB.
+ */
+#define STATS_COMPARE_MOMENTS_f32(result_ref, result_fut)                     \
+    do                                                                        \
+    {                                                                         \
+        STATS_SNR_COMPARE_FIELD(result_ref, result_fut, mean, float32_t);     \
+        STATS_SNR_COMPARE_FIELD(result_ref, result_fut, var, float32_t);      \
+        STATS_SNR_COMPARE_FIELD(result_ref, result_fut, rms, float32_t);      \
+        STATS_SNR_COMPARE_FIELD(result_ref, result_fut, power, float32_t);    \
+    } while (0)
+
+#define STATS_COMPARE_MOMENTS_q31(result_ref, result_fut)                     \
+    do                                                                        \
+    {                                                                         \
+        STATS_SNR_COMPARE_FIELD(result_ref, result_fut, mean, q31_t);         \
+        STATS_SNR_OR_LSB_COMPARE_FIELD(result_ref, result_fut, var,           \
+                                       q31_t, 1);                             \
+        STATS_SNR_COMPARE_FIELD(result_ref, result_fut, rms, q31_t);          \
+        TEST_ASSERT_EQUAL((result_ref).power, (result_fut).power);            \
+    } while (0)
+
+#define STATS_COMPARE_MOMENTS_q15(result_ref, result_fut)                     \
+    do                                                                        \
+    {                                                                         \
+        STATS_SNR_COMPARE_FIELD(result_ref, result_fut, mean, q15_t);         \
+        STATS_SNR_COMPARE_FIELD(result_ref, result_fut, var, q15_t);          \
+        STATS_SNR_COMPARE_FIELD(result_ref, result_fut, rms, q15_t);          \
+        TEST_ASSERT_EQUAL((result_ref).power, (result_fut).power);            \
+    } while (0)
+
+/**
+ *  The single-pass statistics are compared with the separate reference
+ *  functions.
+ */
+#define JTEST_ARM_STATS_TEST(suffix, output_type)                             \
+    JTEST_DEFINE_TEST(arm_stats_##suffix##_test,                              \
+                      arm_stats_##suffix)                                     \
+    {                                                                         \
+        arm_stats_result_##suffix stats_fut = { 0 };                          \
+        arm_stats_result_##suffix stats_ref = { 0 };                          \
+                                                                              \
+        TEMPLATE_DO_ARR_DESC(                                                 \
+            input_idx, ARR_DESC_t *, input_ptr, statistics_f_all              \
+            ,                                                                 \
+            TEMPLATE_DO_ARR_DESC(                                             \
+                block_size_idx, uint32_t, block_size, statistics_block_sizes  \
+                ,                                                             \
+                TEST_DO_VALID_BLOCKSIZE(                                      \
+                    block_size, output_type, input_ptr                        \
+                    ,                                                         \
+                    JTEST_COUNT_CYCLES(                                       \
+                        arm_stats_##suffix(                                   \
+                            input_ptr->data_ptr, block_size, &stats_fut));    \
+                                                                              \
+                    ref_stats_##suffix(                                       \
+                        input_ptr->data_ptr, block_size, &stats_ref);         \
+                                                                              \
+                    STATS_COMPARE_MOMENTS_##suffix(stats_ref, stats_fut);     \
+                    STATS_COMPARE_EXTREMA(stats_ref, stats_fut))));           \
+                                                                              \
+        return JTEST_TEST_PASSED;                                             \
+    }
+
+/**
+ *  Benchmark of the separate functions that arm_stats_xxx() replaces, timed
+ *  on the same inputs so that both tests line up in the cycle log.
+ */
+#define STATS_DEFINE_SEPARATE_FN(suffix, output_type, power_type)             \
+    static void stats_separate_##suffix(                                      \
+        output_type * pSrc,                                                   \
+        uint32_t blockSize,                                                   \
+        arm_stats_result_##suffix * pResult)                                  \
+    {                                                                         \
+        power_type power;                                                     \
+                                                                              \
+        arm_mean_##suffix(pSrc, blockSize, &pResult->mean);                   \
+        arm_var_##suffix(pSrc, blockSize, &pResult->var);                     \
+        arm_rms_##suffix(pSrc, blockSize, &pResult->rms);                     \
+        arm_power_##suffix(pSrc, blockSize, &power);                          \
+        arm_min_##suffix(pSrc, blockSize, &pResult->min, &pResult->minIndex); \
+        arm_max_##suffix(pSrc, blockSize, &pResult->max, &pResult->maxIndex); \
+        pResult->power = power;                                               \
+    }
+
+STATS_DEFINE_SEPARATE_FN(f32, float32_t, float32_t);
+STATS_DEFINE_SEPARATE_FN(q31, q31_t, q63_t);
+STATS_DEFINE_SEPARATE_FN(q15, q15_t, q63_t);
+
+#define JTEST_ARM_STATS_SEPARATE_TEST(suffix, output_type)                    \
+    JTEST_DEFINE_TEST(arm_stats_separate_##suffix##_test,                     \
+                      arm_stats_separate_##suffix)                            \
+    {                                                                         \
+        arm_stats_result_##suffix stats_fut = { 0 };                          \
+        arm_stats_result_##suffix stats_ref = { 0 };                          \
+                                                                              \
+        TEMPLATE_DO_ARR_DESC(                                                 \
+            input_idx, ARR_DESC_t *, input_ptr, statistics_f_all              \
+            ,                                                                 \
+            TEMPLATE_DO_ARR_DESC(                                             \
+                block_size_idx, uint32_t, block_size, statistics_block_sizes  \
+                ,                                                             \
+                TEST_DO_VALID_BLOCKSIZE(                                      \
+                    block_size, output_type, input_ptr                        \
+                    ,                                                         \
+                    TEST_CALL_FUT(                                            \
+                        stats_separate_##suffix,                              \
+                        ((output_type *) input_ptr->data_ptr,                 \
+                         block_size, &stats_fut));                            \
+                                                                              \
+                    ref_stats_##suffix(                                       \
+                        input_ptr->data_ptr, block_size, &stats_ref);         \
+                                                                              \
+                    STATS_COMPARE_EXTREMA(stats_ref, stats_fut))));           \
+                                                                              \
+        return JTEST_TEST_PASSED;                                             \
+    }
+
+/**
+ *  The running statistics of a block added in three parts match the
+ *  single-pass statistics of the block. Once the first part is removed, they
+ *  match the statistics of the two other parts.
+ */
+#define JTEST_ARM_STATS_RUNNING_TEST(suffix, output_type)                     \
+    JTEST_DEFINE_TEST(arm_stats_running_##suffix##_test,                      \
+                      arm_stats_running_##suffix)                             \
+    {                                                                         \
+        arm_stats_running_instance_##suffix stats_inst;                       \
+        arm_stats_result_##suffix stats_fut = { 0 };                          \
+        arm_stats_result_##suffix stats_ref = { 0 };                          \
+        output_type * pSrc;                                                   \
+        uint32_t first, second;                                               \
+                                                                              \
+        TEMPLATE_DO_ARR_DESC(                                                 \
+            input_idx, ARR_DESC_t *, input_ptr, statistics_f_all              \
+            ,                                                                 \
+            TEMPLATE_DO_ARR_DESC(                                             \
+                block_size_idx, uint32_t, block_size, statistics_block_sizes  \
+                ,                                                             \
+                TEST_DO_VALID_BLOCKSIZE(                                      \
+                    block_size, output_type, input_ptr                        \
+                    ,                                                         \
+                    pSrc = (output_type *) input_ptr->data_ptr;               \
+                    first = block_size / 3U;                                  \
+                    second = (block_size - first) / 2U;                       \
+                                                                              \
+                    arm_stats_running_init_##suffix(&stats_inst);             \
+                    arm_stats_running_add_##suffix(                           \
+                        &stats_inst, pSrc, first);                            \
+                    arm_stats_running_add_##suffix(                           \
+                        &stats_inst, pSrc + first, second);                   \
+                    arm_stats_running_add_##suffix(                           \
+                        &stats_inst, pSrc + first + second,                   \
+                        block_size - first - second);                         \
+                    arm_stats_running_get_##suffix(&stats_inst, &stats_fut);  \
+                                                                              \
+                    arm_stats_##suffix(pSrc, block_size, &stats_ref);         \
+                                                                              \
+                    STATS_COMPARE_MOMENTS_##suffix(stats_ref, stats_fut);     \
+                    STATS_COMPARE_EXTREMA(stats_ref, stats_fut);              \
+                                                                              \
+                    if (first > 0U)                                           \
+                    {                                                         \
+                        arm_stats_running_remove_##suffix(                    \
+                            &stats_inst, pSrc, first);                        \
+                        arm_stats_running_get_##suffix(                       \
+                            &stats_inst, &stats_fut);                         \
+                                                                              \
+                        arm_stats_##suffix(                                   \
+                            pSrc + first, block_size - first, &stats_ref);    \
+                                                                              \
+                        STATS_COMPARE_MOMENTS_##suffix(stats_ref, stats_fut); \
+                    })));                                                     \
+                                                                              \
+        return JTEST_TEST_PASSED;                                             \
+    }
+
+JTEST_ARM_STATS_TEST(f32, float32_t);
+JTEST_ARM_STATS_TEST(q31, q31_t);
+JTEST_ARM_STATS_TEST(q15, q15_t);
+
+JTEST_ARM_STATS_SEPARATE_TEST(f32, float32_t);
+JTEST_ARM_STATS_SEPARATE_TEST(q31, q31_t);
+JTEST_ARM_STATS_SEPARATE_TEST(q15, q15_t);
+
+JTEST_ARM_STATS_RUNNING_TEST(f32, float32_t);
+JTEST_ARM_STATS_RUNNING_TEST(q31, q31_t);
+JTEST_ARM_STATS_RUNNING_TEST(q15, q15_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(stats_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_stats_f32_test);
+    JTEST_TEST_CALL(arm_stats_separate_f32_test);
+    JTEST_TEST_CALL(arm_stats_q31_test);
+    JTEST_TEST_CALL(arm_stats_separate_q31_test);
+    JTEST_TEST_CALL(arm_stats_q15_test);
+    JTEST_TEST_CALL(arm_stats_separate_q15_test);
+
+    JTEST_TEST_CALL(arm_stats_running_f32_test);
+    JTEST_TEST_CALL(arm_stats_running_q31_test);
+    JTEST_TEST_CALL(arm_stats_running_q15_test);
+}
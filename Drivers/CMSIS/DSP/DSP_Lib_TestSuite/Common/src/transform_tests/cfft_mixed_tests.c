@@ -0,0 +1,272 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Header Stuff */
+/*--------------------------------------------------------------------------------*/
+
+/* Twiddle factors and scratch of the mixed-radix plans, in float32_t / q31_t
+ * elements. */
+static float32_t cfft_mixed_twiddle[TRANSFORM_MAX_FFT_LEN * 2];
+static float32_t cfft_mixed_twiddle_rfft[TRANSFORM_MAX_FFT_LEN];
+static float32_t cfft_mixed_scratch[TRANSFORM_MAX_FFT_LEN * 2];
+
+/*
+ *  Q31 inputs are shifted down by one bit so that the magnitude of the complex
+ *  values does not exceed 1, as required by the Q31 butterflies.
+ */
+#define CFFT_MIXED_PREPARE_INPUTS_f32(input_ptr, dst_fut, dst_ref, count)   \
+    do                                                                      \
+    {                                                                       \
+        memcpy(dst_fut, input_ptr, (count) * sizeof(float32_t));            \
+        memcpy(dst_ref, input_ptr, (count) * sizeof(float32_t));            \
+    } while (0)
+
+#define CFFT_MIXED_PREPARE_INPUTS_q31(input_ptr, dst_fut, dst_ref, count)   \
+    do                                                                      \
+    {                                                                       \
+        arm_shift_q31((q31_t *) (input_ptr), -1, (q31_t *) (dst_fut), count); \
+        arm_shift_q31((q31_t *) (input_ptr), -1, (q31_t *) (dst_ref), count); \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Lengths */
+/*--------------------------------------------------------------------------------*/
+
+/* Lengths of the form 2^a * 3^b * 5^c, checked against a direct DFT. */
+ARR_DESC_DEFINE(uint16_t,
+                transform_cfft_mixed_fftlens,
+                8,
+                CURLY(
+                    1,
+                    12,
+                    15,
+                    60,
+                    240,
+                    480,
+                    600,
+                    1000
+                    ));
+
+ARR_DESC_DEFINE(uint16_t,
+                transform_rfft_mixed_fftlens,
+                6,
+                CURLY(
+                    2,
+                    30,
+                    120,
+                    480,
+                    600,
+                    1000
+                    ));
+
+/*--------------------------------------------------------------------------------*/
+/* Complex Transforms */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Mixed-radix CFFT test template. Arguments are: function suffix (q31/f32), the
+  output type and the inverse-transform flag.
+*/
+#define CFFT_MIXED_DEFINE_TEST(suffix, output_type, config_suffix, ifft_flag)      \
+    JTEST_DEFINE_TEST(arm_cfft_mixed_##suffix##_##config_suffix##_test,         \
+                      arm_cfft_mixed_##suffix)                                  \
+    {                                                                           \
+        arm_cfft_mixed_instance_##suffix cfft_inst_fut;                         \
+                                                                                \
+        TEMPLATE_DO_ARR_DESC(                                                   \
+            fftlen_idx, uint16_t, fftlen, transform_cfft_mixed_fftlens          \
+            ,                                                                   \
+            arm_cfft_mixed_init_##suffix(                                       \
+                &cfft_inst_fut, fftlen,                                         \
+                (output_type *) cfft_mixed_twiddle,                             \
+                (output_type *) cfft_mixed_scratch);                            \
+                                                                                \
+            CFFT_MIXED_PREPARE_INPUTS_##suffix(                                 \
+                transform_fft_##suffix##_inputs,                                \
+                transform_fft_inplace_input_fut,                                \
+                transform_fft_inplace_input_ref,                                \
+                2 * fftlen);                                                    \
+                                                                                \
+            /* Display parameter values */                                      \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                  \
+                            "Number of Stages: %d\n"                            \
+                            "Inverse-transform flag: %d\n",                     \
+                            (int)fftlen,                                        \
+                            (int)cfft_inst_fut.numStages,                       \
+                            (int)ifft_flag);                                    \
+                                                                                \
+            /* Display cycle count and run test */                              \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_cfft_mixed_##suffix(                                        \
+                    &cfft_inst_fut,                                             \
+                    (void *) transform_fft_inplace_input_fut,                   \
+                    ifft_flag));                                                \
+                                                                                \
+            /* The reference uses the scratch buffer of the plan */             \
+            ref_cfft_mixed_##suffix(                                            \
+                &cfft_inst_fut,                                                 \
+                (void *) transform_fft_inplace_input_ref,                       \
+                ifft_flag);                                                     \
+                                                                                \
+            /* Test correctness */                                              \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                              \
+                fftlen,                                                         \
+                output_type));                                                  \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+CFFT_MIXED_DEFINE_TEST(f32, float32_t, forward, 0U);
+CFFT_MIXED_DEFINE_TEST(f32, float32_t, inverse, 1U);
+CFFT_MIXED_DEFINE_TEST(q31, q31_t, forward, 0U);
+CFFT_MIXED_DEFINE_TEST(q31, q31_t, inverse, 1U);
+
+/*
+  Mixed-radix CFFT test template for the power of two lengths of the
+  arm_cfft_instances, checked against the radix-2 reference ref_cfft_xxx().
+*/
+#define CFFT_MIXED_POW2_DEFINE_TEST(suffix, output_type, config_suffix, ifft_flag) \
+    JTEST_DEFINE_TEST(arm_cfft_mixed_##suffix##_pow2_##config_suffix##_test,    \
+                      arm_cfft_mixed_##suffix)                                  \
+    {                                                                           \
+        arm_cfft_mixed_instance_##suffix cfft_inst_fut;                         \
+                                                                                \
+        TEMPLATE_DO_ARR_DESC(                                                   \
+            cfft_inst_idx, const arm_cfft_instance_##suffix *, cfft_inst_ptr,   \
+            transform_cfft_##suffix##_structs                                   \
+            ,                                                                   \
+            arm_cfft_mixed_init_##suffix(                                       \
+                &cfft_inst_fut, cfft_inst_ptr->fftLen,                          \
+                (output_type *) cfft_mixed_twiddle,                             \
+                (output_type *) cfft_mixed_scratch);                            \
+                                                                                \
+            CFFT_MIXED_PREPARE_INPUTS_##suffix(                                 \
+                transform_fft_##suffix##_inputs,                                \
+                transform_fft_inplace_input_fut,                                \
+                transform_fft_inplace_input_ref,                                \
+                2 * cfft_inst_ptr->fftLen);                                     \
+                                                                                \
+            /* Display parameter values */                                      \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                  \
+                            "Number of Stages: %d\n"                            \
+                            "Inverse-transform flag: %d\n",                     \
+                            (int)cfft_inst_ptr->fftLen,                         \
+                            (int)cfft_inst_fut.numStages,                       \
+                            (int)ifft_flag);                                    \
+                                                                                \
+            /* Display cycle count and run test */                              \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_cfft_mixed_##suffix(                                        \
+                    &cfft_inst_fut,                                             \
+                    (void *) transform_fft_inplace_input_fut,                   \
+                    ifft_flag));                                                \
+                                                                                \
+            ref_cfft_##suffix(cfft_inst_ptr,                                    \
+                              (void *) transform_fft_inplace_input_ref,         \
+                              ifft_flag,                                        \
+                              1);                                               \
+                                                                                \
+            /* Test correctness */                                              \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                              \
+                cfft_inst_ptr->fftLen,                                          \
+                output_type));                                                  \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+CFFT_MIXED_POW2_DEFINE_TEST(f32, float32_t, forward, 0U);
+CFFT_MIXED_POW2_DEFINE_TEST(f32, float32_t, inverse, 1U);
+CFFT_MIXED_POW2_DEFINE_TEST(q31, q31_t, forward, 0U);
+CFFT_MIXED_POW2_DEFINE_TEST(q31, q31_t, inverse, 1U);
+
+/*--------------------------------------------------------------------------------*/
+/* Real Transforms */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Mixed-radix RFFT test template. Any fftLen values are a valid packed spectrum
+  for the inverse transform.
+*/
+#define RFFT_MIXED_DEFINE_TEST(suffix, output_type, config_suffix, ifft_flag)      \
+    JTEST_DEFINE_TEST(arm_rfft_mixed_##suffix##_##config_suffix##_test,         \
+                      arm_rfft_mixed_##suffix)                                  \
+    {                                                                           \
+        arm_rfft_mixed_instance_##suffix rfft_inst_fut;                         \
+                                                                                \
+        TEMPLATE_DO_ARR_DESC(                                                   \
+            fftlen_idx, uint16_t, fftlen, transform_rfft_mixed_fftlens          \
+            ,                                                                   \
+            arm_rfft_mixed_init_##suffix(                                       \
+                &rfft_inst_fut, fftlen,                                         \
+                (output_type *) cfft_mixed_twiddle,                             \
+                (output_type *) cfft_mixed_twiddle_rfft,                        \
+                (output_type *) cfft_mixed_scratch);                            \
+                                                                                \
+            CFFT_MIXED_PREPARE_INPUTS_##suffix(                                 \
+                transform_fft_##suffix##_inputs,                                \
+                transform_fft_input_fut,                                        \
+                transform_fft_input_ref,                                        \
+                fftlen);                                                        \
+                                                                                \
+            /* Display parameter values */                                      \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                  \
+                            "Inverse-transform flag: %d\n",                     \
+                            (int)fftlen,                                        \
+                            (int)ifft_flag);                                    \
+                                                                                \
+            /* Display cycle count and run test */                              \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_rfft_mixed_##suffix(                                        \
+                    &rfft_inst_fut,                                             \
+                    (void *) transform_fft_input_fut,                           \
+                    (void *) transform_fft_output_fut,                          \
+                    ifft_flag));                                                \
+                                                                                \
+            ref_rfft_mixed_##suffix(                                            \
+                &rfft_inst_fut,                                                 \
+                (void *) transform_fft_input_ref,                               \
+                (void *) transform_fft_output_ref,                              \
+                ifft_flag);                                                     \
+                                                                                \
+            /* Test correctness */                                              \
+            TRANSFORM_SNR_COMPARE_INTERFACE(                                    \
+                fftlen,                                                         \
+                output_type));                                                  \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+RFFT_MIXED_DEFINE_TEST(f32, float32_t, forward, 0U);
+RFFT_MIXED_DEFINE_TEST(f32, float32_t, inverse, 1U);
+RFFT_MIXED_DEFINE_TEST(q31, q31_t, forward, 0U);
+RFFT_MIXED_DEFINE_TEST(q31, q31_t, inverse, 1U);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(cfft_mixed_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_cfft_mixed_f32_forward_test);
+    JTEST_TEST_CALL(arm_cfft_mixed_f32_inverse_test);
+    JTEST_TEST_CALL(arm_cfft_mixed_q31_forward_test);
+    JTEST_TEST_CALL(arm_cfft_mixed_q31_inverse_test);
+
+    JTEST_TEST_CALL(arm_cfft_mixed_f32_pow2_forward_test);
+    JTEST_TEST_CALL(arm_cfft_mixed_f32_pow2_inverse_test);
+    JTEST_TEST_CALL(arm_cfft_mixed_q31_pow2_forward_test);
+    JTEST_TEST_CALL(arm_cfft_mixed_q31_pow2_inverse_test);
+
+    JTEST_TEST_CALL(arm_rfft_mixed_f32_forward_test);
+    JTEST_TEST_CALL(arm_rfft_mixed_f32_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_mixed_q31_forward_test);
+    JTEST_TEST_CALL(arm_rfft_mixed_q31_inverse_test);
+}
@@ -0,0 +1,299 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Header Stuff */
+/*--------------------------------------------------------------------------------*/
+
+#define DFT_BINS_MAX_NUM_BINS 8
+#define DFT_BINS_MAX_WINLEN 256
+
+/* Coefficients, bin values and delay line of the instances, in float32_t /
+ * q31_t elements. */
+static float32_t dft_bins_coeffs[DFT_BINS_MAX_NUM_BINS * 2];
+static float32_t dft_bins_state[DFT_BINS_MAX_NUM_BINS * 2];
+static float32_t dft_bins_delay[DFT_BINS_MAX_WINLEN];
+
+static float32_t dft_bins_freqs[DFT_BINS_MAX_NUM_BINS];
+static uint16_t dft_bins_indexes[DFT_BINS_MAX_NUM_BINS];
+
+/*
+ *  The bins of the Goertzel tests are DFT bins of the block, so that the
+ *  references are the DFT bins. Five bins exercise the odd bin of the
+ *  two-bin loop.
+ */
+#define DFT_BINS_SET_GOERTZEL_FREQS(block_size)                             \
+    do                                                                      \
+    {                                                                       \
+        dft_bins_freqs[0] = 0.0f;                                           \
+        dft_bins_freqs[1] = 1.0f / (block_size);                            \
+        dft_bins_freqs[2] = 5.0f / (block_size);                            \
+        dft_bins_freqs[3] = 0.25f;                                          \
+        dft_bins_freqs[4] = 0.5f;                                           \
+    } while (0)
+
+#define DFT_BINS_SET_SDFT_INDEXES(win_len)                                  \
+    do                                                                      \
+    {                                                                       \
+        dft_bins_indexes[0] = 0U;                                           \
+        dft_bins_indexes[1] = 1U;                                           \
+        dft_bins_indexes[2] = 5U;                                           \
+        dft_bins_indexes[3] = (win_len) / 2U;                               \
+        dft_bins_indexes[4] = (win_len) - 1U;                               \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Lengths */
+/*--------------------------------------------------------------------------------*/
+
+/* Block sizes and window lengths, powers of two or not. */
+ARR_DESC_DEFINE(uint16_t,
+                transform_dft_bins_lens,
+                4,
+                CURLY(
+                    16,
+                    60,
+                    100,
+                    256
+                    ));
+
+/* Lengths of the comparison with the fast RFFT. */
+ARR_DESC_DEFINE(uint16_t,
+                transform_dft_bins_rfft_lens,
+                3,
+                CURLY(
+                    64,
+                    256,
+                    1024
+                    ));
+
+/*--------------------------------------------------------------------------------*/
+/* Goertzel Algorithm */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Goertzel test template. Arguments are: function suffix (q15/q31/f32) and the
+  output type.
+*/
+#define GOERTZEL_DEFINE_TEST(suffix, output_type)                               \
+    JTEST_DEFINE_TEST(arm_goertzel_##suffix##_test,                             \
+                      arm_goertzel_##suffix)                                    \
+    {                                                                           \
+        arm_goertzel_instance_##suffix goertzel_inst;                           \
+        uint16_t num_bins = 5;                                                  \
+                                                                                \
+        TEMPLATE_DO_ARR_DESC(                                                   \
+            len_idx, uint16_t, block_size, transform_dft_bins_lens              \
+            ,                                                                   \
+            DFT_BINS_SET_GOERTZEL_FREQS(block_size);                            \
+                                                                                \
+            arm_goertzel_init_##suffix(                                         \
+                &goertzel_inst, num_bins, dft_bins_freqs,                       \
+                (void *) dft_bins_coeffs);                                      \
+                                                                                \
+            /* Display parameter values */                                      \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                  \
+                            "Number of Bins: %d\n",                             \
+                            (int)block_size,                                    \
+                            (int)num_bins);                                     \
+                                                                                \
+            /* Display cycle count and run test */                              \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_goertzel_##suffix(                                          \
+                    &goertzel_inst,                                             \
+                    (output_type *) transform_fft_##suffix##_inputs,            \
+                    block_size,                                                 \
+                    (void *) transform_fft_output_fut));                        \
+                                                                                \
+            ref_goertzel_##suffix(                                              \
+                &goertzel_inst,                                                 \
+                (output_type *) transform_fft_##suffix##_inputs,                \
+                block_size,                                                     \
+                (void *) transform_fft_output_ref);                             \
+                                                                                \
+            /* Test correctness */                                              \
+            GOERTZEL_TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                     \
+                num_bins,                                                       \
+                output_type));                                                  \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+GOERTZEL_DEFINE_TEST(f32, float32_t);
+GOERTZEL_DEFINE_TEST(q31, q31_t);
+GOERTZEL_DEFINE_TEST(q15, q15_t);
+
+/*
+  Comparison of the Goertzel algorithm with the fast RFFT of the block. Both
+  cycle counts are displayed, the Goertzel algorithm first, and the four bins
+  must match those of the RFFT.
+*/
+#define GOERTZEL_RFFT_DEFINE_TEST(suffix, output_type)                          \
+    JTEST_DEFINE_TEST(arm_goertzel_rfft_##suffix##_test,                        \
+                      arm_goertzel_##suffix)                                    \
+    {                                                                           \
+        arm_goertzel_instance_##suffix goertzel_inst;                           \
+        arm_rfft_fast_instance_##suffix rfft_inst;                              \
+        uint16_t num_bins = 4;                                                  \
+        uint32_t i, k;                                                          \
+                                                                                \
+        TEMPLATE_DO_ARR_DESC(                                                   \
+            len_idx, uint16_t, fftlen, transform_dft_bins_rfft_lens             \
+            ,                                                                   \
+            for (i = 0; i < num_bins; i++)                                      \
+            {                                                                   \
+                dft_bins_freqs[i] = (float32_t) ((2U * i) + 1U) / 16.0f;        \
+            }                                                                   \
+                                                                                \
+            arm_goertzel_init_##suffix(                                         \
+                &goertzel_inst, num_bins, dft_bins_freqs,                       \
+                (void *) dft_bins_coeffs);                                      \
+            arm_rfft_fast_init_##suffix(&rfft_inst, fftlen);                    \
+                                                                                \
+            /* The RFFT modifies its input */                                   \
+            TRANSFORM_COPY_INPUTS(                                              \
+                transform_fft_##suffix##_inputs,                                \
+                fftlen * sizeof(output_type));                                  \
+                                                                                \
+            /* Display parameter values */                                      \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                  \
+                            "Number of Bins: %d\n",                             \
+                            (int)fftlen,                                        \
+                            (int)num_bins);                                     \
+                                                                                \
+            /* Display cycle counts and run test */                             \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_goertzel_##suffix(                                          \
+                    &goertzel_inst,                                             \
+                    (output_type *) transform_fft_input_ref,                    \
+                    fftlen,                                                     \
+                    (void *) transform_fft_output_fut));                        \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_rfft_fast_##suffix(                                         \
+                    &rfft_inst,                                                 \
+                    (void *) transform_fft_input_fut,                           \
+                    (void *) transform_fft_output_ref,                          \
+                    0U));                                                       \
+                                                                                \
+            /* Gather the bins (2*i+1)*fftlen/16 of the RFFT */                 \
+            for (i = 0; i < num_bins; i++)                                      \
+            {                                                                   \
+                k = (((2U * i) + 1U) * fftlen) / 16U;                           \
+                ((output_type *) transform_fft_output_ref)[2U * i] =            \
+                    ((output_type *) transform_fft_output_ref)[2U * k];         \
+                ((output_type *) transform_fft_output_ref)[(2U * i) + 1U] =     \
+                    ((output_type *) transform_fft_output_ref)[(2U * k) + 1U];  \
+            }                                                                   \
+                                                                                \
+            /* Test correctness */                                              \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                              \
+                num_bins,                                                       \
+                output_type));                                                  \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+GOERTZEL_RFFT_DEFINE_TEST(f32, float32_t);
+GOERTZEL_RFFT_DEFINE_TEST(q31, q31_t);
+GOERTZEL_RFFT_DEFINE_TEST(q15, q15_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Sliding DFT */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Sliding DFT test template. Arguments are: function suffix (q15/q31/f32) and
+  the output type. A stream of 2*winLen+7 samples is fed as a block of one
+  sample, a block of 2*winLen samples and a block of 6 samples, and the bins
+  are checked after the first and the last block.
+*/
+#define SDFT_DEFINE_TEST(suffix, output_type)                                   \
+    JTEST_DEFINE_TEST(arm_sdft_##suffix##_test,                                 \
+                      arm_sdft_##suffix)                                        \
+    {                                                                           \
+        arm_sdft_instance_##suffix sdft_inst;                                   \
+        output_type * input = (output_type *) transform_fft_##suffix##_inputs;  \
+        uint16_t num_bins = 5;                                                  \
+                                                                                \
+        TEMPLATE_DO_ARR_DESC(                                                   \
+            len_idx, uint16_t, win_len, transform_dft_bins_lens                 \
+            ,                                                                   \
+            DFT_BINS_SET_SDFT_INDEXES(win_len);                                 \
+                                                                                \
+            arm_sdft_init_##suffix(                                             \
+                &sdft_inst, num_bins, win_len, dft_bins_indexes, 1.0f,          \
+                (void *) dft_bins_coeffs,                                       \
+                (void *) dft_bins_state,                                        \
+                (void *) dft_bins_delay);                                       \
+                                                                                \
+            /* Display parameter values */                                      \
+            JTEST_DUMP_STRF("Window Length: %d\n"                               \
+                            "Number of Bins: %d\n",                             \
+                            (int)win_len,                                       \
+                            (int)num_bins);                                     \
+                                                                                \
+            arm_sdft_##suffix(                                                  \
+                &sdft_inst, input, 1U,                                          \
+                (void *) transform_fft_output_fut);                             \
+                                                                                \
+            ref_sdft_##suffix(                                                  \
+                input, 1U, win_len, dft_bins_indexes, num_bins,                 \
+                (void *) transform_fft_output_ref);                             \
+                                                                                \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                              \
+                num_bins,                                                       \
+                output_type);                                                   \
+                                                                                \
+            /* Display cycle count and run test */                              \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_sdft_##suffix(                                              \
+                    &sdft_inst, input + 1U, 2U * win_len,                       \
+                    (void *) transform_fft_output_fut));                        \
+                                                                                \
+            arm_sdft_##suffix(                                                  \
+                &sdft_inst, input + 1U + (2U * win_len), 6U,                    \
+                (void *) transform_fft_output_fut);                             \
+                                                                                \
+            ref_sdft_##suffix(                                                  \
+                input, (2U * win_len) + 7U, win_len,                            \
+                dft_bins_indexes, num_bins,                                     \
+                (void *) transform_fft_output_ref);                             \
+                                                                                \
+            /* Test correctness */                                              \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                              \
+                num_bins,                                                       \
+                output_type));                                                  \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+SDFT_DEFINE_TEST(f32, float32_t);
+SDFT_DEFINE_TEST(q31, q31_t);
+SDFT_DEFINE_TEST(q15, q15_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(dft_bins_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_goertzel_f32_test);
+    JTEST_TEST_CALL(arm_goertzel_q31_test);
+    JTEST_TEST_CALL(arm_goertzel_q15_test);
+
+    JTEST_TEST_CALL(arm_goertzel_rfft_f32_test);
+    JTEST_TEST_CALL(arm_goertzel_rfft_q31_test);
+    JTEST_TEST_CALL(arm_goertzel_rfft_q15_test);
+
+    JTEST_TEST_CALL(arm_sdft_f32_test);
+    JTEST_TEST_CALL(arm_sdft_q31_test);
+    JTEST_TEST_CALL(arm_sdft_q15_test);
+}
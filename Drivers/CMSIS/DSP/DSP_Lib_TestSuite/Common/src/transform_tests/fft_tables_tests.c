@@ -0,0 +1,386 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "template.h"
+#include "arm_const_structs.h"
+#include "arm_common_tables.h"
+#include "transform_test_data.h"
+#include <string.h>             /* memcmp() */
+
+/*--------------------------------------------------------------------------------*/
+/* Header Stuff */
+/*--------------------------------------------------------------------------------*/
+
+extern void arm_bitreversal_32(
+    uint32_t * pSrc,
+    const uint16_t bitRevLen,
+    const uint16_t * pBitRevTable);
+
+/* Arena large enough for the biggest floating-point instance, in bytes. */
+#define FFT_TABLES_ARENA_SIZE ARM_CFFT_RAM_TABLES_SIZE_F32(4096)
+
+static uint32_t fft_tables_arena_buf[FFT_TABLES_ARENA_SIZE / 4];
+static uint16_t fft_tables_bitrev[ARMBITREVINDEXTABLE_4096_TABLE_LENGTH];
+static uint32_t fft_tables_perm_fut[TRANSFORM_MAX_FFT_LEN * 2];
+static uint32_t fft_tables_perm_ref[TRANSFORM_MAX_FFT_LEN * 2];
+
+/*--------------------------------------------------------------------------------*/
+/* Instances */
+/*--------------------------------------------------------------------------------*/
+
+/* All the constant instances, to be reproduced by the generators. */
+ARR_DESC_DEFINE(const arm_cfft_instance_f32 *,
+                fft_tables_cfft_f32_structs,
+                9,
+                CURLY(
+                    &arm_cfft_sR_f32_len16,
+                    &arm_cfft_sR_f32_len32,
+                    &arm_cfft_sR_f32_len64,
+                    &arm_cfft_sR_f32_len128,
+                    &arm_cfft_sR_f32_len256,
+                    &arm_cfft_sR_f32_len512,
+                    &arm_cfft_sR_f32_len1024,
+                    &arm_cfft_sR_f32_len2048,
+                    &arm_cfft_sR_f32_len4096
+                    ));
+
+ARR_DESC_DEFINE(const arm_cfft_instance_q31 *,
+                fft_tables_cfft_q31_structs,
+                9,
+                CURLY(
+                    &arm_cfft_sR_q31_len16,
+                    &arm_cfft_sR_q31_len32,
+                    &arm_cfft_sR_q31_len64,
+                    &arm_cfft_sR_q31_len128,
+                    &arm_cfft_sR_q31_len256,
+                    &arm_cfft_sR_q31_len512,
+                    &arm_cfft_sR_q31_len1024,
+                    &arm_cfft_sR_q31_len2048,
+                    &arm_cfft_sR_q31_len4096
+                    ));
+
+ARR_DESC_DEFINE(const arm_cfft_instance_q15 *,
+                fft_tables_cfft_q15_structs,
+                9,
+                CURLY(
+                    &arm_cfft_sR_q15_len16,
+                    &arm_cfft_sR_q15_len32,
+                    &arm_cfft_sR_q15_len64,
+                    &arm_cfft_sR_q15_len128,
+                    &arm_cfft_sR_q15_len256,
+                    &arm_cfft_sR_q15_len512,
+                    &arm_cfft_sR_q15_len1024,
+                    &arm_cfft_sR_q15_len2048,
+                    &arm_cfft_sR_q15_len4096
+                    ));
+
+ARR_DESC_DEFINE(uint16_t,
+                fft_tables_rfft_fast_fftlens,
+                8,
+                CURLY(
+                    32, 64, 128, 256,
+                    512, 1024, 2048, 4096));
+
+/*--------------------------------------------------------------------------------*/
+/* Helpers */
+/*--------------------------------------------------------------------------------*/
+
+/* Applies a table of swaps to the indices of fftLen complex values. */
+static void fft_tables_permute(
+    uint32_t * pPerm,
+    uint16_t fftLen,
+    uint16_t bitRevLength,
+    const uint16_t * pBitRevTable)
+{
+    uint32_t i;
+
+    for (i = 0; i < 2U * fftLen; i++)
+    {
+        pPerm[i] = i;
+    }
+
+    arm_bitreversal_32(pPerm, bitRevLength, pBitRevTable);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Table Generators */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  Twiddle generator test template. The generated tables must be bit exact with
+  those of arm_common_tables.c. Arguments are: function suffix, output type and the
+  number of values of a table as a function of the length.
+*/
+#define FFT_TABLES_TWIDDLE_DEFINE_TEST(suffix, output_type, table_len)      \
+    JTEST_DEFINE_TEST(arm_cfft_twiddle_gen_##suffix##_test,                     \
+                      arm_cfft_twiddle_gen_##suffix)                            \
+    {                                                                           \
+        TEMPLATE_DO_ARR_DESC(                                                   \
+            cfft_inst_idx, const arm_cfft_instance_##suffix *, cfft_inst_ptr,   \
+            fft_tables_cfft_##suffix##_structs                                  \
+            ,                                                                   \
+            JTEST_DUMP_STRF("Block Size: %d\n",                                 \
+                            (int)cfft_inst_ptr->fftLen);                        \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_cfft_twiddle_gen_##suffix(                                  \
+                    (output_type *) transform_fft_output_fut,                   \
+                    cfft_inst_ptr->fftLen));                                    \
+                                                                                \
+            if (memcmp(transform_fft_output_fut, cfft_inst_ptr->pTwiddle,       \
+                       (table_len) * sizeof(output_type)) != 0)                 \
+            {                                                                   \
+                return JTEST_TEST_FAILED;                                       \
+            });                                                                 \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+FFT_TABLES_TWIDDLE_DEFINE_TEST(f32, float32_t, 2U * cfft_inst_ptr->fftLen);
+FFT_TABLES_TWIDDLE_DEFINE_TEST(q31, q31_t, 3U * cfft_inst_ptr->fftLen / 2U);
+FFT_TABLES_TWIDDLE_DEFINE_TEST(q15, q15_t, 3U * cfft_inst_ptr->fftLen / 2U);
+
+JTEST_DEFINE_TEST(arm_rfft_fast_twiddle_gen_f32_test,
+                  arm_rfft_fast_twiddle_gen_f32)
+{
+    arm_rfft_fast_instance_f32 rfft_inst;
+
+    TEMPLATE_DO_ARR_DESC(
+        fftlen_idx, uint16_t, fftlen, fft_tables_rfft_fast_fftlens
+        ,
+        arm_rfft_fast_init_f32(&rfft_inst, fftlen);
+
+        JTEST_DUMP_STRF("Block Size: %d\n", (int)fftlen);
+
+        JTEST_COUNT_CYCLES(
+            arm_rfft_fast_twiddle_gen_f32(transform_fft_output_fut, fftlen));
+
+        if (memcmp(transform_fft_output_fut, rfft_inst.pTwiddleRFFT,
+                   fftlen * sizeof(float32_t)) != 0)
+        {
+            return JTEST_TEST_FAILED;
+        });
+
+    return JTEST_TEST_PASSED;
+}
+
+/*
+  The fixed-point tables are reproduced byte for byte. The floating-point tables
+  hold the same swaps, a few of them in another order at some lengths, so they
+  are compared through the permutation they apply.
+*/
+#define FFT_TABLES_BITREV_DEFINE_TEST(suffix, fixed_flag)                       \
+    JTEST_DEFINE_TEST(arm_cfft_bitrev_gen_##suffix##_test,                      \
+                      arm_cfft_bitrev_gen)                                      \
+    {                                                                           \
+        uint16_t bitRevLength;                                                  \
+                                                                                \
+        TEMPLATE_DO_ARR_DESC(                                                   \
+            cfft_inst_idx, const arm_cfft_instance_##suffix *, cfft_inst_ptr,   \
+            fft_tables_cfft_##suffix##_structs                                  \
+            ,                                                                   \
+            JTEST_DUMP_STRF("Block Size: %d\n",                                 \
+                            (int)cfft_inst_ptr->fftLen);                        \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                bitRevLength = arm_cfft_bitrev_gen(                             \
+                    fft_tables_bitrev, cfft_inst_ptr->fftLen, fixed_flag));     \
+                                                                                \
+            if (bitRevLength != cfft_inst_ptr->bitRevLength)                    \
+            {                                                                   \
+                return JTEST_TEST_FAILED;                                       \
+            }                                                                   \
+                                                                                \
+            if ((fixed_flag) &&                                                 \
+                (memcmp(fft_tables_bitrev, cfft_inst_ptr->pBitRevTable,         \
+                        bitRevLength * sizeof(uint16_t)) != 0))                 \
+            {                                                                   \
+                return JTEST_TEST_FAILED;                                       \
+            }                                                                   \
+                                                                                \
+            fft_tables_permute(fft_tables_perm_fut, cfft_inst_ptr->fftLen,      \
+                               bitRevLength, fft_tables_bitrev);                \
+            fft_tables_permute(fft_tables_perm_ref, cfft_inst_ptr->fftLen,      \
+                               bitRevLength, cfft_inst_ptr->pBitRevTable);      \
+                                                                                \
+            if (memcmp(fft_tables_perm_fut, fft_tables_perm_ref,                \
+                       2U * cfft_inst_ptr->fftLen * sizeof(uint32_t)) != 0)     \
+            {                                                                   \
+                return JTEST_TEST_FAILED;                                       \
+            });                                                                 \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+FFT_TABLES_BITREV_DEFINE_TEST(f32, 0U);
+FFT_TABLES_BITREV_DEFINE_TEST(q31, 1U);
+
+/*--------------------------------------------------------------------------------*/
+/* Instances in RAM */
+/*--------------------------------------------------------------------------------*/
+
+/*
+  RAM instance test template: the transform with the generated tables must give
+  the same bits as with the constant instance.
+*/
+#define FFT_TABLES_CFFT_RAM_DEFINE_TEST(suffix, output_type, config_suffix, ifft_flag) \
+    JTEST_DEFINE_TEST(arm_cfft_init_ram_##suffix##_##config_suffix##_test,      \
+                      arm_cfft_init_ram_##suffix)                               \
+    {                                                                           \
+        arm_cfft_instance_##suffix cfft_inst_fut;                               \
+        arm_fft_table_arena arena;                                              \
+                                                                                \
+        TEMPLATE_DO_ARR_DESC(                                                   \
+            cfft_inst_idx, const arm_cfft_instance_##suffix *, cfft_inst_ptr,   \
+            fft_tables_cfft_##suffix##_structs                                  \
+            ,                                                                   \
+            arm_fft_table_arena_init(&arena, fft_tables_arena_buf,              \
+                                     sizeof(fft_tables_arena_buf));             \
+                                                                                \
+            if (arm_cfft_init_ram_##suffix(&cfft_inst_fut,                      \
+                                           cfft_inst_ptr->fftLen,               \
+                                           &arena) != ARM_MATH_SUCCESS)         \
+            {                                                                   \
+                return JTEST_TEST_FAILED;                                       \
+            }                                                                   \
+                                                                                \
+            memcpy(transform_fft_inplace_input_fut,                             \
+                   transform_fft_##suffix##_inputs,                             \
+                   2U * cfft_inst_ptr->fftLen * sizeof(output_type));           \
+            memcpy(transform_fft_inplace_input_ref,                             \
+                   transform_fft_##suffix##_inputs,                             \
+                   2U * cfft_inst_ptr->fftLen * sizeof(output_type));           \
+                                                                                \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                  \
+                            "Arena bytes: %d\n"                                 \
+                            "Inverse-transform flag: %d\n",                     \
+                            (int)cfft_inst_ptr->fftLen,                         \
+                            (int)arena.used,                                    \
+                            (int)ifft_flag);                                    \
+                                                                                \
+            JTEST_COUNT_CYCLES(                                                 \
+                arm_cfft_##suffix(&cfft_inst_fut,                               \
+                                  (void *) transform_fft_inplace_input_fut,     \
+                                  ifft_flag, 1U));                              \
+                                                                                \
+            arm_cfft_##suffix(cfft_inst_ptr,                                    \
+                              (void *) transform_fft_inplace_input_ref,         \
+                              ifft_flag, 1U);                                   \
+                                                                                \
+            if (memcmp(transform_fft_inplace_input_fut,                         \
+                       transform_fft_inplace_input_ref,                         \
+                       2U * cfft_inst_ptr->fftLen * sizeof(output_type)) != 0)  \
+            {                                                                   \
+                return JTEST_TEST_FAILED;                                       \
+            });                                                                 \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+FFT_TABLES_CFFT_RAM_DEFINE_TEST(f32, float32_t, forward, 0U);
+FFT_TABLES_CFFT_RAM_DEFINE_TEST(f32, float32_t, inverse, 1U);
+FFT_TABLES_CFFT_RAM_DEFINE_TEST(q31, q31_t, forward, 0U);
+FFT_TABLES_CFFT_RAM_DEFINE_TEST(q31, q31_t, inverse, 1U);
+FFT_TABLES_CFFT_RAM_DEFINE_TEST(q15, q15_t, forward, 0U);
+FFT_TABLES_CFFT_RAM_DEFINE_TEST(q15, q15_t, inverse, 1U);
+
+JTEST_DEFINE_TEST(arm_rfft_fast_init_ram_f32_test,
+                  arm_rfft_fast_init_ram_f32)
+{
+    arm_rfft_fast_instance_f32 rfft_inst_fut;
+    arm_rfft_fast_instance_f32 rfft_inst_ref;
+    arm_fft_table_arena arena;
+
+    TEMPLATE_DO_ARR_DESC(
+        fftlen_idx, uint16_t, fftlen, fft_tables_rfft_fast_fftlens
+        ,
+        arm_fft_table_arena_init(&arena, fft_tables_arena_buf,
+                                 sizeof(fft_tables_arena_buf));
+
+        if ((arm_rfft_fast_init_ram_f32(&rfft_inst_fut, fftlen, &arena) != ARM_MATH_SUCCESS) ||
+            (arm_rfft_fast_init_f32(&rfft_inst_ref, fftlen) != ARM_MATH_SUCCESS))
+        {
+            return JTEST_TEST_FAILED;
+        }
+
+        /* The forward transform modifies its input */
+        memcpy(transform_fft_input_fut, transform_fft_f32_inputs,
+               fftlen * sizeof(float32_t));
+        memcpy(transform_fft_input_ref, transform_fft_f32_inputs,
+               fftlen * sizeof(float32_t));
+
+        JTEST_DUMP_STRF("Block Size: %d\n"
+                        "Arena bytes: %d\n",
+                        (int)fftlen,
+                        (int)arena.used);
+
+        JTEST_COUNT_CYCLES(
+            arm_rfft_fast_f32(&rfft_inst_fut, transform_fft_input_fut,
+                              transform_fft_output_fut, 0U));
+
+        arm_rfft_fast_f32(&rfft_inst_ref, transform_fft_input_ref,
+                          transform_fft_output_ref, 0U);
+
+        if (memcmp(transform_fft_output_fut, transform_fft_output_ref,
+                   fftlen * sizeof(float32_t)) != 0)
+        {
+            return JTEST_TEST_FAILED;
+        });
+
+    return JTEST_TEST_PASSED;
+}
+
+/* A full arena or an unsupported length is reported and nothing is allocated. */
+JTEST_DEFINE_TEST(arm_cfft_init_ram_errors_test,
+                  arm_cfft_init_ram_f32)
+{
+    arm_cfft_instance_f32 cfft_inst_fut;
+    arm_fft_table_arena arena;
+
+    arm_fft_table_arena_init(&arena, fft_tables_arena_buf,
+                             ARM_CFFT_RAM_TABLES_SIZE_F32(1024) - 4U);
+
+    if ((arm_cfft_init_ram_f32(&cfft_inst_fut, 1024U, &arena) != ARM_MATH_LENGTH_ERROR) ||
+        (arm_cfft_init_ram_f32(&cfft_inst_fut, 1000U, &arena) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arm_cfft_init_ram_f32(&cfft_inst_fut, 8192U, &arena) != ARM_MATH_ARGUMENT_ERROR) ||
+        (arena.used != 0U))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    /* 512 points fit once, leaving room for less than another instance */
+    if ((arm_cfft_init_ram_f32(&cfft_inst_fut, 512U, &arena) != ARM_MATH_SUCCESS) ||
+        (arena.used != ARM_CFFT_RAM_TABLES_SIZE_F32(512)) ||
+        (arm_cfft_init_ram_f32(&cfft_inst_fut, 512U, &arena) != ARM_MATH_SUCCESS) ||
+        (arm_cfft_init_ram_f32(&cfft_inst_fut, 1024U, &arena) != ARM_MATH_LENGTH_ERROR))
+    {
+        return JTEST_TEST_FAILED;
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fft_tables_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_cfft_twiddle_gen_f32_test);
+    JTEST_TEST_CALL(arm_cfft_twiddle_gen_q31_test);
+    JTEST_TEST_CALL(arm_cfft_twiddle_gen_q15_test);
+    JTEST_TEST_CALL(arm_rfft_fast_twiddle_gen_f32_test);
+    JTEST_TEST_CALL(arm_cfft_bitrev_gen_f32_test);
+    JTEST_TEST_CALL(arm_cfft_bitrev_gen_q31_test);
+
+    JTEST_TEST_CALL(arm_cfft_init_ram_f32_forward_test);
+    JTEST_TEST_CALL(arm_cfft_init_ram_f32_inverse_test);
+    JTEST_TEST_CALL(arm_cfft_init_ram_q31_forward_test);
+    JTEST_TEST_CALL(arm_cfft_init_ram_q31_inverse_test);
+    JTEST_TEST_CALL(arm_cfft_init_ram_q15_forward_test);
+    JTEST_TEST_CALL(arm_cfft_init_ram_q15_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_init_ram_f32_test);
+    JTEST_TEST_CALL(arm_cfft_init_ram_errors_test);
+}
@@ -64,6 +64,75 @@ FFT fast function test template. Arguments are: function configuration suffix
 RFFT_FAST_DEFINE_TEST(forward, 0U);
 RFFT_FAST_DEFINE_TEST(inverse, 1U);
 
+/*
+Fixed-point fast RFFT test template. Arguments are: output type (q15/q31),
+function configuration suffix and inverse-transform flag. The inputs are
+halved so that the inverse transform of the test data cannot saturate.
+*/
+#define RFFT_FAST_FIXED_DEFINE_TEST(suffix, config_suffix, ifft_flag)  \
+    JTEST_DEFINE_TEST(arm_rfft_fast_##suffix##_##config_suffix##_test,  \
+                      arm_rfft_fast_##suffix)                           \
+    {                                                                   \
+        arm_rfft_fast_instance_##suffix rfft_inst_fut = {{0}, 0, 0};    \
+        arm_rfft_fast_instance_##suffix rfft_inst_ref = {{0}, 0, 0};    \
+        uint32_t i;                                                     \
+                                                                        \
+        /* Go through all FFT lengths */                                \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            fftlen_idx, uint16_t, fftlen, transform_rfft_fast_fftlens   \
+            ,                                                           \
+                                                                        \
+            /* Initialize the RFFT Instances */                         \
+            arm_rfft_fast_init_##suffix(                                \
+                &rfft_inst_fut, fftlen);                                \
+                                                                        \
+            arm_rfft_fast_init_##suffix(                                \
+                &rfft_inst_ref, fftlen);                                \
+                                                                        \
+            TRANSFORM_COPY_INPUTS(                                      \
+                transform_fft_##suffix##_inputs,                        \
+                fftlen *                                                \
+                sizeof(suffix##_t));                      \
+                                                                        \
+            for (i = 0; i < fftlen; i++)                                \
+            {                                                           \
+                ((suffix##_t *) transform_fft_input_fut)[i] >>= 1; \
+                ((suffix##_t *) transform_fft_input_ref)[i] >>= 1; \
+            }                                                           \
+                                                                        \
+            /* Display parameter values */                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                          \
+                            "Inverse-transform flag: %d\n",             \
+                         (int)fftlen,                                   \
+                         (int)ifft_flag);                               \
+                                                                        \
+            /* Display cycle count and run test */                      \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_rfft_fast_##suffix(                                 \
+                    &rfft_inst_fut,                                     \
+                    (void *) transform_fft_input_fut,                   \
+                    (void *) transform_fft_output_fut,                  \
+                    ifft_flag));                                        \
+                                                                        \
+            ref_rfft_fast_##suffix(                                     \
+                &rfft_inst_ref,                                         \
+                (void *) transform_fft_input_ref,                       \
+                (void *) transform_fft_output_ref,                      \
+                ifft_flag);                                             \
+                                                                        \
+            /* Test correctness */                                      \
+            TRANSFORM_SNR_COMPARE_INTERFACE(                            \
+                fftlen,                                                 \
+                suffix##_t));                             \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+RFFT_FAST_FIXED_DEFINE_TEST(q31, forward, 0U);
+RFFT_FAST_FIXED_DEFINE_TEST(q31, inverse, 1U);
+RFFT_FAST_FIXED_DEFINE_TEST(q15, forward, 0U);
+RFFT_FAST_FIXED_DEFINE_TEST(q15, inverse, 1U);
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
 /*--------------------------------------------------------------------------------*/
@@ -72,4 +141,8 @@ JTEST_DEFINE_GROUP(rfft_fast_tests)
 {
     JTEST_TEST_CALL(arm_rfft_fast_f32_forward_test);
     JTEST_TEST_CALL(arm_rfft_fast_f32_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_q31_forward_test);
+    JTEST_TEST_CALL(arm_rfft_fast_q31_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_q15_forward_test);
+    JTEST_TEST_CALL(arm_rfft_fast_q15_inverse_test);
 }
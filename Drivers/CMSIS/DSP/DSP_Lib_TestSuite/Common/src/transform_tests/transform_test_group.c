@@ -7,5 +7,8 @@ JTEST_DEFINE_GROUP(transform_tests)
     JTEST_GROUP_CALL(cfft_family_tests);
     JTEST_GROUP_CALL(rfft_tests);
     JTEST_GROUP_CALL(rfft_fast_tests);
+    JTEST_GROUP_CALL(cfft_mixed_tests);
+    JTEST_GROUP_CALL(fft_tables_tests);
+    JTEST_GROUP_CALL(dft_bins_tests);
     JTEST_GROUP_CALL(dct4_tests);
 }
@@ -0,0 +1,56 @@
+/* ----------------------------------------------------------------------
+ * Title:        arm_bitreversal_host.c
+ * Description:  C versions of arm_bitreversal_32/16 for host builds.
+ *               On target they come from arm_bitreversal2.S; this is the
+ *               same algorithm as its Cortex-M0 variant.
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/*
+* @brief  In-place bit reversal function.
+* @param[in, out] *pSrc        points to the in-place buffer of unknown 32-bit data type.
+* @param[in]      bitRevLen    bit reversal table length
+* @param[in]      *pBitRevTab  points to bit reversal table (byte offsets).
+* @return none.
+*/
+void arm_bitreversal_32(
+  uint32_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTab)
+{
+  uint8_t * p = (uint8_t *) pSrc;
+  uint32_t i;
+  uint32_t t[2];
+
+  for (i = 0; i < bitRevLen; i += 2)
+  {
+    memcpy(t, p + pBitRevTab[i], 8);
+    memcpy(p + pBitRevTab[i], p + pBitRevTab[i + 1], 8);
+    memcpy(p + pBitRevTab[i + 1], t, 8);
+  }
+}
+
+/*
+* @brief  In-place bit reversal function.
+* @param[in, out] *pSrc        points to the in-place buffer of unknown 16-bit data type.
+* @param[in]      bitRevLen    bit reversal table length
+* @param[in]      *pBitRevTab  points to bit reversal table (byte offsets of the 32-bit case).
+* @return none.
+*/
+void arm_bitreversal_16(
+  uint16_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTab)
+{
+  uint8_t * p = (uint8_t *) pSrc;
+  uint32_t i;
+  uint32_t t;
+
+  for (i = 0; i < bitRevLen; i += 2)
+  {
+    memcpy(&t, p + (pBitRevTab[i] >> 1), 4);
+    memcpy(p + (pBitRevTab[i] >> 1), p + (pBitRevTab[i + 1] >> 1), 4);
+    memcpy(p + (pBitRevTab[i + 1] >> 1), &t, 4);
+  }
+}
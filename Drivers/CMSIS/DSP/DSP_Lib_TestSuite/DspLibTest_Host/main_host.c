@@ -0,0 +1,80 @@
+#include "jtest.h"
+#include "all_tests.h"
+#include "arm_math.h"
+#include "jtest_clock.h"
+#include "jtest_report.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*--------------------------------------------------------------------------------*/
+/* Host entry point of the DSP_Lib_TestSuite (see HowTo.txt) */
+/*--------------------------------------------------------------------------------*/
+
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: DspLibTest_Host [-o report.jsonl] [-clock mono|cpu|tsc] [-q]\n"
+            "  -o      write the JSON Lines report (one record per test and size)\n"
+            "  -clock  clock used for JTEST_COUNT_CYCLES (default mono)\n"
+            "  -q      do not echo the test log\n");
+}
+
+int main(int argc, char ** argv)
+{
+    FILE *       report = NULL;
+    const char * report_name = NULL;
+    int          i;
+
+    for (i = 1; i < argc; ++i)
+    {
+        if ((strcmp(argv[i], "-o") == 0) && (i + 1 < argc))
+        {
+            report_name = argv[++i];
+        }
+        else if ((strcmp(argv[i], "-clock") == 0) && (i + 1 < argc))
+        {
+            if (!jtest_clock_select(argv[++i]))
+            {
+                fprintf(stderr, "unknown clock '%s'\n", argv[i]);
+                return 2;
+            }
+        }
+        else if (strcmp(argv[i], "-q") == 0)
+        {
+            jtest_report_echo = 0;
+        }
+        else
+        {
+            usage();
+            return 2;
+        }
+    }
+
+    if (report_name)
+    {
+        report = fopen(report_name, "w");
+        if (report == NULL)
+        {
+            perror(report_name);
+            return 2;
+        }
+        jtest_report_open(report);
+    }
+
+    JTEST_INIT();               /* Initialize test framework. */
+
+    JTEST_GROUP_CALL(all_tests); /* Run all tests. */
+
+    JTEST_ACT_EXIT_FW();        /* Exit test framework.  */
+
+    if (report)
+    {
+        fclose(report);
+    }
+
+    fprintf(stderr, "%d passed, %d failed\n",
+            (int) JTEST_FW.passed, (int) JTEST_FW.failed);
+
+    return (JTEST_FW.failed != 0);
+}
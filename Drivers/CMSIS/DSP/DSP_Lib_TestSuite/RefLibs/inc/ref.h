@@ -927,6 +927,48 @@ void ref_fir_interpolate_q15(
   const arm_fir_interpolate_instance_q15 * S,
   q15_t * pSrc,
   q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_fir_resample_f32(
+  const arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_fir_resample_q31(
+  const arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+void ref_fir_resample_q15(
+  const arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_fir_multi_q15(
+  const arm_fir_multi_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_fir_multi_planar_q15(
+  const arm_fir_multi_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_biquad_cascade_df1_multi_q15(
+  const arm_biquad_casd_df1_multi_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+void ref_biquad_cascade_df1_multi_planar_q15(
+  const arm_biquad_casd_df1_multi_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
   uint32_t blockSize);
 
 	/*
@@ -955,6 +997,14 @@ arm_status ref_mat_inverse_f64(
   const arm_matrix_instance_f64 * pSrc,
   arm_matrix_instance_f64 * pDst);
 
+arm_status ref_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+arm_status ref_mat_cholesky_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst);
+
 arm_status ref_mat_mult_f32(
   const arm_matrix_instance_f32 * pSrcA,
   const arm_matrix_instance_f32 * pSrcB,
@@ -1175,6 +1225,21 @@ void ref_var_q15(
   uint32_t blockSize,
   q15_t * pResult);
 
+void ref_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult);
+
+void ref_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q31 * pResult);
+
+void ref_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q15 * pResult);
+
 	/*
 	 * Support Functions
 	 */
@@ -1348,6 +1413,81 @@ void ref_rfft_q15(
   q15_t * pSrc,
   q15_t * pDst);
 
+void ref_rfft_fast_q31(
+	const arm_rfft_fast_instance_q31 * S,
+	q31_t * p, q31_t * pOut,
+	uint8_t ifftFlag);
+
+void ref_rfft_fast_q15(
+	const arm_rfft_fast_instance_q15 * S,
+	q15_t * p, q15_t * pOut,
+	uint8_t ifftFlag);
+
+void ref_cfft_mixed_f32(
+	const arm_cfft_mixed_instance_f32 * S,
+	float32_t * p1,
+	uint8_t ifftFlag);
+
+void ref_cfft_mixed_q31(
+	const arm_cfft_mixed_instance_q31 * S,
+	q31_t * p1,
+	uint8_t ifftFlag);
+
+void ref_rfft_mixed_f32(
+	const arm_rfft_mixed_instance_f32 * S,
+	float32_t * p,
+	float32_t * pOut,
+	uint8_t ifftFlag);
+
+void ref_rfft_mixed_q31(
+	const arm_rfft_mixed_instance_q31 * S,
+	q31_t * p,
+	q31_t * pOut,
+	uint8_t ifftFlag);
+
+void ref_goertzel_f32(
+	const arm_goertzel_instance_f32 * S,
+	float32_t * pSrc,
+	uint32_t blockSize,
+	float32_t * pDst);
+
+void ref_goertzel_q31(
+	const arm_goertzel_instance_q31 * S,
+	q31_t * pSrc,
+	uint32_t blockSize,
+	q31_t * pDst);
+
+void ref_goertzel_q15(
+	const arm_goertzel_instance_q15 * S,
+	q15_t * pSrc,
+	uint32_t blockSize,
+	q15_t * pDst);
+
+/* The sliding DFT references return the bins after numSamples samples. */
+void ref_sdft_f32(
+	float32_t * pSrc,
+	uint32_t numSamples,
+	uint16_t winLen,
+	const uint16_t * pBins,
+	uint16_t numBins,
+	float32_t * pDst);
+
+void ref_sdft_q31(
+	q31_t * pSrc,
+	uint32_t numSamples,
+	uint16_t winLen,
+	const uint16_t * pBins,
+	uint16_t numBins,
+	q31_t * pDst);
+
+void ref_sdft_q15(
+	q15_t * pSrc,
+	uint32_t numSamples,
+	uint16_t winLen,
+	const uint16_t * pBins,
+	uint16_t numBins,
+	q15_t * pDst);
+
 void ref_dct4_f32(
   const arm_dct4_instance_f32 * S,
   float32_t * pState,
@@ -0,0 +1,145 @@
+#include "ref.h"
+
+void ref_fir_resample_f32(
+  const arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t L = S->L, M = S->M;                   /* Interpolation and decimation factors */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t numTaps = L * phaseLen;               /* Length of the filter */
+  uint32_t i, k;                                 /* Loop counters */
+  int32_t j, idx;                                /* Upsampled sample indexes */
+
+  /* New samples follow the previous phaseLen - 1 samples */
+  for (i = 0; i < blockSize; i++)
+  {
+    pState[phaseLen - 1U + i] = pSrc[i];
+  }
+
+  /* Keep every M-th sample of the upsampled and filtered block, starting with sample 0 */
+  for (i = 0; i < (blockSize * L) / M; i++)
+  {
+    j = (int32_t) (i * M);
+    sum = 0.0f;
+
+    /* Direct convolution with the zero stuffed input */
+    for (k = 0; k < numTaps; k++)
+    {
+      idx = j - (int32_t) k;
+
+      if ((idx % (int32_t) L) == 0)
+      {
+        sum += (float32_t) pState[(int32_t) (phaseLen - 1U) + (idx / (int32_t) L)] * pCoeffs[numTaps - 1U - k];
+      }
+    }
+
+    *pDst++ = sum;
+  }
+
+  /* Keep the last phaseLen - 1 samples for the next call */
+  for (i = 0; i < phaseLen - 1U; i++)
+  {
+    pState[i] = pState[blockSize + i];
+  }
+}
+
+void ref_fir_resample_q31(
+  const arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t L = S->L, M = S->M;                   /* Interpolation and decimation factors */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t numTaps = L * phaseLen;               /* Length of the filter */
+  uint32_t i, k;                                 /* Loop counters */
+  int32_t j, idx;                                /* Upsampled sample indexes */
+
+  /* New samples follow the previous phaseLen - 1 samples */
+  for (i = 0; i < blockSize; i++)
+  {
+    pState[phaseLen - 1U + i] = pSrc[i];
+  }
+
+  /* Keep every M-th sample of the upsampled and filtered block, starting with sample 0 */
+  for (i = 0; i < (blockSize * L) / M; i++)
+  {
+    j = (int32_t) (i * M);
+    sum = 0;
+
+    /* Direct convolution with the zero stuffed input */
+    for (k = 0; k < numTaps; k++)
+    {
+      idx = j - (int32_t) k;
+
+      if ((idx % (int32_t) L) == 0)
+      {
+        sum += (q63_t) pState[(int32_t) (phaseLen - 1U) + (idx / (int32_t) L)] * pCoeffs[numTaps - 1U - k];
+      }
+    }
+
+    *pDst++ = (q31_t) (sum >> 31);
+  }
+
+  /* Keep the last phaseLen - 1 samples for the next call */
+  for (i = 0; i < phaseLen - 1U; i++)
+  {
+    pState[i] = pState[blockSize + i];
+  }
+}
+
+void ref_fir_resample_q15(
+  const arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t L = S->L, M = S->M;                   /* Interpolation and decimation factors */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t numTaps = L * phaseLen;               /* Length of the filter */
+  uint32_t i, k;                                 /* Loop counters */
+  int32_t j, idx;                                /* Upsampled sample indexes */
+
+  /* New samples follow the previous phaseLen - 1 samples */
+  for (i = 0; i < blockSize; i++)
+  {
+    pState[phaseLen - 1U + i] = pSrc[i];
+  }
+
+  /* Keep every M-th sample of the upsampled and filtered block, starting with sample 0 */
+  for (i = 0; i < (blockSize * L) / M; i++)
+  {
+    j = (int32_t) (i * M);
+    sum = 0;
+
+    /* Direct convolution with the zero stuffed input */
+    for (k = 0; k < numTaps; k++)
+    {
+      idx = j - (int32_t) k;
+
+      if ((idx % (int32_t) L) == 0)
+      {
+        sum += (q31_t) pState[(int32_t) (phaseLen - 1U) + (idx / (int32_t) L)] * pCoeffs[numTaps - 1U - k];
+      }
+    }
+
+    *pDst++ = ref_sat_q15(sum >> 15);
+  }
+
+  /* Keep the last phaseLen - 1 samples for the next call */
+  for (i = 0; i < phaseLen - 1U; i++)
+  {
+    pState[i] = pState[blockSize + i];
+  }
+}
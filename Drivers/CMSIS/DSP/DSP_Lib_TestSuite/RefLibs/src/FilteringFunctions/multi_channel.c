@@ -0,0 +1,153 @@
+#include "ref.h"
+
+/*
+ * The multi-channel references filter each channel on its own, with the state
+ * layout of the library functions: interleaved frames for the FIR filter and
+ * four values per channel and stage for the Biquad cascade.
+ * chanStride and frameStride select the interleaved or the planar layout.
+ */
+static void ref_fir_multi_strided_q15(
+  const arm_fir_multi_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t chanStride,
+  uint32_t frameStride,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients */
+  uint32_t numCh = S->numChannels;               /* Number of channels */
+  uint32_t ch, n, i;                             /* Loop counters */
+  q63_t acc;
+
+  /* New frames follow the previous numTaps - 1 frames */
+  for (n = 0; n < blockSize; n++)
+  {
+    for (ch = 0; ch < numCh; ch++)
+    {
+      pState[(numTaps - 1U + n) * numCh + ch] = pSrc[ch * chanStride + n * frameStride];
+    }
+  }
+
+  for (ch = 0; ch < numCh; ch++)
+  {
+    for (n = 0; n < blockSize; n++)
+    {
+      acc = 0;
+
+      for (i = 0; i < numTaps; i++)
+      {
+        acc += (q31_t)pState[(n + i) * numCh + ch] * pCoeffs[i];
+      }
+
+      pDst[ch * chanStride + n * frameStride] = ref_sat_q15(acc >> 15);
+    }
+  }
+
+  /* Keep the last numTaps - 1 frames for the next call */
+  for (i = 0; i < (numTaps - 1U) * numCh; i++)
+  {
+    pState[i] = pState[blockSize * numCh + i];
+  }
+}
+
+void ref_fir_multi_q15(
+  const arm_fir_multi_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  ref_fir_multi_strided_q15(S, pSrc, pDst, 1U, S->numChannels, blockSize);
+}
+
+void ref_fir_multi_planar_q15(
+  const arm_fir_multi_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  ref_fir_multi_strided_q15(S, pSrc, pDst, blockSize, 1U, blockSize);
+}
+
+static void ref_biquad_cascade_df1_multi_strided_q15(
+  const arm_biquad_casd_df1_multi_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t chanStride,
+  uint32_t frameStride,
+  uint32_t blockSize)
+{
+  q15_t *pIn = pSrc;                             /* Source pointer */
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pSt;                                    /* State of the current channel */
+  q15_t b0, b1, b2, a1, a2;                      /* Filter coefficients */
+  q15_t Xn, Xn1, Xn2, Yn1, Yn2;                  /* Filter state variables */
+  q63_t acc;                                     /* Accumulator */
+  int32_t shift = (15 - (int32_t) S->postShift); /* Post shift */
+  uint32_t numCh = S->numChannels;               /* Number of channels */
+  uint32_t stage, ch, n;                         /* Loop counters */
+
+  for (stage = 0; stage < S->numStages; stage++)
+  {
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[2];
+    b2 = pCoeffs[3];
+    a1 = pCoeffs[4];
+    a2 = pCoeffs[5];
+
+    for (ch = 0; ch < numCh; ch++)
+    {
+      pSt = pState + 4U * ch;
+
+      Xn1 = pSt[0];
+      Xn2 = pSt[1];
+      Yn1 = pSt[2];
+      Yn2 = pSt[3];
+
+      for (n = 0; n < blockSize; n++)
+      {
+        Xn = pIn[ch * chanStride + n * frameStride];
+
+        acc = (q31_t)b0*Xn + (q31_t)b1*Xn1 + (q31_t)b2*Xn2 + (q31_t)a1*Yn1 + (q31_t)a2*Yn2;
+        acc = ref_sat_q15(acc >> shift);
+
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = (q15_t) acc;
+
+        pDst[ch * chanStride + n * frameStride] = (q15_t) acc;
+      }
+
+      pSt[0] = Xn1;
+      pSt[1] = Xn2;
+      pSt[2] = Yn1;
+      pSt[3] = Yn2;
+    }
+
+    /* The following stages filter the output of the previous one */
+    pIn = pDst;
+    pCoeffs += 6U;
+    pState += 4U * numCh;
+  }
+}
+
+void ref_biquad_cascade_df1_multi_q15(
+  const arm_biquad_casd_df1_multi_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  ref_biquad_cascade_df1_multi_strided_q15(S, pSrc, pDst, 1U, S->numChannels, blockSize);
+}
+
+void ref_biquad_cascade_df1_multi_planar_q15(
+  const arm_biquad_casd_df1_multi_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  ref_biquad_cascade_df1_multi_strided_q15(S, pSrc, pDst, blockSize, 1U, blockSize);
+}
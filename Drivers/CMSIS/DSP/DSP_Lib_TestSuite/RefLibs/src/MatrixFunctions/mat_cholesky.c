@@ -0,0 +1,96 @@
+#include "ref.h"
+
+/*
+ * Cholesky-Crout decomposition in double precision, L[i][j] for i >= j.
+ */
+static arm_status ref_mat_cholesky_f64(
+  const float64_t * pSrc,
+  float64_t * pDst,
+  uint32_t n)
+{
+	uint32_t i,j,k;
+	float64_t sum;
+
+	for(i=0;i<n*n;i++)
+	{
+		pDst[i] = 0.0;
+	}
+
+	for(j=0;j<n;j++)
+	{
+		sum = pSrc[j*n + j];
+		for(k=0;k<j;k++)
+		{
+			sum -= pDst[j*n + k] * pDst[j*n + k];
+		}
+
+		if(sum <= 0.0)
+		{
+			return ARM_MATH_SINGULAR;
+		}
+
+		pDst[j*n + j] = sqrt(sum);
+
+		for(i=j+1;i<n;i++)
+		{
+			sum = pSrc[i*n + j];
+			for(k=0;k<j;k++)
+			{
+				sum -= pDst[i*n + k] * pDst[j*n + k];
+			}
+			pDst[i*n + j] = sum / pDst[j*n + j];
+		}
+	}
+
+	return ARM_MATH_SUCCESS;
+}
+
+arm_status ref_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+	uint32_t i;
+	uint32_t n = pSrc->numRows;
+	float64_t * pIn = (float64_t *)scratchArray;
+	float64_t * pOut = pIn + n*n;
+	arm_status status;
+
+	for(i=0;i<n*n;i++)
+	{
+		pIn[i] = pSrc->pData[i];
+	}
+
+	status = ref_mat_cholesky_f64(pIn,pOut,n);
+
+	for(i=0;i<n*n;i++)
+	{
+		pDst->pData[i] = (float32_t)pOut[i];
+	}
+
+	return status;
+}
+
+arm_status ref_mat_cholesky_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst)
+{
+	uint32_t i;
+	uint32_t n = pSrc->numRows;
+	float64_t * pIn = (float64_t *)scratchArray;
+	float64_t * pOut = pIn + n*n;
+	arm_status status;
+
+	for(i=0;i<n*n;i++)
+	{
+		pIn[i] = (float64_t)pSrc->pData[i] / 2147483648.0;
+	}
+
+	status = ref_mat_cholesky_f64(pIn,pOut,n);
+
+	for(i=0;i<n*n;i++)
+	{
+		pDst->pData[i] = ref_sat_q31((q63_t)(pOut[i] * 2147483648.0));
+	}
+
+	return status;
+}
@@ -0,0 +1,47 @@
+#include "ref.h"
+
+/*
+ * The single-pass statistics are checked against the separate reference
+ * functions.
+ */
+void ref_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult)
+{
+	ref_mean_f32(pSrc, blockSize, &pResult->mean);
+	ref_var_f32(pSrc, blockSize, &pResult->var);
+	ref_rms_f32(pSrc, blockSize, &pResult->rms);
+	ref_power_f32(pSrc, blockSize, &pResult->power);
+	ref_min_f32(pSrc, blockSize, &pResult->min, &pResult->minIndex);
+	ref_max_f32(pSrc, blockSize, &pResult->max, &pResult->maxIndex);
+}
+
+void ref_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q31 * pResult)
+{
+	ref_mean_q31(pSrc, blockSize, &pResult->mean);
+	ref_var_q31(pSrc, blockSize, &pResult->var);
+	ref_power_q31(pSrc, blockSize, &pResult->power);
+	ref_min_q31(pSrc, blockSize, &pResult->min, &pResult->minIndex);
+	ref_max_q31(pSrc, blockSize, &pResult->max, &pResult->maxIndex);
+
+	/* ref_rms_q31() wraps around for full scale inputs: the RMS value is
+	   derived from the 16.48 power instead */
+	pResult->rms = (q31_t)(sqrt((double)pResult->power / blockSize / 281474976710656.0) * 2147483648.0);
+}
+
+void ref_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q15 * pResult)
+{
+	ref_mean_q15(pSrc, blockSize, &pResult->mean);
+	ref_var_q15(pSrc, blockSize, &pResult->var);
+	ref_rms_q15(pSrc, blockSize, &pResult->rms);
+	ref_power_q15(pSrc, blockSize, &pResult->power);
+	ref_min_q15(pSrc, blockSize, &pResult->min, &pResult->minIndex);
+	ref_max_q15(pSrc, blockSize, &pResult->max, &pResult->maxIndex);
+}
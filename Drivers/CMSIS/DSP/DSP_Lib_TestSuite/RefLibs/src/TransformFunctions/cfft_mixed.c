@@ -0,0 +1,181 @@
+#include "ref.h"
+#include <string.h>             /* memcpy() */
+
+/*
+ * Direct DFT in double precision, used as the reference of the mixed-radix
+ * transforms whose lengths are not powers of two.
+ * dir is -1 for the forward transform and 1 for the inverse transform.
+ */
+static void ref_dft_f64(
+	const float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t N,
+	int32_t dir,
+	float64_t scale)
+{
+	uint32_t k, n;
+	float64_t sumR, sumI, phase;
+
+	for (k = 0; k < N; k++)
+	{
+		sumR = 0.0;
+		sumI = 0.0;
+
+		for (n = 0; n < N; n++)
+		{
+			/* Reduce k*n modulo N to keep the phase accurate */
+			phase = dir * 6.283185307179586476925 * (float64_t)((k * n) % N) / N;
+			sumR += pSrc[2*n] * cos(phase) - pSrc[2*n+1] * sin(phase);
+			sumI += pSrc[2*n] * sin(phase) + pSrc[2*n+1] * cos(phase);
+		}
+
+		pDst[2*k]   = (float32_t)(sumR * scale);
+		pDst[2*k+1] = (float32_t)(sumI * scale);
+	}
+}
+
+static q31_t ref_f64_to_q31(float64_t x)
+{
+	x *= 2147483648.0;
+
+	if (x >= 2147483647.0)
+	{
+		return 0x7FFFFFFF;
+	}
+	else if (x <= -2147483648.0)
+	{
+		return (q31_t)0x80000000;
+	}
+
+	return (q31_t)x;
+}
+
+void ref_cfft_mixed_f32(
+	const arm_cfft_mixed_instance_f32 * S,
+	float32_t * p1,
+	uint8_t ifftFlag)
+{
+	uint32_t N = S->fftLen;
+
+	memcpy(S->pScratch, p1, 2 * N * sizeof(float32_t));
+
+	ref_dft_f64(S->pScratch, p1, N, ifftFlag ? 1 : -1, ifftFlag ? 1.0 / N : 1.0);
+}
+
+void ref_cfft_mixed_q31(
+	const arm_cfft_mixed_instance_q31 * S,
+	q31_t * p1,
+	uint8_t ifftFlag)
+{
+	uint32_t i;
+	uint32_t N = S->fftLen;
+	float32_t *fSrc = (float32_t*)S->pScratch;
+	float32_t *fDst = (float32_t*)p1;
+
+	for (i = 0; i < 2 * N; i++)
+	{
+		fSrc[i] = (float32_t)p1[i] / 2147483648.0f;
+	}
+
+	/* Both directions are scaled by 1/N */
+	ref_dft_f64(fSrc, fDst, N, ifftFlag ? 1 : -1, 1.0 / N);
+
+	for (i = 0; i < 2 * N; i++)
+	{
+		p1[i] = ref_f64_to_q31(fDst[i]);
+	}
+}
+
+/*
+ * Real transforms: the spectrum is packed as for arm_rfft_fast_f32(), with
+ * X[0] and X[N/2] in the first complex value.
+ */
+static void ref_rdft_f64(
+	const float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t N,
+	uint8_t ifftFlag,
+	float64_t scale)
+{
+	uint32_t k, n;
+	float64_t sumR, sumI, phase;
+
+	if (ifftFlag == 0)
+	{
+		for (k = 0; k < N / 2; k++)
+		{
+			sumR = 0.0;
+			sumI = 0.0;
+
+			for (n = 0; n < N; n++)
+			{
+				phase = -6.283185307179586476925 * (float64_t)((k * n) % N) / N;
+				sumR += pSrc[n] * cos(phase);
+				sumI += pSrc[n] * sin(phase);
+			}
+
+			pDst[2*k]   = (float32_t)(sumR * scale);
+			pDst[2*k+1] = (float32_t)(sumI * scale);
+		}
+
+		/* X[N/2] */
+		sumR = 0.0;
+		for (n = 0; n < N; n++)
+		{
+			sumR += (n & 1) ? -pSrc[n] : pSrc[n];
+		}
+		pDst[1] = (float32_t)(sumR * scale);
+	}
+	else
+	{
+		for (n = 0; n < N; n++)
+		{
+			/* Hermitian spectrum: X[0], X[N/2] and twice the real part of the other bins */
+			sumR = pSrc[0] + ((n & 1) ? -pSrc[1] : pSrc[1]);
+
+			for (k = 1; k < N / 2; k++)
+			{
+				phase = 6.283185307179586476925 * (float64_t)((k * n) % N) / N;
+				sumR += 2.0 * (pSrc[2*k] * cos(phase) - pSrc[2*k+1] * sin(phase));
+			}
+
+			pDst[n] = (float32_t)(sumR * scale);
+		}
+	}
+}
+
+void ref_rfft_mixed_f32(
+	const arm_rfft_mixed_instance_f32 * S,
+	float32_t * p,
+	float32_t * pOut,
+	uint8_t ifftFlag)
+{
+	uint32_t N = S->fftLenRFFT;
+
+	ref_rdft_f64(p, pOut, N, ifftFlag, ifftFlag ? 1.0 / N : 1.0);
+}
+
+void ref_rfft_mixed_q31(
+	const arm_rfft_mixed_instance_q31 * S,
+	q31_t * p,
+	q31_t * pOut,
+	uint8_t ifftFlag)
+{
+	uint32_t i;
+	uint32_t N = S->fftLenRFFT;
+	float32_t *fSrc = (float32_t*)S->Sint.pScratch;
+	float32_t *fDst = (float32_t*)pOut;
+
+	for (i = 0; i < N; i++)
+	{
+		fSrc[i] = (float32_t)p[i] / 2147483648.0f;
+	}
+
+	/* Both directions are scaled by 1/N */
+	ref_rdft_f64(fSrc, fDst, N, ifftFlag, 1.0 / N);
+
+	for (i = 0; i < N; i++)
+	{
+		pOut[i] = ref_f64_to_q31(fDst[i]);
+	}
+}
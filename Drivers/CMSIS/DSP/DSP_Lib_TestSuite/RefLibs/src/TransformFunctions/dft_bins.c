@@ -0,0 +1,226 @@
+#include "ref.h"
+
+/*
+ * The Goertzel and sliding DFT references compute the bins directly from their
+ * definition in double precision. The samples are read through a function so
+ * that the same code serves all the data types.
+ */
+typedef float64_t (*ref_dft_bins_sample_fn)(const void * pSrc, uint32_t n);
+
+static float64_t ref_dft_bins_sample_f32(const void * pSrc, uint32_t n)
+{
+	return ((const float32_t *)pSrc)[n];
+}
+
+static float64_t ref_dft_bins_sample_q31(const void * pSrc, uint32_t n)
+{
+	return ((const q31_t *)pSrc)[n] / 2147483648.0;
+}
+
+static float64_t ref_dft_bins_sample_q15(const void * pSrc, uint32_t n)
+{
+	return ((const q15_t *)pSrc)[n] / 32768.0;
+}
+
+static q31_t ref_dft_bins_to_q31(float64_t x)
+{
+	x *= 2147483648.0;
+
+	if (x >= 2147483647.0)
+	{
+		return 0x7FFFFFFF;
+	}
+	else if (x <= -2147483648.0)
+	{
+		return (q31_t)0x80000000;
+	}
+
+	return (q31_t)x;
+}
+
+/*
+ * X = sum(x[n] * exp(-i*w*(n-N))), where w is the frequency of the recursion
+ * 2*cos(w), and its sign that of the sine coefficient. A zero sine coefficient
+ * is the frequency 0 or pi, which saturated fixed-point cosines only approach.
+ */
+static void ref_goertzel_f64(
+	const void * pSrc,
+	ref_dft_bins_sample_fn sample,
+	uint32_t blockSize,
+	float64_t cosCoef,
+	float64_t sinCoef,
+	float64_t * pRe,
+	float64_t * pIm)
+{
+	uint32_t n;
+	float64_t w, sumR = 0.0, sumI = 0.0;
+
+	if (sinCoef == 0.0)
+	{
+		w = (cosCoef > 0.0) ? 0.0 : acos(-1.0);
+	}
+	else
+	{
+		w = acos(cosCoef);
+		if (sinCoef < 0.0)
+		{
+			w = -w;
+		}
+	}
+
+	for (n = 0; n < blockSize; n++)
+	{
+		sumR += sample(pSrc, n) * cos(w * ((float64_t)blockSize - n));
+		sumI += sample(pSrc, n) * sin(w * ((float64_t)blockSize - n));
+	}
+
+	*pRe = sumR;
+	*pIm = sumI;
+}
+
+void ref_goertzel_f32(
+	const arm_goertzel_instance_f32 * S,
+	float32_t * pSrc,
+	uint32_t blockSize,
+	float32_t * pDst)
+{
+	uint32_t k;
+	float64_t re, im;
+
+	for (k = 0; k < S->numBins; k++)
+	{
+		ref_goertzel_f64(pSrc, ref_dft_bins_sample_f32, blockSize,
+		                 S->pCoeffs[2*k], S->pCoeffs[2*k+1], &re, &im);
+		pDst[2*k]   = (float32_t)re;
+		pDst[2*k+1] = (float32_t)im;
+	}
+}
+
+void ref_goertzel_q31(
+	const arm_goertzel_instance_q31 * S,
+	q31_t * pSrc,
+	uint32_t blockSize,
+	q31_t * pDst)
+{
+	uint32_t k;
+	float64_t re, im;
+
+	for (k = 0; k < S->numBins; k++)
+	{
+		ref_goertzel_f64(pSrc, ref_dft_bins_sample_q31, blockSize,
+		                 S->pCoeffs[2*k] / 2147483648.0,
+		                 S->pCoeffs[2*k+1] / 2147483648.0, &re, &im);
+		pDst[2*k]   = ref_dft_bins_to_q31(re / blockSize);
+		pDst[2*k+1] = ref_dft_bins_to_q31(im / blockSize);
+	}
+}
+
+void ref_goertzel_q15(
+	const arm_goertzel_instance_q15 * S,
+	q15_t * pSrc,
+	uint32_t blockSize,
+	q15_t * pDst)
+{
+	uint32_t k;
+	float64_t re, im;
+
+	for (k = 0; k < S->numBins; k++)
+	{
+		ref_goertzel_f64(pSrc, ref_dft_bins_sample_q15, blockSize,
+		                 S->pCoeffs[2*k] / 2147483648.0,
+		                 S->pCoeffs[2*k+1] / 2147483648.0, &re, &im);
+		pDst[2*k]   = (q15_t)(ref_dft_bins_to_q31(re / blockSize) >> 16);
+		pDst[2*k+1] = (q15_t)(ref_dft_bins_to_q31(im / blockSize) >> 16);
+	}
+}
+
+/*
+ * DFT of the last winLen samples of a stream of numSamples samples, the oldest
+ * first, with zeros before the stream.
+ */
+static void ref_sdft_f64(
+	const void * pSrc,
+	ref_dft_bins_sample_fn sample,
+	uint32_t numSamples,
+	uint16_t winLen,
+	uint16_t bin,
+	float64_t * pRe,
+	float64_t * pIm)
+{
+	uint32_t m;
+	float64_t phase, x, sumR = 0.0, sumI = 0.0;
+
+	for (m = 0; m < winLen; m++)
+	{
+		/* Sample m of the window */
+		if (numSamples + m < winLen)
+		{
+			continue;
+		}
+
+		x = sample(pSrc, numSamples + m - winLen);
+		phase = -6.283185307179586476925 * (float64_t)((bin * m) % winLen) / winLen;
+		sumR += x * cos(phase);
+		sumI += x * sin(phase);
+	}
+
+	*pRe = sumR;
+	*pIm = sumI;
+}
+
+void ref_sdft_f32(
+	float32_t * pSrc,
+	uint32_t numSamples,
+	uint16_t winLen,
+	const uint16_t * pBins,
+	uint16_t numBins,
+	float32_t * pDst)
+{
+	uint32_t k;
+	float64_t re, im;
+
+	for (k = 0; k < numBins; k++)
+	{
+		ref_sdft_f64(pSrc, ref_dft_bins_sample_f32, numSamples, winLen, pBins[k], &re, &im);
+		pDst[2*k]   = (float32_t)re;
+		pDst[2*k+1] = (float32_t)im;
+	}
+}
+
+void ref_sdft_q31(
+	q31_t * pSrc,
+	uint32_t numSamples,
+	uint16_t winLen,
+	const uint16_t * pBins,
+	uint16_t numBins,
+	q31_t * pDst)
+{
+	uint32_t k;
+	float64_t re, im;
+
+	for (k = 0; k < numBins; k++)
+	{
+		ref_sdft_f64(pSrc, ref_dft_bins_sample_q31, numSamples, winLen, pBins[k], &re, &im);
+		pDst[2*k]   = ref_dft_bins_to_q31(re / winLen);
+		pDst[2*k+1] = ref_dft_bins_to_q31(im / winLen);
+	}
+}
+
+void ref_sdft_q15(
+	q15_t * pSrc,
+	uint32_t numSamples,
+	uint16_t winLen,
+	const uint16_t * pBins,
+	uint16_t numBins,
+	q15_t * pDst)
+{
+	uint32_t k;
+	float64_t re, im;
+
+	for (k = 0; k < numBins; k++)
+	{
+		ref_sdft_f64(pSrc, ref_dft_bins_sample_q15, numSamples, winLen, pBins[k], &re, &im);
+		pDst[2*k]   = (q15_t)(ref_dft_bins_to_q31(re / winLen) >> 16);
+		pDst[2*k+1] = (q15_t)(ref_dft_bins_to_q31(im / winLen) >> 16);
+	}
+}
@@ -300,3 +300,183 @@ void ref_rfft_q15(
 		}
 	}
 }
+
+void ref_rfft_fast_q31(
+	const arm_rfft_fast_instance_q31 * S,
+	q31_t * p, q31_t * pOut,
+	uint8_t ifftFlag)
+{
+	uint32_t i,j;
+	float32_t *fDst = (float32_t*)pOut;
+	
+	if (ifftFlag)
+	{
+		for(i=0;i<S->fftLenRFFT;i++)
+		{
+			fDst[i] = (float32_t)p[i] / 2147483648.0f;
+		}
+		//unpack first sample's complex part into middle sample's real part
+		fDst[S->fftLenRFFT] = fDst[1];
+		fDst[S->fftLenRFFT+1] = 0;
+		fDst[1] = 0;
+		j=4;
+		for(i = S->fftLenRFFT / 2 + 1;i < S->fftLenRFFT;i++)
+		{
+			fDst[2*i+0] = (float32_t)p[2*i+0 - j] / 2147483648.0f;
+			fDst[2*i+1] = -(float32_t)p[2*i+1 - j] / 2147483648.0f;
+			j+=4;
+		}
+	}
+	else
+	{
+		for(i=0;i<S->fftLenRFFT;i++)
+		{
+			fDst[2*i+0] = (float32_t)p[i] / 2147483648.0f;
+			fDst[2*i+1] = 0.0f;
+		}
+	}
+	
+	switch(S->fftLenRFFT)
+	{   
+   case 32: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len32, fDst, ifftFlag, 1);
+		 break;
+   
+   case 64: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len64, fDst, ifftFlag, 1);
+		 break;
+   
+   case 128: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len128, fDst, ifftFlag, 1);
+		 break;
+   
+   case 256: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len256, fDst, ifftFlag, 1);
+		 break;
+   
+   case 512: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len512, fDst, ifftFlag, 1);
+		 break;
+   
+   case 1024: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len1024, fDst, ifftFlag, 1);
+		 break;
+   
+   case 2048: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len2048, fDst, ifftFlag, 1);
+		 break;
+   
+   case 4096: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len4096, fDst, ifftFlag, 1);
+		 break;
+	}
+	
+	if (ifftFlag)
+	{
+		//throw away the imaginary part which should be all zeros
+		for(i=0;i<S->fftLenRFFT;i++)
+		{
+			pOut[i] = (q31_t)( fDst[2*i] * 2147483648.0f);
+		}
+	}
+	else
+	{
+		//pack last sample's real part into first sample's complex part
+		fDst[1] = fDst[S->fftLenRFFT];
+		for(i=0;i<S->fftLenRFFT;i++)
+		{
+			//the forward transform is scaled by 1/fftLen
+			pOut[i] = (q31_t)( fDst[i] * 2147483648.0f / (float32_t)S->fftLenRFFT);
+		}
+	}
+}
+
+void ref_rfft_fast_q15(
+	const arm_rfft_fast_instance_q15 * S,
+	q15_t * p, q15_t * pOut,
+	uint8_t ifftFlag)
+{
+	uint32_t i,j;
+	float32_t *fDst = (float32_t*)pOut;
+	
+	if (ifftFlag)
+	{
+		for(i=0;i<S->fftLenRFFT;i++)
+		{
+			fDst[i] = (float32_t)p[i] / 32768.0f;
+		}
+		//unpack first sample's complex part into middle sample's real part
+		fDst[S->fftLenRFFT] = fDst[1];
+		fDst[S->fftLenRFFT+1] = 0;
+		fDst[1] = 0;
+		j=4;
+		for(i = S->fftLenRFFT / 2 + 1;i < S->fftLenRFFT;i++)
+		{
+			fDst[2*i+0] = (float32_t)p[2*i+0 - j] / 32768.0f;
+			fDst[2*i+1] = -(float32_t)p[2*i+1 - j] / 32768.0f;
+			j+=4;
+		}
+	}
+	else
+	{
+		for(i=0;i<S->fftLenRFFT;i++)
+		{
+			fDst[2*i+0] = (float32_t)p[i] / 32768.0f;
+			fDst[2*i+1] = 0.0f;
+		}
+	}
+	
+	switch(S->fftLenRFFT)
+	{   
+   case 32: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len32, fDst, ifftFlag, 1);
+		 break;
+   
+   case 64: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len64, fDst, ifftFlag, 1);
+		 break;
+   
+   case 128: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len128, fDst, ifftFlag, 1);
+		 break;
+   
+   case 256: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len256, fDst, ifftFlag, 1);
+		 break;
+   
+   case 512: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len512, fDst, ifftFlag, 1);
+		 break;
+   
+   case 1024: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len1024, fDst, ifftFlag, 1);
+		 break;
+   
+   case 2048: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len2048, fDst, ifftFlag, 1);
+		 break;
+   
+   case 4096: 
+		 ref_cfft_f32(&arm_cfft_sR_f32_len4096, fDst, ifftFlag, 1);
+		 break;
+	}
+	
+	if (ifftFlag)
+	{
+		//throw away the imaginary part which should be all zeros
+		for(i=0;i<S->fftLenRFFT;i++)
+		{
+			pOut[i] = (q15_t)( fDst[2*i] * 32768.0f);
+		}
+	}
+	else
+	{
+		//pack last sample's real part into first sample's complex part
+		fDst[1] = fDst[S->fftLenRFFT];
+		for(i=0;i<S->fftLenRFFT;i++)
+		{
+			//the forward transform is scaled by 1/fftLen
+			pOut[i] = (q15_t)( fDst[i] * 32768.0f / (float32_t)S->fftLenRFFT);
+		}
+	}
+}
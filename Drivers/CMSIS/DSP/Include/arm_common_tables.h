@@ -31,6 +31,20 @@
 
 #include "arm_math.h"
 
+/*
+ * The FFT tables of arm_common_tables.c and arm_const_structs.c are built when
+ * ARM_ALL_FFT_TABLES is defined, which is the default. With ARM_DSP_CONFIG_TABLES
+ * the project provides the tables it uses instead, generated by
+ * Tools/arm_fft_tablegen together with arm_fft_tables_config.h, which defines the
+ * ARM_TABLE_xxx macros of the generated tables. The init functions then only
+ * support the lengths whose tables are present.
+ */
+#if defined(ARM_DSP_CONFIG_TABLES)
+#include "arm_fft_tables_config.h"
+#elif !defined(ARM_ALL_FFT_TABLES)
+#define ARM_ALL_FFT_TABLES
+#endif
+
 extern const uint16_t armBitRevTable[1024];
 extern const q15_t armRecipTableQ15[64];
 extern const q31_t armRecipTableQ31[64];
@@ -113,6 +127,11 @@ extern const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1
 extern const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH];
 extern const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH];
 
+/* bytes of arena used by arm_cfft_init_ram_xxx() for a length N written as a plain number */
+#define ARM_CFFT_RAM_TABLES_SIZE_F32(N) ((8U * (N)) + (2U * ARMBITREVINDEXTABLE_##N##_TABLE_LENGTH))
+#define ARM_CFFT_RAM_TABLES_SIZE_Q31(N) ((6U * (N)) + (2U * ARMBITREVINDEXTABLE_FIXED_##N##_TABLE_LENGTH))
+#define ARM_CFFT_RAM_TABLES_SIZE_Q15(N) ((3U * (N)) + (2U * ARMBITREVINDEXTABLE_FIXED_##N##_TABLE_LENGTH))
+
 /* Tables for Fast Math Sine and Cosine */
 extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
 extern const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1];
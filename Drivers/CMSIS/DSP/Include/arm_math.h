@@ -2133,6 +2133,61 @@ void arm_cfft_q31(
   uint8_t ifftFlag,
   uint8_t bitReverseFlag);
 
+  /**
+   * @brief Arena from which the CFFT tables are allocated when they are computed in RAM.
+   */
+  typedef struct
+  {
+    uint8_t *pBase;                    /**< points to the memory of the arena. */
+    uint32_t size;                     /**< size of the arena in bytes. */
+    uint32_t used;                     /**< number of bytes already allocated. */
+  } arm_fft_table_arena;
+
+  void arm_fft_table_arena_init(
+  arm_fft_table_arena * A,
+  void * pBuffer,
+  uint32_t size);
+
+  void * arm_fft_table_arena_alloc(
+  arm_fft_table_arena * A,
+  uint32_t size);
+
+  void arm_cfft_twiddle_gen_f32(
+  float32_t * pTwiddle,
+  uint16_t fftLen);
+
+  void arm_cfft_twiddle_gen_q31(
+  q31_t * pTwiddle,
+  uint16_t fftLen);
+
+  void arm_cfft_twiddle_gen_q15(
+  q15_t * pTwiddle,
+  uint16_t fftLen);
+
+  void arm_rfft_fast_twiddle_gen_f32(
+  float32_t * pTwiddle,
+  uint16_t fftLen);
+
+  uint16_t arm_cfft_bitrev_gen(
+  uint16_t * pBitRevTable,
+  uint16_t fftLen,
+  uint8_t fixedFlag);
+
+  arm_status arm_cfft_init_ram_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  arm_fft_table_arena * A);
+
+  arm_status arm_cfft_init_ram_q31(
+  arm_cfft_instance_q31 * S,
+  uint16_t fftLen,
+  arm_fft_table_arena * A);
+
+  arm_status arm_cfft_init_ram_q15(
+  arm_cfft_instance_q15 * S,
+  uint16_t fftLen,
+  arm_fft_table_arena * A);
+
   /**
    * @brief Instance structure for the Q15 RFFT/RIFFT function.
    */
@@ -2229,6 +2284,301 @@ void arm_rfft_fast_f32(
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+arm_status arm_rfft_fast_init_ram_f32 (
+   arm_rfft_fast_instance_f32 * S,
+   uint16_t fftLen,
+   arm_fft_table_arena * A);
+
+  /**
+   * @brief Instance structure for the Q31 fast RFFT/RIFFT function.
+   */
+typedef struct
+  {
+    arm_cfft_instance_q31 Sint;      /**< Internal CFFT structure. */
+    uint16_t fftLenRFFT;             /**< length of the real sequence */
+    const q31_t * pTwiddleRFFT;      /**< Twiddle factors real stage  */
+  } arm_rfft_fast_instance_q31 ;
+
+arm_status arm_rfft_fast_init_q31 (
+   arm_rfft_fast_instance_q31 * S,
+   uint16_t fftLen);
+
+void arm_rfft_fast_q31(
+  const arm_rfft_fast_instance_q31 * S,
+  q31_t * p, q31_t * pOut,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the Q15 fast RFFT/RIFFT function.
+   */
+typedef struct
+  {
+    arm_cfft_instance_q15 Sint;      /**< Internal CFFT structure. */
+    uint16_t fftLenRFFT;             /**< length of the real sequence */
+    const q15_t * pTwiddleRFFT;      /**< Twiddle factors real stage  */
+  } arm_rfft_fast_instance_q15 ;
+
+arm_status arm_rfft_fast_init_q15 (
+   arm_rfft_fast_instance_q15 * S,
+   uint16_t fftLen);
+
+void arm_rfft_fast_q15(
+  const arm_rfft_fast_instance_q15 * S,
+  q15_t * p, q15_t * pOut,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Maximum number of radix stages of a mixed-radix FFT of a 16-bit length (3^10).
+   */
+#define ARM_CFFT_MIXED_MAX_STAGES 10U
+
+  /**
+   * @brief Instance structure for the Q31 mixed-radix CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                             /**< length of the FFT. */
+    uint8_t numStages;                           /**< number of radix stages. */
+    uint8_t factors[ARM_CFFT_MIXED_MAX_STAGES];  /**< radix of each stage, 2, 3, 4 or 5. */
+    const q31_t *pTwiddle;                       /**< points to the twiddle factor table of fftLen complex values. */
+    q31_t *pScratch;                             /**< points to the scratch buffer of 2*fftLen values. */
+  } arm_cfft_mixed_instance_q31;
+
+  arm_status arm_cfft_mixed_init_q31(
+  arm_cfft_mixed_instance_q31 * S,
+  uint16_t fftLen,
+  q31_t * pTwiddle,
+  q31_t * pScratch);
+
+  void arm_cfft_mixed_q31(
+  const arm_cfft_mixed_instance_q31 * S,
+  q31_t * p1,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the Q31 mixed-radix RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+    arm_cfft_mixed_instance_q31 Sint;            /**< Internal CFFT structure. */
+    uint16_t fftLenRFFT;                         /**< length of the real sequence. */
+    const q31_t *pTwiddleRFFT;                   /**< points to the twiddle factor table of the real stage. */
+  } arm_rfft_mixed_instance_q31;
+
+  arm_status arm_rfft_mixed_init_q31(
+  arm_rfft_mixed_instance_q31 * S,
+  uint16_t fftLen,
+  q31_t * pTwiddle,
+  q31_t * pTwiddleRFFT,
+  q31_t * pScratch);
+
+  void arm_rfft_mixed_q31(
+  const arm_rfft_mixed_instance_q31 * S,
+  q31_t * p,
+  q31_t * pOut,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                             /**< length of the FFT. */
+    uint8_t numStages;                           /**< number of radix stages. */
+    uint8_t factors[ARM_CFFT_MIXED_MAX_STAGES];  /**< radix of each stage, 2, 3, 4 or 5. */
+    const float32_t *pTwiddle;                   /**< points to the twiddle factor table of fftLen complex values. */
+    float32_t *pScratch;                         /**< points to the scratch buffer of 2*fftLen values. */
+  } arm_cfft_mixed_instance_f32;
+
+  arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pScratch);
+
+  void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+    arm_cfft_mixed_instance_f32 Sint;            /**< Internal CFFT structure. */
+    uint16_t fftLenRFFT;                         /**< length of the real sequence. */
+    const float32_t *pTwiddleRFFT;               /**< points to the twiddle factor table of the real stage. */
+  } arm_rfft_mixed_instance_f32;
+
+  arm_status arm_rfft_mixed_init_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pTwiddleRFFT,
+  float32_t * pScratch);
+
+  void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point Goertzel function.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                            /**< number of frequency bins. */
+    const float32_t *pCoeffs;                    /**< points to the cosine and sine of each bin frequency, of length 2*numBins. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel function.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                            /**< number of frequency bins. */
+    const q31_t *pCoeffs;                        /**< points to the cosine and sine of each bin frequency, of length 2*numBins. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 Goertzel function.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                            /**< number of frequency bins. */
+    const q31_t *pCoeffs;                        /**< points to the cosine and sine of each bin frequency in 1.31 format, of length 2*numBins. */
+  } arm_goertzel_instance_q15;
+
+  arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  const float32_t * pFreqs,
+  float32_t * pCoeffs);
+
+  void arm_goertzel_f32(
+  const arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst);
+
+  arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  const float32_t * pFreqs,
+  q31_t * pCoeffs);
+
+  void arm_goertzel_q31(
+  const arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pDst);
+
+  arm_status arm_goertzel_init_q15(
+  arm_goertzel_instance_q15 * S,
+  uint16_t numBins,
+  const float32_t * pFreqs,
+  q31_t * pCoeffs);
+
+  void arm_goertzel_q15(
+  const arm_goertzel_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT function.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                            /**< number of frequency bins. */
+    uint16_t winLen;                             /**< length of the sliding window. */
+    uint16_t delayIndex;                         /**< index of the oldest sample in the delay line. */
+    float32_t dampLen;                           /**< damping factor to the power of winLen. */
+    const float32_t *pCoeffs;                    /**< points to the damped rotation of each bin, of length 2*numBins. */
+    float32_t *pState;                           /**< points to the complex value of each bin, of length 2*numBins. */
+    float32_t *pDelay;                           /**< points to the delay line of winLen samples. */
+  } arm_sdft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT function.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                            /**< number of frequency bins. */
+    uint16_t winLen;                             /**< length of the sliding window. */
+    uint16_t delayIndex;                         /**< index of the oldest sample in the delay line. */
+    q31_t dampLen;                               /**< damping factor to the power of winLen. */
+    q31_t invLen;                                /**< 1/winLen in 1.31 format. */
+    const q31_t *pCoeffs;                        /**< points to the damped rotation of each bin, of length 2*numBins. */
+    q31_t *pState;                               /**< points to the complex value of each bin divided by winLen, of length 2*numBins. */
+    q31_t *pDelay;                               /**< points to the delay line of winLen samples. */
+  } arm_sdft_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sliding DFT function.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                            /**< number of frequency bins. */
+    uint16_t winLen;                             /**< length of the sliding window. */
+    uint16_t delayIndex;                         /**< index of the oldest sample in the delay line. */
+    q31_t dampLen;                               /**< damping factor to the power of winLen. */
+    q31_t invLen;                                /**< 1/winLen in 1.31 format. */
+    const q31_t *pCoeffs;                        /**< points to the damped rotation of each bin in 1.31 format, of length 2*numBins. */
+    q31_t *pState;                               /**< points to the complex value of each bin divided by winLen in 1.31 format, of length 2*numBins. */
+    q15_t *pDelay;                               /**< points to the delay line of winLen samples. */
+  } arm_sdft_instance_q15;
+
+  arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t winLen,
+  const uint16_t * pBins,
+  float32_t damping,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pDelay);
+
+  void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst);
+
+  arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t winLen,
+  const uint16_t * pBins,
+  float32_t damping,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t * pDelay);
+
+  void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pDst);
+
+  arm_status arm_sdft_init_q15(
+  arm_sdft_instance_q15 * S,
+  uint16_t numBins,
+  uint16_t winLen,
+  const uint16_t * pBins,
+  float32_t damping,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q15_t * pDelay);
+
+  void arm_sdft_q15(
+  arm_sdft_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pDst);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -3544,128 +3894,392 @@ void arm_rfft_fast_f32(
 
 
   /**
-   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
-   */
-  typedef struct
-  {
-    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
-    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
-    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
-  } arm_biquad_cas_df1_32x64_ins_q31;
-
-
-  /**
-   * @param[in]  S          points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of samples to process.
-   */
-  void arm_biquad_cas_df1_32x64_q31(
-  const arm_biquad_cas_df1_32x64_ins_q31 * S,
-  q31_t * pSrc,
-  q31_t * pDst,
-  uint32_t blockSize);
-
-
-  /**
-   * @param[in,out] S          points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]     numStages  number of 2nd order stages in the filter.
-   * @param[in]     pCoeffs    points to the filter coefficients.
-   * @param[in]     pState     points to the state buffer.
-   * @param[in]     postShift  shift to be applied to the output. Varies according to the coefficients format
-   */
-  void arm_biquad_cas_df1_32x64_init_q31(
-  arm_biquad_cas_df1_32x64_ins_q31 * S,
-  uint8_t numStages,
-  q31_t * pCoeffs,
-  q63_t * pState,
-  uint8_t postShift);
-
-
-  /**
-   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief Instance structure for the Q15 FIR rational resampler.
    */
   typedef struct
   {
-    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
-    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-  } arm_biquad_cascade_df2T_instance_f32;
+    uint8_t L;                      /**< upsample factor. */
+    uint8_t M;                      /**< decimation factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q15;
 
   /**
-   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief Instance structure for the Q31 FIR rational resampler.
    */
   typedef struct
   {
-    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 4*numStages. */
-    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-  } arm_biquad_cascade_stereo_df2T_instance_f32;
+    uint8_t L;                      /**< upsample factor. */
+    uint8_t M;                      /**< decimation factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    q31_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q31;
 
   /**
-   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief Instance structure for the floating-point FIR rational resampler.
    */
   typedef struct
   {
-    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float64_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
-    float64_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-  } arm_biquad_cascade_df2T_instance_f64;
+    uint8_t L;                      /**< upsample factor. */
+    uint8_t M;                      /**< decimation factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_f32;
 
 
   /**
-   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in]  S          points to an instance of the filter data structure.
+   * @brief Processing function for the Q15 FIR rational resampler.
+   * @param[in]  S          points to an instance of the Q15 FIR resampler structure.
    * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of samples to process.
+   * @param[out] pDst       points to the block of output data, of length blockSize*L/M.
+   * @param[in]  blockSize  number of input samples to process per call, a multiple of M.
    */
-  void arm_biquad_cascade_df2T_f32(
-  const arm_biquad_cascade_df2T_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
+  void arm_fir_resample_q15(
+  const arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. 2 channels
-   * @param[in]  S          points to an instance of the filter data structure.
-   * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of samples to process.
+   * @brief  Initialization function for the Q15 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q15 FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          decimation factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>numTaps</code> is not a multiple of <code>L</code> or <code>blockSize</code> is not a multiple of <code>M</code>.
    */
-  void arm_biquad_cascade_stereo_df2T_f32(
-  const arm_biquad_cascade_stereo_df2T_instance_f32 * S,
-  float32_t * pSrc,
-  float32_t * pDst,
+  arm_status arm_fir_resample_init_q15(
+  arm_fir_resample_instance_q15 * S,
+  uint8_t L,
+  uint8_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
   uint32_t blockSize);
 
 
   /**
-   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in]  S          points to an instance of the filter data structure.
+   * @brief Processing function for the Q31 FIR rational resampler.
+   * @param[in]  S          points to an instance of the Q31 FIR resampler structure.
    * @param[in]  pSrc       points to the block of input data.
-   * @param[out] pDst       points to the block of output data
-   * @param[in]  blockSize  number of samples to process.
+   * @param[out] pDst       points to the block of output data, of length blockSize*L/M.
+   * @param[in]  blockSize  number of input samples to process per call, a multiple of M.
    */
-  void arm_biquad_cascade_df2T_f64(
-  const arm_biquad_cascade_df2T_instance_f64 * S,
-  float64_t * pSrc,
-  float64_t * pDst,
+  void arm_fir_resample_q31(
+  const arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
   uint32_t blockSize);
 
 
   /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in,out] S          points to an instance of the filter data structure.
-   * @param[in]     numStages  number of 2nd order stages in the filter.
-   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @brief  Initialization function for the Q31 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q31 FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          decimation factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
    * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>numTaps</code> is not a multiple of <code>L</code> or <code>blockSize</code> is not a multiple of <code>M</code>.
    */
-  void arm_biquad_cascade_df2T_init_f32(
-  arm_biquad_cascade_df2T_instance_f32 * S,
-  uint8_t numStages,
+  arm_status arm_fir_resample_init_q31(
+  arm_fir_resample_instance_q31 * S,
+  uint8_t L,
+  uint8_t M,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point FIR rational resampler.
+   * @param[in]  S          points to an instance of the floating-point FIR resampler structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data, of length blockSize*L/M.
+   * @param[in]  blockSize  number of input samples to process per call, a multiple of M.
+   */
+  void arm_fir_resample_f32(
+  const arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR rational resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          decimation factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>numTaps</code> is not a multiple of <code>L</code> or <code>blockSize</code> is not a multiple of <code>M</code>.
+   */
+  arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint8_t L,
+  uint8_t M,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q15 multi-channel FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;               /**< number of filter coefficients in the filter. */
+    uint16_t numChannels;           /**< number of channels filtered with the same coefficients. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length numChannels*(numTaps+blockSize-1). */
+    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length numTaps.*/
+  } arm_fir_multi_instance_q15;
+
+
+  /**
+   * @brief Processing function for the Q15 multi-channel FIR filter on interleaved data.
+   * @param[in]  S          points to an instance of the Q15 multi-channel FIR structure.
+   * @param[in]  pSrc       points to the block of input frames, <code>numChannels</code> interleaved samples each.
+   * @param[out] pDst       points to the block of output frames, <code>numChannels</code> interleaved samples each.
+   * @param[in]  blockSize  number of frames to process per call.
+   */
+  void arm_fir_multi_q15(
+  const arm_fir_multi_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q15 multi-channel FIR filter on planar data.
+   * @param[in]  S          points to an instance of the Q15 multi-channel FIR structure.
+   * @param[in]  pSrc       points to the input blocks of the channels, one after the other.
+   * @param[out] pDst       points to the output blocks of the channels, one after the other.
+   * @param[in]  blockSize  number of samples per channel to process per call.
+   */
+  void arm_fir_multi_planar_q15(
+  const arm_fir_multi_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 multi-channel FIR filter.
+   * @param[in,out] S            points to an instance of the Q15 multi-channel FIR structure.
+   * @param[in]     numTaps      number of filter coefficients in the filter.
+   * @param[in]     numChannels  number of channels.
+   * @param[in]     pCoeffs      points to the filter coefficient buffer.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     blockSize    number of frames to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>numTaps</code> or <code>numChannels</code> is 0.
+   */
+  arm_status arm_fir_multi_init_q15(
+  arm_fir_multi_instance_q15 * S,
+  uint16_t numTaps,
+  uint16_t numChannels,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q15 multi-channel Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;              /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;           /**< number of channels filtered with the same coefficients. */
+    q15_t *pState;                  /**< points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    q15_t *pCoeffs;                 /**< points to the array of coefficients.  The array is of length 6*numStages. */
+    int8_t postShift;               /**< additional shift, in bits, applied to each output sample. */
+  } arm_biquad_casd_df1_multi_inst_q15;
+
+
+  /**
+   * @brief Processing function for the Q15 multi-channel Biquad cascade filter on interleaved data.
+   * @param[in]  S          points to an instance of the Q15 multi-channel Biquad cascade structure.
+   * @param[in]  pSrc       points to the block of input frames, <code>numChannels</code> interleaved samples each.
+   * @param[out] pDst       points to the block of output frames, <code>numChannels</code> interleaved samples each.
+   * @param[in]  blockSize  number of frames to process.
+   */
+  void arm_biquad_cascade_df1_multi_q15(
+  const arm_biquad_casd_df1_multi_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q15 multi-channel Biquad cascade filter on planar data.
+   * @param[in]  S          points to an instance of the Q15 multi-channel Biquad cascade structure.
+   * @param[in]  pSrc       points to the input blocks of the channels, one after the other.
+   * @param[out] pDst       points to the output blocks of the channels, one after the other.
+   * @param[in]  blockSize  number of samples per channel to process.
+   */
+  void arm_biquad_cascade_df1_multi_planar_q15(
+  const arm_biquad_casd_df1_multi_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 multi-channel Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the Q15 multi-channel Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of channels.
+   * @param[in]     pCoeffs      points to the filter coefficients, as for arm_biquad_cascade_df1_init_q15().
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cascade_df1_multi_init_q15(
+  arm_biquad_casd_df1_multi_inst_q15 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  int8_t postShift);
+
+
+  /**
+   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
+  } arm_biquad_cas_df1_32x64_ins_q31;
+
+
+  /**
+   * @param[in]  S          points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_biquad_cas_df1_32x64_q31(
+  const arm_biquad_cas_df1_32x64_ins_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @param[in,out] S          points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     postShift  shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cas_df1_32x64_init_q31(
+  arm_biquad_cas_df1_32x64_ins_q31 * S,
+  uint8_t numStages,
+  q31_t * pCoeffs,
+  q63_t * pState,
+  uint8_t postShift);
+
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_df2T_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_stereo_df2T_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float64_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    float64_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_df2T_instance_f64;
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_biquad_cascade_df2T_f32(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. 2 channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_biquad_cascade_stereo_df2T_f32(
+  const arm_biquad_cascade_stereo_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_biquad_cascade_df2T_f64(
+  const arm_biquad_cascade_df2T_instance_f64 * S,
+  float64_t * pSrc,
+  float64_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] S          points to an instance of the filter data structure.
+   * @param[in]     numStages  number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   */
+  void arm_biquad_cascade_df2T_init_f32(
+  arm_biquad_cascade_df2T_instance_f32 * S,
+  uint8_t numStages,
   float32_t * pCoeffs,
   float32_t * pState);
 
@@ -4404,65 +5018,504 @@ void arm_rfft_fast_f32(
   uint32_t srcBLen,
   q7_t * pDst);
 
+  /**
+   * @brief Number of kernel partitions of an FFT convolution.
+   * @param[in] kernelLen  length of the kernel.
+   * @param[in] fftLen     FFT length.
+   *
+   * A kernel shorter than the FFT length is a single partition, a longer kernel
+   * is split into partitions of fftLen/2 samples.
+   */
+#define ARM_CONV_FFT_NUM_PARTS(kernelLen, fftLen) \
+  (((uint32_t) (kernelLen) < (uint32_t) (fftLen)) ? 1U : \
+   (((uint32_t) (kernelLen) + ((uint32_t) (fftLen) / 2U) - 1U) / ((uint32_t) (fftLen) / 2U)))
 
   /**
-   * @brief Instance structure for the floating-point sparse FIR filter.
+   * @brief Instance structure for the floating-point FFT convolution engine.
    */
   typedef struct
   {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    float32_t *pState;            /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    float32_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_f32;
+    uint32_t kernelLen;                 /**< length of the kernel. */
+    uint16_t fftLen;                    /**< length of the real FFT. */
+    uint16_t partLen;                   /**< length of the kernel partitions. */
+    uint16_t numParts;                  /**< number of kernel partitions. */
+    uint16_t blockLen;                  /**< number of output samples per FFT block, fftLen-partLen+1. */
+    float32_t *pKernelFreq;             /**< points to the kernel spectra. The array is of length numParts*fftLen. */
+    arm_rfft_fast_instance_f32 rfft;    /**< real FFT instance. */
+  } arm_conv_fft_instance_f32;
 
   /**
-   * @brief Instance structure for the Q31 sparse FIR filter.
+   * @brief Instance structure for the Q31 FFT convolution engine.
    */
   typedef struct
   {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    q31_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    q31_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_q31;
+    uint32_t kernelLen;                 /**< length of the kernel. */
+    uint16_t fftLen;                    /**< length of the complex FFT. */
+    uint16_t partLen;                   /**< length of the kernel partitions. */
+    uint16_t numParts;                  /**< number of kernel partitions. */
+    uint16_t blockLen;                  /**< number of output samples per FFT block, fftLen-partLen+1. */
+    int8_t postShift;                   /**< output shift of the inverse transform before block floating point normalization. */
+    q31_t *pKernelFreq;                 /**< points to the kernel spectra. The array is of length 2*numParts*fftLen. */
+    const arm_cfft_instance_q31 *pCfft; /**< complex FFT instance. */
+  } arm_conv_fft_instance_q31;
 
   /**
-   * @brief Instance structure for the Q15 sparse FIR filter.
+   * @brief Instance structure for the floating-point FFT FIR filter.
    */
   typedef struct
   {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    q15_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    q15_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_q15;
+    uint16_t numTaps;                   /**< number of filter coefficients in the filter. */
+    uint16_t fftLen;                    /**< FFT length, 0 when the direct form is used. */
+    float32_t *pState;                  /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t *pScratch;                /**< points to the scratch buffer. The array is of length 3*fftLen. */
+    arm_fir_instance_f32 fir;           /**< direct form filter, used when fftLen is 0. */
+    arm_conv_fft_instance_f32 conv;     /**< FFT convolution engine. */
+  } arm_fir_fft_instance_f32;
 
   /**
-   * @brief Instance structure for the Q7 sparse FIR filter.
+   * @brief Instance structure for the Q31 FFT FIR filter.
    */
   typedef struct
   {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    q7_t *pState;                 /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    q7_t *pCoeffs;                /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_q7;
-
+    uint16_t numTaps;                   /**< number of filter coefficients in the filter. */
+    uint16_t fftLen;                    /**< FFT length, 0 when the direct form is used. */
+    q31_t *pState;                      /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q31_t *pScratch;                    /**< points to the scratch buffer. The array is of length 4*fftLen. */
+    arm_fir_instance_q31 fir;           /**< direct form filter, used when fftLen is 0. */
+    arm_conv_fft_instance_q31 conv;     /**< FFT convolution engine. */
+  } arm_fir_fft_instance_q31;
+
+  /**
+   * @brief FFT length for a floating-point convolution or correlation.
+   * @param[in] srcALen     length of the first input sequence.
+   * @param[in] srcBLen     length of the second input sequence.
+   * @param[in] firstIndex  first output sample to be computed.
+   * @param[in] numPoints   number of output samples to be computed.
+   * @return FFT length, or 0 when the direct form is faster.
+   */
+  uint16_t arm_conv_fft_len_f32(
+  uint32_t srcALen,
+  uint32_t srcBLen,
+  uint32_t firstIndex,
+  uint32_t numPoints);
 
   /**
-   * @brief Processing function for the floating-point sparse FIR filter.
-   * @param[in]  S           points to an instance of the floating-point sparse FIR structure.
-   * @param[in]  pSrc        points to the block of input data.
-   * @param[out] pDst        points to the block of output data
+   * @brief Scratch size of the floating-point FFT convolution functions.
+   * @param[in] srcALen     length of the first input sequence.
+   * @param[in] srcBLen     length of the second input sequence.
+   * @param[in] firstIndex  first output sample to be computed.
+   * @param[in] numPoints   number of output samples to be computed.
+   * @return number of float32_t values, 0 when the direct form is used.
+   */
+  uint32_t arm_conv_fft_scratch_size_f32(
+  uint32_t srcALen,
+  uint32_t srcBLen,
+  uint32_t firstIndex,
+  uint32_t numPoints);
+
+  /**
+   * @brief FFT length for the floating-point FFT FIR filter.
+   * @param[in] numTaps    number of filter coefficients.
+   * @param[in] blockSize  number of samples processed per call.
+   * @return FFT length, or 0 when arm_fir_f32() is faster.
+   */
+  uint16_t arm_fir_fft_len_f32(
+  uint16_t numTaps,
+  uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for the floating-point FFT convolution engine.
+   * @param[in,out] S            points to an instance of the floating-point FFT convolution structure.
+   * @param[in]     pKernel      points to the kernel.
+   * @param[in]     kernelLen    length of the kernel.
+   * @param[in]     reverseFlag  0 to use the kernel as stored, 1 to use it in reversed order.
+   * @param[in]     fftLen       FFT length: 32 to 4096.
+   * @param[in]     pKernelFreq  points to the kernel spectra, of length ARM_CONV_FFT_NUM_PARTS(kernelLen, fftLen)*fftLen.
+   * @param[in]     pScratch     points to a scratch buffer of length fftLen.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_conv_fft_init_f32(
+  arm_conv_fft_instance_f32 * S,
+  const float32_t * pKernel,
+  uint32_t kernelLen,
+  uint8_t reverseFlag,
+  uint16_t fftLen,
+  float32_t * pKernelFreq,
+  float32_t * pScratch);
+
+  /**
+   * @brief Overlap-save convolution with the kernel of a floating-point FFT convolution instance.
+   * @param[in]  S            points to an initialized instance of the floating-point FFT convolution structure.
+   * @param[in]  pSrc         points to the input sequence.
+   * @param[in]  srcLen       length of the input sequence.
+   * @param[in]  reverseFlag  0 to use the sequence as stored, 1 to use it in reversed order.
+   * @param[in]  firstIndex   first output sample to compute.
+   * @param[in]  numPoints    number of output samples to compute.
+   * @param[out] pDst         points to the block of numPoints output samples.
+   * @param[in]  pScratch     points to a scratch buffer of length 3*fftLen.
+   */
+  void arm_conv_fft_save_f32(
+  const arm_conv_fft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  uint32_t firstIndex,
+  uint32_t numPoints,
+  float32_t * pDst,
+  float32_t * pScratch);
+
+  /**
+   * @brief Overlap-add convolution with the kernel of a floating-point FFT convolution instance.
+   * @param[in]     S            points to an initialized instance of the floating-point FFT convolution structure.
+   * @param[in]     pSrc         points to the input sequence.
+   * @param[in]     srcLen       length of the input sequence.
+   * @param[in]     reverseFlag  0 to use the sequence as stored, 1 to use it in reversed order.
+   * @param[in,out] pDst         points to the output sequence of length srcLen+kernelLen-1, the convolution is added to it.
+   * @param[in]     pScratch     points to a scratch buffer of length 3*fftLen.
+   */
+  void arm_conv_fft_add_f32(
+  const arm_conv_fft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  float32_t * pDst,
+  float32_t * pScratch);
+
+  /**
+   * @brief Convolution of floating-point sequences using the FFT when faster.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length srcALen+srcBLen-1.
+   * @param[in]  pScratch  points to a scratch buffer of length arm_conv_fft_scratch_size_f32(srcALen, srcBLen, 0, srcALen+srcBLen-1).
+   */
+  void arm_conv_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch);
+
+  /**
+   * @brief Partial convolution of floating-point sequences using the FFT when faster.
+   * @param[in]  pSrcA       points to the first input sequence.
+   * @param[in]  srcALen     length of the first input sequence.
+   * @param[in]  pSrcB       points to the second input sequence.
+   * @param[in]  srcBLen     length of the second input sequence.
+   * @param[out] pDst        points to the block of output data
+   * @param[in]  firstIndex  is the first output sample to start with.
+   * @param[in]  numPoints   is the number of output points to be computed.
+   * @param[in]  pScratch    points to a scratch buffer of length arm_conv_fft_scratch_size_f32(srcALen, srcBLen, firstIndex, numPoints).
+   * @return Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   */
+  arm_status arm_conv_partial_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints,
+  float32_t * pScratch);
+
+  /**
+   * @brief Correlation of floating-point sequences using the FFT when faster.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch  points to a scratch buffer of length arm_conv_fft_scratch_size_f32(srcALen, srcBLen, 0, srcALen+srcBLen-1).
+   */
+  void arm_correlate_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch);
+
+  /**
+   * @brief Initialization function for the floating-point FFT FIR filter.
+   * @param[in,out] S            points to an instance of the floating-point FFT FIR filter structure.
+   * @param[in]     numTaps      number of filter coefficients in the filter.
+   * @param[in]     pCoeffs      points to the filter coefficients, in time reversed order.
+   * @param[in]     pState       points to the state buffer of length numTaps+blockSize-1.
+   * @param[in]     blockSize    maximum number of samples that are processed per call.
+   * @param[in]     fftLen       FFT length from arm_fir_fft_len_f32(), 0 for the direct form.
+   * @param[in]     pKernelFreq  points to the kernel spectra, of length ARM_CONV_FFT_NUM_PARTS(numTaps, fftLen)*fftLen.
+   * @param[in]     pScratch     points to a scratch buffer of length 3*fftLen.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize,
+  uint16_t fftLen,
+  float32_t * pKernelFreq,
+  float32_t * pScratch);
+
+  /**
+   * @brief Processing function for the floating-point FFT FIR filter.
+   * @param[in]  S          points to an instance of the floating-point FFT FIR filter structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_fir_fft_f32(
+  const arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief FFT length for a Q31 convolution or correlation.
+   * @param[in] srcALen     length of the first input sequence.
+   * @param[in] srcBLen     length of the second input sequence.
+   * @param[in] firstIndex  first output sample to be computed.
+   * @param[in] numPoints   number of output samples to be computed.
+   * @return FFT length, or 0 when the direct form is faster.
+   */
+  uint16_t arm_conv_fft_len_q31(
+  uint32_t srcALen,
+  uint32_t srcBLen,
+  uint32_t firstIndex,
+  uint32_t numPoints);
+
+  /**
+   * @brief Scratch size of the Q31 FFT convolution functions.
+   * @param[in] srcALen     length of the first input sequence.
+   * @param[in] srcBLen     length of the second input sequence.
+   * @param[in] firstIndex  first output sample to be computed.
+   * @param[in] numPoints   number of output samples to be computed.
+   * @return number of q31_t values, 0 when the direct form is used.
+   */
+  uint32_t arm_conv_fft_scratch_size_q31(
+  uint32_t srcALen,
+  uint32_t srcBLen,
+  uint32_t firstIndex,
+  uint32_t numPoints);
+
+  /**
+   * @brief FFT length for the Q31 FFT FIR filter.
+   * @param[in] numTaps    number of filter coefficients.
+   * @param[in] blockSize  number of samples processed per call.
+   * @return FFT length, or 0 when arm_fir_q31() is faster.
+   */
+  uint16_t arm_fir_fft_len_q31(
+  uint16_t numTaps,
+  uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for the Q31 FFT convolution engine.
+   * @param[in,out] S            points to an instance of the Q31 FFT convolution structure.
+   * @param[in]     pKernel      points to the kernel.
+   * @param[in]     kernelLen    length of the kernel.
+   * @param[in]     reverseFlag  0 to use the kernel as stored, 1 to use it in reversed order.
+   * @param[in]     fftLen       FFT length: 16 to 4096.
+   * @param[in]     pKernelFreq  points to the kernel spectra, of length 2*ARM_CONV_FFT_NUM_PARTS(kernelLen, fftLen)*fftLen.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_conv_fft_init_q31(
+  arm_conv_fft_instance_q31 * S,
+  const q31_t * pKernel,
+  uint32_t kernelLen,
+  uint8_t reverseFlag,
+  uint16_t fftLen,
+  q31_t * pKernelFreq);
+
+  /**
+   * @brief Overlap-save convolution with the kernel of a Q31 FFT convolution instance.
+   * @param[in]  S            points to an initialized instance of the Q31 FFT convolution structure.
+   * @param[in]  pSrc         points to the input sequence.
+   * @param[in]  srcLen       length of the input sequence.
+   * @param[in]  reverseFlag  0 to use the sequence as stored, 1 to use it in reversed order.
+   * @param[in]  firstIndex   first output sample to compute.
+   * @param[in]  numPoints    number of output samples to compute.
+   * @param[out] pDst         points to the block of numPoints output samples.
+   * @param[in]  pScratch     points to a scratch buffer of length 4*fftLen.
+   */
+  void arm_conv_fft_save_q31(
+  const arm_conv_fft_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  uint32_t firstIndex,
+  uint32_t numPoints,
+  q31_t * pDst,
+  q31_t * pScratch);
+
+  /**
+   * @brief Overlap-add convolution with the kernel of a Q31 FFT convolution instance.
+   * @param[in]     S            points to an initialized instance of the Q31 FFT convolution structure.
+   * @param[in]     pSrc         points to the input sequence.
+   * @param[in]     srcLen       length of the input sequence.
+   * @param[in]     reverseFlag  0 to use the sequence as stored, 1 to use it in reversed order.
+   * @param[in,out] pDst         points to the output sequence of length srcLen+kernelLen-1, the convolution is added to it with saturation.
+   * @param[in]     pScratch     points to a scratch buffer of length 4*fftLen.
+   */
+  void arm_conv_fft_add_q31(
+  const arm_conv_fft_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  q31_t * pDst,
+  q31_t * pScratch);
+
+  /**
+   * @brief Convolution of Q31 sequences using the FFT when faster.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length srcALen+srcBLen-1.
+   * @param[in]  pScratch  points to a scratch buffer of length arm_conv_fft_scratch_size_q31(srcALen, srcBLen, 0, srcALen+srcBLen-1).
+   */
+  void arm_conv_fft_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst,
+  q31_t * pScratch);
+
+  /**
+   * @brief Partial convolution of Q31 sequences using the FFT when faster.
+   * @param[in]  pSrcA       points to the first input sequence.
+   * @param[in]  srcALen     length of the first input sequence.
+   * @param[in]  pSrcB       points to the second input sequence.
+   * @param[in]  srcBLen     length of the second input sequence.
+   * @param[out] pDst        points to the block of output data
+   * @param[in]  firstIndex  is the first output sample to start with.
+   * @param[in]  numPoints   is the number of output points to be computed.
+   * @param[in]  pScratch    points to a scratch buffer of length arm_conv_fft_scratch_size_q31(srcALen, srcBLen, firstIndex, numPoints).
+   * @return Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   */
+  arm_status arm_conv_partial_fft_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints,
+  q31_t * pScratch);
+
+  /**
+   * @brief Correlation of Q31 sequences using the FFT when faster.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch  points to a scratch buffer of length arm_conv_fft_scratch_size_q31(srcALen, srcBLen, 0, srcALen+srcBLen-1).
+   */
+  void arm_correlate_fft_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst,
+  q31_t * pScratch);
+
+  /**
+   * @brief Initialization function for the Q31 FFT FIR filter.
+   * @param[in,out] S            points to an instance of the Q31 FFT FIR filter structure.
+   * @param[in]     numTaps      number of filter coefficients in the filter.
+   * @param[in]     pCoeffs      points to the filter coefficients, in time reversed order.
+   * @param[in]     pState       points to the state buffer of length numTaps+blockSize-1.
+   * @param[in]     blockSize    maximum number of samples that are processed per call.
+   * @param[in]     fftLen       FFT length from arm_fir_fft_len_q31(), 0 for the direct form.
+   * @param[in]     pKernelFreq  points to the kernel spectra, of length 2*ARM_CONV_FFT_NUM_PARTS(numTaps, fftLen)*fftLen.
+   * @param[in]     pScratch     points to a scratch buffer of length 4*fftLen.
+   * @return ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_fir_fft_init_q31(
+  arm_fir_fft_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize,
+  uint16_t fftLen,
+  q31_t * pKernelFreq,
+  q31_t * pScratch);
+
+  /**
+   * @brief Processing function for the Q31 FFT FIR filter.
+   * @param[in]  S          points to an instance of the Q31 FFT FIR filter structure.
+   * @param[in]  pSrc       points to the block of input data.
+   * @param[out] pDst       points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_fir_fft_q31(
+  const arm_fir_fft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the floating-point sparse FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    float32_t *pState;            /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    float32_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sparse FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    q31_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    q31_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sparse FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    q15_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    q15_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q7 sparse FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    q7_t *pState;                 /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    q7_t *pCoeffs;                /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_q7;
+
+
+  /**
+   * @brief Processing function for the floating-point sparse FIR filter.
+   * @param[in]  S           points to an instance of the floating-point sparse FIR structure.
+   * @param[in]  pSrc        points to the block of input data.
+   * @param[out] pDst        points to the block of output data
    * @param[in]  pScratchIn  points to a temporary buffer of size blockSize.
    * @param[in]  blockSize   number of input samples to process per call.
    */
@@ -4791,138 +5844,536 @@ void arm_rfft_fast_f32(
     /* return to application */
     return (out);
 
-  }
+  }
+
+  /**
+   * @brief  Process function for the Q31 PID Control.
+   * @param[in,out] S  points to an instance of the Q31 PID Control structure
+   * @param[in]     in  input sample to process
+   * @return out processed output sample.
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using an internal 64-bit accumulator.
+   * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+   * Thus, if the accumulator result overflows it wraps around rather than clip.
+   * In order to avoid overflows completely the input signal must be scaled down by 2 bits as there are four additions.
+   * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.32 format and then saturated to 1.31 format.
+   */
+  CMSIS_INLINE __STATIC_INLINE q31_t arm_pid_q31(
+  arm_pid_instance_q31 * S,
+  q31_t in)
+  {
+    q63_t acc;
+    q31_t out;
+
+    /* acc = A0 * x[n]  */
+    acc = (q63_t) S->A0 * in;
+
+    /* acc += A1 * x[n-1] */
+    acc += (q63_t) S->A1 * S->state[0];
+
+    /* acc += A2 * x[n-2]  */
+    acc += (q63_t) S->A2 * S->state[1];
+
+    /* convert output to 1.31 format to add y[n-1] */
+    out = (q31_t) (acc >> 31U);
+
+    /* out += y[n-1] */
+    out += S->state[2];
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
+
+    /* return to application */
+    return (out);
+  }
+
+
+  /**
+   * @brief  Process function for the Q15 PID Control.
+   * @param[in,out] S   points to an instance of the Q15 PID Control structure
+   * @param[in]     in  input sample to process
+   * @return out processed output sample.
+   *
+   * <b>Scaling and Overflow Behavior:</b>
+   * \par
+   * The function is implemented using a 64-bit internal accumulator.
+   * Both Gains and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+   * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+   * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
+   * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+   * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+   */
+  CMSIS_INLINE __STATIC_INLINE q15_t arm_pid_q15(
+  arm_pid_instance_q15 * S,
+  q15_t in)
+  {
+    q63_t acc;
+    q15_t out;
+
+#if defined (ARM_MATH_DSP)
+    __SIMD32_TYPE *vstate;
+
+    /* Implementation of PID controller */
+
+    /* acc = A0 * x[n]  */
+    acc = (q31_t) __SMUAD((uint32_t)S->A0, (uint32_t)in);
+
+    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
+    vstate = __SIMD32_CONST(S->state);
+    acc = (q63_t)__SMLALD((uint32_t)S->A1, (uint32_t)*vstate, (uint64_t)acc);
+#else
+    /* acc = A0 * x[n]  */
+    acc = ((q31_t) S->A0) * in;
+
+    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
+    acc += (q31_t) S->A1 * S->state[0];
+    acc += (q31_t) S->A2 * S->state[1];
+#endif
+
+    /* acc += y[n-1] */
+    acc += (q31_t) S->state[2] << 15;
+
+    /* saturate the output */
+    out = (q15_t) (__SSAT((acc >> 15), 16));
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
+
+    /* return to application */
+    return (out);
+  }
+
+  /**
+   * @} end of PID group
+   */
+
+
+  /**
+   * @brief Floating-point matrix inverse.
+   * @param[in]  src   points to the instance of the input floating-point matrix structure.
+   * @param[out] dst   points to the instance of the output floating-point matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_inverse_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Floating-point matrix inverse.
+   * @param[in]  src   points to the instance of the input floating-point matrix structure.
+   * @param[out] dst   points to the instance of the output floating-point matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_inverse_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
+
+  /**
+   * @brief Floating-point matrix multiplication of fixed-size square matrices, from 2x2 to 6x6.
+   * @param[in]  pSrcA  points to the first input matrix, stored row by row
+   * @param[in]  pSrcB  points to the second input matrix, stored row by row
+   * @param[out] pDst   points to the output matrix, stored row by row
+   * @return none.
+   */
+  void arm_mat_mult_2x2_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_mult_3x3_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_mult_4x4_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_mult_5x5_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_mult_6x6_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Floating-point matrix multiplication, using the fixed-size kernels for square matrices from 2x2 to 6x6.
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return The function returns the status of the fixed-size kernel or of the generic function.
+   */
+  arm_status arm_mat_mult_small_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Q31 matrix multiplication of fixed-size square matrices, from 2x2 to 6x6.
+   * @param[in]  pSrcA  points to the first input matrix, stored row by row
+   * @param[in]  pSrcB  points to the second input matrix, stored row by row
+   * @param[out] pDst   points to the output matrix, stored row by row
+   * @return none.
+   */
+  void arm_mat_mult_2x2_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst);
+
+  void arm_mat_mult_3x3_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst);
+
+  void arm_mat_mult_4x4_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst);
+
+  void arm_mat_mult_5x5_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst);
+
+  void arm_mat_mult_6x6_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst);
+
+
+  /**
+   * @brief Q31 matrix multiplication, using the fixed-size kernels for square matrices from 2x2 to 6x6.
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return The function returns the status of the fixed-size kernel or of the generic function.
+   */
+  arm_status arm_mat_mult_small_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst);
+
+
+  /**
+   * @brief Floating-point matrix addition of fixed-size square matrices, from 2x2 to 6x6.
+   * @param[in]  pSrcA  points to the first input matrix, stored row by row
+   * @param[in]  pSrcB  points to the second input matrix, stored row by row
+   * @param[out] pDst   points to the output matrix, stored row by row
+   * @return none.
+   */
+  void arm_mat_add_2x2_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_add_3x3_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_add_4x4_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_add_5x5_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+  void arm_mat_add_6x6_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Floating-point matrix addition, using the fixed-size kernels for square matrices from 2x2 to 6x6.
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return The function returns the status of the fixed-size kernel or of the generic function.
+   */
+  arm_status arm_mat_add_small_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Q31 matrix addition of fixed-size square matrices, from 2x2 to 6x6.
+   * @param[in]  pSrcA  points to the first input matrix, stored row by row
+   * @param[in]  pSrcB  points to the second input matrix, stored row by row
+   * @param[out] pDst   points to the output matrix, stored row by row
+   * @return none.
+   */
+  void arm_mat_add_2x2_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst);
+
+  void arm_mat_add_3x3_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst);
+
+  void arm_mat_add_4x4_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst);
+
+  void arm_mat_add_5x5_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst);
+
+  void arm_mat_add_6x6_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst);
+
+
+  /**
+   * @brief Q31 matrix addition, using the fixed-size kernels for square matrices from 2x2 to 6x6.
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return The function returns the status of the fixed-size kernel or of the generic function.
+   */
+  arm_status arm_mat_add_small_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst);
+
+
+  /**
+   * @brief Floating-point matrix transpose of fixed-size square matrices, from 2x2 to 6x6.
+   * @param[in]  pSrc   points to the input matrix, stored row by row
+   * @param[out] pDst   points to the output matrix, stored row by row
+   * @return none.
+   */
+  void arm_mat_trans_2x2_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
+
+  void arm_mat_trans_3x3_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
+
+  void arm_mat_trans_4x4_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
+
+  void arm_mat_trans_5x5_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
+
+  void arm_mat_trans_6x6_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Floating-point matrix transpose, using the fixed-size kernels for square matrices from 2x2 to 6x6.
+   * @param[in]  pSrc   points to the input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return The function returns the status of the fixed-size kernel or of the generic function.
+   */
+  arm_status arm_mat_trans_small_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+
+  /**
+   * @brief Q31 matrix transpose of fixed-size square matrices, from 2x2 to 6x6.
+   * @param[in]  pSrc   points to the input matrix, stored row by row
+   * @param[out] pDst   points to the output matrix, stored row by row
+   * @return none.
+   */
+  void arm_mat_trans_2x2_q31(
+  const q31_t * pSrc,
+  q31_t * pDst);
+
+  void arm_mat_trans_3x3_q31(
+  const q31_t * pSrc,
+  q31_t * pDst);
+
+  void arm_mat_trans_4x4_q31(
+  const q31_t * pSrc,
+  q31_t * pDst);
+
+  void arm_mat_trans_5x5_q31(
+  const q31_t * pSrc,
+  q31_t * pDst);
+
+  void arm_mat_trans_6x6_q31(
+  const q31_t * pSrc,
+  q31_t * pDst);
+
+
+  /**
+   * @brief Q31 matrix transpose, using the fixed-size kernels for square matrices from 2x2 to 6x6.
+   * @param[in]  pSrc   points to the input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return The function returns the status of the fixed-size kernel or of the generic function.
+   */
+  arm_status arm_mat_trans_small_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst);
+
 
   /**
-   * @brief  Process function for the Q31 PID Control.
-   * @param[in,out] S  points to an instance of the Q31 PID Control structure
-   * @param[in]     in  input sample to process
-   * @return out processed output sample.
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using an internal 64-bit accumulator.
-   * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
-   * Thus, if the accumulator result overflows it wraps around rather than clip.
-   * In order to avoid overflows completely the input signal must be scaled down by 2 bits as there are four additions.
-   * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.32 format and then saturated to 1.31 format.
+   * @brief Floating-point matrix inverse of fixed-size square matrices, from 2x2 to 6x6.
+   * @param[in]  pSrc   points to the input matrix, stored row by row
+   * @param[out] pDst   points to the output matrix, stored row by row
+   * @return ARM_MATH_SINGULAR if the input matrix is singular, ARM_MATH_SUCCESS otherwise.
    */
-  CMSIS_INLINE __STATIC_INLINE q31_t arm_pid_q31(
-  arm_pid_instance_q31 * S,
-  q31_t in)
-  {
-    q63_t acc;
-    q31_t out;
-
-    /* acc = A0 * x[n]  */
-    acc = (q63_t) S->A0 * in;
+  arm_status arm_mat_inverse_2x2_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
-    /* acc += A1 * x[n-1] */
-    acc += (q63_t) S->A1 * S->state[0];
+  arm_status arm_mat_inverse_3x3_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
-    /* acc += A2 * x[n-2]  */
-    acc += (q63_t) S->A2 * S->state[1];
+  arm_status arm_mat_inverse_4x4_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
-    /* convert output to 1.31 format to add y[n-1] */
-    out = (q31_t) (acc >> 31U);
+  arm_status arm_mat_inverse_5x5_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
-    /* out += y[n-1] */
-    out += S->state[2];
+  arm_status arm_mat_inverse_6x6_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
-    /* Update state */
-    S->state[1] = S->state[0];
-    S->state[0] = in;
-    S->state[2] = out;
 
-    /* return to application */
-    return (out);
-  }
+  /**
+   * @brief Floating-point matrix inverse, using the fixed-size kernels for square matrices from 2x2 to 6x6.
+   * @param[in]  pSrc   points to the input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return The function returns the status of the fixed-size kernel or of the generic function.
+   */
+  arm_status arm_mat_inverse_small_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
 
 
   /**
-   * @brief  Process function for the Q15 PID Control.
-   * @param[in,out] S   points to an instance of the Q15 PID Control structure
-   * @param[in]     in  input sample to process
-   * @return out processed output sample.
-   *
-   * <b>Scaling and Overflow Behavior:</b>
-   * \par
-   * The function is implemented using a 64-bit internal accumulator.
-   * Both Gains and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
-   * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
-   * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
-   * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
-   * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+   * @brief Floating-point Cholesky decomposition.
+   * @param[in]  pSrc   points to the instance of the input matrix structure.
+   * @param[out] pDst   points to the instance of the output matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
    */
-  CMSIS_INLINE __STATIC_INLINE q15_t arm_pid_q15(
-  arm_pid_instance_q15 * S,
-  q15_t in)
-  {
-    q63_t acc;
-    q15_t out;
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
 
-#if defined (ARM_MATH_DSP)
-    __SIMD32_TYPE *vstate;
 
-    /* Implementation of PID controller */
+  /**
+   * @brief Q31 Cholesky decomposition.
+   * @param[in]  pSrc   points to the instance of the input matrix structure.
+   * @param[out] pDst   points to the instance of the output matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_cholesky_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst);
 
-    /* acc = A0 * x[n]  */
-    acc = (q31_t) __SMUAD((uint32_t)S->A0, (uint32_t)in);
 
-    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
-    vstate = __SIMD32_CONST(S->state);
-    acc = (q63_t)__SMLALD((uint32_t)S->A1, (uint32_t)*vstate, (uint64_t)acc);
-#else
-    /* acc = A0 * x[n]  */
-    acc = ((q31_t) S->A0) * in;
+  /**
+   * @brief Floating-point Cholesky decomposition of fixed-size square matrices, from 2x2 to 6x6.
+   * @param[in]  pSrc   points to the input matrix, stored row by row
+   * @param[out] pDst   points to the output matrix, stored row by row
+   * @return ARM_MATH_SINGULAR if the input matrix is not positive definite, ARM_MATH_SUCCESS otherwise.
+   */
+  arm_status arm_mat_cholesky_2x2_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
-    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
-    acc += (q31_t) S->A1 * S->state[0];
-    acc += (q31_t) S->A2 * S->state[1];
-#endif
+  arm_status arm_mat_cholesky_3x3_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
-    /* acc += y[n-1] */
-    acc += (q31_t) S->state[2] << 15;
+  arm_status arm_mat_cholesky_4x4_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
-    /* saturate the output */
-    out = (q15_t) (__SSAT((acc >> 15), 16));
+  arm_status arm_mat_cholesky_5x5_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
-    /* Update state */
-    S->state[1] = S->state[0];
-    S->state[0] = in;
-    S->state[2] = out;
+  arm_status arm_mat_cholesky_6x6_f32(
+  const float32_t * pSrc,
+  float32_t * pDst);
 
-    /* return to application */
-    return (out);
-  }
 
   /**
-   * @} end of PID group
+   * @brief Floating-point Cholesky decomposition, using the fixed-size kernels for square matrices from 2x2 to 6x6.
+   * @param[in]  pSrc   points to the input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return The function returns the status of the fixed-size kernel or of the generic function.
    */
+  arm_status arm_mat_cholesky_small_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
 
 
   /**
-   * @brief Floating-point matrix inverse.
-   * @param[in]  src   points to the instance of the input floating-point matrix structure.
-   * @param[out] dst   points to the instance of the output floating-point matrix structure.
-   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
-   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   * @brief Q31 Cholesky decomposition of fixed-size square matrices, from 2x2 to 6x6.
+   * @param[in]  pSrc   points to the input matrix, stored row by row
+   * @param[out] pDst   points to the output matrix, stored row by row
+   * @return ARM_MATH_SINGULAR if the input matrix is not positive definite, ARM_MATH_SUCCESS otherwise.
    */
-  arm_status arm_mat_inverse_f32(
-  const arm_matrix_instance_f32 * src,
-  arm_matrix_instance_f32 * dst);
+  arm_status arm_mat_cholesky_2x2_q31(
+  const q31_t * pSrc,
+  q31_t * pDst);
+
+  arm_status arm_mat_cholesky_3x3_q31(
+  const q31_t * pSrc,
+  q31_t * pDst);
+
+  arm_status arm_mat_cholesky_4x4_q31(
+  const q31_t * pSrc,
+  q31_t * pDst);
+
+  arm_status arm_mat_cholesky_5x5_q31(
+  const q31_t * pSrc,
+  q31_t * pDst);
+
+  arm_status arm_mat_cholesky_6x6_q31(
+  const q31_t * pSrc,
+  q31_t * pDst);
 
 
   /**
-   * @brief Floating-point matrix inverse.
-   * @param[in]  src   points to the instance of the input floating-point matrix structure.
-   * @param[out] dst   points to the instance of the output floating-point matrix structure.
-   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
-   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+   * @brief Q31 Cholesky decomposition, using the fixed-size kernels for square matrices from 2x2 to 6x6.
+   * @param[in]  pSrc   points to the input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return The function returns the status of the fixed-size kernel or of the generic function.
    */
-  arm_status arm_mat_inverse_f64(
-  const arm_matrix_instance_f64 * src,
-  arm_matrix_instance_f64 * dst);
+  arm_status arm_mat_cholesky_small_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst);
+
 
 
 
@@ -6522,6 +7973,261 @@ void arm_rfft_fast_f32(
   uint32_t * pIndex);
 
 
+  /**
+   * @brief Statistics of a floating-point vector computed in a single pass.
+   */
+  typedef struct
+  {
+    float32_t mean;                 /**< mean value. */
+    float32_t var;                  /**< variance, normalized by blockSize-1. */
+    float32_t rms;                  /**< root mean square value. */
+    float32_t power;                /**< sum of the squares. */
+    float32_t min;                  /**< minimum value. */
+    float32_t max;                  /**< maximum value. */
+    uint32_t minIndex;              /**< index of the first minimum value. */
+    uint32_t maxIndex;              /**< index of the first maximum value. */
+  } arm_stats_result_f32;
+
+  /**
+   * @brief Statistics of a Q31 vector computed in a single pass.
+   */
+  typedef struct
+  {
+    q31_t mean;                     /**< mean value, as returned by arm_mean_q31(). */
+    q31_t var;                      /**< variance, as returned by arm_var_q31(). */
+    q31_t rms;                      /**< root mean square value, computed from the power. */
+    q63_t power;                    /**< sum of the squares in 16.48 format, as returned by arm_power_q31(). */
+    q31_t min;                      /**< minimum value. */
+    q31_t max;                      /**< maximum value. */
+    uint32_t minIndex;              /**< index of the first minimum value. */
+    uint32_t maxIndex;              /**< index of the first maximum value. */
+  } arm_stats_result_q31;
+
+  /**
+   * @brief Statistics of a Q15 vector computed in a single pass.
+   */
+  typedef struct
+  {
+    q15_t mean;                     /**< mean value, as returned by arm_mean_q15(). */
+    q15_t var;                      /**< variance, as returned by arm_var_q15(). */
+    q15_t rms;                      /**< root mean square value, as returned by arm_rms_q15(). */
+    q63_t power;                    /**< sum of the squares in 34.30 format, as returned by arm_power_q15(). */
+    q15_t min;                      /**< minimum value. */
+    q15_t max;                      /**< maximum value. */
+    uint32_t minIndex;              /**< index of the first minimum value. */
+    uint32_t maxIndex;              /**< index of the first maximum value. */
+  } arm_stats_result_q15;
+
+  /**
+   * @brief Instance structure for the floating-point running statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;                 /**< number of samples in the window. */
+    uint32_t numSamples;            /**< number of samples added since the initialization, which indexes min and max. */
+    float32_t mean;                 /**< mean of the samples in the window. */
+    float32_t m2;                   /**< sum of the squared deviations from the mean. */
+    float32_t power;                /**< sum of the squares. */
+    float32_t powerComp;            /**< compensation term of the sum of the squares. */
+    float32_t min;                  /**< minimum of the samples added since the initialization. */
+    float32_t max;                  /**< maximum of the samples added since the initialization. */
+    uint32_t minIndex;              /**< index of the first minimum value. */
+    uint32_t maxIndex;              /**< index of the first maximum value. */
+  } arm_stats_running_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 running statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;                 /**< number of samples in the window. */
+    uint32_t numSamples;            /**< number of samples added since the initialization, which indexes min and max. */
+    q63_t sum;                      /**< sum of the samples in the window. */
+    q63_t power;                    /**< sum of the squares in 16.48 format. */
+    q31_t min;                      /**< minimum of the samples added since the initialization. */
+    q31_t max;                      /**< maximum of the samples added since the initialization. */
+    uint32_t minIndex;              /**< index of the first minimum value. */
+    uint32_t maxIndex;              /**< index of the first maximum value. */
+  } arm_stats_running_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 running statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;                 /**< number of samples in the window. */
+    uint32_t numSamples;            /**< number of samples added since the initialization, which indexes min and max. */
+    q63_t sum;                      /**< sum of the samples in the window. */
+    q63_t power;                    /**< sum of the squares in 34.30 format. */
+    q15_t min;                      /**< minimum of the samples added since the initialization. */
+    q15_t max;                      /**< maximum of the samples added since the initialization. */
+    uint32_t minIndex;              /**< index of the first minimum value. */
+    uint32_t maxIndex;              /**< index of the first maximum value. */
+  } arm_stats_running_instance_q15;
+
+
+/**
+ * @brief Mean, variance, RMS, power, minimum and maximum of a floating-point vector in a single pass.
+ * @param[in]  pSrc       points to the input buffer
+ * @param[in]  blockSize  length of the input vector
+ * @param[out] pResult    statistics returned here
+ */
+  void arm_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult);
+
+
+/**
+ * @brief Mean, variance, RMS, power, minimum and maximum of a Q31 vector in a single pass.
+ * @param[in]  pSrc       points to the input buffer
+ * @param[in]  blockSize  length of the input vector
+ * @param[out] pResult    statistics returned here
+ */
+  void arm_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q31 * pResult);
+
+
+/**
+ * @brief Mean, variance, RMS, power, minimum and maximum of a Q15 vector in a single pass.
+ * @param[in]  pSrc       points to the input buffer
+ * @param[in]  blockSize  length of the input vector
+ * @param[out] pResult    statistics returned here
+ */
+  void arm_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q15 * pResult);
+
+
+/**
+ * @brief Initialization function for the floating-point running statistics.
+ * @param[in,out] S  points to an instance of the floating-point running statistics structure.
+ */
+  void arm_stats_running_init_f32(
+  arm_stats_running_instance_f32 * S);
+
+
+/**
+ * @brief Adds a block of samples to the floating-point running statistics.
+ * @param[in,out] S          points to an instance of the floating-point running statistics structure.
+ * @param[in]     pSrc       points to the input buffer
+ * @param[in]     blockSize  length of the input vector
+ */
+  void arm_stats_running_add_f32(
+  arm_stats_running_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize);
+
+
+/**
+ * @brief Removes a block of samples, added before, from the floating-point running statistics.
+ * @param[in,out] S          points to an instance of the floating-point running statistics structure.
+ * @param[in]     pSrc       points to the input buffer
+ * @param[in]     blockSize  length of the input vector
+ */
+  void arm_stats_running_remove_f32(
+  arm_stats_running_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize);
+
+
+/**
+ * @brief Returns the floating-point running statistics of the samples in the window.
+ * @param[in]  S        points to an instance of the floating-point running statistics structure.
+ * @param[out] pResult  statistics returned here
+ */
+  void arm_stats_running_get_f32(
+  const arm_stats_running_instance_f32 * S,
+  arm_stats_result_f32 * pResult);
+
+
+/**
+ * @brief Initialization function for the Q31 running statistics.
+ * @param[in,out] S  points to an instance of the Q31 running statistics structure.
+ */
+  void arm_stats_running_init_q31(
+  arm_stats_running_instance_q31 * S);
+
+
+/**
+ * @brief Adds a block of samples to the Q31 running statistics.
+ * @param[in,out] S          points to an instance of the Q31 running statistics structure.
+ * @param[in]     pSrc       points to the input buffer
+ * @param[in]     blockSize  length of the input vector
+ */
+  void arm_stats_running_add_q31(
+  arm_stats_running_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize);
+
+
+/**
+ * @brief Removes a block of samples, added before, from the Q31 running statistics.
+ * @param[in,out] S          points to an instance of the Q31 running statistics structure.
+ * @param[in]     pSrc       points to the input buffer
+ * @param[in]     blockSize  length of the input vector
+ */
+  void arm_stats_running_remove_q31(
+  arm_stats_running_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize);
+
+
+/**
+ * @brief Returns the Q31 running statistics of the samples in the window.
+ * @param[in]  S        points to an instance of the Q31 running statistics structure.
+ * @param[out] pResult  statistics returned here
+ */
+  void arm_stats_running_get_q31(
+  const arm_stats_running_instance_q31 * S,
+  arm_stats_result_q31 * pResult);
+
+
+/**
+ * @brief Initialization function for the Q15 running statistics.
+ * @param[in,out] S  points to an instance of the Q15 running statistics structure.
+ */
+  void arm_stats_running_init_q15(
+  arm_stats_running_instance_q15 * S);
+
+
+/**
+ * @brief Adds a block of samples to the Q15 running statistics.
+ * @param[in,out] S          points to an instance of the Q15 running statistics structure.
+ * @param[in]     pSrc       points to the input buffer
+ * @param[in]     blockSize  length of the input vector
+ */
+  void arm_stats_running_add_q15(
+  arm_stats_running_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize);
+
+
+/**
+ * @brief Removes a block of samples, added before, from the Q15 running statistics.
+ * @param[in,out] S          points to an instance of the Q15 running statistics structure.
+ * @param[in]     pSrc       points to the input buffer
+ * @param[in]     blockSize  length of the input vector
+ */
+  void arm_stats_running_remove_q15(
+  arm_stats_running_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize);
+
+
+/**
+ * @brief Returns the Q15 running statistics of the samples in the window.
+ * @param[in]  S        points to an instance of the Q15 running statistics structure.
+ * @param[out] pResult  statistics returned here
+ */
+  void arm_stats_running_get_q15(
+  const arm_stats_running_instance_q15 * S,
+  arm_stats_result_q15 * pResult);
+
+
   /**
    * @brief  Q15 complex-by-complex multiplication
    * @param[in]  pSrcA       points to the first input vector
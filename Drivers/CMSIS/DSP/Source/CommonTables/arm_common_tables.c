@@ -171,6 +171,8 @@ const uint16_t armBitRevTable[1024] = {
 };
 
 
+#if defined(ARM_ALL_FFT_TABLES)
+
 /*
 * @brief  Floating-point Twiddle factors Table Generation
 */
@@ -16089,6 +16091,7 @@ const q15_t twiddleCoef_4096_q15[6144] =
 	(q15_t)0xFF9B, (q15_t)0x8000, (q15_t)0xFFCD, (q15_t)0x8000
 };
 
+#endif /* ARM_ALL_FFT_TABLES */
 
 /**
 * @} end of CFFT_CIFFT group
@@ -16128,6 +16131,8 @@ const q31_t armRecipTableQ31[64] = {
   0x41CCDDB6, 0x4146A3C6, 0x40C28923, 0x40408102
 };
 
+#if defined(ARM_ALL_FFT_TABLES)
+
 const uint16_t armBitRevIndexTable16[ARMBITREVINDEXTABLE_16_TABLE_LENGTH] =
 {
    /* 8x2, size 20 */
@@ -21878,6 +21883,8 @@ const float32_t twiddleCoef_rfft_4096[4096] = {
     0.001533980f, -0.999998823f
 };
 
+#endif /* ARM_ALL_FFT_TABLES */
+
 
 /**
  * \par
@@ -29,6 +29,8 @@
 
 #include "arm_const_structs.h"
 
+#if defined(ARM_ALL_FFT_TABLES)
+
 /* Floating-point structs */
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len16 = {
 	16, twiddleCoef_16, armBitRevIndexTable16, ARMBITREVINDEXTABLE_16_TABLE_LENGTH
@@ -377,3 +379,5 @@ const arm_rfft_instance_q15 arm_rfft_sR_q15_len8192 = {
 	(q15_t*)realCoefBQ15,
 	&arm_cfft_sR_q15_len4096
 };
+
+#endif /* ARM_ALL_FFT_TABLES */
@@ -0,0 +1,296 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fft_table_gen.c
+ * Description:  Generation of the FFT twiddle factor and bit reversal tables
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup ComplexFFT
+ */
+
+/**
+ * @addtogroup CFFT_CIFFT
+ * @{
+ */
+
+/**
+ * \par
+ * The functions below compute the FFT tables of arm_common_tables.c for any supported length
+ * (16, 32, ..., 4096). Tools/arm_fft_tablegen uses them to emit the tables a project needs at build
+ * time, and the arm_cfft_init_ram_xxx() functions use them to fill a RAM arena at run time.
+ * \par
+ * The values reproduce the rounding of the constant tables: the floating-point factors are rounded
+ * to nine decimals, the Q31 factors are <code>floor(x * 2^31 + 0.05)</code> and the Q15 factors are
+ * <code>floor(x * 2^15)</code>, saturated to the largest positive value. With an IEEE double precision
+ * <code>cos()</code>/<code>sin()</code> the twiddle factors are identical to the constant tables.
+ */
+
+/*
+ * Floating-point value rounded to nine decimals, as printed in the constant tables.
+ */
+static float32_t arm_fft_table_round_f32(float64_t x)
+{
+  float64_t r = floor((fabs(x) * 1.0e9) + 0.5) / 1.0e9;
+
+  return (float32_t) ((x < 0.0) ? -r : r);
+}
+
+/**
+ * @brief  Generates the floating-point CFFT twiddle factor table.
+ * @param[out] pTwiddle  points to the table of <code>2*fftLen</code> values, as twiddleCoef_<code>fftLen</code>.
+ * @param[in]  fftLen    length of the FFT.
+ * @return none.
+ */
+
+void arm_cfft_twiddle_gen_f32(
+  float32_t * pTwiddle,
+  uint16_t fftLen)
+{
+  float64_t phase;                               /* angle of the twiddle factor */
+  uint32_t k;                                    /* loop counter */
+
+  for (k = 0U; k < fftLen; k++)
+  {
+    phase = (6.283185307179586476925 * (float64_t) k) / (float64_t) fftLen;
+
+    *pTwiddle++ = arm_fft_table_round_f32(cos(phase));
+    *pTwiddle++ = arm_fft_table_round_f32(sin(phase));
+  }
+}
+
+/**
+ * @brief  Generates the Q31 CFFT twiddle factor table.
+ * @param[out] pTwiddle  points to the table of <code>3*fftLen/2</code> values, as twiddleCoef_<code>fftLen</code>_q31.
+ * @param[in]  fftLen    length of the FFT.
+ * @return none.
+ */
+
+void arm_cfft_twiddle_gen_q31(
+  q31_t * pTwiddle,
+  uint16_t fftLen)
+{
+  float64_t phase, scaled;                       /* angle and scaled component of the twiddle factor */
+  uint32_t k, j;                                 /* loop counters */
+
+  for (k = 0U; k < ((3U * fftLen) / 4U); k++)
+  {
+    phase = (6.283185307179586476925 * (float64_t) k) / (float64_t) fftLen;
+
+    for (j = 0U; j < 2U; j++)
+    {
+      scaled = floor((((j == 0U) ? cos(phase) : sin(phase)) * 2147483648.0) + 0.05);
+      *pTwiddle++ = (scaled >= 2147483647.0) ? 0x7FFFFFFF : (q31_t) scaled;
+    }
+  }
+}
+
+/**
+ * @brief  Generates the Q15 CFFT twiddle factor table.
+ * @param[out] pTwiddle  points to the table of <code>3*fftLen/2</code> values, as twiddleCoef_<code>fftLen</code>_q15.
+ * @param[in]  fftLen    length of the FFT.
+ * @return none.
+ */
+
+void arm_cfft_twiddle_gen_q15(
+  q15_t * pTwiddle,
+  uint16_t fftLen)
+{
+  float64_t phase, scaled;                       /* angle and scaled component of the twiddle factor */
+  uint32_t k, j;                                 /* loop counters */
+
+  for (k = 0U; k < ((3U * fftLen) / 4U); k++)
+  {
+    phase = (6.283185307179586476925 * (float64_t) k) / (float64_t) fftLen;
+
+    for (j = 0U; j < 2U; j++)
+    {
+      scaled = floor(((j == 0U) ? cos(phase) : sin(phase)) * 32768.0);
+      *pTwiddle++ = (scaled >= 32767.0) ? 0x7FFF : (q15_t) scaled;
+    }
+  }
+}
+
+/**
+ * @brief  Generates the twiddle factor table of the real stage of arm_rfft_fast_f32().
+ * @param[out] pTwiddle  points to the table of <code>fftLen</code> values, as twiddleCoef_rfft_<code>fftLen</code>.
+ * @param[in]  fftLen    length of the real sequence.
+ * @return none.
+ */
+
+void arm_rfft_fast_twiddle_gen_f32(
+  float32_t * pTwiddle,
+  uint16_t fftLen)
+{
+  float64_t phase;                               /* angle of the twiddle factor */
+  uint32_t k;                                    /* loop counter */
+
+  for (k = 0U; k < (fftLen / 2U); k++)
+  {
+    phase = (6.283185307179586476925 * (float64_t) k) / (float64_t) fftLen;
+
+    *pTwiddle++ = arm_fft_table_round_f32(sin(phase));
+    *pTwiddle++ = arm_fft_table_round_f32(cos(phase));
+  }
+}
+
+/*
+ * Position of the output sample k after the butterflies. The fixed-point
+ * transforms reverse the bits of k. The floating-point transform reverses its
+ * radix-8 digits, the least significant digit being radix-2 or radix-4 when
+ * log2(fftLen) is not a multiple of 3 (arm_cfft_radix8by2_f32 and by4).
+ */
+static uint32_t arm_cfft_digit_reverse(
+  uint32_t k,
+  uint32_t fftLen,
+  uint8_t fixedFlag)
+{
+  uint32_t radix, n, log2Len = 0U, rev = 0U;
+
+  for (n = fftLen; n > 1U; n >>= 1U)
+  {
+    log2Len++;
+  }
+
+  if (fixedFlag == 1U)
+  {
+    radix = 2U;
+  }
+  else
+  {
+    radix = ((log2Len % 3U) == 0U) ? 8U : (1U << (log2Len % 3U));
+  }
+
+  n = fftLen;
+
+  while (n > 1U)
+  {
+    rev = (rev * radix) + (k % radix);
+    k /= radix;
+    n /= radix;
+
+    /* The other digits are radix-2 or radix-8 */
+    radix = (fixedFlag == 1U) ? 2U : 8U;
+  }
+
+  return (rev);
+}
+
+/**
+ * @brief  Generates a CFFT bit reversal table.
+ * @param[out] pBitRevTable  points to the table, as armBitRevIndexTable<code>fftLen</code> or
+ *                           armBitRevIndexTable_fixed_<code>fftLen</code>. It may be NULL to get the length only.
+ * @param[in]  fftLen        length of the FFT.
+ * @param[in]  fixedFlag     table of the floating-point transform if flag is 0, of the fixed-point transforms if flag is 1.
+ * @return     The function returns the number of values of the table.
+ *
+ * \par
+ * The table is a list of swaps of complex samples, given as byte offsets <code>8*k</code> as read by
+ * arm_bitreversal_32(). Each sample is swapped with the sample it has to be replaced with, following
+ * the cycles of the permutation, so the table has the length and the effect of the constant table.
+ * The fixed-point tables and the floating-point tables of 64, 128, 512, 1024 and 4096 points are
+ * identical to the constant tables; the floating-point tables of 16, 32, 256 and 2048 points list a few
+ * independent swaps in another order.
+ */
+
+uint16_t arm_cfft_bitrev_gen(
+  uint16_t * pBitRevTable,
+  uint16_t fftLen,
+  uint8_t fixedFlag)
+{
+  uint32_t i, k;                                 /* sample indices */
+  uint16_t length = 0U;                          /* length of the table */
+
+  for (i = 0U; i < fftLen; i++)
+  {
+    /* The sample that belongs at position i was moved by the previous swaps if it came from below i */
+    k = arm_cfft_digit_reverse(i, fftLen, fixedFlag);
+
+    while (k < i)
+    {
+      k = arm_cfft_digit_reverse(k, fftLen, fixedFlag);
+    }
+
+    if (k != i)
+    {
+      if (pBitRevTable != NULL)
+      {
+        pBitRevTable[length]      = (uint16_t) (8U * i);
+        pBitRevTable[length + 1U] = (uint16_t) (8U * k);
+      }
+
+      length += 2U;
+    }
+  }
+
+  return (length);
+}
+
+/**
+ * @brief  Initializes an arena from which the arm_cfft_init_ram_xxx() functions allocate their tables.
+ * @param[out] A        points to the arena.
+ * @param[in]  pBuffer  points to the memory of the arena, aligned on 32 bits.
+ * @param[in]  size     size of the memory in bytes.
+ * @return none.
+ */
+
+void arm_fft_table_arena_init(
+  arm_fft_table_arena * A,
+  void * pBuffer,
+  uint32_t size)
+{
+  A->pBase = (uint8_t *) pBuffer;
+  A->size = size;
+  A->used = 0U;
+}
+
+/**
+ * @brief  Allocates a table from an arena.
+ * @param[in,out] A     points to the arena.
+ * @param[in]     size  size of the table in bytes.
+ * @return        The function returns a pointer aligned on 32 bits, or NULL if the arena is too small.
+ */
+
+void * arm_fft_table_arena_alloc(
+  arm_fft_table_arena * A,
+  uint32_t size)
+{
+  uint8_t *pTable = NULL;
+  uint32_t aligned = (size + 3U) & ~3U;          /* keep the next table aligned */
+
+  if (aligned <= (A->size - A->used))
+  {
+    pTable = A->pBase + A->used;
+    A->used += aligned;
+  }
+
+  return (pTable);
+}
+
+/**
+ * @} end of CFFT_CIFFT group
+ */
@@ -0,0 +1,285 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_df1_multi_q15.c
+ * Description:  Processing functions for the Q15 multi-channel Biquad cascade DirectFormI(DF1) filter
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief  Filters all the channels of a block through the Q15 multi-channel Biquad cascade.
+ * @param[in]  S            points to an instance of the Q15 multi-channel Biquad cascade structure.
+ * @param[in]  pSrc         points to the first input sample of the first channel.
+ * @param[out] pDst         points to the first output sample of the first channel.
+ * @param[in]  chanStride   distance between the samples of two consecutive channels.
+ * @param[in]  frameStride  distance between two consecutive samples of a channel.
+ * @param[in]  blockSize    number of frames to process.
+ * @return none.
+ *
+ * The coefficients of a stage are loaded once and applied to all the channels.
+ * With the DSP extension, the channels are processed in pairs whose input samples are
+ * packed in one word, as the stereo filter arm_biquad_cascade_stereo_df2T_f32() does.
+ */
+
+static void arm_biquad_cascade_df1_multi_kernel_q15(
+  const arm_biquad_casd_df1_multi_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t chanStride,
+  uint32_t frameStride,
+  uint32_t blockSize)
+{
+  q15_t *pIn = pSrc;                             /* Source pointer */
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *px, *py, *pSt;                          /* Input, output and state pointers of the current channel */
+  q15_t b0, b1, b2, a1, a2;                      /* Filter coefficients */
+  q15_t Xn, Xn1, Xn2, Yn1, Yn2;                  /* Filter state variables */
+  q63_t acc;                                     /* Accumulator */
+  int32_t shift = (15 - (int32_t) S->postShift); /* Post shift */
+  uint32_t numCh = S->numChannels;               /* Number of channels */
+  uint32_t stage = S->numStages;                 /* Stage loop counter */
+  uint32_t ch, sample;                           /* Loop counters */
+
+#if defined (ARM_MATH_DSP) && !defined (ARM_MATH_BIG_ENDIAN)
+
+  q31_t b0w, b1w, a1w;                           /* Coefficient pairs {b0, 0}, {b1, b2} and {a1, a2} */
+  q31_t in;                                      /* Input samples of two channels */
+  q31_t out0, out1;                              /* Output samples of two channels */
+  q31_t stateIn0, stateOut0, stateIn1, stateOut1; /* Packed state variables of two channels */
+
+#endif
+
+  do
+  {
+    ch = 0U;
+
+#if defined (ARM_MATH_DSP) && !defined (ARM_MATH_BIG_ENDIAN)
+
+    /* Read the coefficient pairs once for all the channels */
+    b0w = _SIMD32_OFFSET(pCoeffs);
+    b1w = _SIMD32_OFFSET(pCoeffs + 2U);
+    a1w = _SIMD32_OFFSET(pCoeffs + 4U);
+
+    /* Channel pairs */
+    while ((ch + 1U) < numCh)
+    {
+      pSt = pState + (4U * ch);
+      px = pIn + (ch * chanStride);
+      py = pDst + (ch * chanStride);
+
+      /* {x[n-1], x[n-2]} and {y[n-1], y[n-2]} of both channels */
+      stateIn0 = _SIMD32_OFFSET(pSt);
+      stateOut0 = _SIMD32_OFFSET(pSt + 2U);
+      stateIn1 = _SIMD32_OFFSET(pSt + 4U);
+      stateOut1 = _SIMD32_OFFSET(pSt + 6U);
+
+      sample = blockSize;
+
+      while (sample > 0U)
+      {
+        /* Pack the input samples of both channels */
+        in = __PKHBT(px[0], px[chanStride], 16);
+
+        /* First channel: b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q31_t) __SMUAD(b0w, in);
+        acc = __SMLALD(b1w, stateIn0, acc);
+        acc = __SMLALD(a1w, stateOut0, acc);
+        out0 = __SSAT((q31_t) (acc >> shift), 16);
+
+        /* Second channel: the swapped dual multiply picks the upper input sample */
+        acc = (q31_t) __SMUADX(b0w, in);
+        acc = __SMLALD(b1w, stateIn1, acc);
+        acc = __SMLALD(a1w, stateOut1, acc);
+        out1 = __SSAT((q31_t) (acc >> shift), 16);
+
+        /* Update the states: x[n-2] = x[n-1], x[n-1] = x[n], y[n-2] = y[n-1], y[n-1] = y[n] */
+        stateIn0 = __PKHBT(in, stateIn0, 16);
+        stateOut0 = __PKHBT(out0, stateOut0, 16);
+        stateIn1 = __PKHBT(in >> 16, stateIn1, 16);
+        stateOut1 = __PKHBT(out1, stateOut1, 16);
+
+        py[0] = (q15_t) out0;
+        py[chanStride] = (q15_t) out1;
+
+        px += frameStride;
+        py += frameStride;
+
+        /* Decrement the loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      _SIMD32_OFFSET(pSt) = stateIn0;
+      _SIMD32_OFFSET(pSt + 2U) = stateOut0;
+      _SIMD32_OFFSET(pSt + 4U) = stateIn1;
+      _SIMD32_OFFSET(pSt + 6U) = stateOut1;
+
+      ch += 2U;
+    }
+
+#endif /* #if defined (ARM_MATH_DSP) && !defined (ARM_MATH_BIG_ENDIAN) */
+
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[2];
+    b2 = pCoeffs[3];
+    a1 = pCoeffs[4];
+    a2 = pCoeffs[5];
+
+    /* Remaining channels, one at a time */
+    while (ch < numCh)
+    {
+      pSt = pState + (4U * ch);
+      px = pIn + (ch * chanStride);
+      py = pDst + (ch * chanStride);
+
+      /* Reading the state values */
+      Xn1 = pSt[0];
+      Xn2 = pSt[1];
+      Yn1 = pSt[2];
+      Yn2 = pSt[3];
+
+      sample = blockSize;
+
+      while (sample > 0U)
+      {
+        /* Read the input */
+        Xn = *px;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q31_t) b0 * Xn;
+        acc += (q31_t) b1 * Xn1;
+        acc += (q31_t) b2 * Xn2;
+        acc += (q31_t) a1 * Yn1;
+        acc += (q31_t) a2 * Yn2;
+
+        /* The result is converted to 1.15 */
+        acc = __SSAT((acc >> shift), 16);
+
+        /* Update the states */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = (q15_t) acc;
+
+        /* Store the output in the destination buffer. */
+        *py = (q15_t) acc;
+
+        px += frameStride;
+        py += frameStride;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pSt[0] = Xn1;
+      pSt[1] = Xn2;
+      pSt[2] = Yn1;
+      pSt[3] = Yn2;
+
+      ch++;
+    }
+
+    /* The first stage goes from the input buffer to the output buffer. */
+    /* Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    /* Next stage */
+    pCoeffs += 6U;
+    pState += 4U * numCh;
+
+    /* Decrement the loop counter */
+    stage--;
+
+  } while (stage > 0U);
+}
+
+/**
+ * @brief Processing function for the Q15 multi-channel Biquad cascade filter on interleaved data.
+ * @param[in]  S          points to an instance of the Q15 multi-channel Biquad cascade structure.
+ * @param[in]  pSrc       points to the block of input frames, <code>numChannels</code> interleaved samples each.
+ * @param[out] pDst       points to the block of output frames, <code>numChannels</code> interleaved samples each.
+ * @param[in]  blockSize  number of frames to process.
+ * @return none.
+ *
+ * \par
+ * Each channel is filtered as by arm_biquad_cascade_df1_q15() with the coefficients of the
+ * instance, and the results are the same. Channel <code>c</code> of frame <code>n</code> is
+ * at <code>pSrc[n*numChannels+c]</code>, so the frames of a multi-channel ADC or codec are
+ * filtered without deinterleaving them. The coefficients of a stage are loaded once for all
+ * the channels. With the DSP extension, the channels are processed in pairs: the input samples
+ * of a pair are packed in one word and both outputs are computed from the same coefficient words.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Same as arm_biquad_cascade_df1_q15(): the function uses a 64-bit internal accumulator
+ * and the result is saturated to 1.15 format after the <code>postShift</code>.
+ */
+
+void arm_biquad_cascade_df1_multi_q15(
+  const arm_biquad_casd_df1_multi_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  arm_biquad_cascade_df1_multi_kernel_q15(S, pSrc, pDst, 1U, S->numChannels, blockSize);
+}
+
+/**
+ * @brief Processing function for the Q15 multi-channel Biquad cascade filter on planar data.
+ * @param[in]  S          points to an instance of the Q15 multi-channel Biquad cascade structure.
+ * @param[in]  pSrc       points to the input blocks of the channels, one after the other.
+ * @param[out] pDst       points to the output blocks of the channels, one after the other.
+ * @param[in]  blockSize  number of samples per channel to process.
+ * @return none.
+ *
+ * \par
+ * Same as arm_biquad_cascade_df1_multi_q15(), with sample <code>n</code> of channel
+ * <code>c</code> at <code>pSrc[c*blockSize+n]</code>.
+ */
+
+void arm_biquad_cascade_df1_multi_planar_q15(
+  const arm_biquad_casd_df1_multi_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  arm_biquad_cascade_df1_multi_kernel_q15(S, pSrc, pDst, blockSize, 1U, blockSize);
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_add_f32.c
+ * Description:  Floating-point overlap-add FFT convolution engine
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+extern void arm_conv_fft_load_f32(
+  const float32_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  int32_t start,
+  uint32_t count,
+  uint32_t fftLen,
+  float32_t * pDst);
+
+extern void arm_conv_fft_mult_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t fftLen);
+
+/**
+ * @brief  Overlap-add convolution of a sequence with the kernel of an FFT convolution instance.
+ * @param[in]     S            points to an initialized instance of the floating-point FFT convolution structure.
+ * @param[in]     pSrc         points to the input sequence.
+ * @param[in]     srcLen       length of the input sequence.
+ * @param[in]     reverseFlag  0 to use the sequence as stored, 1 to use it in reversed order.
+ * @param[in,out] pDst         points to the output sequence of length srcLen+kernelLen-1.
+ * @param[in]     pScratch     points to a scratch buffer of length 3*fftLen.
+ *
+ * <b>Description:</b>
+ * \par
+ * The full convolution of the input sequence with the kernel is added to <code>pDst</code>.
+ * The input is processed in blocks of <code>blockLen</code> samples; each block costs
+ * one forward transform, and one spectrum product and one inverse transform per kernel partition.
+ */
+
+void arm_conv_fft_add_f32(
+  const arm_conv_fft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  float32_t * pDst,
+  float32_t * pScratch)
+{
+  arm_rfft_fast_instance_f32 rfft = S->rfft;     /* local copy of the real FFT instance */
+  uint32_t fftLen = S->fftLen;                   /* FFT length */
+  uint32_t dstLen = srcLen + S->kernelLen - 1U;  /* length of the output sequence */
+  float32_t *pWin = pScratch;                    /* input block and inverse transform output */
+  float32_t *pSpec = pScratch + fftLen;          /* spectrum of the input block */
+  float32_t *pProd = pScratch + (2U * fftLen);   /* product of the spectra */
+  uint32_t s0, off, cnt, p;                      /* block start, output offset, output count, partition counter */
+
+  for (s0 = 0U; s0 < srcLen; s0 += S->blockLen)
+  {
+    arm_conv_fft_load_f32(pSrc, srcLen, reverseFlag, (int32_t) s0, S->blockLen, fftLen, pWin);
+    arm_rfft_fast_f32(&rfft, pWin, pSpec, 0U);
+
+    for (p = 0U; p < S->numParts; p++)
+    {
+      off = s0 + (p * S->partLen);
+
+      /* Partitions of a short kernel may start beyond the end of the output */
+      if (off >= dstLen)
+      {
+        break;
+      }
+
+      arm_conv_fft_mult_f32(pSpec, S->pKernelFreq + (p * fftLen), pProd, fftLen);
+      arm_rfft_fast_f32(&rfft, pProd, pWin, 1U);
+
+      /* Overlap-add of the linear convolution of the block with the partition */
+      cnt = ((dstLen - off) < fftLen) ? (dstLen - off) : fftLen;
+      arm_add_f32(pDst + off, pWin, pDst + off, cnt);
+    }
+  }
+}
+
+/**
+ * @} end of ConvFFT group
+ */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_add_q31.c
+ * Description:  Q31 overlap-add FFT convolution engine
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+extern int32_t arm_conv_fft_headroom_q31(
+  const q31_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  int32_t start,
+  uint32_t count);
+
+extern void arm_conv_fft_load_q31(
+  const q31_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  int32_t start,
+  uint32_t count,
+  uint32_t fftLen,
+  int32_t shift,
+  q31_t * pDst);
+
+extern int32_t arm_conv_fft_norm_q31(
+  const q31_t * pSrc,
+  uint32_t fftLen);
+
+extern void arm_conv_fft_mac_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pAcc,
+  uint32_t fftLen,
+  uint32_t shift,
+  uint32_t accFlag);
+
+extern void arm_conv_fft_store_q31(
+  const q31_t * pSrc,
+  int32_t shift,
+  q31_t * pDst,
+  uint32_t count,
+  uint32_t accFlag);
+
+/**
+ * @brief  Overlap-add convolution of a sequence with the kernel of a Q31 FFT convolution instance.
+ * @param[in]     S            points to an initialized instance of the Q31 FFT convolution structure.
+ * @param[in]     pSrc         points to the input sequence.
+ * @param[in]     srcLen       length of the input sequence.
+ * @param[in]     reverseFlag  0 to use the sequence as stored, 1 to use it in reversed order.
+ * @param[in,out] pDst         points to the output sequence of length srcLen+kernelLen-1.
+ * @param[in]     pScratch     points to a scratch buffer of length 4*fftLen.
+ *
+ * <b>Description:</b>
+ * \par
+ * The full convolution of the input sequence with the kernel, in the 1.31 format of
+ * arm_conv_q31(), is added to <code>pDst</code> with saturation. Two consecutive blocks of
+ * <code>blockLen</code> samples are carried by the real and imaginary parts of one forward
+ * transform; each kernel partition then costs one spectrum product and one inverse transform.
+ */
+
+void arm_conv_fft_add_q31(
+  const arm_conv_fft_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  q31_t * pDst,
+  q31_t * pScratch)
+{
+  uint32_t fftLen = S->fftLen;                   /* FFT length */
+  uint32_t blockLen = S->blockLen;               /* input samples per block */
+  uint32_t dstLen = srcLen + S->kernelLen - 1U;  /* length of the output sequence */
+  q31_t *pSpec = pScratch;                       /* spectrum of the input blocks */
+  q31_t *pProd = pScratch + (2U * fftLen);       /* product of the spectra */
+  uint32_t s0, off, cnt, p;                      /* block start, output offset, output count, partition counter */
+  int32_t xShift, zShift;                        /* normalization shifts */
+
+  for (s0 = 0U; s0 < srcLen; s0 += 2U * blockLen)
+  {
+    /* Common shift of the two blocks */
+    xShift = arm_conv_fft_headroom_q31(pSrc, srcLen, reverseFlag, (int32_t) s0, 2U * blockLen);
+
+    arm_conv_fft_load_q31(pSrc, srcLen, reverseFlag, (int32_t) s0, blockLen, fftLen, xShift, pSpec);
+    arm_conv_fft_load_q31(pSrc, srcLen, reverseFlag, (int32_t) (s0 + blockLen), blockLen, fftLen, xShift, pSpec + 1);
+    arm_cfft_q31(S->pCfft, pSpec, 0U, 1U);
+
+    for (p = 0U; p < S->numParts; p++)
+    {
+      off = s0 + (p * S->partLen);
+
+      /* Partitions of a short kernel may start beyond the end of the output */
+      if (off >= dstLen)
+      {
+        break;
+      }
+
+      arm_conv_fft_mac_q31(pSpec, S->pKernelFreq + (2U * p * fftLen), pProd, fftLen, 32U, 0U);
+
+      zShift = arm_conv_fft_norm_q31(pProd, fftLen);
+      arm_shift_q31(pProd, (int8_t) zShift, pProd, 2U * fftLen);
+
+      arm_cfft_q31(S->pCfft, pProd, 1U, 1U);
+
+      /* Overlap-add of the linear convolutions of the two blocks with the partition */
+      cnt = ((dstLen - off) < fftLen) ? (dstLen - off) : fftLen;
+      arm_conv_fft_store_q31(pProd, S->postShift - xShift - zShift, pDst + off, cnt, 1U);
+
+      off += blockLen;
+
+      if (off < dstLen)
+      {
+        cnt = ((dstLen - off) < fftLen) ? (dstLen - off) : fftLen;
+        arm_conv_fft_store_q31(pProd + 1, S->postShift - xShift - zShift, pDst + off, cnt, 1U);
+      }
+    }
+  }
+}
+
+/**
+ * @} end of ConvFFT group
+ */
@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_f32.c
+ * Description:  Floating-point FFT convolution
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup ConvFFT FFT Convolution
+ *
+ * Convolution, partial convolution and correlation computed with fast Fourier transforms.
+ * The results are those of arm_conv_f32(), arm_conv_partial_f32() and arm_correlate_f32()
+ * (respectively their Q31 counterparts), up to rounding, at a cost that grows with
+ * <code>log2(fftLen)</code> per output sample instead of with the length of the shorter sequence.
+ *
+ * \par Algorithm
+ * The shorter sequence is used as the kernel. Its spectrum is computed once by
+ * arm_conv_fft_init_f32(); a kernel of <code>fftLen</code> samples or more is split into
+ * partitions of <code>fftLen/2</code> samples (uniformly partitioned convolution) so that
+ * long kernels do not require long transforms. Two engines then process the other sequence:
+ * - arm_conv_fft_save_f32() (overlap-save) computes any range of output samples,
+ *   <code>blockLen = fftLen - partLen + 1</code> samples per inverse transform.
+ *   It is used by the partial convolution and by the streaming FIR filter.
+ * - arm_conv_fft_add_f32() (overlap-add) adds the full convolution to the output buffer.
+ *
+ * \par Choice of the algorithm
+ * arm_conv_fft_f32(), arm_conv_partial_fft_f32() and arm_correlate_fft_f32() call
+ * arm_conv_fft_len_f32() to pick the FFT length with the lowest estimated cost and fall back to
+ * arm_conv_f32(), arm_conv_partial_f32() and arm_correlate_f32() when the direct form is cheaper.
+ * The cost constants ARM_CONV_FFT_COST_FFT_F32, ARM_CONV_FFT_COST_MUL_F32 (and the Q31
+ * equivalents) can be defined on the command line to match the measurements of a given target.
+ * As a rough guide, with ARM_MATH_DSP the FFT forms pay off from kernels of a few tens of taps
+ * when the other sequence is several times longer. Without ARM_MATH_DSP (Cortex-M0 and Cortex-M3)
+ * the direct forms visit every pair of samples preceding each output sample, so the FFT forms
+ * are faster for nearly all kernel lengths once the output has a few hundred samples.
+ *
+ * \par Streaming
+ * arm_fir_fft_f32() is a block FIR filter with the interface of arm_fir_f32()
+ * which uses the overlap-save engine; arm_fir_fft_len_f32() tells whether and with which FFT
+ * length it is faster than arm_fir_f32() for a given number of taps and block size.
+ *
+ * \par Memory
+ * The kernel spectra take <code>ARM_CONV_FFT_NUM_PARTS(kernelLen, fftLen) * fftLen</code>
+ * values; the engines need <code>3*fftLen</code> values of scratch for floating-point and
+ * <code>4*fftLen</code> for Q31. The one-shot functions take a single buffer whose length is returned by
+ * arm_conv_fft_scratch_size_f32() and arm_conv_fft_scratch_size_q31().
+ *
+ * \par Fixed-Point Behavior
+ * The Q31 functions use arm_cfft_q31() with block floating point: the input windows and the
+ * accumulated spectra are normalized before each transform and the output is rescaled with
+ * saturation. The result has an SNR of about 100 dB relative to the direct form
+ * and, unlike arm_conv_q31(), does not require scaling down the inputs. There are no Q15 or Q7
+ * versions: convert the data with arm_q15_to_q31() or arm_q7_to_q31() first.
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+extern void arm_conv_fft_add_f32(
+  const arm_conv_fft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  float32_t * pDst,
+  float32_t * pScratch);
+
+/**
+ * @brief Convolution of floating-point sequences using the FFT when faster.
+ * @param[in]  pSrcA     points to the first input sequence.
+ * @param[in]  srcALen   length of the first input sequence.
+ * @param[in]  pSrcB     points to the second input sequence.
+ * @param[in]  srcBLen   length of the second input sequence.
+ * @param[out] pDst      points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @param[in]  pScratch  points to a scratch buffer of length arm_conv_fft_scratch_size_f32(srcALen, srcBLen, 0, srcALen+srcBLen-1).
+ * @return none.
+ */
+
+void arm_conv_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch)
+{
+  arm_conv_fft_instance_f32 S;                   /* FFT convolution instance */
+  float32_t *pKernel = pSrcB, *pIn = pSrcA;      /* kernel and input sequence */
+  uint32_t kernelLen = srcBLen, srcLen = srcALen;
+  uint16_t fftLen = arm_conv_fft_len_f32(srcALen, srcBLen, 0U, srcALen + srcBLen - 1U);
+
+  if (fftLen == 0U)
+  {
+    arm_conv_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+    return;
+  }
+
+  /* The shorter sequence is the kernel */
+  if (srcALen < srcBLen)
+  {
+    pKernel = pSrcA;
+    kernelLen = srcALen;
+    pIn = pSrcB;
+    srcLen = srcBLen;
+  }
+
+  arm_conv_fft_init_f32(&S, pKernel, kernelLen, 0U, fftLen, pScratch,
+                        pScratch + (ARM_CONV_FFT_NUM_PARTS(kernelLen, fftLen) * fftLen));
+
+  arm_fill_f32(0.0f, pDst, srcALen + srcBLen - 1U);
+  arm_conv_fft_add_f32(&S, pIn, srcLen, 0U, pDst,
+                       pScratch + (ARM_CONV_FFT_NUM_PARTS(kernelLen, fftLen) * fftLen));
+}
+
+/**
+ * @} end of ConvFFT group
+ */
@@ -0,0 +1,286 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_init_f32.c
+ * Description:  Floating-point FFT convolution planning and initialization functions
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * Cost model used to choose between the direct form and the FFT forms.
+ * The unit is 1/16 of a direct-form multiply-accumulate; a real FFT of length N
+ * costs ARM_CONV_FFT_COST_FFT_F32 * N * log2(N) and a spectrum product
+ * ARM_CONV_FFT_COST_MUL_F32 * N. The defaults come from the crossover benchmark
+ * of the DSP_Lib_TestSuite (conv_fft_tests.c) and can be overridden per target.
+ */
+#ifndef ARM_CONV_FFT_COST_FFT_F32
+#define ARM_CONV_FFT_COST_FFT_F32   14U
+#endif
+
+#ifndef ARM_CONV_FFT_COST_MUL_F32
+#define ARM_CONV_FFT_COST_MUL_F32   32U
+#endif
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+extern void arm_conv_fft_load_f32(
+  const float32_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  int32_t start,
+  uint32_t count,
+  uint32_t fftLen,
+  float32_t * pDst);
+
+/**
+ * @brief  Cost of an FFT form in 1/16 MAC units.
+ * @param[in]  kernelLen   length of the kernel.
+ * @param[in]  numPoints   number of output samples.
+ * @param[in]  fftLen      FFT length.
+ * @param[in]  kernelFlag  1 to include the transform of the kernel.
+ * @return     estimated cost.
+ */
+
+static uint64_t arm_conv_fft_cost_f32(
+  uint32_t kernelLen,
+  uint32_t numPoints,
+  uint32_t fftLen,
+  uint32_t kernelFlag)
+{
+  uint32_t log2N = 0U;                           /* log2 of the FFT length */
+  uint32_t partLen, numParts, blockLen, numBlocks;
+  uint64_t fft, cost;
+
+  while ((1U << log2N) < fftLen)
+  {
+    log2N++;
+  }
+
+  numParts = ARM_CONV_FFT_NUM_PARTS(kernelLen, fftLen);
+  partLen = (numParts == 1U) ? kernelLen : (fftLen / 2U);
+  blockLen = fftLen - partLen + 1U;
+  numBlocks = (numPoints + blockLen - 1U) / blockLen;
+
+  fft = (uint64_t) ARM_CONV_FFT_COST_FFT_F32 * fftLen * log2N;
+
+  /* Per block: one forward transform and one product per partition, one inverse transform */
+  cost = (uint64_t) numBlocks * (numParts * (fft + (uint64_t) ARM_CONV_FFT_COST_MUL_F32 * fftLen) + fft);
+
+  if (kernelFlag != 0U)
+  {
+    cost += numParts * fft;
+  }
+
+  return (cost);
+}
+
+/**
+ * @brief  Selects the cheapest FFT length, or 0 for the direct form.
+ * @param[in]  kernelLen   length of the kernel.
+ * @param[in]  numPoints   number of output samples.
+ * @param[in]  directMacs  multiply-accumulates of the direct form.
+ * @param[in]  kernelFlag  1 to include the transform of the kernel.
+ * @return     FFT length or 0.
+ */
+
+static uint16_t arm_conv_fft_select_f32(
+  uint32_t kernelLen,
+  uint32_t numPoints,
+  uint64_t directMacs,
+  uint32_t kernelFlag)
+{
+  uint64_t best = directMacs * 16U;              /* cost of the direct form */
+  uint64_t cost;
+  uint32_t fftLen;
+  uint16_t bestLen = 0U;
+
+  for (fftLen = 32U; fftLen <= 4096U; fftLen <<= 1U)
+  {
+    cost = arm_conv_fft_cost_f32(kernelLen, numPoints, fftLen, kernelFlag);
+
+    if (cost < best)
+    {
+      best = cost;
+      bestLen = (uint16_t) fftLen;
+    }
+  }
+
+  return (bestLen);
+}
+
+/**
+ * @brief  FFT length for a convolution or correlation of two sequences.
+ * @param[in]  srcALen     length of the first input sequence.
+ * @param[in]  srcBLen     length of the second input sequence.
+ * @param[in]  firstIndex  first output sample to be computed.
+ * @param[in]  numPoints   number of output samples to be computed.
+ * @return     FFT length to use, or 0 when the direct form is faster.
+ *
+ * \par
+ * The shorter sequence is used as the kernel. The estimate includes the
+ * transform of the kernel, as done by arm_conv_fft_f32(), arm_conv_partial_fft_f32()
+ * and arm_correlate_fft_f32(). Without ARM_MATH_DSP (Cortex-M0 and Cortex-M3) the
+ * direct forms test every pair of samples preceding each output sample, which is
+ * accounted for.
+ */
+
+uint16_t arm_conv_fft_len_f32(
+  uint32_t srcALen,
+  uint32_t srcBLen,
+  uint32_t firstIndex,
+  uint32_t numPoints)
+{
+  uint32_t kernelLen = (srcALen < srcBLen) ? srcALen : srcBLen;
+  uint64_t directMacs;                           /* multiply-accumulates of the direct form */
+
+#if defined (ARM_MATH_DSP)
+
+  directMacs = (uint64_t) numPoints * kernelLen;
+
+  /* A full convolution needs srcALen * srcBLen multiply-accumulates at most */
+  if (directMacs > (uint64_t) srcALen * srcBLen)
+  {
+    directMacs = (uint64_t) srcALen * srcBLen;
+  }
+
+#else
+
+  /* Output sample i visits i+1 pairs */
+  directMacs = ((uint64_t) numPoints * firstIndex) + (((uint64_t) numPoints * (numPoints + 1U)) / 2U);
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  return (arm_conv_fft_select_f32(kernelLen, numPoints, directMacs, 1U));
+}
+
+/**
+ * @brief  Scratch size of the automatic FFT convolution functions.
+ * @param[in]  srcALen     length of the first input sequence.
+ * @param[in]  srcBLen     length of the second input sequence.
+ * @param[in]  firstIndex  first output sample to be computed.
+ * @param[in]  numPoints   number of output samples to be computed.
+ * @return     number of float32_t values of <code>pScratch</code>, 0 when the direct form is used.
+ */
+
+uint32_t arm_conv_fft_scratch_size_f32(
+  uint32_t srcALen,
+  uint32_t srcBLen,
+  uint32_t firstIndex,
+  uint32_t numPoints)
+{
+  uint32_t fftLen = arm_conv_fft_len_f32(srcALen, srcBLen, firstIndex, numPoints);
+  uint32_t kernelLen = (srcALen < srcBLen) ? srcALen : srcBLen;
+
+  if (fftLen == 0U)
+  {
+    return (0U);
+  }
+
+  /* Kernel spectra followed by the scratch of the engines */
+  return ((ARM_CONV_FFT_NUM_PARTS(kernelLen, fftLen) + 3U) * fftLen);
+}
+
+/**
+ * @brief  FFT length for the streaming FFT FIR filter.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  number of samples processed per call.
+ * @return     FFT length to pass to arm_fir_fft_init_f32(), or 0 when the direct form is faster.
+ *
+ * \par
+ * The kernel is transformed once at initialization, so only the per-block cost
+ * is compared against the <code>numTaps</code> multiply-accumulates per sample of arm_fir_f32().
+ */
+
+uint16_t arm_fir_fft_len_f32(
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  return (arm_conv_fft_select_f32(numTaps, blockSize, (uint64_t) numTaps * blockSize, 0U));
+}
+
+/**
+ * @brief  Initialization function for the floating-point FFT convolution engine.
+ * @param[in,out] S            points to an instance of the floating-point FFT convolution structure.
+ * @param[in]     pKernel      points to the kernel.
+ * @param[in]     kernelLen    length of the kernel.
+ * @param[in]     reverseFlag  0 to use the kernel as stored, 1 to use it in reversed order.
+ * @param[in]     fftLen       FFT length: 32, 64, 128, 256, 512, 1024, 2048 or 4096.
+ * @param[in]     pKernelFreq  points to the kernel spectra, of length ARM_CONV_FFT_NUM_PARTS(kernelLen, fftLen) * fftLen.
+ * @param[in]     pScratch     points to a scratch buffer of length fftLen.
+ * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported
+ * or <code>kernelLen</code> is 0.
+ *
+ * <b>Description:</b>
+ * \par
+ * A kernel shorter than <code>fftLen</code> is transformed as a whole; a longer kernel is
+ * split into partitions of <code>fftLen/2</code> samples which are transformed separately.
+ * Each FFT block then produces <code>blockLen = fftLen - partLen + 1</code> output samples.
+ * The spectra include the scaling of the inverse transform.
+ */
+
+arm_status arm_conv_fft_init_f32(
+  arm_conv_fft_instance_f32 * S,
+  const float32_t * pKernel,
+  uint32_t kernelLen,
+  uint8_t reverseFlag,
+  uint16_t fftLen,
+  float32_t * pKernelFreq,
+  float32_t * pScratch)
+{
+  uint32_t p;                                    /* partition counter */
+
+  if ((kernelLen == 0U) || (arm_rfft_fast_init_f32(&S->rfft, fftLen) != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->kernelLen = kernelLen;
+  S->fftLen = fftLen;
+  S->numParts = (uint16_t) ARM_CONV_FFT_NUM_PARTS(kernelLen, fftLen);
+  S->partLen = (S->numParts == 1U) ? (uint16_t) kernelLen : (uint16_t) (fftLen / 2U);
+  S->blockLen = (uint16_t) (fftLen - S->partLen + 1U);
+  S->pKernelFreq = pKernelFreq;
+
+  for (p = 0U; p < S->numParts; p++)
+  {
+    /* Zero padded partition of the kernel */
+    arm_conv_fft_load_f32(pKernel, kernelLen, reverseFlag, (int32_t) (p * S->partLen), S->partLen, fftLen, pScratch);
+
+    arm_rfft_fast_f32(&S->rfft, pScratch, pKernelFreq + (p * fftLen), 0U);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ConvFFT group
+ */
@@ -0,0 +1,357 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_init_q31.c
+ * Description:  Q31 FFT convolution initialization functions
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+/**
+ * Cost model of the Q31 functions, see arm_conv_fft_init_f32.c. A complex FFT
+ * of length N, which carries two blocks, costs ARM_CONV_FFT_COST_FFT_Q31 * N * log2(N);
+ * the loading, normalization, spectrum product and rounding of a pair of blocks
+ * cost ARM_CONV_FFT_COST_MUL_Q31 * N.
+ */
+#ifndef ARM_CONV_FFT_COST_FFT_Q31
+#define ARM_CONV_FFT_COST_FFT_Q31   18U
+#endif
+
+#ifndef ARM_CONV_FFT_COST_MUL_Q31
+#define ARM_CONV_FFT_COST_MUL_Q31   320U
+#endif
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+extern int32_t arm_conv_fft_headroom_q31(
+  const q31_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  int32_t start,
+  uint32_t count);
+
+extern void arm_conv_fft_load_q31(
+  const q31_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  int32_t start,
+  uint32_t count,
+  uint32_t fftLen,
+  int32_t shift,
+  q31_t * pDst);
+
+/**
+ * @brief  Cost of a Q31 FFT form in 1/16 MAC units.
+ * @param[in]  kernelLen   length of the kernel.
+ * @param[in]  numPoints   number of output samples.
+ * @param[in]  fftLen      FFT length.
+ * @param[in]  kernelFlag  1 to include the transform of the kernel.
+ * @return     estimated cost.
+ */
+
+static uint64_t arm_conv_fft_cost_q31(
+  uint32_t kernelLen,
+  uint32_t numPoints,
+  uint32_t fftLen,
+  uint32_t kernelFlag)
+{
+  uint32_t log2N = 0U;                           /* log2 of the FFT length */
+  uint32_t partLen, numParts, blockLen, numPairs;
+  uint64_t fft, cost;
+
+  while ((1U << log2N) < fftLen)
+  {
+    log2N++;
+  }
+
+  numParts = ARM_CONV_FFT_NUM_PARTS(kernelLen, fftLen);
+  partLen = (numParts == 1U) ? kernelLen : (fftLen / 2U);
+  blockLen = fftLen - partLen + 1U;
+  numPairs = (numPoints + (2U * blockLen) - 1U) / (2U * blockLen);
+
+  fft = (uint64_t) ARM_CONV_FFT_COST_FFT_Q31 * fftLen * log2N;
+
+  /* Per pair of blocks: one forward transform and one product per partition, one inverse transform */
+  cost = (uint64_t) numPairs * (numParts * (fft + (uint64_t) ARM_CONV_FFT_COST_MUL_Q31 * fftLen) + fft);
+
+  if (kernelFlag != 0U)
+  {
+    cost += numParts * fft;
+  }
+
+  return (cost);
+}
+
+/**
+ * @brief  Selects the cheapest Q31 FFT length, or 0 for the direct form.
+ * @param[in]  kernelLen   length of the kernel.
+ * @param[in]  numPoints   number of output samples.
+ * @param[in]  directMacs  multiply-accumulates of the direct form.
+ * @param[in]  kernelFlag  1 to include the transform of the kernel.
+ * @return     FFT length or 0.
+ */
+
+static uint16_t arm_conv_fft_select_q31(
+  uint32_t kernelLen,
+  uint32_t numPoints,
+  uint64_t directMacs,
+  uint32_t kernelFlag)
+{
+  uint64_t best = directMacs * 16U;              /* cost of the direct form */
+  uint64_t cost;
+  uint32_t fftLen;
+  uint16_t bestLen = 0U;
+
+  for (fftLen = 16U; fftLen <= 4096U; fftLen <<= 1U)
+  {
+    cost = arm_conv_fft_cost_q31(kernelLen, numPoints, fftLen, kernelFlag);
+
+    if (cost < best)
+    {
+      best = cost;
+      bestLen = (uint16_t) fftLen;
+    }
+  }
+
+  return (bestLen);
+}
+
+/**
+ * @brief  FFT length for a Q31 convolution or correlation of two sequences.
+ * @param[in]  srcALen     length of the first input sequence.
+ * @param[in]  srcBLen     length of the second input sequence.
+ * @param[in]  firstIndex  first output sample to be computed.
+ * @param[in]  numPoints   number of output samples to be computed.
+ * @return     FFT length to use, or 0 when the direct form is faster.
+ *
+ * \par
+ * Same as arm_conv_fft_len_f32(), for arm_conv_fft_q31(), arm_conv_partial_fft_q31()
+ * and arm_correlate_fft_q31().
+ */
+
+uint16_t arm_conv_fft_len_q31(
+  uint32_t srcALen,
+  uint32_t srcBLen,
+  uint32_t firstIndex,
+  uint32_t numPoints)
+{
+  uint32_t kernelLen = (srcALen < srcBLen) ? srcALen : srcBLen;
+  uint64_t directMacs;                           /* multiply-accumulates of the direct form */
+
+#if defined (ARM_MATH_DSP)
+
+  directMacs = (uint64_t) numPoints * kernelLen;
+
+  /* A full convolution needs srcALen * srcBLen multiply-accumulates at most */
+  if (directMacs > (uint64_t) srcALen * srcBLen)
+  {
+    directMacs = (uint64_t) srcALen * srcBLen;
+  }
+
+#else
+
+  /* Output sample i visits i+1 pairs */
+  directMacs = ((uint64_t) numPoints * firstIndex) + (((uint64_t) numPoints * (numPoints + 1U)) / 2U);
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  return (arm_conv_fft_select_q31(kernelLen, numPoints, directMacs, 1U));
+}
+
+/**
+ * @brief  Scratch size of the automatic Q31 FFT convolution functions.
+ * @param[in]  srcALen     length of the first input sequence.
+ * @param[in]  srcBLen     length of the second input sequence.
+ * @param[in]  firstIndex  first output sample to be computed.
+ * @param[in]  numPoints   number of output samples to be computed.
+ * @return     number of q31_t values of <code>pScratch</code>, 0 when the direct form is used.
+ */
+
+uint32_t arm_conv_fft_scratch_size_q31(
+  uint32_t srcALen,
+  uint32_t srcBLen,
+  uint32_t firstIndex,
+  uint32_t numPoints)
+{
+  uint32_t fftLen = arm_conv_fft_len_q31(srcALen, srcBLen, firstIndex, numPoints);
+  uint32_t kernelLen = (srcALen < srcBLen) ? srcALen : srcBLen;
+
+  if (fftLen == 0U)
+  {
+    return (0U);
+  }
+
+  /* Complex kernel spectra followed by the scratch of the engines */
+  return ((2U * ARM_CONV_FFT_NUM_PARTS(kernelLen, fftLen) + 4U) * fftLen);
+}
+
+/**
+ * @brief  FFT length for the streaming Q31 FFT FIR filter.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[in]  blockSize  number of samples processed per call.
+ * @return     FFT length to pass to arm_fir_fft_init_q31(), or 0 when the direct form is faster.
+ */
+
+uint16_t arm_fir_fft_len_q31(
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  return (arm_conv_fft_select_q31(numTaps, blockSize, (uint64_t) numTaps * blockSize, 0U));
+}
+
+/**
+ * @brief  Initialization function for the Q31 FFT convolution engine.
+ * @param[in,out] S            points to an instance of the Q31 FFT convolution structure.
+ * @param[in]     pKernel      points to the kernel.
+ * @param[in]     kernelLen    length of the kernel.
+ * @param[in]     reverseFlag  0 to use the kernel as stored, 1 to use it in reversed order.
+ * @param[in]     fftLen       FFT length: 16, 32, 64, 128, 256, 512, 1024, 2048 or 4096.
+ * @param[in]     pKernelFreq  points to the kernel spectra, of length 2 * ARM_CONV_FFT_NUM_PARTS(kernelLen, fftLen) * fftLen.
+ * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported
+ * or <code>kernelLen</code> is 0.
+ *
+ * <b>Description:</b>
+ * \par
+ * The partitioning is that of arm_conv_fft_init_f32(). The kernel spectra are complex and
+ * transformed in place, so no scratch buffer is needed. The kernel is scaled to full range
+ * before the transforms and the spectra are normalized together; the resulting gain is
+ * recorded in <code>postShift</code>.
+ */
+
+arm_status arm_conv_fft_init_q31(
+  arm_conv_fft_instance_q31 * S,
+  const q31_t * pKernel,
+  uint32_t kernelLen,
+  uint8_t reverseFlag,
+  uint16_t fftLen,
+  q31_t * pKernelFreq)
+{
+  uint32_t log2N = 0U;                           /* log2 of the FFT length */
+  uint32_t p;                                    /* partition counter */
+  int32_t kShift, sShift;                        /* kernel and spectra normalization shifts */
+
+  switch (fftLen)
+  {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_16)
+  case 16U:
+    S->pCfft = &arm_cfft_sR_q31_len16;
+    break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_32)
+  case 32U:
+    S->pCfft = &arm_cfft_sR_q31_len32;
+    break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_64)
+  case 64U:
+    S->pCfft = &arm_cfft_sR_q31_len64;
+    break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_128)
+  case 128U:
+    S->pCfft = &arm_cfft_sR_q31_len128;
+    break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_256)
+  case 256U:
+    S->pCfft = &arm_cfft_sR_q31_len256;
+    break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_512)
+  case 512U:
+    S->pCfft = &arm_cfft_sR_q31_len512;
+    break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_1024)
+  case 1024U:
+    S->pCfft = &arm_cfft_sR_q31_len1024;
+    break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_2048)
+  case 2048U:
+    S->pCfft = &arm_cfft_sR_q31_len2048;
+    break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_4096)
+  case 4096U:
+    S->pCfft = &arm_cfft_sR_q31_len4096;
+    break;
+#endif
+  default:
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if (kernelLen == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->kernelLen = kernelLen;
+  S->fftLen = fftLen;
+  S->numParts = (uint16_t) ARM_CONV_FFT_NUM_PARTS(kernelLen, fftLen);
+  S->partLen = (S->numParts == 1U) ? (uint16_t) kernelLen : (uint16_t) (fftLen / 2U);
+  S->blockLen = (uint16_t) (fftLen - S->partLen + 1U);
+  S->pKernelFreq = pKernelFreq;
+
+  kShift = arm_conv_fft_headroom_q31(pKernel, kernelLen, 0U, 0, kernelLen);
+
+  for (p = 0U; p < S->numParts; p++)
+  {
+    /* Zero padded partition of the kernel in the real parts */
+    arm_fill_q31(0, pKernelFreq + (2U * p * fftLen), 2U * fftLen);
+    arm_conv_fft_load_q31(pKernel, kernelLen, reverseFlag, (int32_t) (p * S->partLen), S->partLen, fftLen, kShift,
+                          pKernelFreq + (2U * p * fftLen));
+
+    arm_cfft_q31(S->pCfft, pKernelFreq + (2U * p * fftLen), 0U, 1U);
+  }
+
+  /* Common normalization of the spectra */
+  sShift = arm_conv_fft_headroom_q31(pKernelFreq, 2U * S->numParts * fftLen, 0U, 0, 2U * S->numParts * fftLen);
+  arm_shift_q31(pKernelFreq, (int8_t) sShift, pKernelFreq, 2U * S->numParts * fftLen);
+
+  while ((1U << log2N) < fftLen)
+  {
+    log2N++;
+  }
+
+  /*
+   * The forward transforms of the input and of the kernel each scale by 1/fftLen, the spectrum
+   * product is shifted right by 32 bits instead of 31, and the kernel gained kShift+sShift bits.
+   */
+  S->postShift = (int8_t) ((int32_t) (2U * log2N) + 1 - kShift - sShift);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ConvFFT group
+ */
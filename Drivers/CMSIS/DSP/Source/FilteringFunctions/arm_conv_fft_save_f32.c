@@ -0,0 +1,252 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_save_f32.c
+ * Description:  Floating-point overlap-save FFT convolution engine
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+/**
+ * @brief  Loads a zero padded window of a sequence.
+ * @param[in]  pSrc         points to the sequence.
+ * @param[in]  srcLen       length of the sequence.
+ * @param[in]  reverseFlag  0 to read the sequence as stored, 1 to read it in reversed order.
+ * @param[in]  start        index of the first sample of the window, may be negative.
+ * @param[in]  count        number of samples of the window.
+ * @param[in]  fftLen       length of the destination buffer.
+ * @param[out] pDst         points to the destination buffer.
+ *
+ * Samples outside of the sequence and the <code>fftLen - count</code> samples
+ * following the window are set to zero.
+ */
+
+void arm_conv_fft_load_f32(
+  const float32_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  int32_t start,
+  uint32_t count,
+  uint32_t fftLen,
+  float32_t * pDst)
+{
+  int32_t first = start, last = start + (int32_t) count;   /* window range */
+  const float32_t *pIn;                          /* input pointer */
+  uint32_t i, n;                                 /* loop counters */
+
+  /* Clip the window to the sequence */
+  first = (first < 0) ? 0 : first;
+  last = (last > (int32_t) srcLen) ? (int32_t) srcLen : last;
+
+  if (first >= last)
+  {
+    arm_fill_f32(0.0f, pDst, fftLen);
+    return;
+  }
+
+  /* Leading zeros */
+  n = (uint32_t) (first - start);
+  arm_fill_f32(0.0f, pDst, n);
+  pDst += n;
+
+  n = (uint32_t) (last - first);
+
+  if (reverseFlag == 0U)
+  {
+    arm_copy_f32((float32_t *) pSrc + first, pDst, n);
+  }
+  else
+  {
+    pIn = pSrc + (srcLen - 1U - (uint32_t) first);
+
+    for (i = 0U; i < n; i++)
+    {
+      pDst[i] = *pIn--;
+    }
+  }
+
+  pDst += n;
+
+  /* Trailing zeros, up to the FFT length */
+  arm_fill_f32(0.0f, pDst, fftLen - (uint32_t) (last - start));
+}
+
+/**
+ * @brief  Multiplies two spectra in the packed format of arm_rfft_fast_f32().
+ * @param[in]  pSrcA   points to the first spectrum.
+ * @param[in]  pSrcB   points to the second spectrum.
+ * @param[out] pDst    points to the product.
+ * @param[in]  fftLen  FFT length.
+ */
+
+void arm_conv_fft_mult_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t fftLen)
+{
+  /* DC and Nyquist bins are real */
+  pDst[0] = pSrcA[0] * pSrcB[0];
+  pDst[1] = pSrcA[1] * pSrcB[1];
+
+  arm_cmplx_mult_cmplx_f32(pSrcA + 2, pSrcB + 2, pDst + 2, (fftLen / 2U) - 1U);
+}
+
+/**
+ * @brief  Multiplies two spectra in the packed format of arm_rfft_fast_f32() and accumulates the product.
+ * @param[in]     pSrcA   points to the first spectrum.
+ * @param[in]     pSrcB   points to the second spectrum.
+ * @param[in,out] pAcc    points to the accumulated spectrum.
+ * @param[in]     fftLen  FFT length.
+ */
+
+void arm_conv_fft_mac_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pAcc,
+  uint32_t fftLen)
+{
+  float32_t a, b, c, d;                          /* Temporary variables to hold the bins */
+  uint32_t blkCnt = (fftLen / 2U) - 1U;          /* loop counter */
+
+  /* DC and Nyquist bins are real */
+  *pAcc++ += *pSrcA++ * *pSrcB++;
+  *pAcc++ += *pSrcA++ * *pSrcB++;
+
+  while (blkCnt > 0U)
+  {
+    /* (a + jb) * (c + jd) = (ac - bd) + j(ad + bc) */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    *pAcc++ += (a * c) - (b * d);
+    *pAcc++ += (a * d) + (b * c);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @brief  Overlap-save convolution of a sequence with the kernel of an FFT convolution instance.
+ * @param[in]  S            points to an initialized instance of the floating-point FFT convolution structure.
+ * @param[in]  pSrc         points to the input sequence.
+ * @param[in]  srcLen       length of the input sequence.
+ * @param[in]  reverseFlag  0 to use the sequence as stored, 1 to use it in reversed order.
+ * @param[in]  firstIndex   first output sample to compute.
+ * @param[in]  numPoints    number of output samples to compute.
+ * @param[out] pDst         points to the block of <code>numPoints</code> output samples.
+ * @param[in]  pScratch     points to a scratch buffer of length 3*fftLen.
+ *
+ * <b>Description:</b>
+ * \par
+ * Computes the samples <code>[firstIndex, ..., firstIndex+numPoints-1]</code> of the
+ * convolution of the input sequence with the kernel. Indices beyond the end of the
+ * full convolution give zeros. Each FFT block computes <code>blockLen</code> samples;
+ * a partitioned kernel costs one forward transform and one spectrum product per
+ * partition and block, and one inverse transform per block.
+ */
+
+void arm_conv_fft_save_f32(
+  const arm_conv_fft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  uint32_t firstIndex,
+  uint32_t numPoints,
+  float32_t * pDst,
+  float32_t * pScratch)
+{
+  arm_rfft_fast_instance_f32 rfft = S->rfft;     /* local copy of the real FFT instance */
+  uint32_t fftLen = S->fftLen;                   /* FFT length */
+  uint32_t partLen = S->partLen;                 /* kernel partition length */
+  float32_t *pWin = pScratch;                    /* input window and inverse transform output */
+  float32_t *pSpec = pScratch + fftLen;          /* spectrum of the input window */
+  float32_t *pAcc = pScratch + (2U * fftLen);    /* accumulated spectrum */
+  uint32_t n0 = firstIndex;                      /* first output sample of the block */
+  uint32_t cnt, p, used;                         /* block size, partition counter, partitions used */
+  int32_t start;                                 /* first input sample of the window */
+
+  while (numPoints > 0U)
+  {
+    cnt = (numPoints < S->blockLen) ? numPoints : S->blockLen;
+    used = 0U;
+
+    for (p = 0U; p < S->numParts; p++)
+    {
+      /* Window of partLen-1 past samples followed by the block */
+      start = (int32_t) n0 - (int32_t) (p * partLen) - (int32_t) (partLen - 1U);
+
+      /* Skip partitions whose window lies outside of the input sequence */
+      if ((start >= (int32_t) srcLen) || ((start + (int32_t) (partLen - 1U + cnt)) <= 0))
+      {
+        continue;
+      }
+
+      arm_conv_fft_load_f32(pSrc, srcLen, reverseFlag, start, partLen - 1U + cnt, fftLen, pWin);
+      arm_rfft_fast_f32(&rfft, pWin, pSpec, 0U);
+
+      if (used == 0U)
+      {
+        arm_conv_fft_mult_f32(pSpec, S->pKernelFreq + (p * fftLen), pAcc, fftLen);
+      }
+      else
+      {
+        arm_conv_fft_mac_f32(pSpec, S->pKernelFreq + (p * fftLen), pAcc, fftLen);
+      }
+
+      used++;
+    }
+
+    if (used == 0U)
+    {
+      arm_fill_f32(0.0f, pDst, cnt);
+    }
+    else
+    {
+      /* The first partLen-1 samples of the circular convolution are aliased */
+      arm_rfft_fast_f32(&rfft, pAcc, pWin, 1U);
+      arm_copy_f32(pWin + (partLen - 1U), pDst, cnt);
+    }
+
+    pDst += cnt;
+    n0 += cnt;
+    numPoints -= cnt;
+  }
+}
+
+/**
+ * @} end of ConvFFT group
+ */
@@ -0,0 +1,339 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_save_q31.c
+ * Description:  Q31 overlap-save FFT convolution engine
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+/**
+ * @brief  Headroom of a window of a sequence.
+ * @param[in]  pSrc         points to the sequence.
+ * @param[in]  srcLen       length of the sequence.
+ * @param[in]  reverseFlag  0 for the sequence as stored, 1 for the sequence in reversed order.
+ * @param[in]  start        index of the first sample of the window, may be negative.
+ * @param[in]  count        number of samples of the window.
+ * @return     left shift which brings the largest magnitude of the window in [2^29, 2^30), 0 for an all zero window.
+ */
+
+int32_t arm_conv_fft_headroom_q31(
+  const q31_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  int32_t start,
+  uint32_t count)
+{
+  int32_t first = start, last = start + (int32_t) count;   /* window range */
+  uint32_t mask = 0U;                            /* OR of the magnitudes */
+  q31_t in;                                      /* Temporary variable to hold the input */
+  uint32_t i;                                    /* loop counter */
+
+  /* Clip the window to the sequence, the reversed window is contiguous too */
+  first = (first < 0) ? 0 : first;
+  last = (last > (int32_t) srcLen) ? (int32_t) srcLen : last;
+
+  if (reverseFlag != 0U)
+  {
+    i = (uint32_t) first;
+    first = (int32_t) srcLen - last;
+    last = (int32_t) srcLen - (int32_t) i;
+  }
+
+  for (i = (uint32_t) first; (int32_t) i < last; i++)
+  {
+    /* The OR of the magnitudes has the same leading bit as their maximum */
+    in = pSrc[i];
+    mask |= (uint32_t) ((in > 0) ? in : (q31_t)__QSUB(0, in));
+  }
+
+  return ((mask == 0U) ? 0 : ((int32_t) __CLZ(mask) - 2));
+}
+
+/**
+ * @brief  Loads one lane of a complex buffer with a zero padded, shifted window of a sequence.
+ * @param[in]  pSrc         points to the sequence.
+ * @param[in]  srcLen       length of the sequence.
+ * @param[in]  reverseFlag  0 to read the sequence as stored, 1 to read it in reversed order.
+ * @param[in]  start        index of the first sample of the window, may be negative.
+ * @param[in]  count        number of samples of the window.
+ * @param[in]  fftLen       number of complex samples of the destination buffer.
+ * @param[in]  shift        left shift (right shift when negative) applied to the samples.
+ * @param[out] pDst         points to the real (imaginary) part of the first complex sample.
+ *
+ * Samples outside of the sequence and the <code>fftLen - count</code> samples
+ * following the window are set to zero.
+ */
+
+void arm_conv_fft_load_q31(
+  const q31_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  int32_t start,
+  uint32_t count,
+  uint32_t fftLen,
+  int32_t shift,
+  q31_t * pDst)
+{
+  int32_t n;                                     /* index in the sequence */
+  q31_t in;                                      /* Temporary variable to hold the input */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0U; i < fftLen; i++)
+  {
+    n = start + (int32_t) i;
+    in = 0;
+
+    if ((i < count) && (n >= 0) && (n < (int32_t) srcLen))
+    {
+      in = (reverseFlag == 0U) ? pSrc[n] : pSrc[srcLen - 1U - (uint32_t) n];
+      in = (shift >= 0) ? (in << shift) : (in >> -shift);
+    }
+
+    *pDst = in;
+    pDst += 2U;
+  }
+}
+
+/**
+ * @brief  Headroom of a complex buffer.
+ * @param[in]  pSrc    points to the buffer.
+ * @param[in]  fftLen  number of complex samples.
+ * @return     left shift which brings the largest magnitude in [2^29, 2^30), 0 for an all zero buffer.
+ */
+
+int32_t arm_conv_fft_norm_q31(
+  const q31_t * pSrc,
+  uint32_t fftLen)
+{
+  return (arm_conv_fft_headroom_q31(pSrc, 2U * fftLen, 0U, 0, 2U * fftLen));
+}
+
+/**
+ * @brief  Multiplies two complex spectra and accumulates the product.
+ * @param[in]     pSrcA     points to the first spectrum.
+ * @param[in]     pSrcB     points to the second spectrum.
+ * @param[in,out] pAcc      points to the accumulated spectrum.
+ * @param[in]     fftLen    number of complex samples.
+ * @param[in]     shift     right shift applied to the 2.62 products, at least 32.
+ * @param[in]     accFlag   0 to overwrite <code>pAcc</code>, 1 to add the product to it with saturation.
+ */
+
+void arm_conv_fft_mac_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pAcc,
+  uint32_t fftLen,
+  uint32_t shift,
+  uint32_t accFlag)
+{
+  q31_t a, b, c, d;                              /* Temporary variables to hold the bins */
+  q31_t re, im;                                  /* product */
+  uint32_t blkCnt = fftLen;                      /* loop counter */
+
+  while (blkCnt > 0U)
+  {
+    /* (a + jb) * (c + jd) = (ac - bd) + j(ad + bc) */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    re = (q31_t) ((((q63_t) a * c) - ((q63_t) b * d)) >> shift);
+    im = (q31_t) ((((q63_t) a * d) + ((q63_t) b * c)) >> shift);
+
+    if (accFlag != 0U)
+    {
+      re = __QADD(pAcc[0], re);
+      im = __QADD(pAcc[1], im);
+    }
+
+    *pAcc++ = re;
+    *pAcc++ = im;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @brief  Stores one lane of a complex buffer with rounding and saturation.
+ * @param[in]     pSrc      points to the real (imaginary) part of the first complex sample.
+ * @param[in]     shift     left shift (right shift when negative) applied to the samples.
+ * @param[in,out] pDst      points to the output samples.
+ * @param[in]     count     number of samples.
+ * @param[in]     accFlag   0 to overwrite <code>pDst</code>, 1 to add the samples to it with saturation.
+ */
+
+void arm_conv_fft_store_q31(
+  const q31_t * pSrc,
+  int32_t shift,
+  q31_t * pDst,
+  uint32_t count,
+  uint32_t accFlag)
+{
+  q63_t in;                                      /* Temporary variable to hold the input */
+  q31_t out;                                     /* Temporary variable to hold the output */
+
+  /* Larger left shifts saturate every non zero sample, larger right shifts clear it */
+  shift = (shift > 32) ? 32 : ((shift < -63) ? -63 : shift);
+
+  while (count > 0U)
+  {
+    in = *pSrc;
+    pSrc += 2U;
+
+    if (shift >= 0)
+    {
+      out = clip_q63_to_q31(in << shift);
+    }
+    else
+    {
+      out = (q31_t) ((in + ((q63_t) 1 << (-shift - 1))) >> -shift);
+    }
+
+    *pDst = (accFlag != 0U) ? __QADD(*pDst, out) : out;
+    pDst++;
+
+    count--;
+  }
+}
+
+/**
+ * @brief  Overlap-save convolution of a sequence with the kernel of a Q31 FFT convolution instance.
+ * @param[in]  S            points to an initialized instance of the Q31 FFT convolution structure.
+ * @param[in]  pSrc         points to the input sequence.
+ * @param[in]  srcLen       length of the input sequence.
+ * @param[in]  reverseFlag  0 to use the sequence as stored, 1 to use it in reversed order.
+ * @param[in]  firstIndex   first output sample to compute.
+ * @param[in]  numPoints    number of output samples to compute.
+ * @param[out] pDst         points to the block of <code>numPoints</code> output samples.
+ * @param[in]  pScratch     points to a scratch buffer of length 4*fftLen.
+ *
+ * <b>Description:</b>
+ * \par
+ * Computes the samples <code>[firstIndex, ..., firstIndex+numPoints-1]</code> of the
+ * convolution of the input sequence with the kernel, in the 1.31 format of arm_conv_q31().
+ * Two consecutive blocks of <code>blockLen</code> samples are carried by the real and imaginary
+ * parts of the same complex transforms.
+ * \par
+ * The input windows of a block pair are shifted to the same headroom before the forward
+ * transforms, and the accumulated spectrum is normalized again before the inverse transform;
+ * the output is shifted back with rounding and saturation.
+ */
+
+void arm_conv_fft_save_q31(
+  const arm_conv_fft_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  uint32_t firstIndex,
+  uint32_t numPoints,
+  q31_t * pDst,
+  q31_t * pScratch)
+{
+  uint32_t fftLen = S->fftLen;                   /* FFT length */
+  uint32_t partLen = S->partLen;                 /* kernel partition length */
+  uint32_t histLen = partLen - 1U;               /* past samples of a window */
+  q31_t *pWin = pScratch;                        /* input windows */
+  q31_t *pAcc = pScratch + (2U * fftLen);        /* accumulated spectrum */
+  uint32_t mulShift = 32U;                       /* right shift of the products */
+  uint32_t n0 = firstIndex;                      /* first output sample of the block pair */
+  uint32_t cnt1, cnt2, p, used;                  /* block sizes, partition counter, partitions used */
+  int32_t start, xShift, zShift, outShift;       /* first input sample of the window, normalization and output shifts */
+
+  /* Headroom for the sum of the partitions */
+  for (p = 1U; p < S->numParts; p <<= 1U)
+  {
+    mulShift++;
+  }
+
+  while (numPoints > 0U)
+  {
+    cnt1 = (numPoints < S->blockLen) ? numPoints : S->blockLen;
+    cnt2 = ((numPoints - cnt1) < S->blockLen) ? (numPoints - cnt1) : S->blockLen;
+    used = 0U;
+
+    /* Common shift of all the windows of the block pair */
+    start = (int32_t) n0 - (int32_t) ((S->numParts - 1U) * partLen) - (int32_t) histLen;
+    xShift = arm_conv_fft_headroom_q31(pSrc, srcLen, reverseFlag, start,
+                                       (uint32_t) ((int32_t) (n0 + cnt1 + cnt2) - start));
+
+    for (p = 0U; p < S->numParts; p++)
+    {
+      /* Window of partLen-1 past samples followed by the two blocks */
+      start = (int32_t) n0 - (int32_t) (p * partLen) - (int32_t) histLen;
+
+      /* Skip partitions whose window lies outside of the input sequence */
+      if ((start >= (int32_t) srcLen) || ((start + (int32_t) (histLen + cnt1 + cnt2)) <= 0))
+      {
+        continue;
+      }
+
+      arm_conv_fft_load_q31(pSrc, srcLen, reverseFlag, start, histLen + cnt1, fftLen, xShift, pWin);
+      arm_conv_fft_load_q31(pSrc, srcLen, reverseFlag, start + (int32_t) cnt1, (cnt2 == 0U) ? 0U : (histLen + cnt2),
+                            fftLen, xShift, pWin + 1);
+
+      arm_cfft_q31(S->pCfft, pWin, 0U, 1U);
+
+      arm_conv_fft_mac_q31(pWin, S->pKernelFreq + (2U * p * fftLen), pAcc, fftLen, mulShift, used);
+
+      used = 1U;
+    }
+
+    if (used == 0U)
+    {
+      arm_fill_q31(0, pDst, cnt1 + cnt2);
+    }
+    else
+    {
+      zShift = arm_conv_fft_norm_q31(pAcc, fftLen);
+      arm_shift_q31(pAcc, (int8_t) zShift, pAcc, 2U * fftLen);
+
+      arm_cfft_q31(S->pCfft, pAcc, 1U, 1U);
+
+      /* The first partLen-1 samples of the circular convolution are aliased */
+      outShift = (int32_t) S->postShift + (int32_t) (mulShift - 32U) - xShift - zShift;
+      arm_conv_fft_store_q31(pAcc + (2U * histLen), outShift, pDst, cnt1, 0U);
+      arm_conv_fft_store_q31(pAcc + (2U * histLen) + 1U, outShift, pDst + cnt1, cnt2, 0U);
+    }
+
+    pDst += cnt1 + cnt2;
+    n0 += cnt1 + cnt2;
+    numPoints -= cnt1 + cnt2;
+  }
+}
+
+/**
+ * @} end of ConvFFT group
+ */
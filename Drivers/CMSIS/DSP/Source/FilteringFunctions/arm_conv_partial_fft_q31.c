@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_partial_fft_q31.c
+ * Description:  Q31 partial FFT convolution
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+extern void arm_conv_fft_save_q31(
+  const arm_conv_fft_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  uint32_t firstIndex,
+  uint32_t numPoints,
+  q31_t * pDst,
+  q31_t * pScratch);
+
+/**
+ * @brief Partial convolution of Q31 sequences using the FFT when faster.
+ * @param[in]  pSrcA       points to the first input sequence.
+ * @param[in]  srcALen     length of the first input sequence.
+ * @param[in]  pSrcB       points to the second input sequence.
+ * @param[in]  srcBLen     length of the second input sequence.
+ * @param[out] pDst        points to the location where the output result is written.
+ * @param[in]  firstIndex  is the first output sample to start with.
+ * @param[in]  numPoints   is the number of output points to be computed.
+ * @param[in]  pScratch    points to a scratch buffer of length arm_conv_fft_scratch_size_q31(srcALen, srcBLen, firstIndex, numPoints).
+ * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+ *
+ * As for arm_conv_partial_q31(), the output samples are written to <code>pDst[firstIndex]</code>
+ * to <code>pDst[firstIndex+numPoints-1]</code>.
+ */
+
+arm_status arm_conv_partial_fft_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst,
+  uint32_t firstIndex,
+  uint32_t numPoints,
+  q31_t * pScratch)
+{
+  arm_conv_fft_instance_q31 S;                   /* FFT convolution instance */
+  q31_t *pKernel = pSrcB, *pIn = pSrcA;          /* kernel and input sequence */
+  uint32_t kernelLen = srcBLen, srcLen = srcALen;
+  uint16_t fftLen;                               /* FFT length, 0 for the direct form */
+
+  /* Check for range of output samples to be calculated */
+  if ((firstIndex + numPoints) > ((srcALen + (srcBLen - 1U))))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  fftLen = arm_conv_fft_len_q31(srcALen, srcBLen, firstIndex, numPoints);
+
+  if (fftLen == 0U)
+  {
+    return (arm_conv_partial_q31(pSrcA, srcALen, pSrcB, srcBLen, pDst, firstIndex, numPoints));
+  }
+
+  /* The shorter sequence is the kernel */
+  if (srcALen < srcBLen)
+  {
+    pKernel = pSrcA;
+    kernelLen = srcALen;
+    pIn = pSrcB;
+    srcLen = srcBLen;
+  }
+
+  arm_conv_fft_init_q31(&S, pKernel, kernelLen, 0U, fftLen, pScratch);
+
+  arm_conv_fft_save_q31(&S, pIn, srcLen, 0U, firstIndex, numPoints, pDst + firstIndex,
+                        pScratch + (2U * ARM_CONV_FFT_NUM_PARTS(kernelLen, fftLen) * fftLen));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ConvFFT group
+ */
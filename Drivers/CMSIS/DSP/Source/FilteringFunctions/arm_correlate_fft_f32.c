@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_correlate_fft_f32.c
+ * Description:  Floating-point FFT correlation
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+extern void arm_conv_fft_add_f32(
+  const arm_conv_fft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  float32_t * pDst,
+  float32_t * pScratch);
+
+/**
+ * @brief Correlation of floating-point sequences using the FFT when faster.
+ * @param[in]  pSrcA     points to the first input sequence.
+ * @param[in]  srcALen   length of the first input sequence.
+ * @param[in]  pSrcB     points to the second input sequence.
+ * @param[in]  srcBLen   length of the second input sequence.
+ * @param[out] pDst      points to the location where the output result is written.  Length 2 * max(srcALen, srcBLen) - 1.
+ * @param[in]  pScratch  points to a scratch buffer of length arm_conv_fft_scratch_size_f32(srcALen, srcBLen, 0, srcALen+srcBLen-1).
+ * @return none.
+ *
+ * The output is that of arm_correlate_f32(): the correlation is the convolution of
+ * <code>pSrcA</code> with <code>pSrcB</code> in reversed order, placed at the offset
+ * <code>srcALen-srcBLen</code> when <code>srcALen > srcBLen</code>. When the FFT is used the
+ * remaining output samples are set to zero.
+ */
+
+void arm_correlate_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  float32_t * pScratch)
+{
+  arm_conv_fft_instance_f32 S;                   /* FFT convolution instance */
+  uint32_t outLen;                               /* length of the output sequence */
+  uint32_t numParts;                             /* number of kernel partitions */
+  float32_t *pWork;                              /* scratch of the engine */
+  uint16_t fftLen = arm_conv_fft_len_f32(srcALen, srcBLen, 0U, srcALen + srcBLen - 1U);
+
+  if (fftLen == 0U)
+  {
+    arm_correlate_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+    return;
+  }
+
+  outLen = (2U * ((srcALen > srcBLen) ? srcALen : srcBLen)) - 1U;
+  arm_fill_f32(0.0f, pDst, outLen);
+
+  if (srcBLen <= srcALen)
+  {
+    /* Kernel: reversed B, input: A */
+    numParts = ARM_CONV_FFT_NUM_PARTS(srcBLen, fftLen);
+    pWork = pScratch + (numParts * fftLen);
+
+    arm_conv_fft_init_f32(&S, pSrcB, srcBLen, 1U, fftLen, pScratch, pWork);
+    arm_conv_fft_add_f32(&S, pSrcA, srcALen, 0U, pDst + (srcALen - srcBLen), pWork);
+  }
+  else
+  {
+    /* Kernel: A, input: reversed B */
+    numParts = ARM_CONV_FFT_NUM_PARTS(srcALen, fftLen);
+    pWork = pScratch + (numParts * fftLen);
+
+    arm_conv_fft_init_f32(&S, pSrcA, srcALen, 0U, fftLen, pScratch, pWork);
+    arm_conv_fft_add_f32(&S, pSrcB, srcBLen, 1U, pDst, pWork);
+  }
+}
+
+/**
+ * @} end of ConvFFT group
+ */
@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_correlate_fft_q31.c
+ * Description:  Q31 FFT correlation
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+extern void arm_conv_fft_add_q31(
+  const arm_conv_fft_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  q31_t * pDst,
+  q31_t * pScratch);
+
+/**
+ * @brief Correlation of Q31 sequences using the FFT when faster.
+ * @param[in]  pSrcA     points to the first input sequence.
+ * @param[in]  srcALen   length of the first input sequence.
+ * @param[in]  pSrcB     points to the second input sequence.
+ * @param[in]  srcBLen   length of the second input sequence.
+ * @param[out] pDst      points to the location where the output result is written.  Length 2 * max(srcALen, srcBLen) - 1.
+ * @param[in]  pScratch  points to a scratch buffer of length arm_conv_fft_scratch_size_q31(srcALen, srcBLen, 0, srcALen+srcBLen-1).
+ * @return none.
+ *
+ * The output is that of arm_correlate_q31(): the correlation is the convolution of
+ * <code>pSrcA</code> with <code>pSrcB</code> in reversed order, placed at the offset
+ * <code>srcALen-srcBLen</code> when <code>srcALen > srcBLen</code>. When the FFT is used the
+ * remaining output samples are set to zero.
+ */
+
+void arm_correlate_fft_q31(
+  q31_t * pSrcA,
+  uint32_t srcALen,
+  q31_t * pSrcB,
+  uint32_t srcBLen,
+  q31_t * pDst,
+  q31_t * pScratch)
+{
+  arm_conv_fft_instance_q31 S;                   /* FFT convolution instance */
+  uint32_t outLen;                               /* length of the output sequence */
+  uint32_t numParts;                             /* number of kernel partitions */
+  q31_t *pWork;                                  /* scratch of the engine */
+  uint16_t fftLen = arm_conv_fft_len_q31(srcALen, srcBLen, 0U, srcALen + srcBLen - 1U);
+
+  if (fftLen == 0U)
+  {
+    arm_correlate_q31(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+    return;
+  }
+
+  outLen = (2U * ((srcALen > srcBLen) ? srcALen : srcBLen)) - 1U;
+  arm_fill_q31(0, pDst, outLen);
+
+  if (srcBLen <= srcALen)
+  {
+    /* Kernel: reversed B, input: A */
+    numParts = ARM_CONV_FFT_NUM_PARTS(srcBLen, fftLen);
+    pWork = pScratch + (2U * numParts * fftLen);
+
+    arm_conv_fft_init_q31(&S, pSrcB, srcBLen, 1U, fftLen, pScratch);
+    arm_conv_fft_add_q31(&S, pSrcA, srcALen, 0U, pDst + (srcALen - srcBLen), pWork);
+  }
+  else
+  {
+    /* Kernel: A, input: reversed B */
+    numParts = ARM_CONV_FFT_NUM_PARTS(srcALen, fftLen);
+    pWork = pScratch + (2U * numParts * fftLen);
+
+    arm_conv_fft_init_q31(&S, pSrcA, srcALen, 0U, fftLen, pScratch);
+    arm_conv_fft_add_q31(&S, pSrcB, srcBLen, 1U, pDst, pWork);
+  }
+}
+
+/**
+ * @} end of ConvFFT group
+ */
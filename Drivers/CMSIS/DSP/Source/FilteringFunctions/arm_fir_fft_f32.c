@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_f32.c
+ * Description:  Floating-point FFT FIR filter processing function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+extern void arm_conv_fft_save_f32(
+  const arm_conv_fft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t srcLen,
+  uint8_t reverseFlag,
+  uint32_t firstIndex,
+  uint32_t numPoints,
+  float32_t * pDst,
+  float32_t * pScratch);
+
+/**
+ * @brief Processing function for the floating-point FFT FIR filter.
+ * @param[in]  S          points to an instance of the floating-point FFT FIR filter structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[out] pDst       points to the block of output data.
+ * @param[in]  blockSize  number of samples to process, at most the block size given to arm_fir_fft_init_f32().
+ * @return none.
+ *
+ * The output is that of arm_fir_f32() up to rounding. The last <code>numTaps-1</code>
+ * input samples are kept in the state buffer, and each block is computed with the
+ * overlap-save engine.
+ */
+
+void arm_fir_fft_f32(
+  const arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* state pointer */
+  uint32_t histLen = S->numTaps - 1U;            /* number of past input samples */
+
+  if (S->fftLen == 0U)
+  {
+    arm_fir_f32(&S->fir, pSrc, pDst, blockSize);
+    return;
+  }
+
+  /* Append the new samples to the past input samples */
+  arm_copy_f32(pSrc, pState + histLen, blockSize);
+
+  /* Outputs of the block are samples numTaps-1 ... of the convolution with the state */
+  arm_conv_fft_save_f32(&S->conv, pState, histLen + blockSize, 0U, histLen, blockSize, pDst, S->pScratch);
+
+  /* Keep the last numTaps-1 samples for the next call */
+  arm_copy_f32(pState + blockSize, pState, histLen);
+}
+
+/**
+ * @} end of ConvFFT group
+ */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_init_q31.c
+ * Description:  Q31 FFT FIR filter initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 FFT FIR filter.
+ * @param[in,out] S            points to an instance of the Q31 FFT FIR filter structure.
+ * @param[in]     numTaps      number of filter coefficients in the filter.
+ * @param[in]     pCoeffs      points to the filter coefficients buffer, in time reversed order as for arm_fir_init_q31().
+ * @param[in]     pState       points to the state buffer of length numTaps+blockSize-1.
+ * @param[in]     blockSize    maximum number of samples that are processed per call.
+ * @param[in]     fftLen       FFT length, as returned by arm_fir_fft_len_q31(); 0 selects arm_fir_q31().
+ * @param[in]     pKernelFreq  points to the kernel spectra, of length 2 * ARM_CONV_FFT_NUM_PARTS(numTaps, fftLen) * fftLen.
+ * @param[in]     pScratch     points to a scratch buffer of length 4*fftLen.
+ * @return        ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not supported.
+ *
+ * <b>Description:</b>
+ * \par
+ * The coefficients are only read during initialization when the FFT is used;
+ * <code>pKernelFreq</code> and <code>pScratch</code> are not used when <code>fftLen</code> is 0.
+ * The state buffer is cleared.
+ */
+
+arm_status arm_fir_fft_init_q31(
+  arm_fir_fft_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize,
+  uint16_t fftLen,
+  q31_t * pKernelFreq,
+  q31_t * pScratch)
+{
+  arm_status status = ARM_MATH_SUCCESS;          /* status of the initialization */
+
+  S->numTaps = numTaps;
+  S->fftLen = fftLen;
+  S->pState = pState;
+  S->pScratch = pScratch;
+
+  /* Direct form instance, also clears the state buffer */
+  arm_fir_init_q31(&S->fir, numTaps, pCoeffs, pState, blockSize);
+
+  if (fftLen != 0U)
+  {
+    /* The coefficients are stored time reversed */
+    status = arm_conv_fft_init_q31(&S->conv, pCoeffs, numTaps, 1U, fftLen, pKernelFreq);
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of ConvFFT group
+ */
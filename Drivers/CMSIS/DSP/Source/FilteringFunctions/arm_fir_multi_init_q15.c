@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_multi_init_q15.c
+ * Description:  Q15 multi-channel FIR filter initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 multi-channel FIR filter.
+ * @param[in,out] S            points to an instance of the Q15 multi-channel FIR structure.
+ * @param[in]     numTaps      number of filter coefficients in the filter.
+ * @param[in]     numChannels  number of channels.
+ * @param[in]     pCoeffs      points to the filter coefficient buffer.
+ * @param[in]     pState       points to the state buffer.
+ * @param[in]     blockSize    number of frames to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numTaps</code> or <code>numChannels</code> is 0.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+ * as for arm_fir_init_q15(). All the channels use these coefficients:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], ..., b[1], b[0]}
+ * </pre>
+ * Unlike arm_fir_q15(), any number of taps is supported.
+ * \par
+ * <code>pState</code> points to the array of state variables, which holds interleaved frames.
+ * <code>pState</code> is of length <code>numChannels*(numTaps+blockSize-1)</code> words
+ * where <code>blockSize</code> is the number of frames processed by each call to
+ * <code>arm_fir_multi_q15()</code> or <code>arm_fir_multi_planar_q15()</code>.
+ */
+
+arm_status arm_fir_multi_init_q15(
+  arm_fir_multi_instance_q15 * S,
+  uint16_t numTaps,
+  uint16_t numChannels,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize)
+{
+  arm_status status;
+
+  if ((numTaps == 0U) || (numChannels == 0U))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign filter taps, channels and coefficient pointer */
+    S->numTaps = numTaps;
+    S->numChannels = numChannels;
+    S->pCoeffs = pCoeffs;
+
+    /* Clear the state buffer. The size is always numChannels*(blockSize + numTaps - 1) */
+    memset(pState, 0, (uint32_t) numChannels * (numTaps + (blockSize - 1U)) * sizeof(q15_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,283 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_multi_q15.c
+ * Description:  Q15 multi-channel FIR filter processing functions
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief  Computes the output samples of the Q15 multi-channel FIR filter from the state buffer.
+ * @param[in]  S            points to an instance of the Q15 multi-channel FIR structure.
+ * @param[out] pDst         points to the first output sample of the first channel.
+ * @param[in]  chanStride   distance between the output samples of two consecutive channels.
+ * @param[in]  frameStride  distance between two consecutive output samples of a channel.
+ * @param[in]  blockSize    number of frames to process.
+ * @return none.
+ *
+ * The state buffer holds interleaved frames. The channels are processed in pairs, so that each
+ * coefficient is loaded once for two channels.
+ */
+
+static void arm_fir_multi_kernel_q15(
+  const arm_fir_multi_instance_q15 * S,
+  q15_t * pDst,
+  uint32_t chanStride,
+  uint32_t frameStride,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pFrame;                                 /* Points to the first state frame of the current output */
+  q15_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  q15_t *pOut;                                   /* Points to the output sample of the current channel */
+  q63_t acc0, acc1;                              /* Accumulators of two channels */
+  q31_t c;                                       /* Coefficient */
+  uint32_t numTaps = S->numTaps;                 /* Number of taps in the filter */
+  uint32_t numCh = S->numChannels;               /* Number of channels */
+  uint32_t n, ch, tapCnt;                        /* Loop counters */
+
+#if defined (ARM_MATH_DSP) && !defined (ARM_MATH_BIG_ENDIAN)
+
+  q31_t x0, x1;                                  /* Samples of two channels in two consecutive frames */
+
+#endif
+
+  for (n = 0U; n < blockSize; n++)
+  {
+    pFrame = pState + (n * numCh);
+    ch = 0U;
+
+    /* Channel pairs */
+    while ((ch + 1U) < numCh)
+    {
+      acc0 = 0;
+      acc1 = 0;
+      px = pFrame + ch;
+      pb = pCoeffs;
+
+#if defined (ARM_MATH_DSP) && !defined (ARM_MATH_BIG_ENDIAN)
+
+      /* Two taps at a time: the samples of each channel in two frames are packed
+       * to match the coefficient pair */
+      tapCnt = numTaps >> 1U;
+
+      while (tapCnt > 0U)
+      {
+        /* Read the coefficients b[k] and b[k+1] */
+        c = *__SIMD32(pb)++;
+
+        /* Read the samples of both channels in frames k and k+1 */
+        x0 = _SIMD32_OFFSET(px);
+        x1 = _SIMD32_OFFSET(px + numCh);
+
+        /* acc0 += b[k] * x0[k] + b[k+1] * x0[k+1] */
+        acc0 = __SMLALD(__PKHBT(x0, x1, 16), c, acc0);
+
+        /* acc1 += b[k] * x1[k] + b[k+1] * x1[k+1] */
+        acc1 = __SMLALD(__PKHTB(x1, x0, 16), c, acc1);
+
+        px += 2U * numCh;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* If the filter length is odd, compute the last tap */
+      tapCnt = numTaps & 0x1U;
+
+#else
+
+      tapCnt = numTaps;
+
+#endif /* #if defined (ARM_MATH_DSP) && !defined (ARM_MATH_BIG_ENDIAN) */
+
+      while (tapCnt > 0U)
+      {
+        /* The coefficient is loaded once for both channels */
+        c = *pb++;
+
+        acc0 += (q31_t) px[0] * c;
+        acc1 += (q31_t) px[1] * c;
+
+        px += numCh;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* Store the results in 1.15 format */
+      pOut = pDst + (ch * chanStride) + (n * frameStride);
+      pOut[0] = (q15_t) (__SSAT((acc0 >> 15), 16));
+      pOut[chanStride] = (q15_t) (__SSAT((acc1 >> 15), 16));
+
+      ch += 2U;
+    }
+
+    /* Last channel when the number of channels is odd */
+    if (ch < numCh)
+    {
+      acc0 = 0;
+      px = pFrame + ch;
+      pb = pCoeffs;
+      tapCnt = numTaps;
+
+      while (tapCnt > 0U)
+      {
+        acc0 += (q31_t) *px * *pb++;
+
+        px += numCh;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      pDst[(ch * chanStride) + (n * frameStride)] = (q15_t) (__SSAT((acc0 >> 15), 16));
+    }
+  }
+}
+
+/**
+ * @brief  Moves the last <code>numTaps-1</code> frames to the start of the state buffer.
+ * @param[in]  S          points to an instance of the Q15 multi-channel FIR structure.
+ * @param[in]  blockSize  number of frames processed.
+ * @return none.
+ */
+
+static void arm_fir_multi_update_state_q15(
+  const arm_fir_multi_instance_q15 * S,
+  uint32_t blockSize)
+{
+  q15_t *pStateCurnt = S->pState;                /* Points to the start of the state buffer */
+  q15_t *px;                                     /* Points to the last numTaps-1 frames */
+  uint32_t i;                                    /* Loop counter */
+
+  px = S->pState + (blockSize * S->numChannels);
+
+  /* The regions may overlap; the copy goes forward from the higher address */
+  i = ((uint32_t) S->numTaps - 1U) * S->numChannels;
+
+  while (i > 0U)
+  {
+    *pStateCurnt++ = *px++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+}
+
+/**
+ * @brief Processing function for the Q15 multi-channel FIR filter on interleaved data.
+ * @param[in]  S          points to an instance of the Q15 multi-channel FIR structure.
+ * @param[in]  pSrc       points to the block of input frames, <code>numChannels</code> interleaved samples each.
+ * @param[out] pDst       points to the block of output frames, <code>numChannels</code> interleaved samples each.
+ * @param[in]  blockSize  number of frames to process per call.
+ * @return none.
+ *
+ * \par
+ * Each channel is filtered as by arm_fir_q15() with the coefficients of the instance, and the
+ * results are the same. Channel <code>c</code> of frame <code>n</code> is at <code>pSrc[n*numChannels+c]</code>.
+ * The channels are filtered in pairs: each coefficient is loaded once for two channels,
+ * where arm_fir_q15() loads it once per channel. With the DSP extension, two consecutive
+ * samples of each channel are packed from the frames for dual multiply-accumulates.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator.
+ * Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+ * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
+ * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+ * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+ */
+
+void arm_fir_multi_q15(
+  const arm_fir_multi_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t numCh = S->numChannels;               /* Number of channels */
+
+  /* The new frames follow the numTaps-1 previous frames in the state buffer */
+  arm_copy_q15(pSrc, S->pState + (((uint32_t) S->numTaps - 1U) * numCh), blockSize * numCh);
+
+  arm_fir_multi_kernel_q15(S, pDst, 1U, numCh, blockSize);
+
+  arm_fir_multi_update_state_q15(S, blockSize);
+}
+
+/**
+ * @brief Processing function for the Q15 multi-channel FIR filter on planar data.
+ * @param[in]  S          points to an instance of the Q15 multi-channel FIR structure.
+ * @param[in]  pSrc       points to the input blocks of the channels, one after the other.
+ * @param[out] pDst       points to the output blocks of the channels, one after the other.
+ * @param[in]  blockSize  number of samples per channel to process per call.
+ * @return none.
+ *
+ * \par
+ * Same as arm_fir_multi_q15(), with sample <code>n</code> of channel <code>c</code> at
+ * <code>pSrc[c*blockSize+n]</code>. The input is interleaved into the state buffer.
+ */
+
+void arm_fir_multi_planar_q15(
+  const arm_fir_multi_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *pIn = pSrc;                             /* Source pointer */
+  uint32_t numCh = S->numChannels;               /* Number of channels */
+  uint32_t ch, i;                                /* Loop counters */
+
+  for (ch = 0U; ch < numCh; ch++)
+  {
+    pStateCurnt = S->pState + (((uint32_t) S->numTaps - 1U) * numCh) + ch;
+
+    for (i = 0U; i < blockSize; i++)
+    {
+      *pStateCurnt = *pIn++;
+      pStateCurnt += numCh;
+    }
+  }
+
+  arm_fir_multi_kernel_q15(S, pDst, blockSize, 1U, blockSize);
+
+  arm_fir_multi_update_state_q15(S, blockSize);
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,267 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_f32.c
+ * Description:  Floating-point FIR rational resampler processing function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Rational Resampler
+ *
+ * These functions change the sample rate of a signal by the rational factor <code>L/M</code>,
+ * for example 160/147 from 44.1 kHz to 48 kHz.
+ * Conceptually, they are equivalent to an FIR interpolator followed by a decimator:
+ * the signal is upsampled by <code>L</code> (zero stuffing), filtered by a lowpass filter with a
+ * normalized cutoff frequency of <code>min(1/L, 1/M)</code>, and every <code>M</code>-th sample is kept.
+ * The user of the function is responsible for providing the filter coefficients.
+ *
+ * Cascading arm_fir_interpolate_f32() and arm_fir_decimate_f32() computes <code>L</code> outputs per input
+ * sample and discards <code>M-1</code> out of <code>M</code> of them.
+ * The resampler instead computes only the outputs which are kept, each with the single polyphase
+ * component of the filter which is aligned with it, so the cost is reduced by a factor of <code>M</code>.
+ * The functions operate on blocks of input and output data.
+ * <code>pSrc</code> points to an array of <code>blockSize</code> input values and
+ * <code>pDst</code> points to an array of <code>blockSize*L/M</code> output values.
+ * <code>blockSize</code> must be a multiple of <code>M</code>, so that every block produces the
+ * same number of outputs.
+ *
+ * The library provides separate functions for Q15, Q31, and floating-point data types.
+ *
+ * \par Algorithm:
+ * Output <code>y[m]</code> is sample <code>j = m*M</code> of the upsampled and filtered signal,
+ * which is the output of arm_fir_decimate_f32() with a single unit coefficient applied to the output
+ * of arm_fir_interpolate_f32(). With <code>p = j % L</code> and <code>n = j / L</code>:
+ * <pre>
+ *    y[m] = b[p] * x[n] + b[L+p] * x[n-1] + ... + b[L*(phaseLength-1)+p] * x[n-phaseLength+1]
+ * </pre>
+ * The polyphase index <code>p</code> and the input index <code>n</code> advance by <code>M % L</code>
+ * and <code>M / L</code> from one output to the next. <code>L</code> and <code>M</code> should not
+ * have common factors, otherwise some polyphase components are never used.
+ * \par
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>, stored in time reversed order
+ * as for the FIR interpolator.
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * <code>numTaps</code> must be a multiple of the interpolation factor <code>L</code>; the filter is
+ * divided into <code>L</code> polyphase components of length <code>phaseLength = numTaps/L</code>.
+ * As for the interpolator, the filter gain should be <code>L</code> to preserve the signal level.
+ * \par
+ * <code>pState</code> points to a state array of size <code>blockSize + phaseLength - 1</code>.
+ * Samples in the state buffer are stored in the order:
+ * \par
+ * <pre>
+ *    {x[n-phaseLength+1], x[n-phaseLength], x[n-phaseLength-1], x[n-phaseLength-2]....x[0], x[1], ..., x[blockSize-1]}
+ * </pre>
+ * The state variables are updated after each block of data is processed, the coefficients are untouched.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a filter are stored together in an instance data structure.
+ * A separate instance structure must be defined for each filter.
+ * Coefficient arrays may be shared among several instances while state variable array should be allocated separately.
+ * There are separate instance structure declarations for each of the 3 supported data types.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ * - Checks to make sure that the length of the filter is a multiple of the interpolation factor,
+ *   and that the block size is a multiple of the decimation factor.
+ * To do this manually without calling the init function, assign the follow subfields of the instance structure:
+ * L (interpolation factor), M (decimation factor), phaseLength (numTaps / L), pCoeffs, pState.
+ * Also set all of the values in pState to zero.
+ *
+ * \par
+ * Use of the initialization function is optional.
+ * However, if the initialization function is used, then the instance structure cannot be placed into a const data section.
+ * To place an instance structure into a const data section, the instance structure must be manually initialized.
+ * The code below statically initializes each of the 3 different data type filter instance structures
+ * <pre>
+ * arm_fir_resample_instance_f32 S = {L, M, phaseLength, pCoeffs, pState};
+ * arm_fir_resample_instance_q31 S = {L, M, phaseLength, pCoeffs, pState};
+ * arm_fir_resample_instance_q15 S = {L, M, phaseLength, pCoeffs, pState};
+ * </pre>
+ * Be sure to set the values in the state buffer to zeros when doing static initialization.
+ *
+ * \par Fixed-Point Behavior
+ * Care must be taken when using the fixed-point versions of the FIR resampler functions.
+ * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.
+ * Refer to the function specific documentation below for usage guidelines.
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point FIR rational resampler.
+ * @param[in]  S          points to an instance of the floating-point FIR resampler structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[out] pDst       points to the block of output data, of length blockSize*L/M.
+ * @param[in]  blockSize  number of input samples to process per call, a multiple of M.
+ * @return none.
+ */
+
+void arm_fir_resample_f32(
+  const arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t sum0;                                /* Accumulator */
+  uint32_t L = S->L;                             /* Interpolation factor */
+  uint32_t M = S->M;                             /* Decimation factor */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t phase, offset;                        /* Polyphase component and state offset of the current output */
+  uint32_t i, blkCnt, tapCnt;                    /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1U);
+
+  /* Copy the new input samples into the state buffer */
+  i = blockSize;
+
+  while (i > 0U)
+  {
+    *pStateCurnt++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+
+  /* The first output of the block is the first sample of the upsampled block */
+  phase = 0U;
+  offset = 0U;
+
+  /* Total number of output samples */
+  blkCnt = (blockSize * L) / M;
+
+  while (blkCnt > 0U)
+  {
+    /* Set accumulator to zero */
+    sum0 = 0.0f;
+
+    /* Initialize state pointer */
+    px = pState + offset;
+
+    /* Initialize coefficient pointer to the polyphase component of the output */
+    pb = pCoeffs + (L - 1U - phase);
+
+#if defined (ARM_MATH_DSP)
+
+    /* Loop over the polyPhase length. Unroll by a factor of 4. */
+    tapCnt = phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulates */
+      sum0 += px[0] * pb[0];
+      sum0 += px[1] * pb[L];
+      sum0 += px[2] * pb[2U * L];
+      sum0 += px[3] * pb[3U * L];
+
+      /* Update the state and coefficient pointers */
+      px += 4U;
+      pb += 4U * L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyPhase length is not a multiple of 4, compute the remaining filter taps */
+    tapCnt = phaseLen % 0x4U;
+
+#else
+
+    /* Loop over the polyPhase length */
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulate */
+      sum0 += *px++ * *pb;
+
+      /* Increment the coefficient pointer by interpolation factor times. */
+      pb += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* The result is in the accumulator, store in the destination buffer. */
+    *pDst++ = sum0;
+
+    /* Advance by M upsampled samples: M / L input samples and M % L polyphase components */
+    offset += M / L;
+    phase += M % L;
+
+    if (phase >= L)
+    {
+      phase -= L;
+      offset++;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Points to the last phaseLen - 1 samples */
+  px = pState + blockSize;
+
+  i = phaseLen - 1U;
+
+  while (i > 0U)
+  {
+    *pStateCurnt++ = *px++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,191 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q15.c
+ * Description:  Q15 FIR rational resampler processing function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 FIR rational resampler.
+ * @param[in]  S          points to an instance of the Q15 FIR resampler structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[out] pDst       points to the block of output data, of length blockSize*L/M.
+ * @param[in]  blockSize  number of input samples to process per call, a multiple of M.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator.
+ * Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+ * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
+ * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+ * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+ */
+
+void arm_fir_resample_q15(
+  const arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  q63_t sum0;                                    /* Accumulator */
+  uint32_t L = S->L;                             /* Interpolation factor */
+  uint32_t M = S->M;                             /* Decimation factor */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t phase, offset;                        /* Polyphase component and state offset of the current output */
+  uint32_t i, blkCnt, tapCnt;                    /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1U);
+
+  /* Copy the new input samples into the state buffer */
+  i = blockSize;
+
+  while (i > 0U)
+  {
+    *pStateCurnt++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+
+  /* The first output of the block is the first sample of the upsampled block */
+  phase = 0U;
+  offset = 0U;
+
+  /* Total number of output samples */
+  blkCnt = (blockSize * L) / M;
+
+  while (blkCnt > 0U)
+  {
+    /* Set accumulator to zero */
+    sum0 = 0;
+
+    /* Initialize state pointer */
+    px = pState + offset;
+
+    /* Initialize coefficient pointer to the polyphase component of the output */
+    pb = pCoeffs + (L - 1U - phase);
+
+#if defined (ARM_MATH_DSP)
+
+    /* Loop over the polyPhase length. Unroll by a factor of 4. */
+    tapCnt = phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulates */
+      sum0 += (q31_t) px[0] * pb[0];
+      sum0 += (q31_t) px[1] * pb[L];
+      sum0 += (q31_t) px[2] * pb[2U * L];
+      sum0 += (q31_t) px[3] * pb[3U * L];
+
+      /* Update the state and coefficient pointers */
+      px += 4U;
+      pb += 4U * L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyPhase length is not a multiple of 4, compute the remaining filter taps */
+    tapCnt = phaseLen % 0x4U;
+
+#else
+
+    /* Loop over the polyPhase length */
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulate */
+      sum0 += (q31_t) *px++ * *pb;
+
+      /* Increment the coefficient pointer by interpolation factor times. */
+      pb += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* Store the result after converting to 1.15 format in the destination buffer */
+    *pDst++ = (q15_t) (__SSAT((sum0 >> 15), 16));
+
+    /* Advance by M upsampled samples: M / L input samples and M % L polyphase components */
+    offset += M / L;
+    phase += M % L;
+
+    if (phase >= L)
+    {
+      phase -= L;
+      offset++;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Points to the last phaseLen - 1 samples */
+  px = pState + blockSize;
+
+  i = phaseLen - 1U;
+
+  while (i > 0U)
+  {
+    *pStateCurnt++ = *px++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,191 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q31.c
+ * Description:  Q31 FIR rational resampler processing function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 FIR rational resampler.
+ * @param[in]  S          points to an instance of the Q31 FIR resampler structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[out] pDst       points to the block of output data, of length blockSize*L/M.
+ * @param[in]  blockSize  number of input samples to process per call, a multiple of M.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using an internal 64-bit accumulator.
+ * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+ * Thus, if the accumulator result overflows it wraps around rather than clip.
+ * In order to avoid overflows completely the input signal must be scaled down by <code>1/(numTaps/L)</code>.
+ * since <code>numTaps/L</code> additions occur per output sample.
+ * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.31 format.
+ */
+
+void arm_fir_resample_q31(
+  const arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q31_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  q63_t sum0;                                    /* Accumulator */
+  uint32_t L = S->L;                             /* Interpolation factor */
+  uint32_t M = S->M;                             /* Decimation factor */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t phase, offset;                        /* Polyphase component and state offset of the current output */
+  uint32_t i, blkCnt, tapCnt;                    /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1U);
+
+  /* Copy the new input samples into the state buffer */
+  i = blockSize;
+
+  while (i > 0U)
+  {
+    *pStateCurnt++ = *pSrc++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+
+  /* The first output of the block is the first sample of the upsampled block */
+  phase = 0U;
+  offset = 0U;
+
+  /* Total number of output samples */
+  blkCnt = (blockSize * L) / M;
+
+  while (blkCnt > 0U)
+  {
+    /* Set accumulator to zero */
+    sum0 = 0;
+
+    /* Initialize state pointer */
+    px = pState + offset;
+
+    /* Initialize coefficient pointer to the polyphase component of the output */
+    pb = pCoeffs + (L - 1U - phase);
+
+#if defined (ARM_MATH_DSP)
+
+    /* Loop over the polyPhase length. Unroll by a factor of 4. */
+    tapCnt = phaseLen >> 2U;
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulates */
+      sum0 += (q63_t) px[0] * pb[0];
+      sum0 += (q63_t) px[1] * pb[L];
+      sum0 += (q63_t) px[2] * pb[2U * L];
+      sum0 += (q63_t) px[3] * pb[3U * L];
+
+      /* Update the state and coefficient pointers */
+      px += 4U;
+      pb += 4U * L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyPhase length is not a multiple of 4, compute the remaining filter taps */
+    tapCnt = phaseLen % 0x4U;
+
+#else
+
+    /* Loop over the polyPhase length */
+    tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (tapCnt > 0U)
+    {
+      /* Perform the multiply-accumulate */
+      sum0 += (q63_t) *px++ * *pb;
+
+      /* Increment the coefficient pointer by interpolation factor times. */
+      pb += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* The result is in 2.62 format. Convert to 1.31 and store in the destination buffer. */
+    *pDst++ = (q31_t) (sum0 >> 31);
+
+    /* Advance by M upsampled samples: M / L input samples and M % L polyphase components */
+    offset += M / L;
+    phase += M % L;
+
+    if (phase >= L)
+    {
+      phase -= L;
+      offset++;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Points to the last phaseLen - 1 samples */
+  px = pState + blockSize;
+
+  i = phaseLen - 1U;
+
+  while (i > 0U)
+  {
+    *pStateCurnt++ = *px++;
+
+    /* Decrement the loop counter */
+    i--;
+  }
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
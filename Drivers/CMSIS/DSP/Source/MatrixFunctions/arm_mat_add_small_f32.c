@@ -0,0 +1,263 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_add_small_f32.c
+ * Description:  Fixed-size floating-point matrix addition
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixAdd
+ * @{
+ */
+
+/**
+ * @brief Floating-point 2x2 matrix addition.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which may be one of the inputs.
+ * @return none.
+ */
+
+void arm_mat_add_2x2_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  pDst[0] = pSrcA[0] + pSrcB[0];
+  pDst[1] = pSrcA[1] + pSrcB[1];
+  pDst[2] = pSrcA[2] + pSrcB[2];
+  pDst[3] = pSrcA[3] + pSrcB[3];
+}
+
+/**
+ * @brief Floating-point 3x3 matrix addition.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which may be one of the inputs.
+ * @return none.
+ */
+
+void arm_mat_add_3x3_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  pDst[0] = pSrcA[0] + pSrcB[0];
+  pDst[1] = pSrcA[1] + pSrcB[1];
+  pDst[2] = pSrcA[2] + pSrcB[2];
+  pDst[3] = pSrcA[3] + pSrcB[3];
+  pDst[4] = pSrcA[4] + pSrcB[4];
+  pDst[5] = pSrcA[5] + pSrcB[5];
+  pDst[6] = pSrcA[6] + pSrcB[6];
+  pDst[7] = pSrcA[7] + pSrcB[7];
+  pDst[8] = pSrcA[8] + pSrcB[8];
+}
+
+/**
+ * @brief Floating-point 4x4 matrix addition.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which may be one of the inputs.
+ * @return none.
+ */
+
+void arm_mat_add_4x4_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  pDst[0] = pSrcA[0] + pSrcB[0];
+  pDst[1] = pSrcA[1] + pSrcB[1];
+  pDst[2] = pSrcA[2] + pSrcB[2];
+  pDst[3] = pSrcA[3] + pSrcB[3];
+  pDst[4] = pSrcA[4] + pSrcB[4];
+  pDst[5] = pSrcA[5] + pSrcB[5];
+  pDst[6] = pSrcA[6] + pSrcB[6];
+  pDst[7] = pSrcA[7] + pSrcB[7];
+  pDst[8] = pSrcA[8] + pSrcB[8];
+  pDst[9] = pSrcA[9] + pSrcB[9];
+  pDst[10] = pSrcA[10] + pSrcB[10];
+  pDst[11] = pSrcA[11] + pSrcB[11];
+  pDst[12] = pSrcA[12] + pSrcB[12];
+  pDst[13] = pSrcA[13] + pSrcB[13];
+  pDst[14] = pSrcA[14] + pSrcB[14];
+  pDst[15] = pSrcA[15] + pSrcB[15];
+}
+
+/**
+ * @brief Floating-point 5x5 matrix addition.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which may be one of the inputs.
+ * @return none.
+ */
+
+void arm_mat_add_5x5_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  pDst[0] = pSrcA[0] + pSrcB[0];
+  pDst[1] = pSrcA[1] + pSrcB[1];
+  pDst[2] = pSrcA[2] + pSrcB[2];
+  pDst[3] = pSrcA[3] + pSrcB[3];
+  pDst[4] = pSrcA[4] + pSrcB[4];
+  pDst[5] = pSrcA[5] + pSrcB[5];
+  pDst[6] = pSrcA[6] + pSrcB[6];
+  pDst[7] = pSrcA[7] + pSrcB[7];
+  pDst[8] = pSrcA[8] + pSrcB[8];
+  pDst[9] = pSrcA[9] + pSrcB[9];
+  pDst[10] = pSrcA[10] + pSrcB[10];
+  pDst[11] = pSrcA[11] + pSrcB[11];
+  pDst[12] = pSrcA[12] + pSrcB[12];
+  pDst[13] = pSrcA[13] + pSrcB[13];
+  pDst[14] = pSrcA[14] + pSrcB[14];
+  pDst[15] = pSrcA[15] + pSrcB[15];
+  pDst[16] = pSrcA[16] + pSrcB[16];
+  pDst[17] = pSrcA[17] + pSrcB[17];
+  pDst[18] = pSrcA[18] + pSrcB[18];
+  pDst[19] = pSrcA[19] + pSrcB[19];
+  pDst[20] = pSrcA[20] + pSrcB[20];
+  pDst[21] = pSrcA[21] + pSrcB[21];
+  pDst[22] = pSrcA[22] + pSrcB[22];
+  pDst[23] = pSrcA[23] + pSrcB[23];
+  pDst[24] = pSrcA[24] + pSrcB[24];
+}
+
+/**
+ * @brief Floating-point 6x6 matrix addition.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which may be one of the inputs.
+ * @return none.
+ */
+
+void arm_mat_add_6x6_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  pDst[0] = pSrcA[0] + pSrcB[0];
+  pDst[1] = pSrcA[1] + pSrcB[1];
+  pDst[2] = pSrcA[2] + pSrcB[2];
+  pDst[3] = pSrcA[3] + pSrcB[3];
+  pDst[4] = pSrcA[4] + pSrcB[4];
+  pDst[5] = pSrcA[5] + pSrcB[5];
+  pDst[6] = pSrcA[6] + pSrcB[6];
+  pDst[7] = pSrcA[7] + pSrcB[7];
+  pDst[8] = pSrcA[8] + pSrcB[8];
+  pDst[9] = pSrcA[9] + pSrcB[9];
+  pDst[10] = pSrcA[10] + pSrcB[10];
+  pDst[11] = pSrcA[11] + pSrcB[11];
+  pDst[12] = pSrcA[12] + pSrcB[12];
+  pDst[13] = pSrcA[13] + pSrcB[13];
+  pDst[14] = pSrcA[14] + pSrcB[14];
+  pDst[15] = pSrcA[15] + pSrcB[15];
+  pDst[16] = pSrcA[16] + pSrcB[16];
+  pDst[17] = pSrcA[17] + pSrcB[17];
+  pDst[18] = pSrcA[18] + pSrcB[18];
+  pDst[19] = pSrcA[19] + pSrcB[19];
+  pDst[20] = pSrcA[20] + pSrcB[20];
+  pDst[21] = pSrcA[21] + pSrcB[21];
+  pDst[22] = pSrcA[22] + pSrcB[22];
+  pDst[23] = pSrcA[23] + pSrcB[23];
+  pDst[24] = pSrcA[24] + pSrcB[24];
+  pDst[25] = pSrcA[25] + pSrcB[25];
+  pDst[26] = pSrcA[26] + pSrcB[26];
+  pDst[27] = pSrcA[27] + pSrcB[27];
+  pDst[28] = pSrcA[28] + pSrcB[28];
+  pDst[29] = pSrcA[29] + pSrcB[29];
+  pDst[30] = pSrcA[30] + pSrcB[30];
+  pDst[31] = pSrcA[31] + pSrcB[31];
+  pDst[32] = pSrcA[32] + pSrcB[32];
+  pDst[33] = pSrcA[33] + pSrcB[33];
+  pDst[34] = pSrcA[34] + pSrcB[34];
+  pDst[35] = pSrcA[35] + pSrcB[35];
+}
+
+/**
+ * @brief Floating-point matrix addition, using the fixed-size kernels for small matrices.
+ * @param[in]  pSrcA  points to the first input matrix structure.
+ * @param[in]  pSrcB  points to the second input matrix structure.
+ * @param[out] pDst   points to output matrix structure.
+ * @return The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * Square matrices of 2x2 to 6x6 elements are added by arm_mat_add_2x2_f32() to
+ * arm_mat_add_6x6_f32(), whose loops are fully unrolled. Other sizes are passed to
+ * arm_mat_add_f32().
+ */
+
+arm_status arm_mat_add_small_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  uint16_t n = pSrcA->numRows;                   /* Size of the square matrices */
+
+  /* One size check selects the kernel */
+  if ((pSrcA->numCols == n) && (pSrcB->numRows == n) && (pSrcB->numCols == n) &&
+      (pDst->numRows == n) && (pDst->numCols == n))
+  {
+    switch (n)
+    {
+    case 2U:
+      arm_mat_add_2x2_f32(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 3U:
+      arm_mat_add_3x3_f32(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 4U:
+      arm_mat_add_4x4_f32(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 5U:
+      arm_mat_add_5x5_f32(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 6U:
+      arm_mat_add_6x6_f32(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    default:
+      break;
+    }
+  }
+
+  /* Other sizes use the generic function */
+  return (arm_mat_add_f32(pSrcA, pSrcB, pDst));
+}
+
+/**
+ * @} end of MatrixAdd group
+ */
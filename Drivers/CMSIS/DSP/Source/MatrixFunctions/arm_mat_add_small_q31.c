@@ -0,0 +1,267 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_add_small_q31.c
+ * Description:  Fixed-size Q31 matrix addition
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixAdd
+ * @{
+ */
+
+/**
+ * @brief Q31 2x2 matrix addition.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which may be one of the inputs.
+ * @return none.
+ */
+
+void arm_mat_add_2x2_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst)
+{
+  pDst[0] = __QADD(pSrcA[0], pSrcB[0]);
+  pDst[1] = __QADD(pSrcA[1], pSrcB[1]);
+  pDst[2] = __QADD(pSrcA[2], pSrcB[2]);
+  pDst[3] = __QADD(pSrcA[3], pSrcB[3]);
+}
+
+/**
+ * @brief Q31 3x3 matrix addition.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which may be one of the inputs.
+ * @return none.
+ */
+
+void arm_mat_add_3x3_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst)
+{
+  pDst[0] = __QADD(pSrcA[0], pSrcB[0]);
+  pDst[1] = __QADD(pSrcA[1], pSrcB[1]);
+  pDst[2] = __QADD(pSrcA[2], pSrcB[2]);
+  pDst[3] = __QADD(pSrcA[3], pSrcB[3]);
+  pDst[4] = __QADD(pSrcA[4], pSrcB[4]);
+  pDst[5] = __QADD(pSrcA[5], pSrcB[5]);
+  pDst[6] = __QADD(pSrcA[6], pSrcB[6]);
+  pDst[7] = __QADD(pSrcA[7], pSrcB[7]);
+  pDst[8] = __QADD(pSrcA[8], pSrcB[8]);
+}
+
+/**
+ * @brief Q31 4x4 matrix addition.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which may be one of the inputs.
+ * @return none.
+ */
+
+void arm_mat_add_4x4_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst)
+{
+  pDst[0] = __QADD(pSrcA[0], pSrcB[0]);
+  pDst[1] = __QADD(pSrcA[1], pSrcB[1]);
+  pDst[2] = __QADD(pSrcA[2], pSrcB[2]);
+  pDst[3] = __QADD(pSrcA[3], pSrcB[3]);
+  pDst[4] = __QADD(pSrcA[4], pSrcB[4]);
+  pDst[5] = __QADD(pSrcA[5], pSrcB[5]);
+  pDst[6] = __QADD(pSrcA[6], pSrcB[6]);
+  pDst[7] = __QADD(pSrcA[7], pSrcB[7]);
+  pDst[8] = __QADD(pSrcA[8], pSrcB[8]);
+  pDst[9] = __QADD(pSrcA[9], pSrcB[9]);
+  pDst[10] = __QADD(pSrcA[10], pSrcB[10]);
+  pDst[11] = __QADD(pSrcA[11], pSrcB[11]);
+  pDst[12] = __QADD(pSrcA[12], pSrcB[12]);
+  pDst[13] = __QADD(pSrcA[13], pSrcB[13]);
+  pDst[14] = __QADD(pSrcA[14], pSrcB[14]);
+  pDst[15] = __QADD(pSrcA[15], pSrcB[15]);
+}
+
+/**
+ * @brief Q31 5x5 matrix addition.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which may be one of the inputs.
+ * @return none.
+ */
+
+void arm_mat_add_5x5_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst)
+{
+  pDst[0] = __QADD(pSrcA[0], pSrcB[0]);
+  pDst[1] = __QADD(pSrcA[1], pSrcB[1]);
+  pDst[2] = __QADD(pSrcA[2], pSrcB[2]);
+  pDst[3] = __QADD(pSrcA[3], pSrcB[3]);
+  pDst[4] = __QADD(pSrcA[4], pSrcB[4]);
+  pDst[5] = __QADD(pSrcA[5], pSrcB[5]);
+  pDst[6] = __QADD(pSrcA[6], pSrcB[6]);
+  pDst[7] = __QADD(pSrcA[7], pSrcB[7]);
+  pDst[8] = __QADD(pSrcA[8], pSrcB[8]);
+  pDst[9] = __QADD(pSrcA[9], pSrcB[9]);
+  pDst[10] = __QADD(pSrcA[10], pSrcB[10]);
+  pDst[11] = __QADD(pSrcA[11], pSrcB[11]);
+  pDst[12] = __QADD(pSrcA[12], pSrcB[12]);
+  pDst[13] = __QADD(pSrcA[13], pSrcB[13]);
+  pDst[14] = __QADD(pSrcA[14], pSrcB[14]);
+  pDst[15] = __QADD(pSrcA[15], pSrcB[15]);
+  pDst[16] = __QADD(pSrcA[16], pSrcB[16]);
+  pDst[17] = __QADD(pSrcA[17], pSrcB[17]);
+  pDst[18] = __QADD(pSrcA[18], pSrcB[18]);
+  pDst[19] = __QADD(pSrcA[19], pSrcB[19]);
+  pDst[20] = __QADD(pSrcA[20], pSrcB[20]);
+  pDst[21] = __QADD(pSrcA[21], pSrcB[21]);
+  pDst[22] = __QADD(pSrcA[22], pSrcB[22]);
+  pDst[23] = __QADD(pSrcA[23], pSrcB[23]);
+  pDst[24] = __QADD(pSrcA[24], pSrcB[24]);
+}
+
+/**
+ * @brief Q31 6x6 matrix addition.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which may be one of the inputs.
+ * @return none.
+ */
+
+void arm_mat_add_6x6_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst)
+{
+  pDst[0] = __QADD(pSrcA[0], pSrcB[0]);
+  pDst[1] = __QADD(pSrcA[1], pSrcB[1]);
+  pDst[2] = __QADD(pSrcA[2], pSrcB[2]);
+  pDst[3] = __QADD(pSrcA[3], pSrcB[3]);
+  pDst[4] = __QADD(pSrcA[4], pSrcB[4]);
+  pDst[5] = __QADD(pSrcA[5], pSrcB[5]);
+  pDst[6] = __QADD(pSrcA[6], pSrcB[6]);
+  pDst[7] = __QADD(pSrcA[7], pSrcB[7]);
+  pDst[8] = __QADD(pSrcA[8], pSrcB[8]);
+  pDst[9] = __QADD(pSrcA[9], pSrcB[9]);
+  pDst[10] = __QADD(pSrcA[10], pSrcB[10]);
+  pDst[11] = __QADD(pSrcA[11], pSrcB[11]);
+  pDst[12] = __QADD(pSrcA[12], pSrcB[12]);
+  pDst[13] = __QADD(pSrcA[13], pSrcB[13]);
+  pDst[14] = __QADD(pSrcA[14], pSrcB[14]);
+  pDst[15] = __QADD(pSrcA[15], pSrcB[15]);
+  pDst[16] = __QADD(pSrcA[16], pSrcB[16]);
+  pDst[17] = __QADD(pSrcA[17], pSrcB[17]);
+  pDst[18] = __QADD(pSrcA[18], pSrcB[18]);
+  pDst[19] = __QADD(pSrcA[19], pSrcB[19]);
+  pDst[20] = __QADD(pSrcA[20], pSrcB[20]);
+  pDst[21] = __QADD(pSrcA[21], pSrcB[21]);
+  pDst[22] = __QADD(pSrcA[22], pSrcB[22]);
+  pDst[23] = __QADD(pSrcA[23], pSrcB[23]);
+  pDst[24] = __QADD(pSrcA[24], pSrcB[24]);
+  pDst[25] = __QADD(pSrcA[25], pSrcB[25]);
+  pDst[26] = __QADD(pSrcA[26], pSrcB[26]);
+  pDst[27] = __QADD(pSrcA[27], pSrcB[27]);
+  pDst[28] = __QADD(pSrcA[28], pSrcB[28]);
+  pDst[29] = __QADD(pSrcA[29], pSrcB[29]);
+  pDst[30] = __QADD(pSrcA[30], pSrcB[30]);
+  pDst[31] = __QADD(pSrcA[31], pSrcB[31]);
+  pDst[32] = __QADD(pSrcA[32], pSrcB[32]);
+  pDst[33] = __QADD(pSrcA[33], pSrcB[33]);
+  pDst[34] = __QADD(pSrcA[34], pSrcB[34]);
+  pDst[35] = __QADD(pSrcA[35], pSrcB[35]);
+}
+
+/**
+ * @brief Q31 matrix addition, using the fixed-size kernels for small matrices.
+ * @param[in]  pSrcA  points to the first input matrix structure.
+ * @param[in]  pSrcB  points to the second input matrix structure.
+ * @param[out] pDst   points to output matrix structure.
+ * @return The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * Square matrices of 2x2 to 6x6 elements are added by arm_mat_add_2x2_q31() to
+ * arm_mat_add_6x6_q31(), whose loops are fully unrolled. Other sizes are passed to
+ * arm_mat_add_q31().
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function uses saturating arithmetic, as arm_mat_add_q31() does.
+ */
+
+arm_status arm_mat_add_small_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst)
+{
+  uint16_t n = pSrcA->numRows;                   /* Size of the square matrices */
+
+  /* One size check selects the kernel */
+  if ((pSrcA->numCols == n) && (pSrcB->numRows == n) && (pSrcB->numCols == n) &&
+      (pDst->numRows == n) && (pDst->numCols == n))
+  {
+    switch (n)
+    {
+    case 2U:
+      arm_mat_add_2x2_q31(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 3U:
+      arm_mat_add_3x3_q31(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 4U:
+      arm_mat_add_4x4_q31(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 5U:
+      arm_mat_add_5x5_q31(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 6U:
+      arm_mat_add_6x6_q31(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    default:
+      break;
+    }
+  }
+
+  /* Other sizes use the generic function */
+  return (arm_mat_add_q31(pSrcA, pSrcB, pDst));
+}
+
+/**
+ * @} end of MatrixAdd group
+ */
@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_f32.c
+ * Description:  Floating-point Cholesky decomposition
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixChol Cholesky Decomposition
+ *
+ * Computes the Cholesky decomposition of a symmetric positive definite matrix.
+ *
+ * The decomposition is the lower triangular matrix <code>L</code> with a positive diagonal such that
+ * <pre>
+ *     A = L * L<sup>T</sup>
+ * </pre>
+ * It is used to solve the linear systems of covariance matrices, as in Kalman filters, at half the
+ * cost of an inverse. Only the lower triangle of the input matrix is read, and the upper triangle
+ * of the output matrix is cleared.
+ *
+ * \par Algorithm
+ * The Cholesky-Banachiewicz algorithm computes the output column by column:
+ * <pre>
+ *     L[j][j] = sqrt(A[j][j] - sum(L[j][k] * L[j][k], k = 0...j-1))
+ *     L[i][j] = (A[i][j] - sum(L[i][k] * L[j][k], k = 0...j-1)) / L[j][j],  for i > j
+ * </pre>
+ * If a term under a square root is not positive, the input matrix is not positive definite and the
+ * functions return <code>ARM_MATH_SINGULAR</code>.
+ * The output matrix may be the input matrix.
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point Cholesky decomposition.
+ * @param[in]  pSrc  points to the instance of the input matrix structure.
+ * @param[out] pDst  points to the instance of the output matrix structure.
+ * @return The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions do not match,
+ * <code>ARM_MATH_SINGULAR</code> if the input matrix is not positive definite and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* Input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* Output data matrix pointer */
+  float32_t *pRowI, *pRowJ;                      /* Rows of the output matrix */
+  float32_t sum, inv;                            /* Accumulator and inverse of the diagonal term */
+  uint16_t n = pSrc->numRows;                    /* Size of the matrices */
+  uint32_t i, j, k;                              /* Loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols) ||
+      (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  for (j = 0U; j < n; j++)
+  {
+    pRowJ = pOut + (j * n);
+
+    /* Diagonal term */
+    sum = pIn[(j * n) + j];
+
+    for (k = 0U; k < j; k++)
+    {
+      sum -= pRowJ[k] * pRowJ[k];
+    }
+
+    if (sum <= 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    arm_sqrt_f32(sum, &pRowJ[j]);
+    inv = 1.0f / pRowJ[j];
+
+    /* Terms below the diagonal */
+    for (i = j + 1U; i < n; i++)
+    {
+      pRowI = pOut + (i * n);
+      sum = pIn[(i * n) + j];
+
+      for (k = 0U; k < j; k++)
+      {
+        sum -= pRowI[k] * pRowJ[k];
+      }
+
+      pRowI[j] = sum * inv;
+    }
+  }
+
+  /* The upper triangle is cleared */
+  for (i = 0U; i < n; i++)
+  {
+    for (j = i + 1U; j < n; j++)
+    {
+      pOut[(i * n) + j] = 0.0f;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_q31.c
+ * Description:  Q31 Cholesky decomposition
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Q31 Cholesky decomposition.
+ * @param[in]  pSrc  points to the instance of the input matrix structure.
+ * @param[out] pDst  points to the instance of the output matrix structure.
+ * @return The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions do not match,
+ * <code>ARM_MATH_SINGULAR</code> if the input matrix is not positive definite and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sums of products are accumulated in 2.62 format, from which the diagonal terms are truncated
+ * to 1.31 format before their square root. The terms below the diagonal are the 64-bit quotients
+ * of the sums by the diagonal term, truncated and saturated to 1.31 format.
+ * The magnitude of the output terms is less than the square root of the diagonal input terms,
+ * so that the accumulations do not overflow.
+ * A diagonal term which truncates to 0 makes the function return <code>ARM_MATH_SINGULAR</code>.
+ */
+
+arm_status arm_mat_cholesky_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst)
+{
+  q31_t *pIn = pSrc->pData;                      /* Input data matrix pointer */
+  q31_t *pOut = pDst->pData;                     /* Output data matrix pointer */
+  q31_t *pRowI, *pRowJ;                          /* Rows of the output matrix */
+  q63_t acc;                                     /* Accumulator */
+  q31_t d;                                       /* Diagonal term */
+  uint16_t n = pSrc->numRows;                    /* Size of the matrices */
+  uint32_t i, j, k;                              /* Loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols) ||
+      (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  for (j = 0U; j < n; j++)
+  {
+    pRowJ = pOut + (j * n);
+
+    /* Diagonal term */
+    acc = (q63_t) pIn[(j * n) + j] << 31;
+
+    for (k = 0U; k < j; k++)
+    {
+      acc -= (q63_t) pRowJ[k] * pRowJ[k];
+    }
+
+    d = clip_q63_to_q31(acc >> 31);
+
+    if (d <= 0)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    arm_sqrt_q31(d, &pRowJ[j]);
+
+    /* Terms below the diagonal */
+    for (i = j + 1U; i < n; i++)
+    {
+      pRowI = pOut + (i * n);
+      acc = (q63_t) pIn[(i * n) + j] << 31;
+
+      for (k = 0U; k < j; k++)
+      {
+        acc -= (q63_t) pRowI[k] * pRowJ[k];
+      }
+
+      pRowI[j] = clip_q63_to_q31(acc / pRowJ[j]);
+    }
+  }
+
+  /* The upper triangle is cleared */
+  for (i = 0U; i < n; i++)
+  {
+    for (j = i + 1U; j < n; j++)
+    {
+      pOut[(i * n) + j] = 0;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,483 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_small_f32.c
+ * Description:  Fixed-size floating-point Cholesky decomposition
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point 2x2 Cholesky decomposition.
+ * @param[in]  pSrc  points to the symmetric positive definite input matrix, stored row by row.
+ * @param[out] pDst  points to the lower triangular output matrix, which may be the input.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the input matrix is not
+ * positive definite, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_cholesky_2x2_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t l00, l10, l11;                       /* Lower triangle of the output */
+  float32_t d, inv;                              /* Diagonal term and its inverse */
+
+  /* Column 0 */
+  d = pSrc[0];
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l00);
+  inv = 1.0f / l00;
+
+  l10 = pSrc[2] * inv;
+
+  /* Column 1 */
+  d = pSrc[3] - (l10 * l10);
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l11);
+
+  /* Output, with the upper triangle cleared */
+  pDst[0] = l00; pDst[1] = 0.0f;
+  pDst[2] = l10; pDst[3] = l11;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Floating-point 3x3 Cholesky decomposition.
+ * @param[in]  pSrc  points to the symmetric positive definite input matrix, stored row by row.
+ * @param[out] pDst  points to the lower triangular output matrix, which may be the input.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the input matrix is not
+ * positive definite, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_cholesky_3x3_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t l00, l10, l11, l20, l21, l22;        /* Lower triangle of the output */
+  float32_t d, inv;                              /* Diagonal term and its inverse */
+
+  /* Column 0 */
+  d = pSrc[0];
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l00);
+  inv = 1.0f / l00;
+
+  l10 = pSrc[3] * inv;
+  l20 = pSrc[6] * inv;
+
+  /* Column 1 */
+  d = pSrc[4] - (l10 * l10);
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l11);
+  inv = 1.0f / l11;
+
+  l21 = (pSrc[7] - (l20 * l10)) * inv;
+
+  /* Column 2 */
+  d = pSrc[8] - (l20 * l20) - (l21 * l21);
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l22);
+
+  /* Output, with the upper triangle cleared */
+  pDst[0] = l00; pDst[1] = 0.0f; pDst[2] = 0.0f;
+  pDst[3] = l10; pDst[4] = l11; pDst[5] = 0.0f;
+  pDst[6] = l20; pDst[7] = l21; pDst[8] = l22;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Floating-point 4x4 Cholesky decomposition.
+ * @param[in]  pSrc  points to the symmetric positive definite input matrix, stored row by row.
+ * @param[out] pDst  points to the lower triangular output matrix, which may be the input.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the input matrix is not
+ * positive definite, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_cholesky_4x4_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t l00, l10, l11, l20, l21, l22;        /* Lower triangle of the output */
+  float32_t l30, l31, l32, l33;
+  float32_t d, inv;                              /* Diagonal term and its inverse */
+
+  /* Column 0 */
+  d = pSrc[0];
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l00);
+  inv = 1.0f / l00;
+
+  l10 = pSrc[4] * inv;
+  l20 = pSrc[8] * inv;
+  l30 = pSrc[12] * inv;
+
+  /* Column 1 */
+  d = pSrc[5] - (l10 * l10);
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l11);
+  inv = 1.0f / l11;
+
+  l21 = (pSrc[9] - (l20 * l10)) * inv;
+  l31 = (pSrc[13] - (l30 * l10)) * inv;
+
+  /* Column 2 */
+  d = pSrc[10] - (l20 * l20) - (l21 * l21);
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l22);
+  inv = 1.0f / l22;
+
+  l32 = (pSrc[14] - (l30 * l20) - (l31 * l21)) * inv;
+
+  /* Column 3 */
+  d = pSrc[15] - (l30 * l30) - (l31 * l31) - (l32 * l32);
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l33);
+
+  /* Output, with the upper triangle cleared */
+  pDst[0] = l00; pDst[1] = 0.0f; pDst[2] = 0.0f; pDst[3] = 0.0f;
+  pDst[4] = l10; pDst[5] = l11; pDst[6] = 0.0f; pDst[7] = 0.0f;
+  pDst[8] = l20; pDst[9] = l21; pDst[10] = l22; pDst[11] = 0.0f;
+  pDst[12] = l30; pDst[13] = l31; pDst[14] = l32; pDst[15] = l33;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Floating-point 5x5 Cholesky decomposition.
+ * @param[in]  pSrc  points to the symmetric positive definite input matrix, stored row by row.
+ * @param[out] pDst  points to the lower triangular output matrix, which may be the input.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the input matrix is not
+ * positive definite, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_cholesky_5x5_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t l00, l10, l11, l20, l21, l22;        /* Lower triangle of the output */
+  float32_t l30, l31, l32, l33, l40, l41;
+  float32_t l42, l43, l44;
+  float32_t d, inv;                              /* Diagonal term and its inverse */
+
+  /* Column 0 */
+  d = pSrc[0];
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l00);
+  inv = 1.0f / l00;
+
+  l10 = pSrc[5] * inv;
+  l20 = pSrc[10] * inv;
+  l30 = pSrc[15] * inv;
+  l40 = pSrc[20] * inv;
+
+  /* Column 1 */
+  d = pSrc[6] - (l10 * l10);
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l11);
+  inv = 1.0f / l11;
+
+  l21 = (pSrc[11] - (l20 * l10)) * inv;
+  l31 = (pSrc[16] - (l30 * l10)) * inv;
+  l41 = (pSrc[21] - (l40 * l10)) * inv;
+
+  /* Column 2 */
+  d = pSrc[12] - (l20 * l20) - (l21 * l21);
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l22);
+  inv = 1.0f / l22;
+
+  l32 = (pSrc[17] - (l30 * l20) - (l31 * l21)) * inv;
+  l42 = (pSrc[22] - (l40 * l20) - (l41 * l21)) * inv;
+
+  /* Column 3 */
+  d = pSrc[18] - (l30 * l30) - (l31 * l31) - (l32 * l32);
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l33);
+  inv = 1.0f / l33;
+
+  l43 = (pSrc[23] - (l40 * l30) - (l41 * l31) - (l42 * l32)) * inv;
+
+  /* Column 4 */
+  d = pSrc[24] - (l40 * l40) - (l41 * l41) - (l42 * l42) - (l43 * l43);
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l44);
+
+  /* Output, with the upper triangle cleared */
+  pDst[0] = l00; pDst[1] = 0.0f; pDst[2] = 0.0f; pDst[3] = 0.0f; pDst[4] = 0.0f;
+  pDst[5] = l10; pDst[6] = l11; pDst[7] = 0.0f; pDst[8] = 0.0f; pDst[9] = 0.0f;
+  pDst[10] = l20; pDst[11] = l21; pDst[12] = l22; pDst[13] = 0.0f; pDst[14] = 0.0f;
+  pDst[15] = l30; pDst[16] = l31; pDst[17] = l32; pDst[18] = l33; pDst[19] = 0.0f;
+  pDst[20] = l40; pDst[21] = l41; pDst[22] = l42; pDst[23] = l43; pDst[24] = l44;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Floating-point 6x6 Cholesky decomposition.
+ * @param[in]  pSrc  points to the symmetric positive definite input matrix, stored row by row.
+ * @param[out] pDst  points to the lower triangular output matrix, which may be the input.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the input matrix is not
+ * positive definite, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_cholesky_6x6_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t l00, l10, l11, l20, l21, l22;        /* Lower triangle of the output */
+  float32_t l30, l31, l32, l33, l40, l41;
+  float32_t l42, l43, l44, l50, l51, l52;
+  float32_t l53, l54, l55;
+  float32_t d, inv;                              /* Diagonal term and its inverse */
+
+  /* Column 0 */
+  d = pSrc[0];
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l00);
+  inv = 1.0f / l00;
+
+  l10 = pSrc[6] * inv;
+  l20 = pSrc[12] * inv;
+  l30 = pSrc[18] * inv;
+  l40 = pSrc[24] * inv;
+  l50 = pSrc[30] * inv;
+
+  /* Column 1 */
+  d = pSrc[7] - (l10 * l10);
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l11);
+  inv = 1.0f / l11;
+
+  l21 = (pSrc[13] - (l20 * l10)) * inv;
+  l31 = (pSrc[19] - (l30 * l10)) * inv;
+  l41 = (pSrc[25] - (l40 * l10)) * inv;
+  l51 = (pSrc[31] - (l50 * l10)) * inv;
+
+  /* Column 2 */
+  d = pSrc[14] - (l20 * l20) - (l21 * l21);
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l22);
+  inv = 1.0f / l22;
+
+  l32 = (pSrc[20] - (l30 * l20) - (l31 * l21)) * inv;
+  l42 = (pSrc[26] - (l40 * l20) - (l41 * l21)) * inv;
+  l52 = (pSrc[32] - (l50 * l20) - (l51 * l21)) * inv;
+
+  /* Column 3 */
+  d = pSrc[21] - (l30 * l30) - (l31 * l31) - (l32 * l32);
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l33);
+  inv = 1.0f / l33;
+
+  l43 = (pSrc[27] - (l40 * l30) - (l41 * l31) - (l42 * l32)) * inv;
+  l53 = (pSrc[33] - (l50 * l30) - (l51 * l31) - (l52 * l32)) * inv;
+
+  /* Column 4 */
+  d = pSrc[28] - (l40 * l40) - (l41 * l41) - (l42 * l42) - (l43 * l43);
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l44);
+  inv = 1.0f / l44;
+
+  l54 = (pSrc[34] - (l50 * l40) - (l51 * l41) - (l52 * l42) - (l53 * l43)) * inv;
+
+  /* Column 5 */
+  d = pSrc[35] - (l50 * l50) - (l51 * l51) - (l52 * l52) - (l53 * l53) - (l54 * l54);
+
+  if (d <= 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_f32(d, &l55);
+
+  /* Output, with the upper triangle cleared */
+  pDst[0] = l00; pDst[1] = 0.0f; pDst[2] = 0.0f; pDst[3] = 0.0f; pDst[4] = 0.0f; pDst[5] = 0.0f;
+  pDst[6] = l10; pDst[7] = l11; pDst[8] = 0.0f; pDst[9] = 0.0f; pDst[10] = 0.0f; pDst[11] = 0.0f;
+  pDst[12] = l20; pDst[13] = l21; pDst[14] = l22; pDst[15] = 0.0f; pDst[16] = 0.0f; pDst[17] = 0.0f;
+  pDst[18] = l30; pDst[19] = l31; pDst[20] = l32; pDst[21] = l33; pDst[22] = 0.0f; pDst[23] = 0.0f;
+  pDst[24] = l40; pDst[25] = l41; pDst[26] = l42; pDst[27] = l43; pDst[28] = l44; pDst[29] = 0.0f;
+  pDst[30] = l50; pDst[31] = l51; pDst[32] = l52; pDst[33] = l53; pDst[34] = l54; pDst[35] = l55;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Floating-point Cholesky decomposition, using the fixed-size kernels for small matrices.
+ * @param[in]  pSrc  points to the instance of the input matrix structure.
+ * @param[out] pDst  points to the instance of the output matrix structure.
+ * @return The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions do not match,
+ * <code>ARM_MATH_SINGULAR</code> if the input matrix is not positive definite and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * \par
+ * Square matrices of 2x2 to 6x6 elements are decomposed by arm_mat_cholesky_2x2_f32() to
+ * arm_mat_cholesky_6x6_f32(), whose loops are fully unrolled and which keep the output
+ * in local variables. They return the same values as arm_mat_cholesky_f32(), to which
+ * other sizes are passed.
+ */
+
+arm_status arm_mat_cholesky_small_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  uint16_t n = pSrc->numRows;                    /* Size of the square matrices */
+
+  /* One size check selects the kernel */
+  if ((pSrc->numCols == n) && (pDst->numRows == n) && (pDst->numCols == n))
+  {
+    switch (n)
+    {
+    case 2U:
+      return (arm_mat_cholesky_2x2_f32(pSrc->pData, pDst->pData));
+
+    case 3U:
+      return (arm_mat_cholesky_3x3_f32(pSrc->pData, pDst->pData));
+
+    case 4U:
+      return (arm_mat_cholesky_4x4_f32(pSrc->pData, pDst->pData));
+
+    case 5U:
+      return (arm_mat_cholesky_5x5_f32(pSrc->pData, pDst->pData));
+
+    case 6U:
+      return (arm_mat_cholesky_6x6_f32(pSrc->pData, pDst->pData));
+
+    default:
+      break;
+    }
+  }
+
+  /* Other sizes use the generic function */
+  return (arm_mat_cholesky_f32(pSrc, pDst));
+}
+
+/**
+ * @} end of MatrixChol group
+ */
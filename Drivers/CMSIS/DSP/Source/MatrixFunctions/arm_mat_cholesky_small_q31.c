@@ -0,0 +1,613 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_small_q31.c
+ * Description:  Fixed-size Q31 Cholesky decomposition
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Q31 2x2 Cholesky decomposition.
+ * @param[in]  pSrc  points to the symmetric positive definite input matrix, stored row by row.
+ * @param[out] pDst  points to the lower triangular output matrix, which may be the input.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the input matrix is not
+ * positive definite, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_cholesky_2x2_q31(
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  q31_t l00, l10, l11;                           /* Lower triangle of the output */
+  q31_t d;                                       /* Diagonal term */
+  q63_t acc;                                     /* Accumulator */
+
+  /* Column 0 */
+  d = pSrc[0];
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l00);
+
+  acc = (q63_t) pSrc[2] << 31;
+  l10 = clip_q63_to_q31(acc / l00);
+
+  /* Column 1 */
+  acc = (q63_t) pSrc[3] << 31;
+  acc -= (q63_t) l10 * l10;
+  d = clip_q63_to_q31(acc >> 31);
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l11);
+
+  /* Output, with the upper triangle cleared */
+  pDst[0] = l00; pDst[1] = 0;
+  pDst[2] = l10; pDst[3] = l11;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Q31 3x3 Cholesky decomposition.
+ * @param[in]  pSrc  points to the symmetric positive definite input matrix, stored row by row.
+ * @param[out] pDst  points to the lower triangular output matrix, which may be the input.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the input matrix is not
+ * positive definite, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_cholesky_3x3_q31(
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  q31_t l00, l10, l11, l20, l21, l22;            /* Lower triangle of the output */
+  q31_t d;                                       /* Diagonal term */
+  q63_t acc;                                     /* Accumulator */
+
+  /* Column 0 */
+  d = pSrc[0];
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l00);
+
+  acc = (q63_t) pSrc[3] << 31;
+  l10 = clip_q63_to_q31(acc / l00);
+
+  acc = (q63_t) pSrc[6] << 31;
+  l20 = clip_q63_to_q31(acc / l00);
+
+  /* Column 1 */
+  acc = (q63_t) pSrc[4] << 31;
+  acc -= (q63_t) l10 * l10;
+  d = clip_q63_to_q31(acc >> 31);
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l11);
+
+  acc = (q63_t) pSrc[7] << 31;
+  acc -= (q63_t) l20 * l10;
+  l21 = clip_q63_to_q31(acc / l11);
+
+  /* Column 2 */
+  acc = (q63_t) pSrc[8] << 31;
+  acc -= (q63_t) l20 * l20;
+  acc -= (q63_t) l21 * l21;
+  d = clip_q63_to_q31(acc >> 31);
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l22);
+
+  /* Output, with the upper triangle cleared */
+  pDst[0] = l00; pDst[1] = 0; pDst[2] = 0;
+  pDst[3] = l10; pDst[4] = l11; pDst[5] = 0;
+  pDst[6] = l20; pDst[7] = l21; pDst[8] = l22;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Q31 4x4 Cholesky decomposition.
+ * @param[in]  pSrc  points to the symmetric positive definite input matrix, stored row by row.
+ * @param[out] pDst  points to the lower triangular output matrix, which may be the input.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the input matrix is not
+ * positive definite, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_cholesky_4x4_q31(
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  q31_t l00, l10, l11, l20, l21, l22;            /* Lower triangle of the output */
+  q31_t l30, l31, l32, l33;
+  q31_t d;                                       /* Diagonal term */
+  q63_t acc;                                     /* Accumulator */
+
+  /* Column 0 */
+  d = pSrc[0];
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l00);
+
+  acc = (q63_t) pSrc[4] << 31;
+  l10 = clip_q63_to_q31(acc / l00);
+
+  acc = (q63_t) pSrc[8] << 31;
+  l20 = clip_q63_to_q31(acc / l00);
+
+  acc = (q63_t) pSrc[12] << 31;
+  l30 = clip_q63_to_q31(acc / l00);
+
+  /* Column 1 */
+  acc = (q63_t) pSrc[5] << 31;
+  acc -= (q63_t) l10 * l10;
+  d = clip_q63_to_q31(acc >> 31);
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l11);
+
+  acc = (q63_t) pSrc[9] << 31;
+  acc -= (q63_t) l20 * l10;
+  l21 = clip_q63_to_q31(acc / l11);
+
+  acc = (q63_t) pSrc[13] << 31;
+  acc -= (q63_t) l30 * l10;
+  l31 = clip_q63_to_q31(acc / l11);
+
+  /* Column 2 */
+  acc = (q63_t) pSrc[10] << 31;
+  acc -= (q63_t) l20 * l20;
+  acc -= (q63_t) l21 * l21;
+  d = clip_q63_to_q31(acc >> 31);
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l22);
+
+  acc = (q63_t) pSrc[14] << 31;
+  acc -= (q63_t) l30 * l20;
+  acc -= (q63_t) l31 * l21;
+  l32 = clip_q63_to_q31(acc / l22);
+
+  /* Column 3 */
+  acc = (q63_t) pSrc[15] << 31;
+  acc -= (q63_t) l30 * l30;
+  acc -= (q63_t) l31 * l31;
+  acc -= (q63_t) l32 * l32;
+  d = clip_q63_to_q31(acc >> 31);
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l33);
+
+  /* Output, with the upper triangle cleared */
+  pDst[0] = l00; pDst[1] = 0; pDst[2] = 0; pDst[3] = 0;
+  pDst[4] = l10; pDst[5] = l11; pDst[6] = 0; pDst[7] = 0;
+  pDst[8] = l20; pDst[9] = l21; pDst[10] = l22; pDst[11] = 0;
+  pDst[12] = l30; pDst[13] = l31; pDst[14] = l32; pDst[15] = l33;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Q31 5x5 Cholesky decomposition.
+ * @param[in]  pSrc  points to the symmetric positive definite input matrix, stored row by row.
+ * @param[out] pDst  points to the lower triangular output matrix, which may be the input.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the input matrix is not
+ * positive definite, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_cholesky_5x5_q31(
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  q31_t l00, l10, l11, l20, l21, l22;            /* Lower triangle of the output */
+  q31_t l30, l31, l32, l33, l40, l41;
+  q31_t l42, l43, l44;
+  q31_t d;                                       /* Diagonal term */
+  q63_t acc;                                     /* Accumulator */
+
+  /* Column 0 */
+  d = pSrc[0];
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l00);
+
+  acc = (q63_t) pSrc[5] << 31;
+  l10 = clip_q63_to_q31(acc / l00);
+
+  acc = (q63_t) pSrc[10] << 31;
+  l20 = clip_q63_to_q31(acc / l00);
+
+  acc = (q63_t) pSrc[15] << 31;
+  l30 = clip_q63_to_q31(acc / l00);
+
+  acc = (q63_t) pSrc[20] << 31;
+  l40 = clip_q63_to_q31(acc / l00);
+
+  /* Column 1 */
+  acc = (q63_t) pSrc[6] << 31;
+  acc -= (q63_t) l10 * l10;
+  d = clip_q63_to_q31(acc >> 31);
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l11);
+
+  acc = (q63_t) pSrc[11] << 31;
+  acc -= (q63_t) l20 * l10;
+  l21 = clip_q63_to_q31(acc / l11);
+
+  acc = (q63_t) pSrc[16] << 31;
+  acc -= (q63_t) l30 * l10;
+  l31 = clip_q63_to_q31(acc / l11);
+
+  acc = (q63_t) pSrc[21] << 31;
+  acc -= (q63_t) l40 * l10;
+  l41 = clip_q63_to_q31(acc / l11);
+
+  /* Column 2 */
+  acc = (q63_t) pSrc[12] << 31;
+  acc -= (q63_t) l20 * l20;
+  acc -= (q63_t) l21 * l21;
+  d = clip_q63_to_q31(acc >> 31);
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l22);
+
+  acc = (q63_t) pSrc[17] << 31;
+  acc -= (q63_t) l30 * l20;
+  acc -= (q63_t) l31 * l21;
+  l32 = clip_q63_to_q31(acc / l22);
+
+  acc = (q63_t) pSrc[22] << 31;
+  acc -= (q63_t) l40 * l20;
+  acc -= (q63_t) l41 * l21;
+  l42 = clip_q63_to_q31(acc / l22);
+
+  /* Column 3 */
+  acc = (q63_t) pSrc[18] << 31;
+  acc -= (q63_t) l30 * l30;
+  acc -= (q63_t) l31 * l31;
+  acc -= (q63_t) l32 * l32;
+  d = clip_q63_to_q31(acc >> 31);
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l33);
+
+  acc = (q63_t) pSrc[23] << 31;
+  acc -= (q63_t) l40 * l30;
+  acc -= (q63_t) l41 * l31;
+  acc -= (q63_t) l42 * l32;
+  l43 = clip_q63_to_q31(acc / l33);
+
+  /* Column 4 */
+  acc = (q63_t) pSrc[24] << 31;
+  acc -= (q63_t) l40 * l40;
+  acc -= (q63_t) l41 * l41;
+  acc -= (q63_t) l42 * l42;
+  acc -= (q63_t) l43 * l43;
+  d = clip_q63_to_q31(acc >> 31);
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l44);
+
+  /* Output, with the upper triangle cleared */
+  pDst[0] = l00; pDst[1] = 0; pDst[2] = 0; pDst[3] = 0; pDst[4] = 0;
+  pDst[5] = l10; pDst[6] = l11; pDst[7] = 0; pDst[8] = 0; pDst[9] = 0;
+  pDst[10] = l20; pDst[11] = l21; pDst[12] = l22; pDst[13] = 0; pDst[14] = 0;
+  pDst[15] = l30; pDst[16] = l31; pDst[17] = l32; pDst[18] = l33; pDst[19] = 0;
+  pDst[20] = l40; pDst[21] = l41; pDst[22] = l42; pDst[23] = l43; pDst[24] = l44;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Q31 6x6 Cholesky decomposition.
+ * @param[in]  pSrc  points to the symmetric positive definite input matrix, stored row by row.
+ * @param[out] pDst  points to the lower triangular output matrix, which may be the input.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the input matrix is not
+ * positive definite, and <code>ARM_MATH_SUCCESS</code> otherwise.
+ */
+
+arm_status arm_mat_cholesky_6x6_q31(
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  q31_t l00, l10, l11, l20, l21, l22;            /* Lower triangle of the output */
+  q31_t l30, l31, l32, l33, l40, l41;
+  q31_t l42, l43, l44, l50, l51, l52;
+  q31_t l53, l54, l55;
+  q31_t d;                                       /* Diagonal term */
+  q63_t acc;                                     /* Accumulator */
+
+  /* Column 0 */
+  d = pSrc[0];
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l00);
+
+  acc = (q63_t) pSrc[6] << 31;
+  l10 = clip_q63_to_q31(acc / l00);
+
+  acc = (q63_t) pSrc[12] << 31;
+  l20 = clip_q63_to_q31(acc / l00);
+
+  acc = (q63_t) pSrc[18] << 31;
+  l30 = clip_q63_to_q31(acc / l00);
+
+  acc = (q63_t) pSrc[24] << 31;
+  l40 = clip_q63_to_q31(acc / l00);
+
+  acc = (q63_t) pSrc[30] << 31;
+  l50 = clip_q63_to_q31(acc / l00);
+
+  /* Column 1 */
+  acc = (q63_t) pSrc[7] << 31;
+  acc -= (q63_t) l10 * l10;
+  d = clip_q63_to_q31(acc >> 31);
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l11);
+
+  acc = (q63_t) pSrc[13] << 31;
+  acc -= (q63_t) l20 * l10;
+  l21 = clip_q63_to_q31(acc / l11);
+
+  acc = (q63_t) pSrc[19] << 31;
+  acc -= (q63_t) l30 * l10;
+  l31 = clip_q63_to_q31(acc / l11);
+
+  acc = (q63_t) pSrc[25] << 31;
+  acc -= (q63_t) l40 * l10;
+  l41 = clip_q63_to_q31(acc / l11);
+
+  acc = (q63_t) pSrc[31] << 31;
+  acc -= (q63_t) l50 * l10;
+  l51 = clip_q63_to_q31(acc / l11);
+
+  /* Column 2 */
+  acc = (q63_t) pSrc[14] << 31;
+  acc -= (q63_t) l20 * l20;
+  acc -= (q63_t) l21 * l21;
+  d = clip_q63_to_q31(acc >> 31);
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l22);
+
+  acc = (q63_t) pSrc[20] << 31;
+  acc -= (q63_t) l30 * l20;
+  acc -= (q63_t) l31 * l21;
+  l32 = clip_q63_to_q31(acc / l22);
+
+  acc = (q63_t) pSrc[26] << 31;
+  acc -= (q63_t) l40 * l20;
+  acc -= (q63_t) l41 * l21;
+  l42 = clip_q63_to_q31(acc / l22);
+
+  acc = (q63_t) pSrc[32] << 31;
+  acc -= (q63_t) l50 * l20;
+  acc -= (q63_t) l51 * l21;
+  l52 = clip_q63_to_q31(acc / l22);
+
+  /* Column 3 */
+  acc = (q63_t) pSrc[21] << 31;
+  acc -= (q63_t) l30 * l30;
+  acc -= (q63_t) l31 * l31;
+  acc -= (q63_t) l32 * l32;
+  d = clip_q63_to_q31(acc >> 31);
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l33);
+
+  acc = (q63_t) pSrc[27] << 31;
+  acc -= (q63_t) l40 * l30;
+  acc -= (q63_t) l41 * l31;
+  acc -= (q63_t) l42 * l32;
+  l43 = clip_q63_to_q31(acc / l33);
+
+  acc = (q63_t) pSrc[33] << 31;
+  acc -= (q63_t) l50 * l30;
+  acc -= (q63_t) l51 * l31;
+  acc -= (q63_t) l52 * l32;
+  l53 = clip_q63_to_q31(acc / l33);
+
+  /* Column 4 */
+  acc = (q63_t) pSrc[28] << 31;
+  acc -= (q63_t) l40 * l40;
+  acc -= (q63_t) l41 * l41;
+  acc -= (q63_t) l42 * l42;
+  acc -= (q63_t) l43 * l43;
+  d = clip_q63_to_q31(acc >> 31);
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l44);
+
+  acc = (q63_t) pSrc[34] << 31;
+  acc -= (q63_t) l50 * l40;
+  acc -= (q63_t) l51 * l41;
+  acc -= (q63_t) l52 * l42;
+  acc -= (q63_t) l53 * l43;
+  l54 = clip_q63_to_q31(acc / l44);
+
+  /* Column 5 */
+  acc = (q63_t) pSrc[35] << 31;
+  acc -= (q63_t) l50 * l50;
+  acc -= (q63_t) l51 * l51;
+  acc -= (q63_t) l52 * l52;
+  acc -= (q63_t) l53 * l53;
+  acc -= (q63_t) l54 * l54;
+  d = clip_q63_to_q31(acc >> 31);
+
+  if (d <= 0)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  arm_sqrt_q31(d, &l55);
+
+  /* Output, with the upper triangle cleared */
+  pDst[0] = l00; pDst[1] = 0; pDst[2] = 0; pDst[3] = 0; pDst[4] = 0; pDst[5] = 0;
+  pDst[6] = l10; pDst[7] = l11; pDst[8] = 0; pDst[9] = 0; pDst[10] = 0; pDst[11] = 0;
+  pDst[12] = l20; pDst[13] = l21; pDst[14] = l22; pDst[15] = 0; pDst[16] = 0; pDst[17] = 0;
+  pDst[18] = l30; pDst[19] = l31; pDst[20] = l32; pDst[21] = l33; pDst[22] = 0; pDst[23] = 0;
+  pDst[24] = l40; pDst[25] = l41; pDst[26] = l42; pDst[27] = l43; pDst[28] = l44; pDst[29] = 0;
+  pDst[30] = l50; pDst[31] = l51; pDst[32] = l52; pDst[33] = l53; pDst[34] = l54; pDst[35] = l55;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Q31 Cholesky decomposition, using the fixed-size kernels for small matrices.
+ * @param[in]  pSrc  points to the instance of the input matrix structure.
+ * @param[out] pDst  points to the instance of the output matrix structure.
+ * @return The function returns <code>ARM_MATH_SIZE_MISMATCH</code> if the dimensions do not match,
+ * <code>ARM_MATH_SINGULAR</code> if the input matrix is not positive definite and
+ * <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * \par
+ * Square matrices of 2x2 to 6x6 elements are decomposed by arm_mat_cholesky_2x2_q31() to
+ * arm_mat_cholesky_6x6_q31(), whose loops are fully unrolled and which keep the output
+ * in local variables. They return the same values as arm_mat_cholesky_q31(), to which
+ * other sizes are passed.
+ */
+
+arm_status arm_mat_cholesky_small_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst)
+{
+  uint16_t n = pSrc->numRows;                    /* Size of the square matrices */
+
+  /* One size check selects the kernel */
+  if ((pSrc->numCols == n) && (pDst->numRows == n) && (pDst->numCols == n))
+  {
+    switch (n)
+    {
+    case 2U:
+      return (arm_mat_cholesky_2x2_q31(pSrc->pData, pDst->pData));
+
+    case 3U:
+      return (arm_mat_cholesky_3x3_q31(pSrc->pData, pDst->pData));
+
+    case 4U:
+      return (arm_mat_cholesky_4x4_q31(pSrc->pData, pDst->pData));
+
+    case 5U:
+      return (arm_mat_cholesky_5x5_q31(pSrc->pData, pDst->pData));
+
+    case 6U:
+      return (arm_mat_cholesky_6x6_q31(pSrc->pData, pDst->pData));
+
+    default:
+      break;
+    }
+  }
+
+  /* Other sizes use the generic function */
+  return (arm_mat_cholesky_q31(pSrc, pDst));
+}
+
+/**
+ * @} end of MatrixChol group
+ */
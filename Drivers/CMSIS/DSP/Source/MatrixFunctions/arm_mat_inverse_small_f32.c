@@ -0,0 +1,397 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_inverse_small_f32.c
+ * Description:  Fixed-size floating-point matrix inverse
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixInv
+ * @{
+ */
+
+/**
+ * @brief Floating-point 2x2 matrix inverse.
+ * @param[in]  pSrc  points to the input matrix, stored row by row.
+ * @param[out] pDst  points to the output matrix, which may be the input.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the input matrix is singular,
+ * and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * The inverse is the adjugate matrix divided by the determinant.
+ */
+
+arm_status arm_mat_inverse_2x2_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t a00, a01, a10, a11;                  /* Input matrix */
+  float32_t det;                                 /* Determinant */
+
+  a00 = pSrc[0]; a01 = pSrc[1];
+  a10 = pSrc[2]; a11 = pSrc[3];
+
+  det = (a00 * a11) - (a01 * a10);
+
+  if (det == 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  det = 1.0f / det;
+
+  pDst[0] = a11 * det;
+  pDst[1] = -a01 * det;
+  pDst[2] = -a10 * det;
+  pDst[3] = a00 * det;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Floating-point 3x3 matrix inverse.
+ * @param[in]  pSrc  points to the input matrix, stored row by row.
+ * @param[out] pDst  points to the output matrix, which may be the input.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the input matrix is singular,
+ * and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * The inverse is the adjugate matrix divided by the determinant, which is expanded
+ * along the first row.
+ */
+
+arm_status arm_mat_inverse_3x3_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t a00, a01, a02, a10, a11, a12, a20, a21, a22; /* Input matrix */
+  float32_t c00, c01, c02;                       /* Cofactors of the first row */
+  float32_t det;                                 /* Determinant */
+
+  a00 = pSrc[0]; a01 = pSrc[1]; a02 = pSrc[2];
+  a10 = pSrc[3]; a11 = pSrc[4]; a12 = pSrc[5];
+  a20 = pSrc[6]; a21 = pSrc[7]; a22 = pSrc[8];
+
+  c00 = (a11 * a22) - (a12 * a21);
+  c01 = (a12 * a20) - (a10 * a22);
+  c02 = (a10 * a21) - (a11 * a20);
+
+  det = (a00 * c00) + (a01 * c01) + (a02 * c02);
+
+  if (det == 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  det = 1.0f / det;
+
+  pDst[0] = c00 * det;
+  pDst[1] = ((a02 * a21) - (a01 * a22)) * det;
+  pDst[2] = ((a01 * a12) - (a02 * a11)) * det;
+  pDst[3] = c01 * det;
+  pDst[4] = ((a00 * a22) - (a02 * a20)) * det;
+  pDst[5] = ((a02 * a10) - (a00 * a12)) * det;
+  pDst[6] = c02 * det;
+  pDst[7] = ((a01 * a20) - (a00 * a21)) * det;
+  pDst[8] = ((a00 * a11) - (a01 * a10)) * det;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Floating-point 4x4 matrix inverse.
+ * @param[in]  pSrc  points to the input matrix, stored row by row.
+ * @param[out] pDst  points to the output matrix, which may be the input.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the input matrix is singular,
+ * and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * The inverse is the adjugate matrix divided by the determinant. Both are computed
+ * from the 2x2 minors of the two upper rows and of the two lower rows (Laplace
+ * expansion), which share most of the products.
+ */
+
+arm_status arm_mat_inverse_4x4_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t a00, a01, a02, a03, a10, a11, a12, a13; /* Two upper rows */
+  float32_t a20, a21, a22, a23, a30, a31, a32, a33; /* Two lower rows */
+  float32_t s0, s1, s2, s3, s4, s5;              /* Minors of the upper rows */
+  float32_t c0, c1, c2, c3, c4, c5;              /* Minors of the lower rows */
+  float32_t det;                                 /* Determinant */
+
+  a00 = pSrc[0]; a01 = pSrc[1]; a02 = pSrc[2]; a03 = pSrc[3];
+  a10 = pSrc[4]; a11 = pSrc[5]; a12 = pSrc[6]; a13 = pSrc[7];
+  a20 = pSrc[8]; a21 = pSrc[9]; a22 = pSrc[10]; a23 = pSrc[11];
+  a30 = pSrc[12]; a31 = pSrc[13]; a32 = pSrc[14]; a33 = pSrc[15];
+
+  s0 = (a00 * a11) - (a10 * a01);
+  s1 = (a00 * a12) - (a10 * a02);
+  s2 = (a00 * a13) - (a10 * a03);
+  s3 = (a01 * a12) - (a11 * a02);
+  s4 = (a01 * a13) - (a11 * a03);
+  s5 = (a02 * a13) - (a12 * a03);
+
+  c0 = (a20 * a31) - (a30 * a21);
+  c1 = (a20 * a32) - (a30 * a22);
+  c2 = (a20 * a33) - (a30 * a23);
+  c3 = (a21 * a32) - (a31 * a22);
+  c4 = (a21 * a33) - (a31 * a23);
+  c5 = (a22 * a33) - (a32 * a23);
+
+  det = (s0 * c5) - (s1 * c4) + (s2 * c3) + (s3 * c2) - (s4 * c1) + (s5 * c0);
+
+  if (det == 0.0f)
+  {
+    return (ARM_MATH_SINGULAR);
+  }
+
+  det = 1.0f / det;
+
+  pDst[0] = ((a11 * c5) - (a12 * c4) + (a13 * c3)) * det;
+  pDst[1] = ((a02 * c4) - (a01 * c5) - (a03 * c3)) * det;
+  pDst[2] = ((a31 * s5) - (a32 * s4) + (a33 * s3)) * det;
+  pDst[3] = ((a22 * s4) - (a21 * s5) - (a23 * s3)) * det;
+  pDst[4] = ((a12 * c2) - (a10 * c5) - (a13 * c1)) * det;
+  pDst[5] = ((a00 * c5) - (a02 * c2) + (a03 * c1)) * det;
+  pDst[6] = ((a32 * s2) - (a30 * s5) - (a33 * s1)) * det;
+  pDst[7] = ((a20 * s5) - (a22 * s2) + (a23 * s1)) * det;
+  pDst[8] = ((a10 * c4) - (a11 * c2) + (a13 * c0)) * det;
+  pDst[9] = ((a01 * c2) - (a00 * c4) - (a03 * c0)) * det;
+  pDst[10] = ((a30 * s4) - (a31 * s2) + (a33 * s0)) * det;
+  pDst[11] = ((a21 * s2) - (a20 * s4) - (a23 * s0)) * det;
+  pDst[12] = ((a11 * c1) - (a10 * c3) - (a12 * c0)) * det;
+  pDst[13] = ((a00 * c3) - (a01 * c1) + (a02 * c0)) * det;
+  pDst[14] = ((a31 * s1) - (a30 * s3) - (a32 * s0)) * det;
+  pDst[15] = ((a20 * s3) - (a21 * s1) + (a22 * s0)) * det;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Gauss-Jordan inverse of a small floating-point matrix.
+ * @param[in]  pSrc   points to the input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which may be the input.
+ * @param[in]  pWork  points to a working copy of <code>n*n</code> elements.
+ * @param[in]  n      size of the matrices, a constant in each caller.
+ * @return <code>ARM_MATH_SINGULAR</code> or <code>ARM_MATH_SUCCESS</code>.
+ *
+ * The function is inlined in the callers, where the compiler unrolls the loops on
+ * the constant size. The pivot of each column is the element of largest magnitude.
+ */
+
+static __INLINE arm_status arm_mat_inverse_gj_f32(
+  const float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pWork,
+  const uint32_t n)
+{
+  float32_t *pRow, *pPiv;                        /* Rows of the working copy */
+  float32_t *pOut, *pOutPiv;                     /* Rows of the output matrix */
+  float32_t maxVal, val, tmp;                    /* Pivot search and row operations */
+  uint32_t row, col, piv, k;                     /* Loop counters */
+
+  /* The working copy starts as the input and the output as the identity */
+  for (k = 0U; k < (n * n); k++)
+  {
+    pWork[k] = pSrc[k];
+  }
+
+  for (k = 0U; k < (n * n); k++)
+  {
+    pDst[k] = ((k % (n + 1U)) == 0U) ? 1.0f : 0.0f;
+  }
+
+  for (col = 0U; col < n; col++)
+  {
+    /* Partial pivoting */
+    piv = col;
+    maxVal = fabsf(pWork[(col * n) + col]);
+
+    for (row = col + 1U; row < n; row++)
+    {
+      val = fabsf(pWork[(row * n) + col]);
+
+      if (val > maxVal)
+      {
+        maxVal = val;
+        piv = row;
+      }
+    }
+
+    if (maxVal == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    pPiv = pWork + (col * n);
+    pOutPiv = pDst + (col * n);
+
+    if (piv != col)
+    {
+      pRow = pWork + (piv * n);
+      pOut = pDst + (piv * n);
+
+      for (k = 0U; k < n; k++)
+      {
+        tmp = pPiv[k];
+        pPiv[k] = pRow[k];
+        pRow[k] = tmp;
+
+        tmp = pOutPiv[k];
+        pOutPiv[k] = pOut[k];
+        pOut[k] = tmp;
+      }
+    }
+
+    /* Normalize the pivot row */
+    val = 1.0f / pPiv[col];
+
+    for (k = 0U; k < n; k++)
+    {
+      pPiv[k] *= val;
+      pOutPiv[k] *= val;
+    }
+
+    /* Eliminate the column from the other rows */
+    for (row = 0U; row < n; row++)
+    {
+      pRow = pWork + (row * n);
+      val = pRow[col];
+
+      if ((row != col) && (val != 0.0f))
+      {
+        pOut = pDst + (row * n);
+
+        for (k = 0U; k < n; k++)
+        {
+          pRow[k] -= val * pPiv[k];
+          pOut[k] -= val * pOutPiv[k];
+        }
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Floating-point 5x5 matrix inverse.
+ * @param[in]  pSrc  points to the input matrix, stored row by row.
+ * @param[out] pDst  points to the output matrix, which may be the input.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the input matrix is singular,
+ * and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * The Gauss-Jordan method is used with partial pivoting, on a working copy of the
+ * input. The loops have a constant trip count and are unrolled by the compiler.
+ */
+
+arm_status arm_mat_inverse_5x5_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t work[25];                            /* Working copy of the input */
+
+  return (arm_mat_inverse_gj_f32(pSrc, pDst, work, 5U));
+}
+
+/**
+ * @brief Floating-point 6x6 matrix inverse.
+ * @param[in]  pSrc  points to the input matrix, stored row by row.
+ * @param[out] pDst  points to the output matrix, which may be the input.
+ * @return The function returns <code>ARM_MATH_SINGULAR</code> if the input matrix is singular,
+ * and <code>ARM_MATH_SUCCESS</code> otherwise.
+ *
+ * The Gauss-Jordan method is used with partial pivoting, on a working copy of the
+ * input. The loops have a constant trip count and are unrolled by the compiler.
+ */
+
+arm_status arm_mat_inverse_6x6_f32(
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  float32_t work[36];                            /* Working copy of the input */
+
+  return (arm_mat_inverse_gj_f32(pSrc, pDst, work, 6U));
+}
+
+/**
+ * @brief Floating-point matrix inverse, using the fixed-size kernels for small matrices.
+ * @param[in]  pSrc  points to the instance of the input floating-point matrix structure.
+ * @param[out] pDst  points to the instance of the output floating-point matrix structure.
+ * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+ * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
+ *
+ * \par
+ * Square matrices of 2x2 to 6x6 elements are inverted by arm_mat_inverse_2x2_f32() to
+ * arm_mat_inverse_6x6_f32(), which do not modify the input matrix.
+ * Other sizes are passed to arm_mat_inverse_f32(), which does.
+ *
+ * \par
+ * The 2x2 to 4x4 kernels use the adjugate matrix without pivoting: for ill-conditioned
+ * matrices, their results are less accurate than those of arm_mat_inverse_f32().
+ */
+
+arm_status arm_mat_inverse_small_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  uint16_t n = pSrc->numRows;                    /* Size of the square matrices */
+
+  /* One size check selects the kernel */
+  if ((pSrc->numCols == n) && (pDst->numRows == n) && (pDst->numCols == n))
+  {
+    switch (n)
+    {
+    case 2U:
+      return (arm_mat_inverse_2x2_f32(pSrc->pData, pDst->pData));
+
+    case 3U:
+      return (arm_mat_inverse_3x3_f32(pSrc->pData, pDst->pData));
+
+    case 4U:
+      return (arm_mat_inverse_4x4_f32(pSrc->pData, pDst->pData));
+
+    case 5U:
+      return (arm_mat_inverse_5x5_f32(pSrc->pData, pDst->pData));
+
+    case 6U:
+      return (arm_mat_inverse_6x6_f32(pSrc->pData, pDst->pData));
+
+    default:
+      break;
+    }
+  }
+
+  /* Other sizes use the generic function */
+  return (arm_mat_inverse_f32(pSrc, pDst));
+}
+
+/**
+ * @} end of MatrixInv group
+ */
@@ -0,0 +1,459 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_small_f32.c
+ * Description:  Fixed-size floating-point matrix multiplication
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * @brief Floating-point 2x2 matrix multiplication.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which must not overlap the inputs.
+ * @return none.
+ */
+
+void arm_mat_mult_2x2_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  float32_t a0, a1;                              /* Row of the first matrix */
+
+  /* Row 0 */
+  a0 = pSrcA[0];
+  a1 = pSrcA[1];
+  pDst[0] = (a0 * pSrcB[0]) + (a1 * pSrcB[2]);
+  pDst[1] = (a0 * pSrcB[1]) + (a1 * pSrcB[3]);
+
+  /* Row 1 */
+  a0 = pSrcA[2];
+  a1 = pSrcA[3];
+  pDst[2] = (a0 * pSrcB[0]) + (a1 * pSrcB[2]);
+  pDst[3] = (a0 * pSrcB[1]) + (a1 * pSrcB[3]);
+}
+
+/**
+ * @brief Floating-point 3x3 matrix multiplication.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which must not overlap the inputs.
+ * @return none.
+ */
+
+void arm_mat_mult_3x3_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  float32_t a0, a1, a2;                          /* Row of the first matrix */
+
+  /* Row 0 */
+  a0 = pSrcA[0];
+  a1 = pSrcA[1];
+  a2 = pSrcA[2];
+  pDst[0] = (a0 * pSrcB[0]) + (a1 * pSrcB[3]) + (a2 * pSrcB[6]);
+  pDst[1] = (a0 * pSrcB[1]) + (a1 * pSrcB[4]) + (a2 * pSrcB[7]);
+  pDst[2] = (a0 * pSrcB[2]) + (a1 * pSrcB[5]) + (a2 * pSrcB[8]);
+
+  /* Row 1 */
+  a0 = pSrcA[3];
+  a1 = pSrcA[4];
+  a2 = pSrcA[5];
+  pDst[3] = (a0 * pSrcB[0]) + (a1 * pSrcB[3]) + (a2 * pSrcB[6]);
+  pDst[4] = (a0 * pSrcB[1]) + (a1 * pSrcB[4]) + (a2 * pSrcB[7]);
+  pDst[5] = (a0 * pSrcB[2]) + (a1 * pSrcB[5]) + (a2 * pSrcB[8]);
+
+  /* Row 2 */
+  a0 = pSrcA[6];
+  a1 = pSrcA[7];
+  a2 = pSrcA[8];
+  pDst[6] = (a0 * pSrcB[0]) + (a1 * pSrcB[3]) + (a2 * pSrcB[6]);
+  pDst[7] = (a0 * pSrcB[1]) + (a1 * pSrcB[4]) + (a2 * pSrcB[7]);
+  pDst[8] = (a0 * pSrcB[2]) + (a1 * pSrcB[5]) + (a2 * pSrcB[8]);
+}
+
+/**
+ * @brief Floating-point 4x4 matrix multiplication.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which must not overlap the inputs.
+ * @return none.
+ */
+
+void arm_mat_mult_4x4_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  float32_t a0, a1, a2, a3;                      /* Row of the first matrix */
+
+  /* Row 0 */
+  a0 = pSrcA[0];
+  a1 = pSrcA[1];
+  a2 = pSrcA[2];
+  a3 = pSrcA[3];
+  pDst[0] = (a0 * pSrcB[0]) + (a1 * pSrcB[4]) + (a2 * pSrcB[8]) + (a3 * pSrcB[12]);
+  pDst[1] = (a0 * pSrcB[1]) + (a1 * pSrcB[5]) + (a2 * pSrcB[9]) + (a3 * pSrcB[13]);
+  pDst[2] = (a0 * pSrcB[2]) + (a1 * pSrcB[6]) + (a2 * pSrcB[10]) + (a3 * pSrcB[14]);
+  pDst[3] = (a0 * pSrcB[3]) + (a1 * pSrcB[7]) + (a2 * pSrcB[11]) + (a3 * pSrcB[15]);
+
+  /* Row 1 */
+  a0 = pSrcA[4];
+  a1 = pSrcA[5];
+  a2 = pSrcA[6];
+  a3 = pSrcA[7];
+  pDst[4] = (a0 * pSrcB[0]) + (a1 * pSrcB[4]) + (a2 * pSrcB[8]) + (a3 * pSrcB[12]);
+  pDst[5] = (a0 * pSrcB[1]) + (a1 * pSrcB[5]) + (a2 * pSrcB[9]) + (a3 * pSrcB[13]);
+  pDst[6] = (a0 * pSrcB[2]) + (a1 * pSrcB[6]) + (a2 * pSrcB[10]) + (a3 * pSrcB[14]);
+  pDst[7] = (a0 * pSrcB[3]) + (a1 * pSrcB[7]) + (a2 * pSrcB[11]) + (a3 * pSrcB[15]);
+
+  /* Row 2 */
+  a0 = pSrcA[8];
+  a1 = pSrcA[9];
+  a2 = pSrcA[10];
+  a3 = pSrcA[11];
+  pDst[8] = (a0 * pSrcB[0]) + (a1 * pSrcB[4]) + (a2 * pSrcB[8]) + (a3 * pSrcB[12]);
+  pDst[9] = (a0 * pSrcB[1]) + (a1 * pSrcB[5]) + (a2 * pSrcB[9]) + (a3 * pSrcB[13]);
+  pDst[10] = (a0 * pSrcB[2]) + (a1 * pSrcB[6]) + (a2 * pSrcB[10]) + (a3 * pSrcB[14]);
+  pDst[11] = (a0 * pSrcB[3]) + (a1 * pSrcB[7]) + (a2 * pSrcB[11]) + (a3 * pSrcB[15]);
+
+  /* Row 3 */
+  a0 = pSrcA[12];
+  a1 = pSrcA[13];
+  a2 = pSrcA[14];
+  a3 = pSrcA[15];
+  pDst[12] = (a0 * pSrcB[0]) + (a1 * pSrcB[4]) + (a2 * pSrcB[8]) + (a3 * pSrcB[12]);
+  pDst[13] = (a0 * pSrcB[1]) + (a1 * pSrcB[5]) + (a2 * pSrcB[9]) + (a3 * pSrcB[13]);
+  pDst[14] = (a0 * pSrcB[2]) + (a1 * pSrcB[6]) + (a2 * pSrcB[10]) + (a3 * pSrcB[14]);
+  pDst[15] = (a0 * pSrcB[3]) + (a1 * pSrcB[7]) + (a2 * pSrcB[11]) + (a3 * pSrcB[15]);
+}
+
+/**
+ * @brief Floating-point 5x5 matrix multiplication.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which must not overlap the inputs.
+ * @return none.
+ */
+
+void arm_mat_mult_5x5_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  float32_t a0, a1, a2, a3, a4;                  /* Row of the first matrix */
+
+  /* Row 0 */
+  a0 = pSrcA[0];
+  a1 = pSrcA[1];
+  a2 = pSrcA[2];
+  a3 = pSrcA[3];
+  a4 = pSrcA[4];
+  pDst[0] = (a0 * pSrcB[0]) + (a1 * pSrcB[5]) + (a2 * pSrcB[10]) + (a3 * pSrcB[15])
+          + (a4 * pSrcB[20]);
+  pDst[1] = (a0 * pSrcB[1]) + (a1 * pSrcB[6]) + (a2 * pSrcB[11]) + (a3 * pSrcB[16])
+          + (a4 * pSrcB[21]);
+  pDst[2] = (a0 * pSrcB[2]) + (a1 * pSrcB[7]) + (a2 * pSrcB[12]) + (a3 * pSrcB[17])
+          + (a4 * pSrcB[22]);
+  pDst[3] = (a0 * pSrcB[3]) + (a1 * pSrcB[8]) + (a2 * pSrcB[13]) + (a3 * pSrcB[18])
+          + (a4 * pSrcB[23]);
+  pDst[4] = (a0 * pSrcB[4]) + (a1 * pSrcB[9]) + (a2 * pSrcB[14]) + (a3 * pSrcB[19])
+          + (a4 * pSrcB[24]);
+
+  /* Row 1 */
+  a0 = pSrcA[5];
+  a1 = pSrcA[6];
+  a2 = pSrcA[7];
+  a3 = pSrcA[8];
+  a4 = pSrcA[9];
+  pDst[5] = (a0 * pSrcB[0]) + (a1 * pSrcB[5]) + (a2 * pSrcB[10]) + (a3 * pSrcB[15])
+          + (a4 * pSrcB[20]);
+  pDst[6] = (a0 * pSrcB[1]) + (a1 * pSrcB[6]) + (a2 * pSrcB[11]) + (a3 * pSrcB[16])
+          + (a4 * pSrcB[21]);
+  pDst[7] = (a0 * pSrcB[2]) + (a1 * pSrcB[7]) + (a2 * pSrcB[12]) + (a3 * pSrcB[17])
+          + (a4 * pSrcB[22]);
+  pDst[8] = (a0 * pSrcB[3]) + (a1 * pSrcB[8]) + (a2 * pSrcB[13]) + (a3 * pSrcB[18])
+          + (a4 * pSrcB[23]);
+  pDst[9] = (a0 * pSrcB[4]) + (a1 * pSrcB[9]) + (a2 * pSrcB[14]) + (a3 * pSrcB[19])
+          + (a4 * pSrcB[24]);
+
+  /* Row 2 */
+  a0 = pSrcA[10];
+  a1 = pSrcA[11];
+  a2 = pSrcA[12];
+  a3 = pSrcA[13];
+  a4 = pSrcA[14];
+  pDst[10] = (a0 * pSrcB[0]) + (a1 * pSrcB[5]) + (a2 * pSrcB[10]) + (a3 * pSrcB[15])
+           + (a4 * pSrcB[20]);
+  pDst[11] = (a0 * pSrcB[1]) + (a1 * pSrcB[6]) + (a2 * pSrcB[11]) + (a3 * pSrcB[16])
+           + (a4 * pSrcB[21]);
+  pDst[12] = (a0 * pSrcB[2]) + (a1 * pSrcB[7]) + (a2 * pSrcB[12]) + (a3 * pSrcB[17])
+           + (a4 * pSrcB[22]);
+  pDst[13] = (a0 * pSrcB[3]) + (a1 * pSrcB[8]) + (a2 * pSrcB[13]) + (a3 * pSrcB[18])
+           + (a4 * pSrcB[23]);
+  pDst[14] = (a0 * pSrcB[4]) + (a1 * pSrcB[9]) + (a2 * pSrcB[14]) + (a3 * pSrcB[19])
+           + (a4 * pSrcB[24]);
+
+  /* Row 3 */
+  a0 = pSrcA[15];
+  a1 = pSrcA[16];
+  a2 = pSrcA[17];
+  a3 = pSrcA[18];
+  a4 = pSrcA[19];
+  pDst[15] = (a0 * pSrcB[0]) + (a1 * pSrcB[5]) + (a2 * pSrcB[10]) + (a3 * pSrcB[15])
+           + (a4 * pSrcB[20]);
+  pDst[16] = (a0 * pSrcB[1]) + (a1 * pSrcB[6]) + (a2 * pSrcB[11]) + (a3 * pSrcB[16])
+           + (a4 * pSrcB[21]);
+  pDst[17] = (a0 * pSrcB[2]) + (a1 * pSrcB[7]) + (a2 * pSrcB[12]) + (a3 * pSrcB[17])
+           + (a4 * pSrcB[22]);
+  pDst[18] = (a0 * pSrcB[3]) + (a1 * pSrcB[8]) + (a2 * pSrcB[13]) + (a3 * pSrcB[18])
+           + (a4 * pSrcB[23]);
+  pDst[19] = (a0 * pSrcB[4]) + (a1 * pSrcB[9]) + (a2 * pSrcB[14]) + (a3 * pSrcB[19])
+           + (a4 * pSrcB[24]);
+
+  /* Row 4 */
+  a0 = pSrcA[20];
+  a1 = pSrcA[21];
+  a2 = pSrcA[22];
+  a3 = pSrcA[23];
+  a4 = pSrcA[24];
+  pDst[20] = (a0 * pSrcB[0]) + (a1 * pSrcB[5]) + (a2 * pSrcB[10]) + (a3 * pSrcB[15])
+           + (a4 * pSrcB[20]);
+  pDst[21] = (a0 * pSrcB[1]) + (a1 * pSrcB[6]) + (a2 * pSrcB[11]) + (a3 * pSrcB[16])
+           + (a4 * pSrcB[21]);
+  pDst[22] = (a0 * pSrcB[2]) + (a1 * pSrcB[7]) + (a2 * pSrcB[12]) + (a3 * pSrcB[17])
+           + (a4 * pSrcB[22]);
+  pDst[23] = (a0 * pSrcB[3]) + (a1 * pSrcB[8]) + (a2 * pSrcB[13]) + (a3 * pSrcB[18])
+           + (a4 * pSrcB[23]);
+  pDst[24] = (a0 * pSrcB[4]) + (a1 * pSrcB[9]) + (a2 * pSrcB[14]) + (a3 * pSrcB[19])
+           + (a4 * pSrcB[24]);
+}
+
+/**
+ * @brief Floating-point 6x6 matrix multiplication.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which must not overlap the inputs.
+ * @return none.
+ */
+
+void arm_mat_mult_6x6_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+  float32_t * pDst)
+{
+  float32_t a0, a1, a2, a3, a4, a5;              /* Row of the first matrix */
+
+  /* Row 0 */
+  a0 = pSrcA[0];
+  a1 = pSrcA[1];
+  a2 = pSrcA[2];
+  a3 = pSrcA[3];
+  a4 = pSrcA[4];
+  a5 = pSrcA[5];
+  pDst[0] = (a0 * pSrcB[0]) + (a1 * pSrcB[6]) + (a2 * pSrcB[12]) + (a3 * pSrcB[18])
+          + (a4 * pSrcB[24]) + (a5 * pSrcB[30]);
+  pDst[1] = (a0 * pSrcB[1]) + (a1 * pSrcB[7]) + (a2 * pSrcB[13]) + (a3 * pSrcB[19])
+          + (a4 * pSrcB[25]) + (a5 * pSrcB[31]);
+  pDst[2] = (a0 * pSrcB[2]) + (a1 * pSrcB[8]) + (a2 * pSrcB[14]) + (a3 * pSrcB[20])
+          + (a4 * pSrcB[26]) + (a5 * pSrcB[32]);
+  pDst[3] = (a0 * pSrcB[3]) + (a1 * pSrcB[9]) + (a2 * pSrcB[15]) + (a3 * pSrcB[21])
+          + (a4 * pSrcB[27]) + (a5 * pSrcB[33]);
+  pDst[4] = (a0 * pSrcB[4]) + (a1 * pSrcB[10]) + (a2 * pSrcB[16]) + (a3 * pSrcB[22])
+          + (a4 * pSrcB[28]) + (a5 * pSrcB[34]);
+  pDst[5] = (a0 * pSrcB[5]) + (a1 * pSrcB[11]) + (a2 * pSrcB[17]) + (a3 * pSrcB[23])
+          + (a4 * pSrcB[29]) + (a5 * pSrcB[35]);
+
+  /* Row 1 */
+  a0 = pSrcA[6];
+  a1 = pSrcA[7];
+  a2 = pSrcA[8];
+  a3 = pSrcA[9];
+  a4 = pSrcA[10];
+  a5 = pSrcA[11];
+  pDst[6] = (a0 * pSrcB[0]) + (a1 * pSrcB[6]) + (a2 * pSrcB[12]) + (a3 * pSrcB[18])
+          + (a4 * pSrcB[24]) + (a5 * pSrcB[30]);
+  pDst[7] = (a0 * pSrcB[1]) + (a1 * pSrcB[7]) + (a2 * pSrcB[13]) + (a3 * pSrcB[19])
+          + (a4 * pSrcB[25]) + (a5 * pSrcB[31]);
+  pDst[8] = (a0 * pSrcB[2]) + (a1 * pSrcB[8]) + (a2 * pSrcB[14]) + (a3 * pSrcB[20])
+          + (a4 * pSrcB[26]) + (a5 * pSrcB[32]);
+  pDst[9] = (a0 * pSrcB[3]) + (a1 * pSrcB[9]) + (a2 * pSrcB[15]) + (a3 * pSrcB[21])
+          + (a4 * pSrcB[27]) + (a5 * pSrcB[33]);
+  pDst[10] = (a0 * pSrcB[4]) + (a1 * pSrcB[10]) + (a2 * pSrcB[16]) + (a3 * pSrcB[22])
+           + (a4 * pSrcB[28]) + (a5 * pSrcB[34]);
+  pDst[11] = (a0 * pSrcB[5]) + (a1 * pSrcB[11]) + (a2 * pSrcB[17]) + (a3 * pSrcB[23])
+           + (a4 * pSrcB[29]) + (a5 * pSrcB[35]);
+
+  /* Row 2 */
+  a0 = pSrcA[12];
+  a1 = pSrcA[13];
+  a2 = pSrcA[14];
+  a3 = pSrcA[15];
+  a4 = pSrcA[16];
+  a5 = pSrcA[17];
+  pDst[12] = (a0 * pSrcB[0]) + (a1 * pSrcB[6]) + (a2 * pSrcB[12]) + (a3 * pSrcB[18])
+           + (a4 * pSrcB[24]) + (a5 * pSrcB[30]);
+  pDst[13] = (a0 * pSrcB[1]) + (a1 * pSrcB[7]) + (a2 * pSrcB[13]) + (a3 * pSrcB[19])
+           + (a4 * pSrcB[25]) + (a5 * pSrcB[31]);
+  pDst[14] = (a0 * pSrcB[2]) + (a1 * pSrcB[8]) + (a2 * pSrcB[14]) + (a3 * pSrcB[20])
+           + (a4 * pSrcB[26]) + (a5 * pSrcB[32]);
+  pDst[15] = (a0 * pSrcB[3]) + (a1 * pSrcB[9]) + (a2 * pSrcB[15]) + (a3 * pSrcB[21])
+           + (a4 * pSrcB[27]) + (a5 * pSrcB[33]);
+  pDst[16] = (a0 * pSrcB[4]) + (a1 * pSrcB[10]) + (a2 * pSrcB[16]) + (a3 * pSrcB[22])
+           + (a4 * pSrcB[28]) + (a5 * pSrcB[34]);
+  pDst[17] = (a0 * pSrcB[5]) + (a1 * pSrcB[11]) + (a2 * pSrcB[17]) + (a3 * pSrcB[23])
+           + (a4 * pSrcB[29]) + (a5 * pSrcB[35]);
+
+  /* Row 3 */
+  a0 = pSrcA[18];
+  a1 = pSrcA[19];
+  a2 = pSrcA[20];
+  a3 = pSrcA[21];
+  a4 = pSrcA[22];
+  a5 = pSrcA[23];
+  pDst[18] = (a0 * pSrcB[0]) + (a1 * pSrcB[6]) + (a2 * pSrcB[12]) + (a3 * pSrcB[18])
+           + (a4 * pSrcB[24]) + (a5 * pSrcB[30]);
+  pDst[19] = (a0 * pSrcB[1]) + (a1 * pSrcB[7]) + (a2 * pSrcB[13]) + (a3 * pSrcB[19])
+           + (a4 * pSrcB[25]) + (a5 * pSrcB[31]);
+  pDst[20] = (a0 * pSrcB[2]) + (a1 * pSrcB[8]) + (a2 * pSrcB[14]) + (a3 * pSrcB[20])
+           + (a4 * pSrcB[26]) + (a5 * pSrcB[32]);
+  pDst[21] = (a0 * pSrcB[3]) + (a1 * pSrcB[9]) + (a2 * pSrcB[15]) + (a3 * pSrcB[21])
+           + (a4 * pSrcB[27]) + (a5 * pSrcB[33]);
+  pDst[22] = (a0 * pSrcB[4]) + (a1 * pSrcB[10]) + (a2 * pSrcB[16]) + (a3 * pSrcB[22])
+           + (a4 * pSrcB[28]) + (a5 * pSrcB[34]);
+  pDst[23] = (a0 * pSrcB[5]) + (a1 * pSrcB[11]) + (a2 * pSrcB[17]) + (a3 * pSrcB[23])
+           + (a4 * pSrcB[29]) + (a5 * pSrcB[35]);
+
+  /* Row 4 */
+  a0 = pSrcA[24];
+  a1 = pSrcA[25];
+  a2 = pSrcA[26];
+  a3 = pSrcA[27];
+  a4 = pSrcA[28];
+  a5 = pSrcA[29];
+  pDst[24] = (a0 * pSrcB[0]) + (a1 * pSrcB[6]) + (a2 * pSrcB[12]) + (a3 * pSrcB[18])
+           + (a4 * pSrcB[24]) + (a5 * pSrcB[30]);
+  pDst[25] = (a0 * pSrcB[1]) + (a1 * pSrcB[7]) + (a2 * pSrcB[13]) + (a3 * pSrcB[19])
+           + (a4 * pSrcB[25]) + (a5 * pSrcB[31]);
+  pDst[26] = (a0 * pSrcB[2]) + (a1 * pSrcB[8]) + (a2 * pSrcB[14]) + (a3 * pSrcB[20])
+           + (a4 * pSrcB[26]) + (a5 * pSrcB[32]);
+  pDst[27] = (a0 * pSrcB[3]) + (a1 * pSrcB[9]) + (a2 * pSrcB[15]) + (a3 * pSrcB[21])
+           + (a4 * pSrcB[27]) + (a5 * pSrcB[33]);
+  pDst[28] = (a0 * pSrcB[4]) + (a1 * pSrcB[10]) + (a2 * pSrcB[16]) + (a3 * pSrcB[22])
+           + (a4 * pSrcB[28]) + (a5 * pSrcB[34]);
+  pDst[29] = (a0 * pSrcB[5]) + (a1 * pSrcB[11]) + (a2 * pSrcB[17]) + (a3 * pSrcB[23])
+           + (a4 * pSrcB[29]) + (a5 * pSrcB[35]);
+
+  /* Row 5 */
+  a0 = pSrcA[30];
+  a1 = pSrcA[31];
+  a2 = pSrcA[32];
+  a3 = pSrcA[33];
+  a4 = pSrcA[34];
+  a5 = pSrcA[35];
+  pDst[30] = (a0 * pSrcB[0]) + (a1 * pSrcB[6]) + (a2 * pSrcB[12]) + (a3 * pSrcB[18])
+           + (a4 * pSrcB[24]) + (a5 * pSrcB[30]);
+  pDst[31] = (a0 * pSrcB[1]) + (a1 * pSrcB[7]) + (a2 * pSrcB[13]) + (a3 * pSrcB[19])
+           + (a4 * pSrcB[25]) + (a5 * pSrcB[31]);
+  pDst[32] = (a0 * pSrcB[2]) + (a1 * pSrcB[8]) + (a2 * pSrcB[14]) + (a3 * pSrcB[20])
+           + (a4 * pSrcB[26]) + (a5 * pSrcB[32]);
+  pDst[33] = (a0 * pSrcB[3]) + (a1 * pSrcB[9]) + (a2 * pSrcB[15]) + (a3 * pSrcB[21])
+           + (a4 * pSrcB[27]) + (a5 * pSrcB[33]);
+  pDst[34] = (a0 * pSrcB[4]) + (a1 * pSrcB[10]) + (a2 * pSrcB[16]) + (a3 * pSrcB[22])
+           + (a4 * pSrcB[28]) + (a5 * pSrcB[34]);
+  pDst[35] = (a0 * pSrcB[5]) + (a1 * pSrcB[11]) + (a2 * pSrcB[17]) + (a3 * pSrcB[23])
+           + (a4 * pSrcB[29]) + (a5 * pSrcB[35]);
+}
+
+/**
+ * @brief Floating-point matrix multiplication, using the fixed-size kernels for small matrices.
+ * @param[in]  pSrcA  points to the first input matrix structure.
+ * @param[in]  pSrcB  points to the second input matrix structure.
+ * @param[out] pDst   points to output matrix structure.
+ * @return The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * Square matrices of 2x2 to 6x6 elements are multiplied by arm_mat_mult_2x2_f32()
+ * to arm_mat_mult_6x6_f32(), whose loops are fully unrolled: they need neither loop
+ * counters nor pointer updates. Other sizes are passed to arm_mat_mult_f32().
+ */
+
+arm_status arm_mat_mult_small_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  uint16_t n = pSrcA->numRows;                   /* Size of the square matrices */
+
+  /* One size check selects the kernel */
+  if ((pSrcA->numCols == n) && (pSrcB->numRows == n) && (pSrcB->numCols == n) &&
+      (pDst->numRows == n) && (pDst->numCols == n))
+  {
+    switch (n)
+    {
+    case 2U:
+      arm_mat_mult_2x2_f32(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 3U:
+      arm_mat_mult_3x3_f32(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 4U:
+      arm_mat_mult_4x4_f32(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 5U:
+      arm_mat_mult_5x5_f32(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 6U:
+      arm_mat_mult_6x6_f32(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    default:
+      break;
+    }
+  }
+
+  /* Other sizes use the generic function */
+  return (arm_mat_mult_f32(pSrcA, pSrcB, pDst));
+}
+
+/**
+ * @} end of MatrixMult group
+ */
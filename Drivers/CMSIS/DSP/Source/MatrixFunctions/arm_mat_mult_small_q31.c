@@ -0,0 +1,848 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_small_q31.c
+ * Description:  Fixed-size Q31 matrix multiplication
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * @brief Q31 2x2 matrix multiplication.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which must not overlap the inputs.
+ * @return none.
+ */
+
+void arm_mat_mult_2x2_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst)
+{
+  q31_t a0, a1;                                  /* Row of the first matrix */
+  q63_t sum;                                     /* Accumulator */
+
+  /* Row 0 */
+  a0 = pSrcA[0];
+  a1 = pSrcA[1];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[2];
+  pDst[0] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[3];
+  pDst[1] = clip_q63_to_q31(sum >> 31);
+
+  /* Row 1 */
+  a0 = pSrcA[2];
+  a1 = pSrcA[3];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[2];
+  pDst[2] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[3];
+  pDst[3] = clip_q63_to_q31(sum >> 31);
+}
+
+/**
+ * @brief Q31 3x3 matrix multiplication.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which must not overlap the inputs.
+ * @return none.
+ */
+
+void arm_mat_mult_3x3_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst)
+{
+  q31_t a0, a1, a2;                              /* Row of the first matrix */
+  q63_t sum;                                     /* Accumulator */
+
+  /* Row 0 */
+  a0 = pSrcA[0];
+  a1 = pSrcA[1];
+  a2 = pSrcA[2];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[3];
+  sum += (q63_t) a2 * pSrcB[6];
+  pDst[0] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[4];
+  sum += (q63_t) a2 * pSrcB[7];
+  pDst[1] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[5];
+  sum += (q63_t) a2 * pSrcB[8];
+  pDst[2] = clip_q63_to_q31(sum >> 31);
+
+  /* Row 1 */
+  a0 = pSrcA[3];
+  a1 = pSrcA[4];
+  a2 = pSrcA[5];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[3];
+  sum += (q63_t) a2 * pSrcB[6];
+  pDst[3] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[4];
+  sum += (q63_t) a2 * pSrcB[7];
+  pDst[4] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[5];
+  sum += (q63_t) a2 * pSrcB[8];
+  pDst[5] = clip_q63_to_q31(sum >> 31);
+
+  /* Row 2 */
+  a0 = pSrcA[6];
+  a1 = pSrcA[7];
+  a2 = pSrcA[8];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[3];
+  sum += (q63_t) a2 * pSrcB[6];
+  pDst[6] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[4];
+  sum += (q63_t) a2 * pSrcB[7];
+  pDst[7] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[5];
+  sum += (q63_t) a2 * pSrcB[8];
+  pDst[8] = clip_q63_to_q31(sum >> 31);
+}
+
+/**
+ * @brief Q31 4x4 matrix multiplication.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which must not overlap the inputs.
+ * @return none.
+ */
+
+void arm_mat_mult_4x4_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst)
+{
+  q31_t a0, a1, a2, a3;                          /* Row of the first matrix */
+  q63_t sum;                                     /* Accumulator */
+
+  /* Row 0 */
+  a0 = pSrcA[0];
+  a1 = pSrcA[1];
+  a2 = pSrcA[2];
+  a3 = pSrcA[3];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[4];
+  sum += (q63_t) a2 * pSrcB[8];
+  sum += (q63_t) a3 * pSrcB[12];
+  pDst[0] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[5];
+  sum += (q63_t) a2 * pSrcB[9];
+  sum += (q63_t) a3 * pSrcB[13];
+  pDst[1] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[6];
+  sum += (q63_t) a2 * pSrcB[10];
+  sum += (q63_t) a3 * pSrcB[14];
+  pDst[2] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[3];
+  sum += (q63_t) a1 * pSrcB[7];
+  sum += (q63_t) a2 * pSrcB[11];
+  sum += (q63_t) a3 * pSrcB[15];
+  pDst[3] = clip_q63_to_q31(sum >> 31);
+
+  /* Row 1 */
+  a0 = pSrcA[4];
+  a1 = pSrcA[5];
+  a2 = pSrcA[6];
+  a3 = pSrcA[7];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[4];
+  sum += (q63_t) a2 * pSrcB[8];
+  sum += (q63_t) a3 * pSrcB[12];
+  pDst[4] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[5];
+  sum += (q63_t) a2 * pSrcB[9];
+  sum += (q63_t) a3 * pSrcB[13];
+  pDst[5] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[6];
+  sum += (q63_t) a2 * pSrcB[10];
+  sum += (q63_t) a3 * pSrcB[14];
+  pDst[6] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[3];
+  sum += (q63_t) a1 * pSrcB[7];
+  sum += (q63_t) a2 * pSrcB[11];
+  sum += (q63_t) a3 * pSrcB[15];
+  pDst[7] = clip_q63_to_q31(sum >> 31);
+
+  /* Row 2 */
+  a0 = pSrcA[8];
+  a1 = pSrcA[9];
+  a2 = pSrcA[10];
+  a3 = pSrcA[11];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[4];
+  sum += (q63_t) a2 * pSrcB[8];
+  sum += (q63_t) a3 * pSrcB[12];
+  pDst[8] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[5];
+  sum += (q63_t) a2 * pSrcB[9];
+  sum += (q63_t) a3 * pSrcB[13];
+  pDst[9] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[6];
+  sum += (q63_t) a2 * pSrcB[10];
+  sum += (q63_t) a3 * pSrcB[14];
+  pDst[10] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[3];
+  sum += (q63_t) a1 * pSrcB[7];
+  sum += (q63_t) a2 * pSrcB[11];
+  sum += (q63_t) a3 * pSrcB[15];
+  pDst[11] = clip_q63_to_q31(sum >> 31);
+
+  /* Row 3 */
+  a0 = pSrcA[12];
+  a1 = pSrcA[13];
+  a2 = pSrcA[14];
+  a3 = pSrcA[15];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[4];
+  sum += (q63_t) a2 * pSrcB[8];
+  sum += (q63_t) a3 * pSrcB[12];
+  pDst[12] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[5];
+  sum += (q63_t) a2 * pSrcB[9];
+  sum += (q63_t) a3 * pSrcB[13];
+  pDst[13] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[6];
+  sum += (q63_t) a2 * pSrcB[10];
+  sum += (q63_t) a3 * pSrcB[14];
+  pDst[14] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[3];
+  sum += (q63_t) a1 * pSrcB[7];
+  sum += (q63_t) a2 * pSrcB[11];
+  sum += (q63_t) a3 * pSrcB[15];
+  pDst[15] = clip_q63_to_q31(sum >> 31);
+}
+
+/**
+ * @brief Q31 5x5 matrix multiplication.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which must not overlap the inputs.
+ * @return none.
+ */
+
+void arm_mat_mult_5x5_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst)
+{
+  q31_t a0, a1, a2, a3, a4;                      /* Row of the first matrix */
+  q63_t sum;                                     /* Accumulator */
+
+  /* Row 0 */
+  a0 = pSrcA[0];
+  a1 = pSrcA[1];
+  a2 = pSrcA[2];
+  a3 = pSrcA[3];
+  a4 = pSrcA[4];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[5];
+  sum += (q63_t) a2 * pSrcB[10];
+  sum += (q63_t) a3 * pSrcB[15];
+  sum += (q63_t) a4 * pSrcB[20];
+  pDst[0] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[6];
+  sum += (q63_t) a2 * pSrcB[11];
+  sum += (q63_t) a3 * pSrcB[16];
+  sum += (q63_t) a4 * pSrcB[21];
+  pDst[1] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[7];
+  sum += (q63_t) a2 * pSrcB[12];
+  sum += (q63_t) a3 * pSrcB[17];
+  sum += (q63_t) a4 * pSrcB[22];
+  pDst[2] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[3];
+  sum += (q63_t) a1 * pSrcB[8];
+  sum += (q63_t) a2 * pSrcB[13];
+  sum += (q63_t) a3 * pSrcB[18];
+  sum += (q63_t) a4 * pSrcB[23];
+  pDst[3] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[4];
+  sum += (q63_t) a1 * pSrcB[9];
+  sum += (q63_t) a2 * pSrcB[14];
+  sum += (q63_t) a3 * pSrcB[19];
+  sum += (q63_t) a4 * pSrcB[24];
+  pDst[4] = clip_q63_to_q31(sum >> 31);
+
+  /* Row 1 */
+  a0 = pSrcA[5];
+  a1 = pSrcA[6];
+  a2 = pSrcA[7];
+  a3 = pSrcA[8];
+  a4 = pSrcA[9];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[5];
+  sum += (q63_t) a2 * pSrcB[10];
+  sum += (q63_t) a3 * pSrcB[15];
+  sum += (q63_t) a4 * pSrcB[20];
+  pDst[5] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[6];
+  sum += (q63_t) a2 * pSrcB[11];
+  sum += (q63_t) a3 * pSrcB[16];
+  sum += (q63_t) a4 * pSrcB[21];
+  pDst[6] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[7];
+  sum += (q63_t) a2 * pSrcB[12];
+  sum += (q63_t) a3 * pSrcB[17];
+  sum += (q63_t) a4 * pSrcB[22];
+  pDst[7] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[3];
+  sum += (q63_t) a1 * pSrcB[8];
+  sum += (q63_t) a2 * pSrcB[13];
+  sum += (q63_t) a3 * pSrcB[18];
+  sum += (q63_t) a4 * pSrcB[23];
+  pDst[8] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[4];
+  sum += (q63_t) a1 * pSrcB[9];
+  sum += (q63_t) a2 * pSrcB[14];
+  sum += (q63_t) a3 * pSrcB[19];
+  sum += (q63_t) a4 * pSrcB[24];
+  pDst[9] = clip_q63_to_q31(sum >> 31);
+
+  /* Row 2 */
+  a0 = pSrcA[10];
+  a1 = pSrcA[11];
+  a2 = pSrcA[12];
+  a3 = pSrcA[13];
+  a4 = pSrcA[14];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[5];
+  sum += (q63_t) a2 * pSrcB[10];
+  sum += (q63_t) a3 * pSrcB[15];
+  sum += (q63_t) a4 * pSrcB[20];
+  pDst[10] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[6];
+  sum += (q63_t) a2 * pSrcB[11];
+  sum += (q63_t) a3 * pSrcB[16];
+  sum += (q63_t) a4 * pSrcB[21];
+  pDst[11] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[7];
+  sum += (q63_t) a2 * pSrcB[12];
+  sum += (q63_t) a3 * pSrcB[17];
+  sum += (q63_t) a4 * pSrcB[22];
+  pDst[12] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[3];
+  sum += (q63_t) a1 * pSrcB[8];
+  sum += (q63_t) a2 * pSrcB[13];
+  sum += (q63_t) a3 * pSrcB[18];
+  sum += (q63_t) a4 * pSrcB[23];
+  pDst[13] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[4];
+  sum += (q63_t) a1 * pSrcB[9];
+  sum += (q63_t) a2 * pSrcB[14];
+  sum += (q63_t) a3 * pSrcB[19];
+  sum += (q63_t) a4 * pSrcB[24];
+  pDst[14] = clip_q63_to_q31(sum >> 31);
+
+  /* Row 3 */
+  a0 = pSrcA[15];
+  a1 = pSrcA[16];
+  a2 = pSrcA[17];
+  a3 = pSrcA[18];
+  a4 = pSrcA[19];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[5];
+  sum += (q63_t) a2 * pSrcB[10];
+  sum += (q63_t) a3 * pSrcB[15];
+  sum += (q63_t) a4 * pSrcB[20];
+  pDst[15] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[6];
+  sum += (q63_t) a2 * pSrcB[11];
+  sum += (q63_t) a3 * pSrcB[16];
+  sum += (q63_t) a4 * pSrcB[21];
+  pDst[16] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[7];
+  sum += (q63_t) a2 * pSrcB[12];
+  sum += (q63_t) a3 * pSrcB[17];
+  sum += (q63_t) a4 * pSrcB[22];
+  pDst[17] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[3];
+  sum += (q63_t) a1 * pSrcB[8];
+  sum += (q63_t) a2 * pSrcB[13];
+  sum += (q63_t) a3 * pSrcB[18];
+  sum += (q63_t) a4 * pSrcB[23];
+  pDst[18] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[4];
+  sum += (q63_t) a1 * pSrcB[9];
+  sum += (q63_t) a2 * pSrcB[14];
+  sum += (q63_t) a3 * pSrcB[19];
+  sum += (q63_t) a4 * pSrcB[24];
+  pDst[19] = clip_q63_to_q31(sum >> 31);
+
+  /* Row 4 */
+  a0 = pSrcA[20];
+  a1 = pSrcA[21];
+  a2 = pSrcA[22];
+  a3 = pSrcA[23];
+  a4 = pSrcA[24];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[5];
+  sum += (q63_t) a2 * pSrcB[10];
+  sum += (q63_t) a3 * pSrcB[15];
+  sum += (q63_t) a4 * pSrcB[20];
+  pDst[20] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[6];
+  sum += (q63_t) a2 * pSrcB[11];
+  sum += (q63_t) a3 * pSrcB[16];
+  sum += (q63_t) a4 * pSrcB[21];
+  pDst[21] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[7];
+  sum += (q63_t) a2 * pSrcB[12];
+  sum += (q63_t) a3 * pSrcB[17];
+  sum += (q63_t) a4 * pSrcB[22];
+  pDst[22] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[3];
+  sum += (q63_t) a1 * pSrcB[8];
+  sum += (q63_t) a2 * pSrcB[13];
+  sum += (q63_t) a3 * pSrcB[18];
+  sum += (q63_t) a4 * pSrcB[23];
+  pDst[23] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[4];
+  sum += (q63_t) a1 * pSrcB[9];
+  sum += (q63_t) a2 * pSrcB[14];
+  sum += (q63_t) a3 * pSrcB[19];
+  sum += (q63_t) a4 * pSrcB[24];
+  pDst[24] = clip_q63_to_q31(sum >> 31);
+}
+
+/**
+ * @brief Q31 6x6 matrix multiplication.
+ * @param[in]  pSrcA  points to the first input matrix, stored row by row.
+ * @param[in]  pSrcB  points to the second input matrix, stored row by row.
+ * @param[out] pDst   points to the output matrix, which must not overlap the inputs.
+ * @return none.
+ */
+
+void arm_mat_mult_6x6_q31(
+  const q31_t * pSrcA,
+  const q31_t * pSrcB,
+  q31_t * pDst)
+{
+  q31_t a0, a1, a2, a3, a4, a5;                  /* Row of the first matrix */
+  q63_t sum;                                     /* Accumulator */
+
+  /* Row 0 */
+  a0 = pSrcA[0];
+  a1 = pSrcA[1];
+  a2 = pSrcA[2];
+  a3 = pSrcA[3];
+  a4 = pSrcA[4];
+  a5 = pSrcA[5];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[6];
+  sum += (q63_t) a2 * pSrcB[12];
+  sum += (q63_t) a3 * pSrcB[18];
+  sum += (q63_t) a4 * pSrcB[24];
+  sum += (q63_t) a5 * pSrcB[30];
+  pDst[0] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[7];
+  sum += (q63_t) a2 * pSrcB[13];
+  sum += (q63_t) a3 * pSrcB[19];
+  sum += (q63_t) a4 * pSrcB[25];
+  sum += (q63_t) a5 * pSrcB[31];
+  pDst[1] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[8];
+  sum += (q63_t) a2 * pSrcB[14];
+  sum += (q63_t) a3 * pSrcB[20];
+  sum += (q63_t) a4 * pSrcB[26];
+  sum += (q63_t) a5 * pSrcB[32];
+  pDst[2] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[3];
+  sum += (q63_t) a1 * pSrcB[9];
+  sum += (q63_t) a2 * pSrcB[15];
+  sum += (q63_t) a3 * pSrcB[21];
+  sum += (q63_t) a4 * pSrcB[27];
+  sum += (q63_t) a5 * pSrcB[33];
+  pDst[3] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[4];
+  sum += (q63_t) a1 * pSrcB[10];
+  sum += (q63_t) a2 * pSrcB[16];
+  sum += (q63_t) a3 * pSrcB[22];
+  sum += (q63_t) a4 * pSrcB[28];
+  sum += (q63_t) a5 * pSrcB[34];
+  pDst[4] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[5];
+  sum += (q63_t) a1 * pSrcB[11];
+  sum += (q63_t) a2 * pSrcB[17];
+  sum += (q63_t) a3 * pSrcB[23];
+  sum += (q63_t) a4 * pSrcB[29];
+  sum += (q63_t) a5 * pSrcB[35];
+  pDst[5] = clip_q63_to_q31(sum >> 31);
+
+  /* Row 1 */
+  a0 = pSrcA[6];
+  a1 = pSrcA[7];
+  a2 = pSrcA[8];
+  a3 = pSrcA[9];
+  a4 = pSrcA[10];
+  a5 = pSrcA[11];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[6];
+  sum += (q63_t) a2 * pSrcB[12];
+  sum += (q63_t) a3 * pSrcB[18];
+  sum += (q63_t) a4 * pSrcB[24];
+  sum += (q63_t) a5 * pSrcB[30];
+  pDst[6] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[7];
+  sum += (q63_t) a2 * pSrcB[13];
+  sum += (q63_t) a3 * pSrcB[19];
+  sum += (q63_t) a4 * pSrcB[25];
+  sum += (q63_t) a5 * pSrcB[31];
+  pDst[7] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[8];
+  sum += (q63_t) a2 * pSrcB[14];
+  sum += (q63_t) a3 * pSrcB[20];
+  sum += (q63_t) a4 * pSrcB[26];
+  sum += (q63_t) a5 * pSrcB[32];
+  pDst[8] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[3];
+  sum += (q63_t) a1 * pSrcB[9];
+  sum += (q63_t) a2 * pSrcB[15];
+  sum += (q63_t) a3 * pSrcB[21];
+  sum += (q63_t) a4 * pSrcB[27];
+  sum += (q63_t) a5 * pSrcB[33];
+  pDst[9] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[4];
+  sum += (q63_t) a1 * pSrcB[10];
+  sum += (q63_t) a2 * pSrcB[16];
+  sum += (q63_t) a3 * pSrcB[22];
+  sum += (q63_t) a4 * pSrcB[28];
+  sum += (q63_t) a5 * pSrcB[34];
+  pDst[10] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[5];
+  sum += (q63_t) a1 * pSrcB[11];
+  sum += (q63_t) a2 * pSrcB[17];
+  sum += (q63_t) a3 * pSrcB[23];
+  sum += (q63_t) a4 * pSrcB[29];
+  sum += (q63_t) a5 * pSrcB[35];
+  pDst[11] = clip_q63_to_q31(sum >> 31);
+
+  /* Row 2 */
+  a0 = pSrcA[12];
+  a1 = pSrcA[13];
+  a2 = pSrcA[14];
+  a3 = pSrcA[15];
+  a4 = pSrcA[16];
+  a5 = pSrcA[17];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[6];
+  sum += (q63_t) a2 * pSrcB[12];
+  sum += (q63_t) a3 * pSrcB[18];
+  sum += (q63_t) a4 * pSrcB[24];
+  sum += (q63_t) a5 * pSrcB[30];
+  pDst[12] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[7];
+  sum += (q63_t) a2 * pSrcB[13];
+  sum += (q63_t) a3 * pSrcB[19];
+  sum += (q63_t) a4 * pSrcB[25];
+  sum += (q63_t) a5 * pSrcB[31];
+  pDst[13] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[8];
+  sum += (q63_t) a2 * pSrcB[14];
+  sum += (q63_t) a3 * pSrcB[20];
+  sum += (q63_t) a4 * pSrcB[26];
+  sum += (q63_t) a5 * pSrcB[32];
+  pDst[14] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[3];
+  sum += (q63_t) a1 * pSrcB[9];
+  sum += (q63_t) a2 * pSrcB[15];
+  sum += (q63_t) a3 * pSrcB[21];
+  sum += (q63_t) a4 * pSrcB[27];
+  sum += (q63_t) a5 * pSrcB[33];
+  pDst[15] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[4];
+  sum += (q63_t) a1 * pSrcB[10];
+  sum += (q63_t) a2 * pSrcB[16];
+  sum += (q63_t) a3 * pSrcB[22];
+  sum += (q63_t) a4 * pSrcB[28];
+  sum += (q63_t) a5 * pSrcB[34];
+  pDst[16] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[5];
+  sum += (q63_t) a1 * pSrcB[11];
+  sum += (q63_t) a2 * pSrcB[17];
+  sum += (q63_t) a3 * pSrcB[23];
+  sum += (q63_t) a4 * pSrcB[29];
+  sum += (q63_t) a5 * pSrcB[35];
+  pDst[17] = clip_q63_to_q31(sum >> 31);
+
+  /* Row 3 */
+  a0 = pSrcA[18];
+  a1 = pSrcA[19];
+  a2 = pSrcA[20];
+  a3 = pSrcA[21];
+  a4 = pSrcA[22];
+  a5 = pSrcA[23];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[6];
+  sum += (q63_t) a2 * pSrcB[12];
+  sum += (q63_t) a3 * pSrcB[18];
+  sum += (q63_t) a4 * pSrcB[24];
+  sum += (q63_t) a5 * pSrcB[30];
+  pDst[18] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[7];
+  sum += (q63_t) a2 * pSrcB[13];
+  sum += (q63_t) a3 * pSrcB[19];
+  sum += (q63_t) a4 * pSrcB[25];
+  sum += (q63_t) a5 * pSrcB[31];
+  pDst[19] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[8];
+  sum += (q63_t) a2 * pSrcB[14];
+  sum += (q63_t) a3 * pSrcB[20];
+  sum += (q63_t) a4 * pSrcB[26];
+  sum += (q63_t) a5 * pSrcB[32];
+  pDst[20] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[3];
+  sum += (q63_t) a1 * pSrcB[9];
+  sum += (q63_t) a2 * pSrcB[15];
+  sum += (q63_t) a3 * pSrcB[21];
+  sum += (q63_t) a4 * pSrcB[27];
+  sum += (q63_t) a5 * pSrcB[33];
+  pDst[21] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[4];
+  sum += (q63_t) a1 * pSrcB[10];
+  sum += (q63_t) a2 * pSrcB[16];
+  sum += (q63_t) a3 * pSrcB[22];
+  sum += (q63_t) a4 * pSrcB[28];
+  sum += (q63_t) a5 * pSrcB[34];
+  pDst[22] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[5];
+  sum += (q63_t) a1 * pSrcB[11];
+  sum += (q63_t) a2 * pSrcB[17];
+  sum += (q63_t) a3 * pSrcB[23];
+  sum += (q63_t) a4 * pSrcB[29];
+  sum += (q63_t) a5 * pSrcB[35];
+  pDst[23] = clip_q63_to_q31(sum >> 31);
+
+  /* Row 4 */
+  a0 = pSrcA[24];
+  a1 = pSrcA[25];
+  a2 = pSrcA[26];
+  a3 = pSrcA[27];
+  a4 = pSrcA[28];
+  a5 = pSrcA[29];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[6];
+  sum += (q63_t) a2 * pSrcB[12];
+  sum += (q63_t) a3 * pSrcB[18];
+  sum += (q63_t) a4 * pSrcB[24];
+  sum += (q63_t) a5 * pSrcB[30];
+  pDst[24] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[7];
+  sum += (q63_t) a2 * pSrcB[13];
+  sum += (q63_t) a3 * pSrcB[19];
+  sum += (q63_t) a4 * pSrcB[25];
+  sum += (q63_t) a5 * pSrcB[31];
+  pDst[25] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[8];
+  sum += (q63_t) a2 * pSrcB[14];
+  sum += (q63_t) a3 * pSrcB[20];
+  sum += (q63_t) a4 * pSrcB[26];
+  sum += (q63_t) a5 * pSrcB[32];
+  pDst[26] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[3];
+  sum += (q63_t) a1 * pSrcB[9];
+  sum += (q63_t) a2 * pSrcB[15];
+  sum += (q63_t) a3 * pSrcB[21];
+  sum += (q63_t) a4 * pSrcB[27];
+  sum += (q63_t) a5 * pSrcB[33];
+  pDst[27] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[4];
+  sum += (q63_t) a1 * pSrcB[10];
+  sum += (q63_t) a2 * pSrcB[16];
+  sum += (q63_t) a3 * pSrcB[22];
+  sum += (q63_t) a4 * pSrcB[28];
+  sum += (q63_t) a5 * pSrcB[34];
+  pDst[28] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[5];
+  sum += (q63_t) a1 * pSrcB[11];
+  sum += (q63_t) a2 * pSrcB[17];
+  sum += (q63_t) a3 * pSrcB[23];
+  sum += (q63_t) a4 * pSrcB[29];
+  sum += (q63_t) a5 * pSrcB[35];
+  pDst[29] = clip_q63_to_q31(sum >> 31);
+
+  /* Row 5 */
+  a0 = pSrcA[30];
+  a1 = pSrcA[31];
+  a2 = pSrcA[32];
+  a3 = pSrcA[33];
+  a4 = pSrcA[34];
+  a5 = pSrcA[35];
+  sum = (q63_t) a0 * pSrcB[0];
+  sum += (q63_t) a1 * pSrcB[6];
+  sum += (q63_t) a2 * pSrcB[12];
+  sum += (q63_t) a3 * pSrcB[18];
+  sum += (q63_t) a4 * pSrcB[24];
+  sum += (q63_t) a5 * pSrcB[30];
+  pDst[30] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[1];
+  sum += (q63_t) a1 * pSrcB[7];
+  sum += (q63_t) a2 * pSrcB[13];
+  sum += (q63_t) a3 * pSrcB[19];
+  sum += (q63_t) a4 * pSrcB[25];
+  sum += (q63_t) a5 * pSrcB[31];
+  pDst[31] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[2];
+  sum += (q63_t) a1 * pSrcB[8];
+  sum += (q63_t) a2 * pSrcB[14];
+  sum += (q63_t) a3 * pSrcB[20];
+  sum += (q63_t) a4 * pSrcB[26];
+  sum += (q63_t) a5 * pSrcB[32];
+  pDst[32] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[3];
+  sum += (q63_t) a1 * pSrcB[9];
+  sum += (q63_t) a2 * pSrcB[15];
+  sum += (q63_t) a3 * pSrcB[21];
+  sum += (q63_t) a4 * pSrcB[27];
+  sum += (q63_t) a5 * pSrcB[33];
+  pDst[33] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[4];
+  sum += (q63_t) a1 * pSrcB[10];
+  sum += (q63_t) a2 * pSrcB[16];
+  sum += (q63_t) a3 * pSrcB[22];
+  sum += (q63_t) a4 * pSrcB[28];
+  sum += (q63_t) a5 * pSrcB[34];
+  pDst[34] = clip_q63_to_q31(sum >> 31);
+  sum = (q63_t) a0 * pSrcB[5];
+  sum += (q63_t) a1 * pSrcB[11];
+  sum += (q63_t) a2 * pSrcB[17];
+  sum += (q63_t) a3 * pSrcB[23];
+  sum += (q63_t) a4 * pSrcB[29];
+  sum += (q63_t) a5 * pSrcB[35];
+  pDst[35] = clip_q63_to_q31(sum >> 31);
+}
+
+/**
+ * @brief Q31 matrix multiplication, using the fixed-size kernels for small matrices.
+ * @param[in]  pSrcA  points to the first input matrix structure.
+ * @param[in]  pSrcB  points to the second input matrix structure.
+ * @param[out] pDst   points to output matrix structure.
+ * @return The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * Square matrices of 2x2 to 6x6 elements are multiplied by arm_mat_mult_2x2_q31()
+ * to arm_mat_mult_6x6_q31(), whose loops are fully unrolled: they need neither loop
+ * counters nor pointer updates. Other sizes are passed to arm_mat_mult_q31().
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The kernels accumulate the products in 2.62 format as arm_mat_mult_q31() does,
+ * and saturate the result to 1.31 format.
+ */
+
+arm_status arm_mat_mult_small_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst)
+{
+  uint16_t n = pSrcA->numRows;                   /* Size of the square matrices */
+
+  /* One size check selects the kernel */
+  if ((pSrcA->numCols == n) && (pSrcB->numRows == n) && (pSrcB->numCols == n) &&
+      (pDst->numRows == n) && (pDst->numCols == n))
+  {
+    switch (n)
+    {
+    case 2U:
+      arm_mat_mult_2x2_q31(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 3U:
+      arm_mat_mult_3x3_q31(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 4U:
+      arm_mat_mult_4x4_q31(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 5U:
+      arm_mat_mult_5x5_q31(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 6U:
+      arm_mat_mult_6x6_q31(pSrcA->pData, pSrcB->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    default:
+      break;
+    }
+  }
+
+  /* Other sizes use the generic function */
+  return (arm_mat_mult_q31(pSrcA, pSrcB, pDst));
+}
+
+/**
+ * @} end of MatrixMult group
+ */
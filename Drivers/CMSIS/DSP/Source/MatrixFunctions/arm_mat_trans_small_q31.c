@@ -0,0 +1,250 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_trans_small_q31.c
+ * Description:  Fixed-size Q31 matrix transpose
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixTrans
+ * @{
+ */
+
+/**
+ * @brief Q31 2x2 matrix transpose.
+ * @param[in]  pSrc  points to the input matrix, stored row by row.
+ * @param[out] pDst  points to the output matrix, which must not overlap the input.
+ * @return none.
+ */
+
+void arm_mat_trans_2x2_q31(
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  pDst[0] = pSrc[0];
+  pDst[1] = pSrc[2];
+  pDst[2] = pSrc[1];
+  pDst[3] = pSrc[3];
+}
+
+/**
+ * @brief Q31 3x3 matrix transpose.
+ * @param[in]  pSrc  points to the input matrix, stored row by row.
+ * @param[out] pDst  points to the output matrix, which must not overlap the input.
+ * @return none.
+ */
+
+void arm_mat_trans_3x3_q31(
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  pDst[0] = pSrc[0];
+  pDst[1] = pSrc[3];
+  pDst[2] = pSrc[6];
+  pDst[3] = pSrc[1];
+  pDst[4] = pSrc[4];
+  pDst[5] = pSrc[7];
+  pDst[6] = pSrc[2];
+  pDst[7] = pSrc[5];
+  pDst[8] = pSrc[8];
+}
+
+/**
+ * @brief Q31 4x4 matrix transpose.
+ * @param[in]  pSrc  points to the input matrix, stored row by row.
+ * @param[out] pDst  points to the output matrix, which must not overlap the input.
+ * @return none.
+ */
+
+void arm_mat_trans_4x4_q31(
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  pDst[0] = pSrc[0];
+  pDst[1] = pSrc[4];
+  pDst[2] = pSrc[8];
+  pDst[3] = pSrc[12];
+  pDst[4] = pSrc[1];
+  pDst[5] = pSrc[5];
+  pDst[6] = pSrc[9];
+  pDst[7] = pSrc[13];
+  pDst[8] = pSrc[2];
+  pDst[9] = pSrc[6];
+  pDst[10] = pSrc[10];
+  pDst[11] = pSrc[14];
+  pDst[12] = pSrc[3];
+  pDst[13] = pSrc[7];
+  pDst[14] = pSrc[11];
+  pDst[15] = pSrc[15];
+}
+
+/**
+ * @brief Q31 5x5 matrix transpose.
+ * @param[in]  pSrc  points to the input matrix, stored row by row.
+ * @param[out] pDst  points to the output matrix, which must not overlap the input.
+ * @return none.
+ */
+
+void arm_mat_trans_5x5_q31(
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  pDst[0] = pSrc[0];
+  pDst[1] = pSrc[5];
+  pDst[2] = pSrc[10];
+  pDst[3] = pSrc[15];
+  pDst[4] = pSrc[20];
+  pDst[5] = pSrc[1];
+  pDst[6] = pSrc[6];
+  pDst[7] = pSrc[11];
+  pDst[8] = pSrc[16];
+  pDst[9] = pSrc[21];
+  pDst[10] = pSrc[2];
+  pDst[11] = pSrc[7];
+  pDst[12] = pSrc[12];
+  pDst[13] = pSrc[17];
+  pDst[14] = pSrc[22];
+  pDst[15] = pSrc[3];
+  pDst[16] = pSrc[8];
+  pDst[17] = pSrc[13];
+  pDst[18] = pSrc[18];
+  pDst[19] = pSrc[23];
+  pDst[20] = pSrc[4];
+  pDst[21] = pSrc[9];
+  pDst[22] = pSrc[14];
+  pDst[23] = pSrc[19];
+  pDst[24] = pSrc[24];
+}
+
+/**
+ * @brief Q31 6x6 matrix transpose.
+ * @param[in]  pSrc  points to the input matrix, stored row by row.
+ * @param[out] pDst  points to the output matrix, which must not overlap the input.
+ * @return none.
+ */
+
+void arm_mat_trans_6x6_q31(
+  const q31_t * pSrc,
+  q31_t * pDst)
+{
+  pDst[0] = pSrc[0];
+  pDst[1] = pSrc[6];
+  pDst[2] = pSrc[12];
+  pDst[3] = pSrc[18];
+  pDst[4] = pSrc[24];
+  pDst[5] = pSrc[30];
+  pDst[6] = pSrc[1];
+  pDst[7] = pSrc[7];
+  pDst[8] = pSrc[13];
+  pDst[9] = pSrc[19];
+  pDst[10] = pSrc[25];
+  pDst[11] = pSrc[31];
+  pDst[12] = pSrc[2];
+  pDst[13] = pSrc[8];
+  pDst[14] = pSrc[14];
+  pDst[15] = pSrc[20];
+  pDst[16] = pSrc[26];
+  pDst[17] = pSrc[32];
+  pDst[18] = pSrc[3];
+  pDst[19] = pSrc[9];
+  pDst[20] = pSrc[15];
+  pDst[21] = pSrc[21];
+  pDst[22] = pSrc[27];
+  pDst[23] = pSrc[33];
+  pDst[24] = pSrc[4];
+  pDst[25] = pSrc[10];
+  pDst[26] = pSrc[16];
+  pDst[27] = pSrc[22];
+  pDst[28] = pSrc[28];
+  pDst[29] = pSrc[34];
+  pDst[30] = pSrc[5];
+  pDst[31] = pSrc[11];
+  pDst[32] = pSrc[17];
+  pDst[33] = pSrc[23];
+  pDst[34] = pSrc[29];
+  pDst[35] = pSrc[35];
+}
+
+/**
+ * @brief Q31 matrix transpose, using the fixed-size kernels for small matrices.
+ * @param[in]  pSrc  points to the input matrix structure.
+ * @param[out] pDst  points to output matrix structure.
+ * @return The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * Square matrices of 2x2 to 6x6 elements are transposed by arm_mat_trans_2x2_q31() to
+ * arm_mat_trans_6x6_q31(), whose loops are fully unrolled. Other sizes are passed to
+ * arm_mat_trans_q31().
+ */
+
+arm_status arm_mat_trans_small_q31(
+  const arm_matrix_instance_q31 * pSrc,
+  arm_matrix_instance_q31 * pDst)
+{
+  uint16_t n = pSrc->numRows;                    /* Size of the square matrices */
+
+  /* One size check selects the kernel */
+  if ((pSrc->numCols == n) && (pDst->numRows == n) && (pDst->numCols == n))
+  {
+    switch (n)
+    {
+    case 2U:
+      arm_mat_trans_2x2_q31(pSrc->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 3U:
+      arm_mat_trans_3x3_q31(pSrc->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 4U:
+      arm_mat_trans_4x4_q31(pSrc->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 5U:
+      arm_mat_trans_5x5_q31(pSrc->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    case 6U:
+      arm_mat_trans_6x6_q31(pSrc->pData, pDst->pData);
+      return (ARM_MATH_SUCCESS);
+
+    default:
+      break;
+    }
+  }
+
+  /* Other sizes use the generic function */
+  return (arm_mat_trans_q31(pSrc, pDst));
+}
+
+/**
+ * @} end of MatrixTrans group
+ */
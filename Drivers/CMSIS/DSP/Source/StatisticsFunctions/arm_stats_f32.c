@@ -0,0 +1,347 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_f32.c
+ * Description:  Single-pass and running statistics of a floating-point vector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Stats Single-Pass Statistics
+ *
+ * Computes the mean, variance, RMS value, power, minimum and maximum of a vector
+ * in a single pass over the data.
+ * Calling arm_mean(), arm_var(), arm_rms(), arm_power(), arm_min() and arm_max()
+ * on the same buffer reads it once per function, and twice for the floating-point variance.
+ *
+ * The running statistics keep the same values over a stream of blocks.
+ * Blocks are added with arm_stats_running_add() and blocks that leave a sliding window
+ * are removed with arm_stats_running_remove(); arm_stats_running_get() returns the
+ * statistics of the samples in the window.
+ * The minimum and maximum cannot be updated when samples are removed: they cover all
+ * the samples added since the initialization and are indexed from the first of them.
+ *
+ * There are separate functions for floating point, Q31, and Q15 data types.
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief Sums, minimum and maximum of a floating-point vector.
+ * @param[in]  pSrc       points to the input vector.
+ * @param[in]  blockSize  length of the input vector.
+ * @param[out] pSum       sum of the samples.
+ * @param[out] pSumDev    sum of the deviations from the first sample.
+ * @param[out] pSumSq     sum of the squared deviations from the first sample.
+ * @param[out] pPower     sum of the squares.
+ * @param[out] pResult    minimum and maximum values and indexes returned here.
+ * @return none.
+ *
+ * Deviations from the first sample keep the one-pass variance accurate when the
+ * mean is large compared to the spread of the samples.
+ */
+
+static void arm_stats_accumulate_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pSum,
+  float32_t * pSumDev,
+  float32_t * pSumSq,
+  float32_t * pPower,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t ref = *pSrc;                         /* Reference value of the deviations */
+  float32_t sum = 0.0f;                          /* Sum of the samples */
+  float32_t sumDev = 0.0f, sumSq = 0.0f;         /* Sums of the deviations and of their squares */
+  float32_t power = 0.0f;                        /* Sum of the squares */
+  float32_t minVal = ref, maxVal = ref;          /* Minimum and maximum values */
+  uint32_t minIdx = 0U, maxIdx = 0U;             /* Indexes of the minimum and maximum values */
+  float32_t in, dev;                             /* Input sample and its deviation */
+  uint32_t blkCnt;                               /* Loop counter */
+  uint32_t idx = 0U;                             /* Index of the current sample */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+    dev = in - ref;
+
+    /* All the sums are accumulated from the same read */
+    sum += in;
+    sumDev += dev;
+    sumSq += dev * dev;
+    power += in * in;
+
+    /* Strict comparisons keep the first minimum and maximum */
+    if (in < minVal)
+    {
+      minVal = in;
+      minIdx = idx;
+    }
+
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = idx;
+    }
+
+    idx++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  *pSum = sum;
+  *pSumDev = sumDev;
+  *pSumSq = sumSq;
+  *pPower = power;
+
+  pResult->min = minVal;
+  pResult->max = maxVal;
+  pResult->minIndex = minIdx;
+  pResult->maxIndex = maxIdx;
+}
+
+/**
+ * @brief Single-pass statistics of a floating-point vector.
+ * @param[in]  pSrc       points to the input vector.
+ * @param[in]  blockSize  length of the input vector, at least 1.
+ * @param[out] pResult    statistics returned here.
+ * @return none.
+ *
+ * \par
+ * The variance is normalized by <code>blockSize-1</code> as in arm_var_f32(), and is 0 for a single sample.
+ * It is computed from the deviations from the first sample, so that a large mean does not cancel
+ * the precision of the sum of squares.
+ */
+
+void arm_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t sum, sumDev, sumSq, power;           /* Sums of the block */
+  float32_t m2;                                  /* Sum of the squared deviations from the mean */
+  float32_t n = (float32_t) blockSize;           /* Number of samples */
+
+  arm_stats_accumulate_f32(pSrc, blockSize, &sum, &sumDev, &sumSq, &power, pResult);
+
+  pResult->mean = sum / n;
+  pResult->power = power;
+
+  m2 = sumSq - ((sumDev * sumDev) / n);
+  pResult->var = ((blockSize > 1U) && (m2 > 0.0f)) ? (m2 / (n - 1.0f)) : 0.0f;
+
+  arm_sqrt_f32(power / n, &pResult->rms);
+}
+
+/**
+ * @brief Adds a block of samples to the floating-point running statistics.
+ * @param[in,out] S          points to an instance of the floating-point running statistics structure.
+ * @param[in]     pSrc       points to the input vector.
+ * @param[in]     blockSize  length of the input vector.
+ * @return none.
+ *
+ * \par
+ * The block is reduced to its mean and sum of squared deviations, which are merged with those
+ * of the window as in Welford's update, once per block instead of once per sample.
+ * The sum of the squares is accumulated with Kahan's compensated summation, so that the
+ * power of long streams does not lose the contribution of small blocks.
+ */
+
+void arm_stats_running_add_f32(
+  arm_stats_running_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  arm_stats_result_f32 block;                    /* Minimum and maximum of the block */
+  float32_t sum, sumDev, sumSq, power;           /* Sums of the block */
+  float32_t nB = (float32_t) blockSize;          /* Number of samples of the block */
+  float32_t nA = (float32_t) S->count;           /* Number of samples of the window */
+  float32_t n;                                   /* Number of samples of the merged window */
+  float32_t meanB, m2B, delta, y, t;             /* Temporary variables */
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  arm_stats_accumulate_f32(pSrc, blockSize, &sum, &sumDev, &sumSq, &power, &block);
+
+  /* Mean and sum of squared deviations of the block */
+  meanB = sum / nB;
+  m2B = sumSq - ((sumDev * sumDev) / nB);
+
+  if (m2B < 0.0f)
+  {
+    m2B = 0.0f;
+  }
+
+  /* Merge them with the window */
+  n = nA + nB;
+  delta = meanB - S->mean;
+  S->mean += (delta * nB) / n;
+  S->m2 += m2B + ((delta * delta) * ((nA * nB) / n));
+
+  /* Compensated sum of the squares */
+  y = power - S->powerComp;
+  t = S->power + y;
+  S->powerComp = (t - S->power) - y;
+  S->power = t;
+
+  /* Minimum and maximum over all the samples added */
+  if ((S->numSamples == 0U) || (block.min < S->min))
+  {
+    S->min = block.min;
+    S->minIndex = S->numSamples + block.minIndex;
+  }
+
+  if ((S->numSamples == 0U) || (block.max > S->max))
+  {
+    S->max = block.max;
+    S->maxIndex = S->numSamples + block.maxIndex;
+  }
+
+  S->count += blockSize;
+  S->numSamples += blockSize;
+}
+
+/**
+ * @brief Removes a block of samples from the floating-point running statistics.
+ * @param[in,out] S          points to an instance of the floating-point running statistics structure.
+ * @param[in]     pSrc       points to the input vector, which must have been added before.
+ * @param[in]     blockSize  length of the input vector.
+ * @return none.
+ *
+ * \par
+ * The merge of arm_stats_running_add_f32() is reversed, so that a sliding window is updated
+ * with the block entering it and the block leaving it, whatever its length.
+ * The minimum and maximum are not changed.
+ */
+
+void arm_stats_running_remove_f32(
+  arm_stats_running_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  arm_stats_result_f32 block;                    /* Minimum and maximum of the block, unused */
+  float32_t sum, sumDev, sumSq, power;           /* Sums of the block */
+  float32_t nB = (float32_t) blockSize;          /* Number of samples of the block */
+  float32_t n = (float32_t) S->count;            /* Number of samples of the window */
+  float32_t nA;                                  /* Number of samples left in the window */
+  float32_t meanB, m2B, meanA, delta, y, t;      /* Temporary variables */
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  /* Removing all the samples empties the window */
+  if (blockSize >= S->count)
+  {
+    S->count = 0U;
+    S->mean = 0.0f;
+    S->m2 = 0.0f;
+    S->power = 0.0f;
+    S->powerComp = 0.0f;
+    return;
+  }
+
+  arm_stats_accumulate_f32(pSrc, blockSize, &sum, &sumDev, &sumSq, &power, &block);
+
+  meanB = sum / nB;
+  m2B = sumSq - ((sumDev * sumDev) / nB);
+
+  if (m2B < 0.0f)
+  {
+    m2B = 0.0f;
+  }
+
+  /* Mean of the samples left, and the merge term they had with the block */
+  nA = n - nB;
+  meanA = S->mean - (((meanB - S->mean) * nB) / nA);
+  delta = meanB - meanA;
+
+  S->mean = meanA;
+  S->m2 -= m2B + ((delta * delta) * ((nA * nB) / n));
+
+  /* Rounding errors must not leave a negative sum of squares */
+  if (S->m2 < 0.0f)
+  {
+    S->m2 = 0.0f;
+  }
+
+  y = -power - S->powerComp;
+  t = S->power + y;
+  S->powerComp = (t - S->power) - y;
+  S->power = t;
+
+  S->count -= blockSize;
+}
+
+/**
+ * @brief Returns the floating-point running statistics of the samples in the window.
+ * @param[in]  S        points to an instance of the floating-point running statistics structure.
+ * @param[out] pResult  statistics returned here.
+ * @return none.
+ *
+ * The mean, variance, RMS value and power cover the samples in the window, and are 0 when it is empty.
+ */
+
+void arm_stats_running_get_f32(
+  const arm_stats_running_instance_f32 * S,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t n = (float32_t) S->count;            /* Number of samples of the window */
+  float32_t power = (S->power > 0.0f) ? S->power : 0.0f;
+
+  pResult->mean = S->mean;
+  pResult->var = (S->count > 1U) ? (S->m2 / (n - 1.0f)) : 0.0f;
+  pResult->power = power;
+  pResult->rms = 0.0f;
+
+  if (S->count > 0U)
+  {
+    arm_sqrt_f32(power / n, &pResult->rms);
+  }
+
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**
+ * @} end of Stats group
+ */
@@ -0,0 +1,345 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_q15.c
+ * Description:  Single-pass and running statistics of a Q15 vector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief Sums, minimum and maximum of a Q15 vector.
+ * @param[in]  pSrc       points to the input vector.
+ * @param[in]  blockSize  length of the input vector.
+ * @param[out] pSum       sum of the samples.
+ * @param[out] pPower     sum of the squares in 34.30 format.
+ * @param[out] pResult    minimum and maximum values and indexes returned here.
+ * @return none.
+ */
+
+static void arm_stats_accumulate_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q63_t * pSum,
+  q63_t * pPower,
+  arm_stats_result_q15 * pResult)
+{
+  q63_t sum = 0;                                 /* Sum of the samples */
+  q63_t power = 0;                               /* Sum of the squares */
+  q15_t minVal = *pSrc, maxVal = *pSrc;          /* Minimum and maximum values */
+  uint32_t minIdx = 0U, maxIdx = 0U;             /* Indexes of the minimum and maximum values */
+  q15_t in;                                      /* Input sample */
+  uint32_t blkCnt;                               /* Loop counter */
+  uint32_t idx = 0U;                             /* Index of the current sample */
+
+#if defined (ARM_MATH_DSP)
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t in2;                                     /* Two packed input samples */
+
+  /* Two samples are read at a time */
+  blkCnt = blockSize >> 1U;
+
+  while (blkCnt > 0U)
+  {
+    in2 = *__SIMD32(pSrc)++;
+
+    /* Both squares are accumulated by one dual multiply-accumulate */
+    power = __SMLALD(in2, in2, power);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+    in = (q15_t) in2;
+#else
+    in = (q15_t) (in2 >> 16);
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    sum += in;
+
+    if (in < minVal)
+    {
+      minVal = in;
+      minIdx = idx;
+    }
+
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = idx;
+    }
+
+#ifndef ARM_MATH_BIG_ENDIAN
+    in = (q15_t) (in2 >> 16);
+#else
+    in = (q15_t) in2;
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    sum += in;
+
+    if (in < minVal)
+    {
+      minVal = in;
+      minIdx = idx + 1U;
+    }
+
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = idx + 1U;
+    }
+
+    idx += 2U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is odd, the last sample is processed here */
+  blkCnt = blockSize % 0x2U;
+
+#else
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* All the sums are accumulated from the same read */
+    sum += in;
+    power += ((q31_t) in * in);
+
+    /* Strict comparisons keep the first minimum and maximum */
+    if (in < minVal)
+    {
+      minVal = in;
+      minIdx = idx;
+    }
+
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = idx;
+    }
+
+    idx++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  *pSum = sum;
+  *pPower = power;
+
+  pResult->min = minVal;
+  pResult->max = maxVal;
+  pResult->minIndex = minIdx;
+  pResult->maxIndex = maxIdx;
+}
+
+/**
+ * @brief Derives the Q15 statistics from the sums of the samples.
+ * @param[in]  sum      sum of the samples.
+ * @param[in]  power    sum of the squares in 34.30 format.
+ * @param[in]  count    number of samples, at least 1.
+ * @param[out] pResult  mean, variance, RMS value and power returned here.
+ * @return none.
+ */
+
+static void arm_stats_finish_q15(
+  q63_t sum,
+  q63_t power,
+  uint32_t count,
+  arm_stats_result_q15 * pResult)
+{
+  q31_t meanOfSquares, squareOfMean;             /* Mean of the squares and square of the mean */
+
+  pResult->mean = (q15_t) (sum / (q63_t) count);
+  pResult->power = power;
+
+  if (count > 1U)
+  {
+    /* Same computation as arm_var_q15() */
+    meanOfSquares = (q31_t) (power / (q63_t) (count - 1U));
+    squareOfMean = (q31_t) ((sum * sum) / ((q63_t) count * (count - 1U)));
+    pResult->var = (q15_t) ((meanOfSquares - squareOfMean) >> 15U);
+  }
+  else
+  {
+    pResult->var = 0;
+  }
+
+  /* Same computation as arm_rms_q15() */
+  arm_sqrt_q15((q15_t) __SSAT((power / (q63_t) count) >> 15, 16), &pResult->rms);
+}
+
+/**
+ * @brief Single-pass statistics of a Q15 vector.
+ * @param[in]  pSrc       points to the input vector.
+ * @param[in]  blockSize  length of the input vector, at least 1.
+ * @param[out] pResult    statistics returned here.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each value is computed as by the separate function and is the same: arm_mean_q15(),
+ * arm_var_q15(), arm_rms_q15(), arm_power_q15(), arm_min_q15() and arm_max_q15().
+ * The sum of the samples and the sum of their squares are accumulated in 64 bits.
+ */
+
+void arm_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q15 * pResult)
+{
+  q63_t sum, power;                              /* Sums of the block */
+
+  arm_stats_accumulate_q15(pSrc, blockSize, &sum, &power, pResult);
+
+  arm_stats_finish_q15(sum, power, blockSize, pResult);
+}
+
+/**
+ * @brief Adds a block of samples to the Q15 running statistics.
+ * @param[in,out] S          points to an instance of the Q15 running statistics structure.
+ * @param[in]     pSrc       points to the input vector.
+ * @param[in]     blockSize  length of the input vector.
+ * @return none.
+ *
+ * \par
+ * The window keeps the exact sums of the samples and of their squares, so that adding
+ * and removing blocks never accumulates rounding errors.
+ */
+
+void arm_stats_running_add_q15(
+  arm_stats_running_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize)
+{
+  arm_stats_result_q15 block;                    /* Minimum and maximum of the block */
+  q63_t sum, power;                              /* Sums of the block */
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  arm_stats_accumulate_q15(pSrc, blockSize, &sum, &power, &block);
+
+  S->sum += sum;
+  S->power += power;
+
+  /* Minimum and maximum over all the samples added */
+  if ((S->numSamples == 0U) || (block.min < S->min))
+  {
+    S->min = block.min;
+    S->minIndex = S->numSamples + block.minIndex;
+  }
+
+  if ((S->numSamples == 0U) || (block.max > S->max))
+  {
+    S->max = block.max;
+    S->maxIndex = S->numSamples + block.maxIndex;
+  }
+
+  S->count += blockSize;
+  S->numSamples += blockSize;
+}
+
+/**
+ * @brief Removes a block of samples from the Q15 running statistics.
+ * @param[in,out] S          points to an instance of the Q15 running statistics structure.
+ * @param[in]     pSrc       points to the input vector, which must have been added before.
+ * @param[in]     blockSize  length of the input vector.
+ * @return none.
+ *
+ * The minimum and maximum are not changed.
+ */
+
+void arm_stats_running_remove_q15(
+  arm_stats_running_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize)
+{
+  arm_stats_result_q15 block;                    /* Minimum and maximum of the block, unused */
+  q63_t sum, power;                              /* Sums of the block */
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  arm_stats_accumulate_q15(pSrc, blockSize, &sum, &power, &block);
+
+  S->sum -= sum;
+  S->power -= power;
+  S->count -= blockSize;
+}
+
+/**
+ * @brief Returns the Q15 running statistics of the samples in the window.
+ * @param[in]  S        points to an instance of the Q15 running statistics structure.
+ * @param[out] pResult  statistics returned here.
+ * @return none.
+ *
+ * The values are those arm_stats_q15() returns for the samples in the window, and are 0 when it is empty.
+ */
+
+void arm_stats_running_get_q15(
+  const arm_stats_running_instance_q15 * S,
+  arm_stats_result_q15 * pResult)
+{
+  if (S->count > 0U)
+  {
+    arm_stats_finish_q15(S->sum, S->power, S->count, pResult);
+  }
+  else
+  {
+    pResult->mean = 0;
+    pResult->var = 0;
+    pResult->rms = 0;
+    pResult->power = 0;
+  }
+
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**
+ * @} end of Stats group
+ */
@@ -0,0 +1,282 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_q31.c
+ * Description:  Single-pass and running statistics of a Q31 vector
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief Sums, minimum and maximum of a Q31 vector.
+ * @param[in]  pSrc       points to the input vector.
+ * @param[in]  blockSize  length of the input vector.
+ * @param[out] pSum       sum of the samples.
+ * @param[out] pPower     sum of the squares in 16.48 format.
+ * @param[out] pResult    minimum and maximum values and indexes returned here.
+ * @return none.
+ */
+
+static void arm_stats_accumulate_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q63_t * pSum,
+  q63_t * pPower,
+  arm_stats_result_q31 * pResult)
+{
+  q63_t sum = 0;                                 /* Sum of the samples */
+  q63_t power = 0;                               /* Sum of the squares */
+  q31_t minVal = *pSrc, maxVal = *pSrc;          /* Minimum and maximum values */
+  uint32_t minIdx = 0U, maxIdx = 0U;             /* Indexes of the minimum and maximum values */
+  q31_t in;                                      /* Input sample */
+  uint32_t blkCnt;                               /* Loop counter */
+  uint32_t idx = 0U;                             /* Index of the current sample */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* All the sums are accumulated from the same read */
+    sum += in;
+    power += ((q63_t) in * in) >> 14U;
+
+    /* Strict comparisons keep the first minimum and maximum */
+    if (in < minVal)
+    {
+      minVal = in;
+      minIdx = idx;
+    }
+
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = idx;
+    }
+
+    idx++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  *pSum = sum;
+  *pPower = power;
+
+  pResult->min = minVal;
+  pResult->max = maxVal;
+  pResult->minIndex = minIdx;
+  pResult->maxIndex = maxIdx;
+}
+
+/**
+ * @brief Derives the Q31 statistics from the sums of the samples.
+ * @param[in]  sum      sum of the samples.
+ * @param[in]  power    sum of the squares in 16.48 format.
+ * @param[in]  count    number of samples, at least 1.
+ * @param[out] pResult  mean, variance, RMS value and power returned here.
+ * @return none.
+ */
+
+static void arm_stats_finish_q31(
+  q63_t sum,
+  q63_t power,
+  uint32_t count,
+  arm_stats_result_q31 * pResult)
+{
+  q63_t meanOfSquares, squareOfMean;             /* Mean of the squares and square of the mean */
+  q63_t sum8 = sum >> 8U;                        /* Sum of the samples in 1.23 format */
+
+  pResult->mean = (q31_t) (sum / (q63_t) count);
+  pResult->power = power;
+
+  if (count > 1U)
+  {
+    /* Computation of arm_var_q31() in 18.46 format, from the 16.48 sum of the squares */
+    meanOfSquares = (power >> 2U) / (q63_t) (count - 1U);
+    squareOfMean = (sum8 * sum8) / ((q63_t) count * (count - 1U));
+    pResult->var = (q31_t) ((meanOfSquares - squareOfMean + 0x4000) >> 15U);
+  }
+  else
+  {
+    pResult->var = 0;
+  }
+
+  /* The mean of the squares is converted from 16.48 to 1.31 format */
+  arm_sqrt_q31(clip_q63_to_q31((power / (q63_t) count) >> 17U), &pResult->rms);
+}
+
+/**
+ * @brief Single-pass statistics of a Q31 vector.
+ * @param[in]  pSrc       points to the input vector.
+ * @param[in]  blockSize  length of the input vector, at least 1.
+ * @param[out] pResult    statistics returned here.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The mean, power, minimum and maximum are the values arm_mean_q31(), arm_power_q31(),
+ * arm_min_q31() and arm_max_q31() return.
+ * The variance and RMS value are derived from the 16.48 power instead of separate sums of squares.
+ * The variance differs from arm_var_q31() by the truncation of the samples to 1.23 format,
+ * which it applies before squaring them, and is rounded to nearest; it has the same limits otherwise.
+ * The RMS value does not overflow where arm_rms_q31(), which accumulates the 2.62 squares
+ * in 64 bits, does: the power has 15 guard bits.
+ * With full scale inputs, the power therefore overflows after 2^15 samples.
+ */
+
+void arm_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q31 * pResult)
+{
+  q63_t sum, power;                              /* Sums of the block */
+
+  arm_stats_accumulate_q31(pSrc, blockSize, &sum, &power, pResult);
+
+  arm_stats_finish_q31(sum, power, blockSize, pResult);
+}
+
+/**
+ * @brief Adds a block of samples to the Q31 running statistics.
+ * @param[in,out] S          points to an instance of the Q31 running statistics structure.
+ * @param[in]     pSrc       points to the input vector.
+ * @param[in]     blockSize  length of the input vector.
+ * @return none.
+ *
+ * \par
+ * The window keeps the exact sums of the samples and of their squares, so that adding
+ * and removing blocks never accumulates rounding errors.
+ */
+
+void arm_stats_running_add_q31(
+  arm_stats_running_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  arm_stats_result_q31 block;                    /* Minimum and maximum of the block */
+  q63_t sum, power;                              /* Sums of the block */
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  arm_stats_accumulate_q31(pSrc, blockSize, &sum, &power, &block);
+
+  S->sum += sum;
+  S->power += power;
+
+  /* Minimum and maximum over all the samples added */
+  if ((S->numSamples == 0U) || (block.min < S->min))
+  {
+    S->min = block.min;
+    S->minIndex = S->numSamples + block.minIndex;
+  }
+
+  if ((S->numSamples == 0U) || (block.max > S->max))
+  {
+    S->max = block.max;
+    S->maxIndex = S->numSamples + block.maxIndex;
+  }
+
+  S->count += blockSize;
+  S->numSamples += blockSize;
+}
+
+/**
+ * @brief Removes a block of samples from the Q31 running statistics.
+ * @param[in,out] S          points to an instance of the Q31 running statistics structure.
+ * @param[in]     pSrc       points to the input vector, which must have been added before.
+ * @param[in]     blockSize  length of the input vector.
+ * @return none.
+ *
+ * The minimum and maximum are not changed.
+ */
+
+void arm_stats_running_remove_q31(
+  arm_stats_running_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  arm_stats_result_q31 block;                    /* Minimum and maximum of the block, unused */
+  q63_t sum, power;                              /* Sums of the block */
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  arm_stats_accumulate_q31(pSrc, blockSize, &sum, &power, &block);
+
+  S->sum -= sum;
+  S->power -= power;
+  S->count -= blockSize;
+}
+
+/**
+ * @brief Returns the Q31 running statistics of the samples in the window.
+ * @param[in]  S        points to an instance of the Q31 running statistics structure.
+ * @param[out] pResult  statistics returned here.
+ * @return none.
+ *
+ * The values are those arm_stats_q31() returns for the samples in the window, and are 0 when it is empty.
+ */
+
+void arm_stats_running_get_q31(
+  const arm_stats_running_instance_q31 * S,
+  arm_stats_result_q31 * pResult)
+{
+  if (S->count > 0U)
+  {
+    arm_stats_finish_q31(S->sum, S->power, S->count, pResult);
+  }
+  else
+  {
+    pResult->mean = 0;
+    pResult->var = 0;
+    pResult->rms = 0;
+    pResult->power = 0;
+  }
+
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**
+ * @} end of Stats group
+ */
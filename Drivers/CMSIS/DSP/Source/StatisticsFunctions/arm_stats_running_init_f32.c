@@ -0,0 +1,57 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_running_init_f32.c
+ * Description:  floating-point running statistics initialization function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief Initialization function for the floating-point running statistics.
+ * @param[in,out] S  points to an instance of the floating-point running statistics structure.
+ * @return none.
+ *
+ * The window is empty and no sample has been added yet.
+ */
+
+void arm_stats_running_init_f32(
+  arm_stats_running_instance_f32 * S)
+{
+  /* Clear the counters, the sums and the extrema */
+  memset(S, 0, sizeof(arm_stats_running_instance_f32));
+}
+
+/**
+ * @} end of Stats group
+ */
@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_init_ram_q15.c
+ * Description:  Initialization of the Q15 CFFT with tables computed in RAM
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 CFFT/CIFFT with tables computed in RAM.
+ * @param[out]    S       points to an instance of the Q15 CFFT structure.
+ * @param[in]     fftLen  length of the FFT: 16, 32, 64, 128, 256, 512, 1024, 2048 or 4096.
+ * @param[in,out] A       points to the arena the tables are allocated from.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not a supported value or ARM_MATH_LENGTH_ERROR if the arena is too small.
+ *
+ * \par Description:
+ * \par
+ * The twiddle factor and bit reversal tables are computed into the arena, with the values of
+ * twiddleCoef_<code>fftLen</code>_q15 and armBitRevIndexTable_fixed_<code>fftLen</code>, so the instance can replace
+ * arm_cfft_sR_q15_len<code>fftLen</code> when the constant tables are not linked.
+ * The arena needs <code>ARM_CFFT_RAM_TABLES_SIZE_Q15(fftLen)</code> bytes for each instance.
+ */
+
+arm_status arm_cfft_init_ram_q15(
+  arm_cfft_instance_q15 * S,
+  uint16_t fftLen,
+  arm_fft_table_arena * A)
+{
+  q15_t *pTwiddle;                               /* twiddle factor table */
+  uint16_t *pBitRevTable;                        /* bit reversal table */
+  uint16_t bitRevLength;                         /* length of the bit reversal table */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  if ((fftLen < 16U) || (fftLen > 4096U) || ((fftLen & (fftLen - 1U)) != 0U))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    bitRevLength = arm_cfft_bitrev_gen(NULL, fftLen, 1U);
+
+    if (((3U * fftLen) + (2U * bitRevLength)) > (A->size - A->used))
+    {
+      status = ARM_MATH_LENGTH_ERROR;
+    }
+    else
+    {
+      pTwiddle = (q15_t *) arm_fft_table_arena_alloc(A, 3U * fftLen);
+      pBitRevTable = (uint16_t *) arm_fft_table_arena_alloc(A, 2U * bitRevLength);
+
+      arm_cfft_twiddle_gen_q15(pTwiddle, fftLen);
+      (void) arm_cfft_bitrev_gen(pBitRevTable, fftLen, 1U);
+
+      S->fftLen = fftLen;
+      S->pTwiddle = pTwiddle;
+      S->pBitRevTable = pBitRevTable;
+      S->bitRevLength = bitRevLength;
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of ComplexFFT group
+ */
@@ -0,0 +1,481 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_f32.c
+ * Description:  Mixed-radix (2, 3, 4, 5) floating-point CFFT processing function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup MixedRadixFFT Mixed-Radix FFT Functions
+ *
+ * \par
+ * The complex and real FFT functions of the library support power of two lengths only.
+ * The mixed-radix functions support every length whose prime factors are 2, 3 and 5,
+ * such as 480, 600 or 1000, so that frames of such lengths need not be zero padded.
+ * \par
+ * The length is factored into radix-4, radix-2, radix-3 and radix-5 stages.
+ * The stages are computed out of place in the Stockham order: each stage reads one
+ * buffer and writes the other one, so that the result is in natural order and no
+ * bit or digit reversal is needed. The transforms are nevertheless in-place for the
+ * caller: a scratch buffer of <code>2*fftLen</code> values holds the intermediate
+ * stages and the result is copied back when the number of stages is odd.
+ * \par
+ * The complex data is stored in interleaved format, as for arm_cfft_f32():
+ * <pre> {real[0], imag[0], real[1], imag[1],..} </pre>
+ * The real transforms use a complex transform of half the length and
+ * pack their result as arm_rfft_fast_f32().
+ *
+ * \par Plans
+ * The instance structure holds the plan of a transform: the length, the radix of each
+ * stage, the twiddle factor table and the scratch buffer. The initialization functions
+ * factor the length and generate the twiddle factors
+ * <code>exp(2*pi*i*k/fftLen)</code> into a buffer provided by the caller, so that the
+ * lengths in use do not need precomputed tables.
+ * A twiddle factor table can be shared by the instances of the same length and
+ * data type, while the scratch buffer must not be used by two transforms at the same time.
+ *
+ * \par Floating-point
+ * The forward transform uses the standard FFT definition. The inverse transform includes
+ * a scale of <code>1/fftLen</code>, as arm_cfft_f32().
+ *
+ * \par Q31
+ * Each radix-<code>p</code> stage scales its inputs by <code>1/p</code> to prevent overflows,
+ * so that both the forward and the inverse complex transforms are scaled by
+ * <code>1/fftLen</code> and the output stays in 1.31 format.
+ */
+
+/**
+ * @addtogroup MixedRadixFFT
+ * @{
+ */
+
+/**
+ * @brief  Radix-2 stage of the floating-point mixed-radix CFFT.
+ * @param[in]  pIn       points to the input of the stage.
+ * @param[out] pOut      points to the output of the stage.
+ * @param[in]  pTwiddle  points to the twiddle factor table of the transform.
+ * @param[in]  m         length of the sub-transforms computed by the following stages.
+ * @param[in]  s         product of the radices of the previous stages.
+ * @return none.
+ */
+
+static void arm_cfft_mixed_radix2_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  const float32_t * pTwiddle,
+  uint32_t m,
+  uint32_t s)
+{
+  const float32_t *pA0, *pA1;                    /* inputs of the butterfly */
+  float32_t *pY0, *pY1;                          /* outputs of the butterfly */
+  float32_t yr, yi, wr, wi;                      /* temporary variables */
+  uint32_t q, k;                                 /* loop counters */
+
+  for (q = 0U; q < m; q++)
+  {
+    /* Twiddle factor of the second output, W^(q*s) */
+    wr = pTwiddle[2U * (q * s)];
+    wi = pTwiddle[(2U * (q * s)) + 1U];
+
+    pA0 = pIn + (2U * s * q);
+    pA1 = pA0 + (2U * s * m);
+    pY0 = pOut + (2U * s * 2U * q);
+    pY1 = pY0 + (2U * s);
+
+    for (k = 0U; k < s; k++)
+    {
+      pY0[0] = pA0[0] + pA1[0];
+      pY0[1] = pA0[1] + pA1[1];
+
+      yr = pA0[0] - pA1[0];
+      yi = pA0[1] - pA1[1];
+
+      /* Multiply by the conjugate of the table entry */
+      pY1[0] = (yr * wr) + (yi * wi);
+      pY1[1] = (yi * wr) - (yr * wi);
+
+      pA0 += 2U;
+      pA1 += 2U;
+      pY0 += 2U;
+      pY1 += 2U;
+    }
+  }
+}
+
+/**
+ * @brief  Radix-3 stage of the floating-point mixed-radix CFFT.
+ * @param[in]  pIn       points to the input of the stage.
+ * @param[out] pOut      points to the output of the stage.
+ * @param[in]  pTwiddle  points to the twiddle factor table of the transform.
+ * @param[in]  m         length of the sub-transforms computed by the following stages.
+ * @param[in]  s         product of the radices of the previous stages.
+ * @return none.
+ */
+
+static void arm_cfft_mixed_radix3_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  const float32_t * pTwiddle,
+  uint32_t m,
+  uint32_t s)
+{
+  const float32_t sin60 = 0.866025403784438647f; /* sin(2*pi/3) */
+  const float32_t *pA0, *pA1, *pA2;              /* inputs of the butterfly */
+  float32_t *pY0, *pY1, *pY2;                    /* outputs of the butterfly */
+  float32_t tr, ti, dr, di, mr, mi, yr, yi;      /* temporary variables */
+  float32_t w1r, w1i, w2r, w2i;                  /* twiddle factors */
+  uint32_t q, k;                                 /* loop counters */
+
+  for (q = 0U; q < m; q++)
+  {
+    w1r = pTwiddle[2U * (q * s)];
+    w1i = pTwiddle[(2U * (q * s)) + 1U];
+    w2r = pTwiddle[2U * (2U * q * s)];
+    w2i = pTwiddle[(2U * (2U * q * s)) + 1U];
+
+    pA0 = pIn + (2U * s * q);
+    pA1 = pA0 + (2U * s * m);
+    pA2 = pA1 + (2U * s * m);
+    pY0 = pOut + (2U * s * 3U * q);
+    pY1 = pY0 + (2U * s);
+    pY2 = pY1 + (2U * s);
+
+    for (k = 0U; k < s; k++)
+    {
+      tr = pA1[0] + pA2[0];
+      ti = pA1[1] + pA2[1];
+      dr = pA1[0] - pA2[0];
+      di = pA1[1] - pA2[1];
+
+      pY0[0] = pA0[0] + tr;
+      pY0[1] = pA0[1] + ti;
+
+      /* y1 = a0 - t/2 - i*sin60*d, y2 = a0 - t/2 + i*sin60*d */
+      mr = pA0[0] - (0.5f * tr);
+      mi = pA0[1] - (0.5f * ti);
+      dr *= sin60;
+      di *= sin60;
+
+      yr = mr + di;
+      yi = mi - dr;
+      pY1[0] = (yr * w1r) + (yi * w1i);
+      pY1[1] = (yi * w1r) - (yr * w1i);
+
+      yr = mr - di;
+      yi = mi + dr;
+      pY2[0] = (yr * w2r) + (yi * w2i);
+      pY2[1] = (yi * w2r) - (yr * w2i);
+
+      pA0 += 2U;
+      pA1 += 2U;
+      pA2 += 2U;
+      pY0 += 2U;
+      pY1 += 2U;
+      pY2 += 2U;
+    }
+  }
+}
+
+/**
+ * @brief  Radix-4 stage of the floating-point mixed-radix CFFT.
+ * @param[in]  pIn       points to the input of the stage.
+ * @param[out] pOut      points to the output of the stage.
+ * @param[in]  pTwiddle  points to the twiddle factor table of the transform.
+ * @param[in]  m         length of the sub-transforms computed by the following stages.
+ * @param[in]  s         product of the radices of the previous stages.
+ * @return none.
+ */
+
+static void arm_cfft_mixed_radix4_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  const float32_t * pTwiddle,
+  uint32_t m,
+  uint32_t s)
+{
+  const float32_t *pA0, *pA1, *pA2, *pA3;        /* inputs of the butterfly */
+  float32_t *pY0, *pY1, *pY2, *pY3;              /* outputs of the butterfly */
+  float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i; /* temporary variables */
+  float32_t yr, yi;                              /* temporary variables */
+  float32_t w1r, w1i, w2r, w2i, w3r, w3i;        /* twiddle factors */
+  uint32_t q, k;                                 /* loop counters */
+
+  for (q = 0U; q < m; q++)
+  {
+    w1r = pTwiddle[2U * (q * s)];
+    w1i = pTwiddle[(2U * (q * s)) + 1U];
+    w2r = pTwiddle[2U * (2U * q * s)];
+    w2i = pTwiddle[(2U * (2U * q * s)) + 1U];
+    w3r = pTwiddle[2U * (3U * q * s)];
+    w3i = pTwiddle[(2U * (3U * q * s)) + 1U];
+
+    pA0 = pIn + (2U * s * q);
+    pA1 = pA0 + (2U * s * m);
+    pA2 = pA1 + (2U * s * m);
+    pA3 = pA2 + (2U * s * m);
+    pY0 = pOut + (2U * s * 4U * q);
+    pY1 = pY0 + (2U * s);
+    pY2 = pY1 + (2U * s);
+    pY3 = pY2 + (2U * s);
+
+    for (k = 0U; k < s; k++)
+    {
+      t0r = pA0[0] + pA2[0];
+      t0i = pA0[1] + pA2[1];
+      t1r = pA0[0] - pA2[0];
+      t1i = pA0[1] - pA2[1];
+      t2r = pA1[0] + pA3[0];
+      t2i = pA1[1] + pA3[1];
+      t3r = pA1[0] - pA3[0];
+      t3i = pA1[1] - pA3[1];
+
+      pY0[0] = t0r + t2r;
+      pY0[1] = t0i + t2i;
+
+      /* y1 = t1 - i*t3 */
+      yr = t1r + t3i;
+      yi = t1i - t3r;
+      pY1[0] = (yr * w1r) + (yi * w1i);
+      pY1[1] = (yi * w1r) - (yr * w1i);
+
+      /* y2 = t0 - t2 */
+      yr = t0r - t2r;
+      yi = t0i - t2i;
+      pY2[0] = (yr * w2r) + (yi * w2i);
+      pY2[1] = (yi * w2r) - (yr * w2i);
+
+      /* y3 = t1 + i*t3 */
+      yr = t1r - t3i;
+      yi = t1i + t3r;
+      pY3[0] = (yr * w3r) + (yi * w3i);
+      pY3[1] = (yi * w3r) - (yr * w3i);
+
+      pA0 += 2U;
+      pA1 += 2U;
+      pA2 += 2U;
+      pA3 += 2U;
+      pY0 += 2U;
+      pY1 += 2U;
+      pY2 += 2U;
+      pY3 += 2U;
+    }
+  }
+}
+
+/**
+ * @brief  Radix-5 stage of the floating-point mixed-radix CFFT.
+ * @param[in]  pIn       points to the input of the stage.
+ * @param[out] pOut      points to the output of the stage.
+ * @param[in]  pTwiddle  points to the twiddle factor table of the transform.
+ * @param[in]  m         length of the sub-transforms computed by the following stages.
+ * @param[in]  s         product of the radices of the previous stages.
+ * @return none.
+ */
+
+static void arm_cfft_mixed_radix5_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  const float32_t * pTwiddle,
+  uint32_t m,
+  uint32_t s)
+{
+  const float32_t c1 = 0.309016994374947424f;   /* cos(2*pi/5) */
+  const float32_t c2 = -0.809016994374947424f;  /* cos(4*pi/5) */
+  const float32_t s1 = 0.951056516295153572f;   /* sin(2*pi/5) */
+  const float32_t s2 = 0.587785252292473129f;   /* sin(4*pi/5) */
+  const float32_t *pA0, *pA1, *pA2, *pA3, *pA4;  /* inputs of the butterfly */
+  float32_t *pY[5];                              /* outputs of the butterfly */
+  float32_t b1r, b1i, b2r, b2i, d1r, d1i, d2r, d2i; /* temporary variables */
+  float32_t mr, mi, nr, ni, yr, yi;              /* temporary variables */
+  float32_t wr[5], wi[5];                        /* twiddle factors */
+  uint32_t q, k, u;                              /* loop counters */
+
+  for (q = 0U; q < m; q++)
+  {
+    for (u = 1U; u < 5U; u++)
+    {
+      wr[u] = pTwiddle[2U * (u * q * s)];
+      wi[u] = pTwiddle[(2U * (u * q * s)) + 1U];
+    }
+
+    pA0 = pIn + (2U * s * q);
+    pA1 = pA0 + (2U * s * m);
+    pA2 = pA1 + (2U * s * m);
+    pA3 = pA2 + (2U * s * m);
+    pA4 = pA3 + (2U * s * m);
+    pY[0] = pOut + (2U * s * 5U * q);
+
+    for (u = 1U; u < 5U; u++)
+    {
+      pY[u] = pY[u - 1U] + (2U * s);
+    }
+
+    for (k = 0U; k < s; k++)
+    {
+      b1r = pA1[0] + pA4[0];
+      b1i = pA1[1] + pA4[1];
+      b2r = pA2[0] + pA3[0];
+      b2i = pA2[1] + pA3[1];
+      d1r = pA1[0] - pA4[0];
+      d1i = pA1[1] - pA4[1];
+      d2r = pA2[0] - pA3[0];
+      d2i = pA2[1] - pA3[1];
+
+      pY[0][0] = pA0[0] + b1r + b2r;
+      pY[0][1] = pA0[1] + b1i + b2i;
+
+      /* y1 = m - i*n, y4 = m + i*n with m = a0 + c1*b1 + c2*b2, n = s1*d1 + s2*d2 */
+      mr = pA0[0] + (c1 * b1r) + (c2 * b2r);
+      mi = pA0[1] + (c1 * b1i) + (c2 * b2i);
+      nr = (s1 * d1r) + (s2 * d2r);
+      ni = (s1 * d1i) + (s2 * d2i);
+
+      yr = mr + ni;
+      yi = mi - nr;
+      pY[1][0] = (yr * wr[1]) + (yi * wi[1]);
+      pY[1][1] = (yi * wr[1]) - (yr * wi[1]);
+
+      yr = mr - ni;
+      yi = mi + nr;
+      pY[4][0] = (yr * wr[4]) + (yi * wi[4]);
+      pY[4][1] = (yi * wr[4]) - (yr * wi[4]);
+
+      /* y2 = m - i*n, y3 = m + i*n with m = a0 + c2*b1 + c1*b2, n = s2*d1 - s1*d2 */
+      mr = pA0[0] + (c2 * b1r) + (c1 * b2r);
+      mi = pA0[1] + (c2 * b1i) + (c1 * b2i);
+      nr = (s2 * d1r) - (s1 * d2r);
+      ni = (s2 * d1i) - (s1 * d2i);
+
+      yr = mr + ni;
+      yi = mi - nr;
+      pY[2][0] = (yr * wr[2]) + (yi * wi[2]);
+      pY[2][1] = (yi * wr[2]) - (yr * wi[2]);
+
+      yr = mr - ni;
+      yi = mi + nr;
+      pY[3][0] = (yr * wr[3]) + (yi * wi[3]);
+      pY[3][1] = (yi * wr[3]) - (yr * wi[3]);
+
+      pA0 += 2U;
+      pA1 += 2U;
+      pA2 += 2U;
+      pA3 += 2U;
+      pA4 += 2U;
+
+      for (u = 0U; u < 5U; u++)
+      {
+        pY[u] += 2U;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Processing function for the floating-point mixed-radix CFFT/CIFFT.
+ * @param[in]      S         points to an instance of the floating-point mixed-radix CFFT structure.
+ * @param[in, out] p1        points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+ * @return none.
+ *
+ * The inverse transform is computed as the conjugate of the forward transform of the
+ * conjugated input, scaled by <code>1/fftLen</code>.
+ */
+
+void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag)
+{
+  uint32_t fftLen = S->fftLen;                   /* length of the FFT */
+  float32_t *pIn = p1;                           /* input of the current stage */
+  float32_t *pOut = S->pScratch;                 /* output of the current stage */
+  float32_t *pTmp;                               /* temporary pointer */
+  float32_t invL;                                /* scale of the inverse transform */
+  uint32_t n = fftLen, s = 1U, m;                /* sub-transform length, stride and length of the next stage */
+  uint32_t i;                                    /* loop counter */
+
+  if (ifftFlag == 1U)
+  {
+    for (i = 0U; i < fftLen; i++)
+    {
+      p1[(2U * i) + 1U] = -p1[(2U * i) + 1U];
+    }
+  }
+
+  for (i = 0U; i < S->numStages; i++)
+  {
+    m = n / S->factors[i];
+
+    switch (S->factors[i])
+    {
+    case 2U:
+      arm_cfft_mixed_radix2_f32(pIn, pOut, S->pTwiddle, m, s);
+      break;
+    case 3U:
+      arm_cfft_mixed_radix3_f32(pIn, pOut, S->pTwiddle, m, s);
+      break;
+    case 4U:
+      arm_cfft_mixed_radix4_f32(pIn, pOut, S->pTwiddle, m, s);
+      break;
+    default:
+      arm_cfft_mixed_radix5_f32(pIn, pOut, S->pTwiddle, m, s);
+      break;
+    }
+
+    s *= S->factors[i];
+    n = m;
+
+    /* The output of a stage is the input of the next one */
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  /* The result is in the scratch buffer after an odd number of stages */
+  if (pIn != p1)
+  {
+    arm_copy_f32(pIn, p1, 2U * fftLen);
+  }
+
+  if (ifftFlag == 1U)
+  {
+    invL = 1.0f / (float32_t) fftLen;
+
+    for (i = 0U; i < fftLen; i++)
+    {
+      p1[2U * i] *= invL;
+      p1[(2U * i) + 1U] *= -invL;
+    }
+  }
+}
+
+/**
+ * @} end of MixedRadixFFT group
+ */
@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_init_f32.c
+ * Description:  Initialization function for the floating-point mixed-radix CFFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MixedRadixFFT
+ * @{
+ */
+
+/**
+ * @brief  Factors the length of a mixed-radix transform.
+ * @param[in]  fftLen      length of the FFT.
+ * @param[out] pFactors    points to the radix of each stage, ARM_CFFT_MIXED_MAX_STAGES values.
+ * @param[out] pNumStages  points to the number of stages.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is 0 or has a prime factor larger than 5.
+ *
+ * Radix-4 stages are used first, followed by at most one radix-2 stage and by the
+ * radix-3 and radix-5 stages.
+ */
+
+arm_status arm_cfft_mixed_factor(
+  uint16_t fftLen,
+  uint8_t * pFactors,
+  uint8_t * pNumStages)
+{
+  uint32_t n = fftLen;                           /* part of the length left to factor */
+  uint32_t numStages = 0U;                       /* number of stages */
+
+  if (n == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  while ((n % 4U) == 0U)
+  {
+    pFactors[numStages++] = 4U;
+    n /= 4U;
+  }
+
+  if ((n % 2U) == 0U)
+  {
+    pFactors[numStages++] = 2U;
+    n /= 2U;
+  }
+
+  while ((n % 3U) == 0U)
+  {
+    pFactors[numStages++] = 3U;
+    n /= 3U;
+  }
+
+  while ((n % 5U) == 0U)
+  {
+    pFactors[numStages++] = 5U;
+    n /= 5U;
+  }
+
+  *pNumStages = (uint8_t) numStages;
+
+  return ((n == 1U) ? ARM_MATH_SUCCESS : ARM_MATH_ARGUMENT_ERROR);
+}
+
+/**
+ * @brief  Initialization function for the floating-point mixed-radix CFFT/CIFFT.
+ * @param[in,out] S          points to an instance of the floating-point mixed-radix CFFT structure.
+ * @param[in]     fftLen     length of the FFT, a product of powers of 2, 3 and 5.
+ * @param[out]    pTwiddle   points to the twiddle factor table to generate, of length <code>2*fftLen</code>.
+ * @param[in]     pScratch   points to a scratch buffer of length <code>2*fftLen</code>.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not a supported value.
+ *
+ * \par Description:
+ * \par
+ * The twiddle factor table holds <code>cos(2*pi*k/fftLen)</code> and <code>sin(2*pi*k/fftLen)</code>
+ * for <code>k = 0, 1, ..., fftLen-1</code>, computed in double precision.
+ * The table depends on the length only and may be shared by several instances.
+ */
+
+arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pScratch)
+{
+  arm_status status;                             /* status of the initialization */
+  float64_t phase;                               /* phase of the twiddle factor */
+  uint32_t k;                                    /* loop counter */
+
+  status = arm_cfft_mixed_factor(fftLen, S->factors, &S->numStages);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    S->fftLen = fftLen;
+    S->pTwiddle = pTwiddle;
+    S->pScratch = pScratch;
+
+    for (k = 0U; k < fftLen; k++)
+    {
+      phase = (6.283185307179586476925 * (float64_t) k) / (float64_t) fftLen;
+      pTwiddle[2U * k] = (float32_t) cos(phase);
+      pTwiddle[(2U * k) + 1U] = (float32_t) sin(phase);
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MixedRadixFFT group
+ */
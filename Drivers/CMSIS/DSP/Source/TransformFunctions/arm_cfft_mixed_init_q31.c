@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_init_q31.c
+ * Description:  Initialization function for the Q31 mixed-radix CFFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MixedRadixFFT
+ * @{
+ */
+
+extern arm_status arm_cfft_mixed_factor(
+  uint16_t fftLen,
+  uint8_t * pFactors,
+  uint8_t * pNumStages);
+
+/**
+ * @brief  Initialization function for the Q31 mixed-radix CFFT/CIFFT.
+ * @param[in,out] S          points to an instance of the Q31 mixed-radix CFFT structure.
+ * @param[in]     fftLen     length of the FFT, a product of powers of 2, 3 and 5.
+ * @param[out]    pTwiddle   points to the twiddle factor table to generate, of length <code>2*fftLen</code>.
+ * @param[in]     pScratch   points to a scratch buffer of length <code>2*fftLen</code>.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not a supported value.
+ *
+ * \par Description:
+ * \par
+ * The twiddle factor table holds <code>cos(2*pi*k/fftLen)</code> and <code>sin(2*pi*k/fftLen)</code>
+ * for <code>k = 0, 1, ..., fftLen-1</code> in 1.31 format, computed in double precision
+ * with rounding and saturation of the value 1.
+ * The table depends on the length only and may be shared by several instances.
+ */
+
+arm_status arm_cfft_mixed_init_q31(
+  arm_cfft_mixed_instance_q31 * S,
+  uint16_t fftLen,
+  q31_t * pTwiddle,
+  q31_t * pScratch)
+{
+  arm_status status;                             /* status of the initialization */
+  float64_t phase, scaled;                       /* phase and scaled component of the twiddle factor */
+  uint32_t k, j;                                 /* loop counters */
+
+  status = arm_cfft_mixed_factor(fftLen, S->factors, &S->numStages);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    S->fftLen = fftLen;
+    S->pTwiddle = pTwiddle;
+    S->pScratch = pScratch;
+
+    for (k = 0U; k < fftLen; k++)
+    {
+      phase = (6.283185307179586476925 * (float64_t) k) / (float64_t) fftLen;
+
+      for (j = 0U; j < 2U; j++)
+      {
+        scaled = ((j == 0U) ? cos(phase) : sin(phase)) * 2147483648.0;
+        scaled = (scaled >= 0.0) ? (scaled + 0.5) : (scaled - 0.5);
+        pTwiddle[(2U * k) + j] = (scaled >= 2147483647.0) ? 0x7FFFFFFF : (q31_t) scaled;
+      }
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MixedRadixFFT group
+ */
@@ -0,0 +1,451 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_q31.c
+ * Description:  Mixed-radix (2, 3, 4, 5) Q31 CFFT processing function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MixedRadixFFT
+ * @{
+ */
+
+/* Multiplication of two 1.31 values, truncated to 1.31 */
+#define ARM_CFFT_MIXED_MUL_Q31(a, b) ((q31_t) (((q63_t) (a) * (b)) >> 31))
+
+/* Multiplication by the conjugate of a twiddle factor, written to pY[0] and pY[1] */
+#define ARM_CFFT_MIXED_ROTATE_Q31(pY, yr, yi, wr, wi)                          \
+  do                                                                           \
+  {                                                                            \
+    (pY)[0] = (q31_t) ((((q63_t) (yr) * (wr)) + ((q63_t) (yi) * (wi))) >> 31); \
+    (pY)[1] = (q31_t) ((((q63_t) (yi) * (wr)) - ((q63_t) (yr) * (wi))) >> 31); \
+  } while (0)
+
+/**
+ * @brief  Radix-2 stage of the Q31 mixed-radix CFFT, inputs scaled by 1/2.
+ * @param[in]  pIn       points to the input of the stage.
+ * @param[out] pOut      points to the output of the stage.
+ * @param[in]  pTwiddle  points to the twiddle factor table of the transform.
+ * @param[in]  m         length of the sub-transforms computed by the following stages.
+ * @param[in]  s         product of the radices of the previous stages.
+ * @return none.
+ */
+
+static void arm_cfft_mixed_radix2_q31(
+  const q31_t * pIn,
+  q31_t * pOut,
+  const q31_t * pTwiddle,
+  uint32_t m,
+  uint32_t s)
+{
+  const q31_t *pA0, *pA1;                        /* inputs of the butterfly */
+  q31_t *pY0, *pY1;                              /* outputs of the butterfly */
+  q31_t a0r, a0i, a1r, a1i, yr, yi, wr, wi;      /* temporary variables */
+  uint32_t q, k;                                 /* loop counters */
+
+  for (q = 0U; q < m; q++)
+  {
+    wr = pTwiddle[2U * (q * s)];
+    wi = pTwiddle[(2U * (q * s)) + 1U];
+
+    pA0 = pIn + (2U * s * q);
+    pA1 = pA0 + (2U * s * m);
+    pY0 = pOut + (2U * s * 2U * q);
+    pY1 = pY0 + (2U * s);
+
+    for (k = 0U; k < s; k++)
+    {
+      a0r = pA0[0] >> 1;
+      a0i = pA0[1] >> 1;
+      a1r = pA1[0] >> 1;
+      a1i = pA1[1] >> 1;
+
+      pY0[0] = a0r + a1r;
+      pY0[1] = a0i + a1i;
+
+      yr = a0r - a1r;
+      yi = a0i - a1i;
+      ARM_CFFT_MIXED_ROTATE_Q31(pY1, yr, yi, wr, wi);
+
+      pA0 += 2U;
+      pA1 += 2U;
+      pY0 += 2U;
+      pY1 += 2U;
+    }
+  }
+}
+
+/**
+ * @brief  Radix-3 stage of the Q31 mixed-radix CFFT, inputs scaled by 1/3.
+ * @param[in]  pIn       points to the input of the stage.
+ * @param[out] pOut      points to the output of the stage.
+ * @param[in]  pTwiddle  points to the twiddle factor table of the transform.
+ * @param[in]  m         length of the sub-transforms computed by the following stages.
+ * @param[in]  s         product of the radices of the previous stages.
+ * @return none.
+ */
+
+static void arm_cfft_mixed_radix3_q31(
+  const q31_t * pIn,
+  q31_t * pOut,
+  const q31_t * pTwiddle,
+  uint32_t m,
+  uint32_t s)
+{
+  const q31_t third = 0x2AAAAAAB;                /* 1/3 */
+  const q31_t sin60 = 0x6ED9EBA1;                /* sin(2*pi/3) */
+  const q31_t *pA0, *pA1, *pA2;                  /* inputs of the butterfly */
+  q31_t *pY0, *pY1, *pY2;                        /* outputs of the butterfly */
+  q31_t a0r, a0i, a1r, a1i, a2r, a2i;            /* scaled inputs */
+  q31_t tr, ti, dr, di, mr, mi, yr, yi;          /* temporary variables */
+  q31_t w1r, w1i, w2r, w2i;                      /* twiddle factors */
+  uint32_t q, k;                                 /* loop counters */
+
+  for (q = 0U; q < m; q++)
+  {
+    w1r = pTwiddle[2U * (q * s)];
+    w1i = pTwiddle[(2U * (q * s)) + 1U];
+    w2r = pTwiddle[2U * (2U * q * s)];
+    w2i = pTwiddle[(2U * (2U * q * s)) + 1U];
+
+    pA0 = pIn + (2U * s * q);
+    pA1 = pA0 + (2U * s * m);
+    pA2 = pA1 + (2U * s * m);
+    pY0 = pOut + (2U * s * 3U * q);
+    pY1 = pY0 + (2U * s);
+    pY2 = pY1 + (2U * s);
+
+    for (k = 0U; k < s; k++)
+    {
+      a0r = ARM_CFFT_MIXED_MUL_Q31(pA0[0], third);
+      a0i = ARM_CFFT_MIXED_MUL_Q31(pA0[1], third);
+      a1r = ARM_CFFT_MIXED_MUL_Q31(pA1[0], third);
+      a1i = ARM_CFFT_MIXED_MUL_Q31(pA1[1], third);
+      a2r = ARM_CFFT_MIXED_MUL_Q31(pA2[0], third);
+      a2i = ARM_CFFT_MIXED_MUL_Q31(pA2[1], third);
+
+      tr = a1r + a2r;
+      ti = a1i + a2i;
+      dr = ARM_CFFT_MIXED_MUL_Q31(a1r - a2r, sin60);
+      di = ARM_CFFT_MIXED_MUL_Q31(a1i - a2i, sin60);
+
+      pY0[0] = a0r + tr;
+      pY0[1] = a0i + ti;
+
+      /* y1 = a0 - t/2 - i*sin60*d, y2 = a0 - t/2 + i*sin60*d */
+      mr = a0r - (tr >> 1);
+      mi = a0i - (ti >> 1);
+
+      yr = mr + di;
+      yi = mi - dr;
+      ARM_CFFT_MIXED_ROTATE_Q31(pY1, yr, yi, w1r, w1i);
+
+      yr = mr - di;
+      yi = mi + dr;
+      ARM_CFFT_MIXED_ROTATE_Q31(pY2, yr, yi, w2r, w2i);
+
+      pA0 += 2U;
+      pA1 += 2U;
+      pA2 += 2U;
+      pY0 += 2U;
+      pY1 += 2U;
+      pY2 += 2U;
+    }
+  }
+}
+
+/**
+ * @brief  Radix-4 stage of the Q31 mixed-radix CFFT, inputs scaled by 1/4.
+ * @param[in]  pIn       points to the input of the stage.
+ * @param[out] pOut      points to the output of the stage.
+ * @param[in]  pTwiddle  points to the twiddle factor table of the transform.
+ * @param[in]  m         length of the sub-transforms computed by the following stages.
+ * @param[in]  s         product of the radices of the previous stages.
+ * @return none.
+ */
+
+static void arm_cfft_mixed_radix4_q31(
+  const q31_t * pIn,
+  q31_t * pOut,
+  const q31_t * pTwiddle,
+  uint32_t m,
+  uint32_t s)
+{
+  const q31_t *pA0, *pA1, *pA2, *pA3;            /* inputs of the butterfly */
+  q31_t *pY0, *pY1, *pY2, *pY3;                  /* outputs of the butterfly */
+  q31_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;  /* temporary variables */
+  q31_t yr, yi;                                  /* temporary variables */
+  q31_t w1r, w1i, w2r, w2i, w3r, w3i;            /* twiddle factors */
+  uint32_t q, k;                                 /* loop counters */
+
+  for (q = 0U; q < m; q++)
+  {
+    w1r = pTwiddle[2U * (q * s)];
+    w1i = pTwiddle[(2U * (q * s)) + 1U];
+    w2r = pTwiddle[2U * (2U * q * s)];
+    w2i = pTwiddle[(2U * (2U * q * s)) + 1U];
+    w3r = pTwiddle[2U * (3U * q * s)];
+    w3i = pTwiddle[(2U * (3U * q * s)) + 1U];
+
+    pA0 = pIn + (2U * s * q);
+    pA1 = pA0 + (2U * s * m);
+    pA2 = pA1 + (2U * s * m);
+    pA3 = pA2 + (2U * s * m);
+    pY0 = pOut + (2U * s * 4U * q);
+    pY1 = pY0 + (2U * s);
+    pY2 = pY1 + (2U * s);
+    pY3 = pY2 + (2U * s);
+
+    for (k = 0U; k < s; k++)
+    {
+      t0r = (pA0[0] >> 2) + (pA2[0] >> 2);
+      t0i = (pA0[1] >> 2) + (pA2[1] >> 2);
+      t1r = (pA0[0] >> 2) - (pA2[0] >> 2);
+      t1i = (pA0[1] >> 2) - (pA2[1] >> 2);
+      t2r = (pA1[0] >> 2) + (pA3[0] >> 2);
+      t2i = (pA1[1] >> 2) + (pA3[1] >> 2);
+      t3r = (pA1[0] >> 2) - (pA3[0] >> 2);
+      t3i = (pA1[1] >> 2) - (pA3[1] >> 2);
+
+      pY0[0] = t0r + t2r;
+      pY0[1] = t0i + t2i;
+
+      /* y1 = t1 - i*t3 */
+      yr = t1r + t3i;
+      yi = t1i - t3r;
+      ARM_CFFT_MIXED_ROTATE_Q31(pY1, yr, yi, w1r, w1i);
+
+      /* y2 = t0 - t2 */
+      yr = t0r - t2r;
+      yi = t0i - t2i;
+      ARM_CFFT_MIXED_ROTATE_Q31(pY2, yr, yi, w2r, w2i);
+
+      /* y3 = t1 + i*t3 */
+      yr = t1r - t3i;
+      yi = t1i + t3r;
+      ARM_CFFT_MIXED_ROTATE_Q31(pY3, yr, yi, w3r, w3i);
+
+      pA0 += 2U;
+      pA1 += 2U;
+      pA2 += 2U;
+      pA3 += 2U;
+      pY0 += 2U;
+      pY1 += 2U;
+      pY2 += 2U;
+      pY3 += 2U;
+    }
+  }
+}
+
+/**
+ * @brief  Radix-5 stage of the Q31 mixed-radix CFFT, inputs scaled by 1/5.
+ * @param[in]  pIn       points to the input of the stage.
+ * @param[out] pOut      points to the output of the stage.
+ * @param[in]  pTwiddle  points to the twiddle factor table of the transform.
+ * @param[in]  m         length of the sub-transforms computed by the following stages.
+ * @param[in]  s         product of the radices of the previous stages.
+ * @return none.
+ */
+
+static void arm_cfft_mixed_radix5_q31(
+  const q31_t * pIn,
+  q31_t * pOut,
+  const q31_t * pTwiddle,
+  uint32_t m,
+  uint32_t s)
+{
+  const q31_t fifth = 0x1999999A;                /* 1/5 */
+  const q31_t c1 = 0x278DDE6E;                   /* cos(2*pi/5) */
+  const q31_t c2 = (q31_t) 0x98722192;           /* cos(4*pi/5) */
+  const q31_t s1 = 0x79BC384D;                   /* sin(2*pi/5) */
+  const q31_t s2 = 0x4B3C8C12;                   /* sin(4*pi/5) */
+  const q31_t *pA[5];                            /* inputs of the butterfly */
+  q31_t *pY[5];                                  /* outputs of the butterfly */
+  q31_t ar[5], ai[5];                            /* scaled inputs */
+  q31_t b1r, b1i, b2r, b2i, d1r, d1i, d2r, d2i;  /* temporary variables */
+  q31_t mr, mi, nr, ni, yr, yi;                  /* temporary variables */
+  q31_t wr[5], wi[5];                            /* twiddle factors */
+  uint32_t q, k, u;                              /* loop counters */
+
+  for (q = 0U; q < m; q++)
+  {
+    for (u = 1U; u < 5U; u++)
+    {
+      wr[u] = pTwiddle[2U * (u * q * s)];
+      wi[u] = pTwiddle[(2U * (u * q * s)) + 1U];
+    }
+
+    pA[0] = pIn + (2U * s * q);
+    pY[0] = pOut + (2U * s * 5U * q);
+
+    for (u = 1U; u < 5U; u++)
+    {
+      pA[u] = pA[u - 1U] + (2U * s * m);
+      pY[u] = pY[u - 1U] + (2U * s);
+    }
+
+    for (k = 0U; k < s; k++)
+    {
+      for (u = 0U; u < 5U; u++)
+      {
+        ar[u] = ARM_CFFT_MIXED_MUL_Q31(pA[u][0], fifth);
+        ai[u] = ARM_CFFT_MIXED_MUL_Q31(pA[u][1], fifth);
+        pA[u] += 2U;
+      }
+
+      b1r = ar[1] + ar[4];
+      b1i = ai[1] + ai[4];
+      b2r = ar[2] + ar[3];
+      b2i = ai[2] + ai[3];
+      d1r = ar[1] - ar[4];
+      d1i = ai[1] - ai[4];
+      d2r = ar[2] - ar[3];
+      d2i = ai[2] - ai[3];
+
+      pY[0][0] = ar[0] + b1r + b2r;
+      pY[0][1] = ai[0] + b1i + b2i;
+
+      /* y1 = m - i*n, y4 = m + i*n with m = a0 + c1*b1 + c2*b2, n = s1*d1 + s2*d2 */
+      mr = ar[0] + (q31_t) ((((q63_t) c1 * b1r) + ((q63_t) c2 * b2r)) >> 31);
+      mi = ai[0] + (q31_t) ((((q63_t) c1 * b1i) + ((q63_t) c2 * b2i)) >> 31);
+      nr = (q31_t) ((((q63_t) s1 * d1r) + ((q63_t) s2 * d2r)) >> 31);
+      ni = (q31_t) ((((q63_t) s1 * d1i) + ((q63_t) s2 * d2i)) >> 31);
+
+      yr = mr + ni;
+      yi = mi - nr;
+      ARM_CFFT_MIXED_ROTATE_Q31(pY[1], yr, yi, wr[1], wi[1]);
+
+      yr = mr - ni;
+      yi = mi + nr;
+      ARM_CFFT_MIXED_ROTATE_Q31(pY[4], yr, yi, wr[4], wi[4]);
+
+      /* y2 = m - i*n, y3 = m + i*n with m = a0 + c2*b1 + c1*b2, n = s2*d1 - s1*d2 */
+      mr = ar[0] + (q31_t) ((((q63_t) c2 * b1r) + ((q63_t) c1 * b2r)) >> 31);
+      mi = ai[0] + (q31_t) ((((q63_t) c2 * b1i) + ((q63_t) c1 * b2i)) >> 31);
+      nr = (q31_t) ((((q63_t) s2 * d1r) - ((q63_t) s1 * d2r)) >> 31);
+      ni = (q31_t) ((((q63_t) s2 * d1i) - ((q63_t) s1 * d2i)) >> 31);
+
+      yr = mr + ni;
+      yi = mi - nr;
+      ARM_CFFT_MIXED_ROTATE_Q31(pY[2], yr, yi, wr[2], wi[2]);
+
+      yr = mr - ni;
+      yi = mi + nr;
+      ARM_CFFT_MIXED_ROTATE_Q31(pY[3], yr, yi, wr[3], wi[3]);
+
+      for (u = 0U; u < 5U; u++)
+      {
+        pY[u] += 2U;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Processing function for the Q31 mixed-radix CFFT/CIFFT.
+ * @param[in]      S         points to an instance of the Q31 mixed-radix CFFT structure.
+ * @param[in, out] p1        points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+ * @return none.
+ *
+ * \par
+ * Both transforms are scaled by <code>1/fftLen</code>: the forward transform outputs
+ * <code>X[k]/fftLen</code> and the inverse transform matches the textbook definition of the inverse FFT.
+ * The inverse transform is computed as the conjugate of the forward transform of the
+ * conjugated input; the conjugation saturates.
+ */
+
+void arm_cfft_mixed_q31(
+  const arm_cfft_mixed_instance_q31 * S,
+  q31_t * p1,
+  uint8_t ifftFlag)
+{
+  uint32_t fftLen = S->fftLen;                   /* length of the FFT */
+  q31_t *pIn = p1;                               /* input of the current stage */
+  q31_t *pOut = S->pScratch;                     /* output of the current stage */
+  q31_t *pTmp;                                   /* temporary pointer */
+  uint32_t n = fftLen, s = 1U, m;                /* sub-transform length, stride and length of the next stage */
+  uint32_t i;                                    /* loop counter */
+
+  if (ifftFlag == 1U)
+  {
+    for (i = 0U; i < fftLen; i++)
+    {
+      p1[(2U * i) + 1U] = __QSUB(0, p1[(2U * i) + 1U]);
+    }
+  }
+
+  for (i = 0U; i < S->numStages; i++)
+  {
+    m = n / S->factors[i];
+
+    switch (S->factors[i])
+    {
+    case 2U:
+      arm_cfft_mixed_radix2_q31(pIn, pOut, S->pTwiddle, m, s);
+      break;
+    case 3U:
+      arm_cfft_mixed_radix3_q31(pIn, pOut, S->pTwiddle, m, s);
+      break;
+    case 4U:
+      arm_cfft_mixed_radix4_q31(pIn, pOut, S->pTwiddle, m, s);
+      break;
+    default:
+      arm_cfft_mixed_radix5_q31(pIn, pOut, S->pTwiddle, m, s);
+      break;
+    }
+
+    s *= S->factors[i];
+    n = m;
+
+    /* The output of a stage is the input of the next one */
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  /* The result is in the scratch buffer after an odd number of stages */
+  if (pIn != p1)
+  {
+    arm_copy_q31(pIn, p1, 2U * fftLen);
+  }
+
+  if (ifftFlag == 1U)
+  {
+    for (i = 0U; i < fftLen; i++)
+    {
+      p1[(2U * i) + 1U] = __QSUB(0, p1[(2U * i) + 1U]);
+    }
+  }
+}
+
+/**
+ * @} end of MixedRadixFFT group
+ */
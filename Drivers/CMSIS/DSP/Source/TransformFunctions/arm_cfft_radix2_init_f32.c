@@ -69,6 +69,8 @@ arm_status arm_cfft_radix2_init_f32(
   /*  Initialise the default arm status */
   arm_status status = ARM_MATH_SUCCESS;
 
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_F32_4096)
+
   /*  Initialise the FFT length */
   S->fftLen = fftLen;
 
@@ -184,6 +186,13 @@ arm_status arm_cfft_radix2_init_f32(
     break;
   }
 
+#else
+
+  /*  The 4096 point twiddle table shared by all the lengths is not built */
+  status = ARM_MATH_ARGUMENT_ERROR;
+
+#endif
+
   return (status);
 }
 
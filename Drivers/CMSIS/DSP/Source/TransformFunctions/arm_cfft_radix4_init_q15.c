@@ -70,6 +70,9 @@ arm_status arm_cfft_radix4_init_q15(
 {
   /*  Initialise the default arm status */
   arm_status status = ARM_MATH_SUCCESS;
+
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_TWIDDLECOEF_Q15_4096)
+
   /*  Initialise the FFT length */
   S->fftLen = fftLen;
   /*  Initialise the Twiddle coefficient pointer */
@@ -132,6 +135,13 @@ arm_status arm_cfft_radix4_init_q15(
     break;
   }
 
+#else
+
+  /*  The 4096 point twiddle table shared by all the lengths is not built */
+  status = ARM_MATH_ARGUMENT_ERROR;
+
+#endif
+
   return (status);
 }
 
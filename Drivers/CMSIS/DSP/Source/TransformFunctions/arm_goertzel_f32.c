@@ -0,0 +1,178 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_f32.c
+ * Description:  Floating-point Goertzel algorithm
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Algorithm
+ *
+ * \par
+ * The Goertzel algorithm computes a few bins of the DFT of a block with a second-order
+ * recursion per bin, in <code>O(blockSize*numBins)</code> operations instead of the
+ * <code>O(fftLen*log2(fftLen))</code> of an FFT, and for any block length.
+ * Tone and fault-frequency detectors which watch a handful of frequencies use it
+ * instead of a complete transform.
+ * \par
+ * For each bin of frequency <code>w</code> in radians per sample, the recursion
+ * <pre>
+ *     s[n] = x[n] + 2*cos(w)*s[n-1] - s[n-2]
+ * </pre>
+ * runs over the block and the bin is obtained from the last two values:
+ * <pre>
+ *     X = exp(i*w)*s[N-1] - s[N-2]
+ *       = sum(x[n]*exp(-i*w*(n-N)), n = 0, ..., N-1)
+ * </pre>
+ * where <code>N</code> is the block size. When <code>w = 2*pi*k/N</code> for an integer
+ * <code>k</code>, <code>X</code> is the bin <code>k</code> of the DFT of the block, as
+ * computed by arm_rfft_fast_f32(). For other frequencies, it is the DTFT of the block
+ * at <code>w</code> up to the phase <code>w*N</code>, which leaves its magnitude unchanged.
+ * \par
+ * The output holds one complex value per bin in interleaved format:
+ * <pre> {real[0], imag[0], real[1], imag[1],..} </pre>
+ * so that arm_cmplx_mag_f32() or arm_cmplx_mag_squared_f32() give the magnitudes.
+ * \par
+ * The bins are computed two at a time, so that each input sample is loaded once for two bins.
+ *
+ * \par Instance Structure
+ * The instance structure holds the number of bins and a table of the cosine and sine of
+ * each bin frequency, that the initialization function computes from the frequencies
+ * normalized by the sampling frequency. The same instance serves blocks of any length.
+ *
+ * \par Fixed-Point Behavior
+ * The fixed-point functions use coefficients in 1.31 format for all data types, since the
+ * frequency resolution of 1.15 coefficients is too coarse at low frequencies.
+ * The output is scaled by <code>1/blockSize</code> as the fixed-point FFTs, and is in the
+ * format of the input.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Floating-point Goertzel algorithm.
+ * @param[in]  S          points to an instance of the floating-point Goertzel structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[in]  blockSize  number of samples of the block.
+ * @param[out] pDst       points to the complex value of each bin, of length <code>2*numBins</code>.
+ * @return none.
+ */
+
+void arm_goertzel_f32(
+  const arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst)
+{
+  const float32_t *pCoeffs = S->pCoeffs;         /* Coefficient pointer */
+  float32_t *pIn;                                /* Input pointer */
+  float32_t c0, c1;                              /* Twice the cosines of the two bins */
+  float32_t s0, s1, t0, t1, u0, u1;              /* Recursion values of the two bins */
+  float32_t in;                                  /* Input sample */
+  uint32_t binCnt, blkCnt;                       /* Loop counters */
+
+  /* Bins are processed two at a time */
+  binCnt = (uint32_t) S->numBins >> 1U;
+
+  while (binCnt > 0U)
+  {
+    c0 = 2.0f * pCoeffs[0];
+    c1 = 2.0f * pCoeffs[2];
+
+    s0 = 0.0f;
+    s1 = 0.0f;
+    t0 = 0.0f;
+    t1 = 0.0f;
+
+    pIn = pSrc;
+    blkCnt = blockSize;
+
+    while (blkCnt > 0U)
+    {
+      /* Both recursions use the same sample */
+      in = *pIn++;
+
+      /* s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2] */
+      u0 = (in + (c0 * s0)) - t0;
+      u1 = (in + (c1 * s1)) - t1;
+
+      t0 = s0;
+      t1 = s1;
+      s0 = u0;
+      s1 = u1;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* X = exp(i * w) * s[N-1] - s[N-2] */
+    *pDst++ = (pCoeffs[0] * s0) - t0;
+    *pDst++ = pCoeffs[1] * s0;
+    *pDst++ = (pCoeffs[2] * s1) - t1;
+    *pDst++ = pCoeffs[3] * s1;
+
+    pCoeffs += 4U;
+
+    /* Decrement the loop counter */
+    binCnt--;
+  }
+
+  /* If the number of bins is odd, the last bin is computed here */
+  if (((uint32_t) S->numBins & 0x1U) != 0U)
+  {
+    c0 = 2.0f * pCoeffs[0];
+
+    s0 = 0.0f;
+    t0 = 0.0f;
+
+    pIn = pSrc;
+    blkCnt = blockSize;
+
+    while (blkCnt > 0U)
+    {
+      u0 = (*pIn++ + (c0 * s0)) - t0;
+
+      t0 = s0;
+      s0 = u0;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    *pDst++ = (pCoeffs[0] * s0) - t0;
+    *pDst++ = pCoeffs[1] * s0;
+  }
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_f32.c
+ * Description:  Initialization function for the floating-point Goertzel algorithm
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Goertzel algorithm.
+ * @param[in,out] S        points to an instance of the floating-point Goertzel structure.
+ * @param[in]     numBins  number of frequency bins.
+ * @param[in]     pFreqs   points to the frequency of each bin, normalized by the sampling frequency.
+ * @param[out]    pCoeffs  points to the coefficient table to generate, of length <code>2*numBins</code>.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numBins</code> is 0 or a frequency is not in the range <code>[0, 1)</code>.
+ *
+ * \par Description:
+ * \par
+ * The bin <code>k</code> of the DFT of a block of <code>N</code> samples has the normalized
+ * frequency <code>k/N</code>. The table holds <code>cos(2*pi*f)</code> and <code>sin(2*pi*f)</code>
+ * for each frequency <code>f</code>, computed in double precision.
+ */
+
+arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  const float32_t * pFreqs,
+  float32_t * pCoeffs)
+{
+  float64_t phase;                               /* phase of the bin frequency */
+  uint32_t k;                                    /* loop counter */
+
+  if (numBins == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0U; k < numBins; k++)
+  {
+    if ((pFreqs[k] < 0.0f) || (pFreqs[k] >= 1.0f))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  S->numBins = numBins;
+  S->pCoeffs = pCoeffs;
+
+  for (k = 0U; k < numBins; k++)
+  {
+    phase = 6.283185307179586476925 * (float64_t) pFreqs[k];
+
+    pCoeffs[2U * k] = (float32_t) cos(phase);
+    pCoeffs[(2U * k) + 1U] = (float32_t) sin(phase);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,165 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 Goertzel algorithm
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Product of a 64-bit recursion value by twice a 1.31 coefficient.
+ * @param[in] s  recursion value.
+ * @param[in] c  coefficient in 1.31 format.
+ * @return <code>2*c*s</code>, in the format of <code>s</code>.
+ *
+ * The product is split on the two halves of <code>s</code>, so that it needs two
+ * 32x32 multiplications instead of a 64x64 one.
+ */
+
+static __INLINE q63_t arm_goertzel_mult_q31(
+  q63_t s,
+  q31_t c)
+{
+  q31_t hi = (q31_t) (s >> 32);                  /* Signed upper half */
+  uint32_t lo = (uint32_t) s;                    /* Unsigned lower half */
+
+  return ((((q63_t) c * hi) * 4) + (((q63_t) c * lo) >> 30));
+}
+
+/**
+ * @brief Q31 Goertzel algorithm.
+ * @param[in]  S          points to an instance of the Q31 Goertzel structure.
+ * @param[in]  pSrc       points to the block of input data.
+ * @param[in]  blockSize  number of samples of the block.
+ * @param[out] pDst       points to the complex value of each bin, of length <code>2*numBins</code>.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The recursion values are kept in 64 bits with the LSB of the input, which leaves 32 guard bits.
+ * They grow with the block size, up to <code>blockSize/|sin(w)|</code> times the input
+ * amplitude and <code>blockSize^2/2</code> times at the frequency 0: full scale blocks of up
+ * to 32768 samples do not overflow at any frequency.
+ * The output is scaled by <code>1/blockSize</code> and saturated to 1.31 format.
+ */
+
+void arm_goertzel_q31(
+  const arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pDst)
+{
+  const q31_t *pCoeffs = S->pCoeffs;             /* Coefficient pointer */
+  q31_t *pIn;                                    /* Input pointer */
+  q31_t c0, c1;                                  /* Cosines of the two bins */
+  q63_t s0, s1, t0, t1, u0, u1;                  /* Recursion values of the two bins */
+  q31_t in;                                      /* Input sample */
+  q63_t len = (q63_t) blockSize;                 /* Divisor of the output */
+  uint32_t binCnt, blkCnt;                       /* Loop counters */
+
+  /* Bins are processed two at a time */
+  binCnt = (uint32_t) S->numBins >> 1U;
+
+  while (binCnt > 0U)
+  {
+    c0 = pCoeffs[0];
+    c1 = pCoeffs[2];
+
+    s0 = 0;
+    s1 = 0;
+    t0 = 0;
+    t1 = 0;
+
+    pIn = pSrc;
+    blkCnt = blockSize;
+
+    while (blkCnt > 0U)
+    {
+      /* Both recursions use the same sample */
+      in = *pIn++;
+
+      /* s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2] */
+      u0 = (in + arm_goertzel_mult_q31(s0, c0)) - t0;
+      u1 = (in + arm_goertzel_mult_q31(s1, c1)) - t1;
+
+      t0 = s0;
+      t1 = s1;
+      s0 = u0;
+      s1 = u1;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* X = exp(i * w) * s[N-1] - s[N-2], scaled by 1/N */
+    *pDst++ = clip_q63_to_q31(((arm_goertzel_mult_q31(s0, c0) >> 1) - t0) / len);
+    *pDst++ = clip_q63_to_q31((arm_goertzel_mult_q31(s0, pCoeffs[1]) >> 1) / len);
+    *pDst++ = clip_q63_to_q31(((arm_goertzel_mult_q31(s1, c1) >> 1) - t1) / len);
+    *pDst++ = clip_q63_to_q31((arm_goertzel_mult_q31(s1, pCoeffs[3]) >> 1) / len);
+
+    pCoeffs += 4U;
+
+    /* Decrement the loop counter */
+    binCnt--;
+  }
+
+  /* If the number of bins is odd, the last bin is computed here */
+  if (((uint32_t) S->numBins & 0x1U) != 0U)
+  {
+    c0 = pCoeffs[0];
+
+    s0 = 0;
+    t0 = 0;
+
+    pIn = pSrc;
+    blkCnt = blockSize;
+
+    while (blkCnt > 0U)
+    {
+      u0 = (*pIn++ + arm_goertzel_mult_q31(s0, c0)) - t0;
+
+      t0 = s0;
+      s0 = u0;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    *pDst++ = clip_q63_to_q31(((arm_goertzel_mult_q31(s0, c0) >> 1) - t0) / len);
+    *pDst++ = clip_q63_to_q31((arm_goertzel_mult_q31(s0, pCoeffs[1]) >> 1) / len);
+  }
+}
+
+/**
+ * @} end of Goertzel group
+ */
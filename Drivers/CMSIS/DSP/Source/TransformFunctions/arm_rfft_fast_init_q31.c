@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_init_q31.c
+ * Description:  Initialization function for the Q31 fast RFFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RealFFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 fast real FFT.
+ * @param[in,out] S       points to an arm_rfft_fast_instance_q31 structure.
+ * @param[in]     fftLen  length of the real sequence.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+ *
+ * \par Description:
+ * \par
+ * The parameter <code>fftLen</code> specifies the length of the RFFT/RIFFT process. Supported FFT lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096.
+ * \par
+ * The internal complex FFT of length <code>fftLen/2</code> uses the tables of arm_cfft_sR_q31_len<code>fftLen/2</code>.
+ * The twiddle factors of the real stage are read from the Q31 CFFT table of length <code>fftLen</code>,
+ * which holds <code>cos(2*pi*k/fftLen)</code> and <code>sin(2*pi*k/fftLen)</code>, so no additional table is needed.
+ */
+
+arm_status arm_rfft_fast_init_q31(
+  arm_rfft_fast_instance_q31 * S,
+  uint16_t fftLen)
+{
+  arm_cfft_instance_q31 * Sint;
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+  /*  Initialise the FFT length */
+  Sint = &(S->Sint);
+  Sint->fftLen = fftLen/2;
+  S->fftLenRFFT = fftLen;
+
+  /*  Initializations of structure parameters depending on the FFT length */
+  switch (Sint->fftLen)
+  {
+#if defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_Q31_2048) && defined(ARM_TABLE_BITREVIDX_FXT_2048) && defined(ARM_TABLE_TWIDDLECOEF_Q31_4096))
+  case 2048U:
+    /*  Initializations of structure parameters for 2048 point FFT */
+    /*  Initialise the bit reversal table length */
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH;
+    /*  Initialise the bit reversal table pointer */
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_2048;
+    /*  Initialise the Twiddle coefficient pointers */
+    Sint->pTwiddle     = twiddleCoef_2048_q31;
+    S->pTwiddleRFFT    = twiddleCoef_4096_q31;
+    break;
+#endif
+
+#if defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_Q31_1024) && defined(ARM_TABLE_BITREVIDX_FXT_1024) && defined(ARM_TABLE_TWIDDLECOEF_Q31_2048))
+  case 1024U:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH;
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_1024;
+    Sint->pTwiddle     = twiddleCoef_1024_q31;
+    S->pTwiddleRFFT    = twiddleCoef_2048_q31;
+    break;
+#endif
+
+#if defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_Q31_512) && defined(ARM_TABLE_BITREVIDX_FXT_512) && defined(ARM_TABLE_TWIDDLECOEF_Q31_1024))
+  case 512U:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH;
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_512;
+    Sint->pTwiddle     = twiddleCoef_512_q31;
+    S->pTwiddleRFFT    = twiddleCoef_1024_q31;
+    break;
+#endif
+
+#if defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_Q31_256) && defined(ARM_TABLE_BITREVIDX_FXT_256) && defined(ARM_TABLE_TWIDDLECOEF_Q31_512))
+  case 256U:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH;
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_256;
+    Sint->pTwiddle     = twiddleCoef_256_q31;
+    S->pTwiddleRFFT    = twiddleCoef_512_q31;
+    break;
+#endif
+
+#if defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_Q31_128) && defined(ARM_TABLE_BITREVIDX_FXT_128) && defined(ARM_TABLE_TWIDDLECOEF_Q31_256))
+  case 128U:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH;
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_128;
+    Sint->pTwiddle     = twiddleCoef_128_q31;
+    S->pTwiddleRFFT    = twiddleCoef_256_q31;
+    break;
+#endif
+
+#if defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_Q31_64) && defined(ARM_TABLE_BITREVIDX_FXT_64) && defined(ARM_TABLE_TWIDDLECOEF_Q31_128))
+  case 64U:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH;
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_64;
+    Sint->pTwiddle     = twiddleCoef_64_q31;
+    S->pTwiddleRFFT    = twiddleCoef_128_q31;
+    break;
+#endif
+
+#if defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_Q31_32) && defined(ARM_TABLE_BITREVIDX_FXT_32) && defined(ARM_TABLE_TWIDDLECOEF_Q31_64))
+  case 32U:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH;
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_32;
+    Sint->pTwiddle     = twiddleCoef_32_q31;
+    S->pTwiddleRFFT    = twiddleCoef_64_q31;
+    break;
+#endif
+
+#if defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_Q31_16) && defined(ARM_TABLE_BITREVIDX_FXT_16) && defined(ARM_TABLE_TWIDDLECOEF_Q31_32))
+  case 16U:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH;
+    Sint->pBitRevTable = armBitRevIndexTable_fixed_16;
+    Sint->pTwiddle     = twiddleCoef_16_q31;
+    S->pTwiddleRFFT    = twiddleCoef_32_q31;
+    break;
+#endif
+  default:
+    /*  Reporting argument error if fftSize is not valid value */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of RealFFT group
+ */
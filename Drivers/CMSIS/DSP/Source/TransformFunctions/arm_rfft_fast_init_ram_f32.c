@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_init_ram_f32.c
+ * Description:  Initialization of the floating-point fast RFFT with tables computed in RAM
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RealFFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point real FFT with tables computed in RAM.
+ * @param[out]    S       points to an arm_rfft_fast_instance_f32 structure.
+ * @param[in]     fftLen  length of the real sequence: 32, 64, 128, 256, 512, 1024, 2048 or 4096.
+ * @param[in,out] A       points to the arena the tables are allocated from.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not a supported value or ARM_MATH_LENGTH_ERROR if the arena is too small.
+ *
+ * \par Description:
+ * \par
+ * The tables of the internal CFFT of length <code>fftLen/2</code> and the twiddle factors of the real
+ * stage are computed into the arena, with the values of the constant tables used by arm_rfft_fast_init_f32().
+ * The arena needs <code>ARM_CFFT_RAM_TABLES_SIZE_F32(fftLen/2) + 4*fftLen</code> bytes for each instance.
+ */
+
+arm_status arm_rfft_fast_init_ram_f32(
+  arm_rfft_fast_instance_f32 * S,
+  uint16_t fftLen,
+  arm_fft_table_arena * A)
+{
+  arm_status status = ARM_MATH_ARGUMENT_ERROR;
+
+  if ((fftLen >= 32U) && (fftLen <= 4096U) && ((fftLen & (fftLen - 1U)) == 0U))
+  {
+    /* Check the space of both tables before allocating any of them */
+    if (((4U * fftLen) + (2U * arm_cfft_bitrev_gen(NULL, fftLen / 2U, 0U)) + (4U * fftLen)) > (A->size - A->used))
+    {
+      status = ARM_MATH_LENGTH_ERROR;
+    }
+    else
+    {
+      status = arm_cfft_init_ram_f32(&S->Sint, fftLen / 2U, A);
+
+      S->fftLenRFFT = fftLen;
+      S->pTwiddleRFFT = (float32_t *) arm_fft_table_arena_alloc(A, 4U * fftLen);
+
+      arm_rfft_fast_twiddle_gen_f32(S->pTwiddleRFFT, fftLen);
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of RealFFT group
+ */
@@ -0,0 +1,183 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_q31.c
+ * Description:  Q31 fast RFFT processing function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RealFFT
+ * @{
+ */
+
+/**
+ * @brief  Extracts the spectrum of a real sequence from the complex transform of its even and odd samples.
+ * @param[in]  S     points to an instance of the Q31 fast RFFT structure.
+ * @param[in]  p     points to the output of the complex transform.
+ * @param[out] pOut  points to the packed spectrum.
+ * @return none.
+ *
+ * The complex transform is scaled by <code>2/fftLen</code>; the terms are scaled by 1/4
+ * instead of 1/2 so that the spectrum is scaled by <code>1/fftLen</code> and cannot overflow.
+ */
+
+static void stage_rfft_q31(
+  const arm_rfft_fast_instance_q31 * S,
+  const q31_t * p,
+  q31_t * pOut)
+{
+  const q31_t *pCoeff = S->pTwiddleRFFT + 2U;    /* cos and sin of 2*pi*k/fftLen */
+  const q31_t *pA = p + 2U;                      /* increasing pointer */
+  const q31_t *pB = p + (2U * (S->Sint.fftLen - 1U)); /* decreasing pointer */
+  q31_t xAR, xAI, xBR, xBI;                      /* inputs scaled by 1/4 */
+  q31_t twC, twS, t1a, t1b;                      /* temporary variables */
+  uint32_t k = S->Sint.fftLen - 1U;              /* loop counter */
+
+  /* X[0] and X[N/2] are real and packed together */
+  *pOut++ = (p[0] >> 1) + (p[1] >> 1);
+  *pOut++ = (p[0] >> 1) - (p[1] >> 1);
+
+  while (k > 0U)
+  {
+    /* X[k] = 1/2 * (A + conj(B) + TW * (conj(B) - A)), TW = i*exp(-2*pi*i*k/N) */
+    xAR = pA[0] >> 2;
+    xAI = pA[1] >> 2;
+    xBR = pB[0] >> 2;
+    xBI = pB[1] >> 2;
+
+    twC = *pCoeff++;
+    twS = *pCoeff++;
+
+    t1a = xBR - xAR;
+    t1b = xBI + xAI;
+
+    *pOut++ = xAR + xBR + (q31_t) ((((q63_t) twS * t1a) + ((q63_t) twC * t1b)) >> 31);
+    *pOut++ = xAI - xBI + (q31_t) ((((q63_t) twC * t1a) - ((q63_t) twS * t1b)) >> 31);
+
+    pA += 2U;
+    pB -= 2U;
+    k--;
+  }
+}
+
+/**
+ * @brief  Prepares the complex sequence whose inverse transform holds the even and odd samples of a real sequence.
+ * @param[in]  S     points to an instance of the Q31 fast RFFT structure.
+ * @param[in]  p     points to the packed spectrum.
+ * @param[out] pOut  points to the input of the complex inverse transform.
+ * @return none.
+ *
+ * The terms are scaled by 1/4 instead of 1/2 so that the sequence cannot overflow.
+ */
+
+static void merge_rfft_q31(
+  const arm_rfft_fast_instance_q31 * S,
+  const q31_t * p,
+  q31_t * pOut)
+{
+  const q31_t *pCoeff = S->pTwiddleRFFT + 2U;    /* cos and sin of 2*pi*k/fftLen */
+  const q31_t *pA = p + 2U;                      /* increasing pointer */
+  const q31_t *pB = p + (2U * (S->Sint.fftLen - 1U)); /* decreasing pointer */
+  q31_t xAR, xAI, xBR, xBI;                      /* inputs scaled by 1/4 */
+  q31_t twC, twS, t1a, t1b;                      /* temporary variables */
+  uint32_t k = S->Sint.fftLen - 1U;              /* loop counter */
+
+  *pOut++ = (p[0] >> 2) + (p[1] >> 2);
+  *pOut++ = (p[0] >> 2) - (p[1] >> 2);
+
+  while (k > 0U)
+  {
+    xAR = pA[0] >> 2;
+    xAI = pA[1] >> 2;
+    xBR = pB[0] >> 2;
+    xBI = pB[1] >> 2;
+
+    twC = *pCoeff++;
+    twS = *pCoeff++;
+
+    t1a = xAR - xBR;
+    t1b = xAI + xBI;
+
+    *pOut++ = xAR + xBR - (q31_t) ((((q63_t) twS * t1a) + ((q63_t) twC * t1b)) >> 31);
+    *pOut++ = xAI - xBI + (q31_t) ((((q63_t) twC * t1a) - ((q63_t) twS * t1b)) >> 31);
+
+    pA += 2U;
+    pB -= 2U;
+    k--;
+  }
+}
+
+/**
+ * @brief Processing function for the Q31 fast real FFT.
+ * @param[in]  S         points to an arm_rfft_fast_instance_q31 structure.
+ * @param[in]  p         points to the input buffer, which is modified by the forward transform.
+ * @param[out] pOut      points to the output buffer.
+ * @param[in]  ifftFlag  RFFT if flag is 0, RIFFT if flag is 1.
+ * @return none.
+ *
+ * \par
+ * The real sequence is transformed with a complex FFT of length <code>fftLen/2</code> followed by a
+ * split stage, as arm_rfft_fast_f32(), and the spectrum is packed in the same way:
+ * <code>fftLen/2</code> complex values whose first one holds the real values <code>X[0]</code>
+ * and <code>X[fftLen/2]</code>.
+ * \par
+ * arm_cfft_q31() scales each radix stage to avoid overflows and the split stage contributes the
+ * remaining factor of 1/2, so the forward transform outputs <code>X[k]/fftLen</code> in 1.31 format
+ * for all lengths. The inverse transform matches the textbook definition of the inverse FFT, so that
+ * the inverse of the forward output is <code>x[n]/fftLen</code>.
+ */
+
+void arm_rfft_fast_q31(
+  const arm_rfft_fast_instance_q31 * S,
+  q31_t * p,
+  q31_t * pOut,
+  uint8_t ifftFlag)
+{
+  if (ifftFlag == 1U)
+  {
+    merge_rfft_q31(S, p, pOut);
+
+    arm_cfft_q31(&S->Sint, pOut, 1U, 1U);
+
+    /* Compensate the extra 1/2 of the merge */
+    arm_shift_q31(pOut, 1, pOut, S->fftLenRFFT);
+  }
+  else
+  {
+    /* The even and odd samples are the real and imaginary parts of a complex sequence */
+    arm_cfft_q31(&S->Sint, p, 0U, 1U);
+
+    stage_rfft_q31(S, p, pOut);
+  }
+}
+
+/**
+ * @} end of RealFFT group
+ */
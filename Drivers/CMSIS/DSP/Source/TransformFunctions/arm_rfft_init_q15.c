@@ -2178,42 +2178,60 @@ arm_status arm_rfft_init_q15(
     /*  Initialization of coef modifier depending on the FFT length */
     switch (S->fftLenReal)
     {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q15_4096)
     case 8192U:
         S->twidCoefRModifier = 1U;
         S->pCfft = &arm_cfft_sR_q15_len4096;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q15_2048)
     case 4096U:
         S->twidCoefRModifier = 2U;
         S->pCfft = &arm_cfft_sR_q15_len2048;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q15_1024)
     case 2048U:
         S->twidCoefRModifier = 4U;
         S->pCfft = &arm_cfft_sR_q15_len1024;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q15_512)
     case 1024U:
         S->twidCoefRModifier = 8U;
         S->pCfft = &arm_cfft_sR_q15_len512;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q15_256)
     case 512U:
         S->twidCoefRModifier = 16U;
         S->pCfft = &arm_cfft_sR_q15_len256;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q15_128)
     case 256U:
         S->twidCoefRModifier = 32U;
         S->pCfft = &arm_cfft_sR_q15_len128;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q15_64)
     case 128U:
         S->twidCoefRModifier = 64U;
         S->pCfft = &arm_cfft_sR_q15_len64;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q15_32)
     case 64U:
         S->twidCoefRModifier = 128U;
         S->pCfft = &arm_cfft_sR_q15_len32;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q15_16)
     case 32U:
         S->twidCoefRModifier = 256U;
         S->pCfft = &arm_cfft_sR_q15_len16;
         break;
+#endif
     default:
         /*  Reporting argument error if rfftSize is not valid value */
         status = ARM_MATH_ARGUMENT_ERROR;
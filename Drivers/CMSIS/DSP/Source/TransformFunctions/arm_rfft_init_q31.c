@@ -4229,42 +4229,60 @@ arm_status arm_rfft_init_q31(
     /*  Initialization of coef modifier depending on the FFT length */
     switch (S->fftLenReal)
     {
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_4096)
     case 8192U:
         S->twidCoefRModifier = 1U;
         S->pCfft = &arm_cfft_sR_q31_len4096;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_2048)
     case 4096U:
         S->twidCoefRModifier = 2U;
         S->pCfft = &arm_cfft_sR_q31_len2048;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_1024)
     case 2048U:
         S->twidCoefRModifier = 4U;
         S->pCfft = &arm_cfft_sR_q31_len1024;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_512)
     case 1024U:
         S->twidCoefRModifier = 8U;
         S->pCfft = &arm_cfft_sR_q31_len512;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_256)
     case 512U:
         S->twidCoefRModifier = 16U;
         S->pCfft = &arm_cfft_sR_q31_len256;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_128)
     case 256U:
         S->twidCoefRModifier = 32U;
         S->pCfft = &arm_cfft_sR_q31_len128;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_64)
     case 128U:
         S->twidCoefRModifier = 64U;
         S->pCfft = &arm_cfft_sR_q31_len64;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_32)
     case 64U:
         S->twidCoefRModifier = 128U;
         S->pCfft = &arm_cfft_sR_q31_len32;
         break;
+#endif
+#if defined(ARM_ALL_FFT_TABLES) || defined(ARM_TABLE_CFFT_Q31_16)
     case 32U:
         S->twidCoefRModifier = 256U;
         S->pCfft = &arm_cfft_sR_q31_len16;
         break;
+#endif
     default:
         /*  Reporting argument error if rfftSize is not valid value */
         status = ARM_MATH_ARGUMENT_ERROR;
@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_f32.c
+ * Description:  Mixed-radix floating-point RFFT processing function
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MixedRadixFFT
+ * @{
+ */
+
+/**
+ * @brief  Extracts the spectrum of a real sequence from the complex transform of its even and odd samples.
+ * @param[in]  S     points to an instance of the floating-point mixed-radix RFFT structure.
+ * @param[in]  p     points to the output of the complex transform.
+ * @param[out] pOut  points to the packed spectrum.
+ * @return none.
+ */
+
+static void arm_rfft_mixed_split_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  const float32_t * p,
+  float32_t * pOut)
+{
+  const float32_t *pCoeff = S->pTwiddleRFFT + 2U; /* RFFT twiddle factors */
+  const float32_t *pA = p + 2U;                  /* increasing pointer */
+  const float32_t *pB = p + (2U * (S->Sint.fftLen - 1U)); /* decreasing pointer */
+  float32_t xAR, xAI, xBR, xBI;                  /* temporary variables */
+  float32_t twR, twI, t1a, t1b;                  /* temporary variables */
+  uint32_t k = S->Sint.fftLen - 1U;              /* loop counter */
+
+  /* X[0] and X[N/2] are real and packed together */
+  *pOut++ = p[0] + p[1];
+  *pOut++ = p[0] - p[1];
+
+  while (k > 0U)
+  {
+    /* X[k] = 1/2 * (A + conj(B) + TW * (conj(B) - A)), TW = i*exp(-2*pi*i*k/N) */
+    xAR = pA[0];
+    xAI = pA[1];
+    xBR = pB[0];
+    xBI = pB[1];
+
+    twR = *pCoeff++;
+    twI = *pCoeff++;
+
+    t1a = xBR - xAR;
+    t1b = xBI + xAI;
+
+    *pOut++ = 0.5f * (xAR + xBR + (twR * t1a) + (twI * t1b));
+    *pOut++ = 0.5f * (xAI - xBI + (twI * t1a) - (twR * t1b));
+
+    pA += 2U;
+    pB -= 2U;
+    k--;
+  }
+}
+
+/**
+ * @brief  Prepares the complex sequence whose inverse transform holds the even and odd samples of a real sequence.
+ * @param[in]  S     points to an instance of the floating-point mixed-radix RFFT structure.
+ * @param[in]  p     points to the packed spectrum.
+ * @param[out] pOut  points to the input of the complex inverse transform.
+ * @return none.
+ */
+
+static void arm_rfft_mixed_merge_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  const float32_t * p,
+  float32_t * pOut)
+{
+  const float32_t *pCoeff = S->pTwiddleRFFT + 2U; /* RFFT twiddle factors */
+  const float32_t *pA = p + 2U;                  /* increasing pointer */
+  const float32_t *pB = p + (2U * (S->Sint.fftLen - 1U)); /* decreasing pointer */
+  float32_t xAR, xAI, xBR, xBI;                  /* temporary variables */
+  float32_t twR, twI, t1a, t1b;                  /* temporary variables */
+  uint32_t k = S->Sint.fftLen - 1U;              /* loop counter */
+
+  *pOut++ = 0.5f * (p[0] + p[1]);
+  *pOut++ = 0.5f * (p[0] - p[1]);
+
+  while (k > 0U)
+  {
+    xAR = pA[0];
+    xAI = pA[1];
+    xBR = pB[0];
+    xBI = pB[1];
+
+    twR = *pCoeff++;
+    twI = *pCoeff++;
+
+    t1a = xAR - xBR;
+    t1b = xAI + xBI;
+
+    *pOut++ = 0.5f * (xAR + xBR - (twR * t1a) - (twI * t1b));
+    *pOut++ = 0.5f * (xAI - xBI + (twI * t1a) - (twR * t1b));
+
+    pA += 2U;
+    pB -= 2U;
+    k--;
+  }
+}
+
+/**
+ * @brief Processing function for the floating-point mixed-radix real FFT.
+ * @param[in]  S         points to an instance of the floating-point mixed-radix RFFT structure.
+ * @param[in]  p         points to the input buffer, which is modified by the forward transform.
+ * @param[out] pOut      points to the output buffer.
+ * @param[in]  ifftFlag  RFFT if flag is 0, RIFFT if flag is 1.
+ * @return none.
+ *
+ * \par
+ * The spectrum is packed as for arm_rfft_fast_f32(): <code>fftLen/2</code> complex values
+ * whose first one holds the real values <code>X[0]</code> and <code>X[fftLen/2]</code>.
+ * The inverse transform expects its input in this format and includes a scale of <code>1/fftLen</code>.
+ */
+
+void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  float32_t * p,
+  float32_t * pOut,
+  uint8_t ifftFlag)
+{
+  if (ifftFlag == 1U)
+  {
+    arm_rfft_mixed_merge_f32(S, p, pOut);
+
+    arm_cfft_mixed_f32(&S->Sint, pOut, 1U);
+  }
+  else
+  {
+    /* The even and odd samples are the real and imaginary parts of a complex sequence */
+    arm_cfft_mixed_f32(&S->Sint, p, 0U);
+
+    arm_rfft_mixed_split_f32(S, p, pOut);
+  }
+}
+
+/**
+ * @} end of MixedRadixFFT group
+ */
@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_init_f32.c
+ * Description:  Initialization function for the floating-point mixed-radix RFFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MixedRadixFFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point mixed-radix real FFT.
+ * @param[in,out] S             points to an instance of the floating-point mixed-radix RFFT structure.
+ * @param[in]     fftLen        length of the real sequence, twice a product of powers of 2, 3 and 5.
+ * @param[out]    pTwiddle      points to the twiddle factor table of the complex transform to generate, of length <code>fftLen</code>.
+ * @param[out]    pTwiddleRFFT  points to the twiddle factor table of the real transform to generate, of length <code>fftLen</code>.
+ * @param[in]     pScratch      points to a scratch buffer of length <code>fftLen</code>.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not a supported value.
+ *
+ * \par Description:
+ * \par
+ * The real transform uses a complex transform of length <code>fftLen/2</code>, initialized with
+ * arm_cfft_mixed_init_f32(). The real transform table holds <code>sin(2*pi*k/fftLen)</code> and
+ * <code>cos(2*pi*k/fftLen)</code> for <code>k = 0, 1, ..., fftLen/2-1</code>, as the table
+ * used by arm_rfft_fast_f32().
+ */
+
+arm_status arm_rfft_mixed_init_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pTwiddleRFFT,
+  float32_t * pScratch)
+{
+  arm_status status = ARM_MATH_ARGUMENT_ERROR;   /* status of the initialization */
+  float64_t phase;                               /* phase of the twiddle factor */
+  uint32_t k;                                    /* loop counter */
+
+  if ((fftLen % 2U) == 0U)
+  {
+    status = arm_cfft_mixed_init_f32(&S->Sint, fftLen / 2U, pTwiddle, pScratch);
+  }
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    S->fftLenRFFT = fftLen;
+    S->pTwiddleRFFT = pTwiddleRFFT;
+
+    for (k = 0U; k < (fftLen / 2U); k++)
+    {
+      phase = (6.283185307179586476925 * (float64_t) k) / (float64_t) fftLen;
+      pTwiddleRFFT[2U * k] = (float32_t) sin(phase);
+      pTwiddleRFFT[(2U * k) + 1U] = (float32_t) cos(phase);
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MixedRadixFFT group
+ */
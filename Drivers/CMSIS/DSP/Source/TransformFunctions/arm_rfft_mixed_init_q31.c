@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_init_q31.c
+ * Description:  Initialization function for the Q31 mixed-radix RFFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MixedRadixFFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 mixed-radix real FFT.
+ * @param[in,out] S             points to an instance of the Q31 mixed-radix RFFT structure.
+ * @param[in]     fftLen        length of the real sequence, twice a product of powers of 2, 3 and 5.
+ * @param[out]    pTwiddle      points to the twiddle factor table of the complex transform to generate, of length <code>fftLen</code>.
+ * @param[out]    pTwiddleRFFT  points to the twiddle factor table of the real transform to generate, of length <code>fftLen</code>.
+ * @param[in]     pScratch      points to a scratch buffer of length <code>fftLen</code>.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not a supported value.
+ *
+ * \par Description:
+ * \par
+ * The real transform uses a complex transform of length <code>fftLen/2</code>, initialized with
+ * arm_cfft_mixed_init_q31(). The real transform table holds <code>sin(2*pi*k/fftLen)</code> and
+ * <code>cos(2*pi*k/fftLen)</code> for <code>k = 0, 1, ..., fftLen/2-1</code> in 1.31 format.
+ */
+
+arm_status arm_rfft_mixed_init_q31(
+  arm_rfft_mixed_instance_q31 * S,
+  uint16_t fftLen,
+  q31_t * pTwiddle,
+  q31_t * pTwiddleRFFT,
+  q31_t * pScratch)
+{
+  arm_status status = ARM_MATH_ARGUMENT_ERROR;   /* status of the initialization */
+  float64_t phase, scaled;                       /* phase and scaled component of the twiddle factor */
+  uint32_t k, j;                                 /* loop counters */
+
+  if ((fftLen % 2U) == 0U)
+  {
+    status = arm_cfft_mixed_init_q31(&S->Sint, fftLen / 2U, pTwiddle, pScratch);
+  }
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    S->fftLenRFFT = fftLen;
+    S->pTwiddleRFFT = pTwiddleRFFT;
+
+    for (k = 0U; k < (fftLen / 2U); k++)
+    {
+      phase = (6.283185307179586476925 * (float64_t) k) / (float64_t) fftLen;
+
+      for (j = 0U; j < 2U; j++)
+      {
+        scaled = ((j == 0U) ? sin(phase) : cos(phase)) * 2147483648.0;
+        scaled = (scaled >= 0.0) ? (scaled + 0.5) : (scaled - 0.5);
+        pTwiddleRFFT[(2U * k) + j] = (scaled >= 2147483647.0) ? 0x7FFFFFFF : (q31_t) scaled;
+      }
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MixedRadixFFT group
+ */
@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_f32.c
+ * Description:  Floating-point sliding DFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup SlidingDFT Sliding DFT
+ *
+ * \par
+ * The sliding DFT updates a few bins of the DFT of the last <code>winLen</code> samples
+ * each time a sample arrives, in <code>O(numBins)</code> operations per sample. Detectors
+ * get a new spectrum after every sample instead of waiting for a block to fill up.
+ * \par
+ * Each bin <code>k</code> of the window is updated by the recursion
+ * <pre>
+ *     X[n] = r*exp(i*w)*(X[n-1] + x[n] - r^winLen*x[n-winLen])
+ * </pre>
+ * where <code>w = 2*pi*k/winLen</code>. With the damping factor <code>r = 1</code>,
+ * <code>X[n]</code> is the bin <code>k</code> of the DFT of the samples
+ * <code>x[n-winLen+1], ..., x[n]</code>, the oldest sample first, as computed by
+ * arm_rfft_fast_f32(). The samples before the first one are 0.
+ * \par
+ * The rotation rounding errors of the undamped recursion accumulate over time.
+ * A damping factor slightly below 1, such as <code>0.9999</code>, makes them decay for
+ * streams that run indefinitely, at the cost of a window with exponential weights.
+ * \par
+ * The processing function feeds a block of samples one at a time. The sample leaving the
+ * window and its difference with the new sample are shared by all the bins, and the
+ * function writes the bins after the last sample of the block in interleaved format:
+ * <pre> {real[0], imag[0], real[1], imag[1],..} </pre>
+ * A block of one sample gives a new spectrum after each sample.
+ *
+ * \par Instance Structure
+ * The instance holds the rotations of the bins, their current values and the delay line of
+ * the last <code>winLen</code> samples. The initialization function computes the rotations
+ * and clears the bins and the delay line.
+ *
+ * \par Fixed-Point Behavior
+ * The fixed-point functions keep the bins divided by <code>winLen</code> in 1.31 format, as the
+ * fixed-point FFTs scale their output, and use rotations in 1.31 format for all data types.
+ * The difference of the new and the oldest sample is scaled by <code>1/winLen</code> once
+ * per sample.
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief Floating-point sliding DFT.
+ * @param[in,out] S          points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[in]     blockSize  number of samples of the block.
+ * @param[out]    pDst       points to the complex value of each bin after the last sample, of length <code>2*numBins</code>.
+ * @return none.
+ */
+
+void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pDelay = S->pDelay;                 /* Delay line pointer */
+  const float32_t *pCoeffs;                      /* Coefficient pointer */
+  float32_t *pX;                                 /* Pointer to the current bin */
+  float32_t dampLen = S->dampLen;                /* Damping of the oldest sample */
+  float32_t in, diff;                            /* New sample and its difference with the oldest one */
+  float32_t c, s, re, im;                        /* Rotation and value of the current bin */
+  uint32_t delayIndex = S->delayIndex;           /* Index of the oldest sample */
+  uint32_t winLen = S->winLen;                   /* Length of the window */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t blkCnt, binCnt;                       /* Loop counters */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* The new sample replaces the oldest one in the delay line */
+    in = *pSrc++;
+    diff = in - (dampLen * pDelay[delayIndex]);
+    pDelay[delayIndex] = in;
+
+    delayIndex++;
+
+    if (delayIndex == winLen)
+    {
+      delayIndex = 0U;
+    }
+
+    pCoeffs = S->pCoeffs;
+    pX = pState;
+    binCnt = numBins;
+
+    while (binCnt > 0U)
+    {
+      c = *pCoeffs++;
+      s = *pCoeffs++;
+
+      /* X[n] = r * exp(i * w) * (X[n-1] + x[n] - r^N * x[n-N]) */
+      re = pX[0] + diff;
+      im = pX[1];
+
+      pX[0] = (c * re) - (s * im);
+      pX[1] = (s * re) + (c * im);
+
+      pX += 2U;
+
+      /* Decrement the loop counter */
+      binCnt--;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->delayIndex = (uint16_t) delayIndex;
+
+  /* Copy the bins after the last sample */
+  arm_copy_f32(pState, pDst, 2U * numBins);
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
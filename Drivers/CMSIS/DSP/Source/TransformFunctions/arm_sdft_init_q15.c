@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_q15.c
+ * Description:  Initialization function for the Q15 sliding DFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 sliding DFT.
+ * @param[in,out] S        points to an instance of the Q15 sliding DFT structure.
+ * @param[in]     numBins  number of frequency bins.
+ * @param[in]     winLen   length of the sliding window, at least 2.
+ * @param[in]     pBins    points to the DFT index of each bin, below <code>winLen</code>.
+ * @param[in]     damping  damping factor <code>r</code>, in the range <code>(0, 1]</code>.
+ * @param[out]    pCoeffs  points to the rotation table to generate, of length <code>2*numBins</code>.
+ * @param[in]     pState   points to the bin values, of length <code>2*numBins</code>.
+ * @param[in]     pDelay   points to the delay line, of length <code>winLen</code>.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ * an argument is not in its range.
+ *
+ * \par Description:
+ * \par
+ * The table holds <code>r*cos(2*pi*k/winLen)</code> and <code>r*sin(2*pi*k/winLen)</code>
+ * for each DFT index <code>k</code> in 1.31 format, computed in double precision with rounding
+ * and saturation of the value 1.
+ * The bin values and the delay line are cleared.
+ */
+
+arm_status arm_sdft_init_q15(
+  arm_sdft_instance_q15 * S,
+  uint16_t numBins,
+  uint16_t winLen,
+  const uint16_t * pBins,
+  float32_t damping,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q15_t * pDelay)
+{
+  float64_t phase, scaled;                       /* phase of the rotation and scaled coefficient */
+  uint32_t k, j;                                 /* loop counters */
+
+  if ((numBins == 0U) || (winLen < 2U) || (damping <= 0.0f) || (damping > 1.0f))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0U; k < numBins; k++)
+  {
+    if (pBins[k] >= winLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  S->numBins = numBins;
+  S->winLen = winLen;
+  S->delayIndex = 0U;
+  S->dampLen = clip_q63_to_q31((q63_t) ((pow((float64_t) damping, (float64_t) winLen) * 2147483648.0) + 0.5));
+  S->invLen = (q31_t) ((2147483648.0 / (float64_t) winLen) + 0.5);
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pDelay = pDelay;
+
+  for (k = 0U; k < numBins; k++)
+  {
+    phase = (6.283185307179586476925 * (float64_t) pBins[k]) / (float64_t) winLen;
+
+    for (j = 0U; j < 2U; j++)
+    {
+      scaled = (float64_t) damping * ((j == 0U) ? cos(phase) : sin(phase)) * 2147483648.0;
+      scaled = (scaled >= 0.0) ? (scaled + 0.5) : (scaled - 0.5);
+      pCoeffs[(2U * k) + j] = (scaled >= 2147483647.0) ? 0x7FFFFFFF : (q31_t) scaled;
+    }
+  }
+
+  /* Clear the bins and the delay line */
+  memset(pState, 0, 2U * numBins * sizeof(q31_t));
+  memset(pDelay, 0, winLen * sizeof(q15_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
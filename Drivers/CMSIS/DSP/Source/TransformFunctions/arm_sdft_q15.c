@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_q15.c
+ * Description:  Q15 sliding DFT
+ *
+ * $Date:        19. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief Q15 sliding DFT.
+ * @param[in,out] S          points to an instance of the Q15 sliding DFT structure.
+ * @param[in]     pSrc       points to the block of input data.
+ * @param[in]     blockSize  number of samples of the block.
+ * @param[out]    pDst       points to the complex value of each bin after the last sample, of length <code>2*numBins</code>.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The bins are divided by <code>winLen</code> and kept in 1.31 format, so that the rounding
+ * errors of the rotations stay well below the LSB of the 1.15 output.
+ * The output is rounded to 1.15 format.
+ */
+
+void arm_sdft_q15(
+  arm_sdft_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pDst)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q15_t *pDelay = S->pDelay;                     /* Delay line pointer */
+  const q31_t *pCoeffs;                          /* Coefficient pointer */
+  q31_t *pX;                                     /* Pointer to the current bin */
+  q31_t dampLen = S->dampLen;                    /* Damping of the oldest sample */
+  q31_t invLen = S->invLen;                      /* Scaling of the new samples */
+  q15_t in;                                      /* New sample */
+  q31_t diff;                                    /* Scaled difference of the new and the oldest sample */
+  q31_t c, s, re, im;                            /* Rotation and value of the current bin */
+  uint32_t delayIndex = S->delayIndex;           /* Index of the oldest sample */
+  uint32_t winLen = S->winLen;                   /* Length of the window */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t blkCnt, binCnt;                       /* Loop counters */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    /* The new sample replaces the oldest one in the delay line */
+    in = *pSrc++;
+    diff = (q31_t) (((((q63_t) in << 16) - (((q63_t) dampLen * pDelay[delayIndex]) >> 15)) * invLen) >> 31);
+    pDelay[delayIndex] = in;
+
+    delayIndex++;
+
+    if (delayIndex == winLen)
+    {
+      delayIndex = 0U;
+    }
+
+    pCoeffs = S->pCoeffs;
+    pX = pState;
+    binCnt = numBins;
+
+    while (binCnt > 0U)
+    {
+      c = *pCoeffs++;
+      s = *pCoeffs++;
+
+      /* X[n] = r * exp(i * w) * (X[n-1] + (x[n] - r^N * x[n-N]) / N) */
+      re = clip_q63_to_q31((q63_t) pX[0] + diff);
+      im = pX[1];
+
+      pX[0] = (q31_t) (((((q63_t) c * re) - ((q63_t) s * im)) + 0x40000000) >> 31);
+      pX[1] = (q31_t) (((((q63_t) s * re) + ((q63_t) c * im)) + 0x40000000) >> 31);
+
+      pX += 2U;
+
+      /* Decrement the loop counter */
+      binCnt--;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->delayIndex = (uint16_t) delayIndex;
+
+  /* Round the bins after the last sample to 1.15 format */
+  pX = pState;
+  binCnt = 2U * numBins;
+
+  while (binCnt > 0U)
+  {
+    *pDst++ = (q15_t) __SSAT((*pX++ + 0x8000) >> 16, 16);
+
+    /* Decrement the loop counter */
+    binCnt--;
+  }
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
@@ -0,0 +1,324 @@
+/*
+ * arm_fft_tablegen.c
+ *
+ * Генератор таблиц FFT CMSIS-DSP только для нужных длин ( запускается на ПК )
+ *
+ * Сборка:   gcc -O2 -DARM_MATH_CM3 -I../Drivers/CMSIS/DSP/Include -I../Drivers/CMSIS/Include -o arm_fft_tablegen
+ *           arm_fft_tablegen.c ../Drivers/CMSIS/DSP/Source/CommonTables/arm_fft_table_gen.c -lm
+ * Запуск:   arm_fft_tablegen [-o каталог] тип:длина ...
+ *
+ * Типы ( длина - как у соответствующей функции init ):
+ *   cfft_f32, cfft_q31, cfft_q15                 - таблицы и структура arm_cfft_sR_xxx_lenN
+ *   rfft_fast_f32, rfft_fast_q31, rfft_fast_q15  - таблицы arm_rfft_fast_init_xxx()
+ *   rfft_q31, rfft_q15                           - структура CFFT для arm_rfft_init_xxx()
+ * Результат - arm_fft_tables.c ( таблицы под стандартными именами ) и arm_fft_tables_config.h
+ * ( макросы ARM_TABLE_xxx ). В проекте вместо полного набора из arm_common_tables.c и
+ * arm_const_structs.c собирается arm_fft_tables.c, определяется ARM_DSP_CONFIG_TABLES,
+ * каталог с arm_fft_tables_config.h добавляется в пути поиска заголовков.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arm_math.h"
+
+#define MAX_LEN				4096
+#define NUM_LENS			9			// 16 ... 4096
+
+// что нужно для каждой длины CFFT ( индекс - log2(N) - 4 )
+static uint8_t TwF32[NUM_LENS], TwQ31[NUM_LENS], TwQ15[NUM_LENS], TwRfftF32[NUM_LENS];
+static uint8_t BrFlt[NUM_LENS], BrFxt[NUM_LENS];
+static uint8_t CfftF32[NUM_LENS], CfftQ31[NUM_LENS], CfftQ15[NUM_LENS];
+
+//==============================================================================
+// Процедура вычисления индекса длины, -1 если длина не поддерживается
+//==============================================================================
+static int LenIndex(long n)
+{
+
+	int i;
+
+	for (i = 0; i < NUM_LENS; i++)
+	{
+		if (n == (16L << i))
+		{
+			return i;
+		}
+	}
+
+	return -1;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура разбора одного задания тип:длина
+//==============================================================================
+static int AddSpec(const char *spec)
+{
+
+	const char *colon = strchr(spec, ':');
+	size_t typeLen;
+	long n;
+	int i, half;
+
+	if (colon == NULL)
+	{
+		return 0;
+	}
+
+	typeLen = (size_t)(colon - spec);
+	n = strtol(colon + 1, NULL, 10);
+	i = LenIndex(n);
+	half = LenIndex(n / 2);
+
+	if ((typeLen == 8) && !strncmp(spec, "cfft_f32", typeLen) && (i >= 0))
+	{
+		TwF32[i] = BrFlt[i] = CfftF32[i] = 1;
+	}
+	else if ((typeLen == 8) && !strncmp(spec, "cfft_q31", typeLen) && (i >= 0))
+	{
+		TwQ31[i] = BrFxt[i] = CfftQ31[i] = 1;
+	}
+	else if ((typeLen == 8) && !strncmp(spec, "cfft_q15", typeLen) && (i >= 0))
+	{
+		TwQ15[i] = BrFxt[i] = CfftQ15[i] = 1;
+	}
+	else if ((typeLen == 13) && !strncmp(spec, "rfft_fast_f32", typeLen) && (half >= 0))
+	{
+		// CFFT половинной длины + таблица разделения спектра длины N
+		TwF32[half] = BrFlt[half] = CfftF32[half] = 1;
+		TwRfftF32[half + 1] = 1;
+	}
+	else if ((typeLen == 13) && !strncmp(spec, "rfft_fast_q31", typeLen) && (half >= 0) && (i >= 0))
+	{
+		// таблица разделения - таблица CFFT длины N
+		TwQ31[half] = BrFxt[half] = TwQ31[i] = 1;
+	}
+	else if ((typeLen == 13) && !strncmp(spec, "rfft_fast_q15", typeLen) && (half >= 0) && (i >= 0))
+	{
+		TwQ15[half] = BrFxt[half] = TwQ15[i] = 1;
+	}
+	else if ((typeLen == 8) && !strncmp(spec, "rfft_q31", typeLen) && (half >= 0))
+	{
+		TwQ31[half] = BrFxt[half] = CfftQ31[half] = 1;
+	}
+	else if ((typeLen == 8) && !strncmp(spec, "rfft_q15", typeLen) && (half >= 0))
+	{
+		TwQ15[half] = BrFxt[half] = CfftQ15[half] = 1;
+	}
+	else
+	{
+		return 0;
+	}
+
+	return 1;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедуры вывода массивов
+//==============================================================================
+static void PutF32(FILE *f, const char *name, const float32_t *p, int n)
+{
+
+	char buf[32];
+	int k, j;
+
+	fprintf(f, "const float32_t %s[%d] = {\n", name, n);
+	for (k = 0; k < n; k += 2)
+	{
+		fprintf(f, "   ");
+		for (j = k; j < k + 2; j++)
+		{
+			// 9 знаков как в arm_common_tables.c, если значение восстанавливается без потерь
+			snprintf(buf, sizeof(buf), "%.9f", p[j]);
+			if ((float32_t)strtod(buf, NULL) != p[j])
+			{
+				snprintf(buf, sizeof(buf), "%.8e", p[j]);
+			}
+			fprintf(f, " %12sf%s", buf, (j + 1 < n) ? "," : "");
+		}
+		fprintf(f, "\n");
+	}
+	fprintf(f, "};\n\n");
+}
+
+static void PutQ31(FILE *f, const char *name, const q31_t *p, int n)
+{
+
+	int k;
+
+	fprintf(f, "const q31_t %s[%d] = {\n", name, n);
+	for (k = 0; k < n; k += 2)
+	{
+		fprintf(f, "    (q31_t)0x%08X, (q31_t)0x%08X%s\n", (unsigned)p[k], (unsigned)p[k + 1], (k + 2 < n) ? "," : "");
+	}
+	fprintf(f, "};\n\n");
+}
+
+static void PutQ15(FILE *f, const char *name, const q15_t *p, int n)
+{
+
+	int k;
+
+	fprintf(f, "const q15_t %s[%d] = {\n", name, n);
+	for (k = 0; k < n; k += 2)
+	{
+		fprintf(f, "    (q15_t)0x%04X, (q15_t)0x%04X%s\n", (uint16_t)p[k], (uint16_t)p[k + 1], (k + 2 < n) ? "," : "");
+	}
+	fprintf(f, "};\n\n");
+}
+
+static void PutBitRev(FILE *f, const char *name, const char *lenName, const uint16_t *p, int n)
+{
+
+	int k;
+
+	fprintf(f, "const uint16_t %s[%s] =\n{\n", name, lenName);
+	for (k = 0; k < n; k += 2)
+	{
+		fprintf(f, "%s%d,%d%s", ((k % 16) == 0) ? "   " : " ", p[k], p[k + 1], (k + 2 < n) ? "," : "");
+		if (((k % 16) == 14) || (k + 2 >= n))
+		{
+			fprintf(f, "\n");
+		}
+	}
+	fprintf(f, "};\n\n");
+}
+//==============================================================================
+
+int main(int argc, char **argv)
+{
+
+	static float32_t f32[2 * MAX_LEN];
+	static q31_t q31[2 * MAX_LEN];
+	static q15_t q15[2 * MAX_LEN];
+	static uint16_t brev[2 * MAX_LEN];
+	const char *dir = ".";
+	char path[1024], name[64], lenName[64];
+	int i, specs = 0, count;
+	long n;
+	FILE *c, *h;
+
+	for (i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-o") && (i + 1 < argc))
+		{
+			dir = argv[++i];
+		}
+		else if (AddSpec(argv[i]))
+		{
+			specs++;
+		}
+		else
+		{
+			fprintf(stderr, "%s: unknown type or length\n", argv[i]);
+			return 1;
+		}
+	}
+
+	if (specs == 0)
+	{
+		fprintf(stderr, "usage: arm_fft_tablegen [-o dir] cfft_f32:N cfft_q31:N cfft_q15:N rfft_fast_f32:N\n"
+						"                        rfft_fast_q31:N rfft_fast_q15:N rfft_q31:N rfft_q15:N ...\n");
+		return 1;
+	}
+
+	snprintf(path, sizeof(path), "%s/arm_fft_tables.c", dir);
+	c = fopen(path, "w");
+	snprintf(path, sizeof(path), "%s/arm_fft_tables_config.h", dir);
+	h = fopen(path, "w");
+	if ((c == NULL) || (h == NULL))
+	{
+		fprintf(stderr, "%s: cannot create\n", dir);
+		return 1;
+	}
+
+	fprintf(h, "/* Generated by arm_fft_tablegen, do not edit */\n\n"
+			   "#ifndef _ARM_FFT_TABLES_CONFIG_H\n#define _ARM_FFT_TABLES_CONFIG_H\n\n");
+	fprintf(c, "/* Generated by arm_fft_tablegen, do not edit */\n\n"
+			   "#include \"arm_math.h\"\n#include \"arm_common_tables.h\"\n#include \"arm_const_structs.h\"\n\n");
+
+	for (i = 0; i < NUM_LENS; i++)
+	{
+		n = 16L << i;
+
+		if (TwF32[i])
+		{
+			arm_cfft_twiddle_gen_f32(f32, (uint16_t)n);
+			snprintf(name, sizeof(name), "twiddleCoef_%ld", n);
+			PutF32(c, name, f32, 2 * (int)n);
+			fprintf(h, "#define ARM_TABLE_TWIDDLECOEF_F32_%ld\n", n);
+		}
+		if (TwRfftF32[i])
+		{
+			arm_rfft_fast_twiddle_gen_f32(f32, (uint16_t)n);
+			snprintf(name, sizeof(name), "twiddleCoef_rfft_%ld", n);
+			PutF32(c, name, f32, (int)n);
+			fprintf(h, "#define ARM_TABLE_TWIDDLECOEF_RFFT_F32_%ld\n", n);
+		}
+		if (TwQ31[i])
+		{
+			arm_cfft_twiddle_gen_q31(q31, (uint16_t)n);
+			snprintf(name, sizeof(name), "twiddleCoef_%ld_q31", n);
+			PutQ31(c, name, q31, 3 * (int)n / 2);
+			fprintf(h, "#define ARM_TABLE_TWIDDLECOEF_Q31_%ld\n", n);
+		}
+		if (TwQ15[i])
+		{
+			arm_cfft_twiddle_gen_q15(q15, (uint16_t)n);
+			snprintf(name, sizeof(name), "twiddleCoef_%ld_q15", n);
+			PutQ15(c, name, q15, 3 * (int)n / 2);
+			fprintf(h, "#define ARM_TABLE_TWIDDLECOEF_Q15_%ld\n", n);
+		}
+		if (BrFlt[i])
+		{
+			count = arm_cfft_bitrev_gen(brev, (uint16_t)n, 0U);
+			snprintf(name, sizeof(name), "armBitRevIndexTable%ld", n);
+			snprintf(lenName, sizeof(lenName), "ARMBITREVINDEXTABLE_%ld_TABLE_LENGTH", n);
+			PutBitRev(c, name, lenName, brev, count);
+			fprintf(h, "#define ARM_TABLE_BITREVIDX_FLT_%ld\n", n);
+		}
+		if (BrFxt[i])
+		{
+			count = arm_cfft_bitrev_gen(brev, (uint16_t)n, 1U);
+			snprintf(name, sizeof(name), "armBitRevIndexTable_fixed_%ld", n);
+			snprintf(lenName, sizeof(lenName), "ARMBITREVINDEXTABLE_FIXED_%ld_TABLE_LENGTH", n);
+			PutBitRev(c, name, lenName, brev, count);
+			fprintf(h, "#define ARM_TABLE_BITREVIDX_FXT_%ld\n", n);
+		}
+	}
+
+	for (i = 0; i < NUM_LENS; i++)
+	{
+		n = 16L << i;
+
+		if (CfftF32[i])
+		{
+			fprintf(c, "const arm_cfft_instance_f32 arm_cfft_sR_f32_len%ld = {\n"
+					   "\t%ld, twiddleCoef_%ld, armBitRevIndexTable%ld, ARMBITREVINDEXTABLE_%ld_TABLE_LENGTH\n};\n\n",
+					n, n, n, n, n);
+			fprintf(h, "#define ARM_TABLE_CFFT_F32_%ld\n", n);
+		}
+		if (CfftQ31[i])
+		{
+			fprintf(c, "const arm_cfft_instance_q31 arm_cfft_sR_q31_len%ld = {\n"
+					   "\t%ld, twiddleCoef_%ld_q31, armBitRevIndexTable_fixed_%ld, ARMBITREVINDEXTABLE_FIXED_%ld_TABLE_LENGTH\n};\n\n",
+					n, n, n, n, n);
+			fprintf(h, "#define ARM_TABLE_CFFT_Q31_%ld\n", n);
+		}
+		if (CfftQ15[i])
+		{
+			fprintf(c, "const arm_cfft_instance_q15 arm_cfft_sR_q15_len%ld = {\n"
+					   "\t%ld, twiddleCoef_%ld_q15, armBitRevIndexTable_fixed_%ld, ARMBITREVINDEXTABLE_FIXED_%ld_TABLE_LENGTH\n};\n\n",
+					n, n, n, n, n);
+			fprintf(h, "#define ARM_TABLE_CFFT_Q15_%ld\n", n);
+		}
+	}
+
+	fprintf(h, "\n#endif /* _ARM_FFT_TABLES_CONFIG_H */\n");
+	fclose(h);
+	fclose(c);
+
+	return 0;
+}
@@ -0,0 +1,489 @@
+/*
+ * st7789_animenc.c
+ *
+ * Кодировщик дифференциальной анимации для st7789_anim ( запускается на ПК )
+ *
+ * Сборка:   gcc -O2 -o st7789_animenc st7789_animenc.c
+ * Запуск:   st7789_animenc [-n имя] [-d мс] [-g зазор] [-loop] [-o out.h] frame0.ppm frame1.ppm ...
+ *
+ * Кадры - двоичные PPM ( P6, 8 бит на канал ) одного размера, например
+ *           convert anim.gif -coalesce frame%03d.ppm
+ * Результат - заголовочный файл с массивом const uint16_t ( формат описан в st7789_anim.h ),
+ * после записи поток декодируется обратно и сравнивается с исходными кадрами.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+// формат потока - должен совпадать с st7789_anim.h
+#define ANIM_MAGIC			0x4E41
+#define ANIM_VERSION		1
+#define ANIM_FLAG_LOOP		0x01
+#define ANIM_RECT_RAW		0
+#define ANIM_RECT_FILL		1
+#define ANIM_HEADER_WORDS	6
+
+// цена одного окна ( CASET + RASET + RAMWR с параметрами, переключения CS ) в пикселях
+#define WINDOW_COST			8
+
+#define MAX_FRAMES			1024
+
+typedef struct {
+	int x0, x1;				// [x0, x1)
+	int y0, h;
+	int row;				// последняя строка, к которой присоединялся отрезок
+} Rect_t;
+
+static uint16_t *Stream;
+static size_t StreamLen, StreamCap;
+
+//==============================================================================
+// Процедура добавления слова в поток
+//==============================================================================
+static void Put(uint16_t w)
+{
+
+	if (StreamLen == StreamCap)
+	{
+		StreamCap = StreamCap ? StreamCap * 2 : 65536;
+		Stream = realloc(Stream, StreamCap * sizeof(uint16_t));
+		if (Stream == NULL)
+		{
+			fprintf(stderr, "out of memory\n");
+			exit(1);
+		}
+	}
+
+	Stream[StreamLen++] = w;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура чтения числа из заголовка PPM ( с комментариями )
+//==============================================================================
+static int PpmNumber(FILE *f)
+{
+
+	int c, v = 0;
+
+	do
+	{
+		c = fgetc(f);
+		if (c == '#')
+		{
+			while ((c != '\n') && (c != EOF))
+			{
+				c = fgetc(f);
+			}
+		}
+	} while ((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n'));
+
+	while ((c >= '0') && (c <= '9'))
+	{
+		v = v * 10 + (c - '0');
+		c = fgetc(f);
+	}
+
+	return v;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура загрузки кадра PPM в RGB565
+//==============================================================================
+static uint16_t *LoadPpm(const char *name, int *pw, int *ph)
+{
+
+	FILE *f = fopen(name, "rb");
+	uint8_t rgb[3];
+	uint16_t *pix;
+	int w, h, maxval, i;
+
+	if (f == NULL)
+	{
+		fprintf(stderr, "%s: cannot open\n", name);
+		exit(1);
+	}
+
+	if ((fgetc(f) != 'P') || (fgetc(f) != '6'))
+	{
+		fprintf(stderr, "%s: not a binary PPM (P6)\n", name);
+		exit(1);
+	}
+
+	w = PpmNumber(f);
+	h = PpmNumber(f);
+	maxval = PpmNumber(f);
+
+	if ((w <= 0) || (h <= 0) || (w > 320) || (h > 320) || (maxval != 255))
+	{
+		fprintf(stderr, "%s: unsupported size or depth\n", name);
+		exit(1);
+	}
+
+	pix = malloc(sizeof(uint16_t) * w * h);
+
+	for (i = 0; i < w * h; i++)
+	{
+		if (fread(rgb, 1, 3, f) != 3)
+		{
+			fprintf(stderr, "%s: truncated\n", name);
+			exit(1);
+		}
+		pix[i] = (uint16_t)(((rgb[0] & 0xF8) << 8) | ((rgb[1] & 0xFC) << 3) | (rgb[2] >> 3));
+	}
+
+	fclose(f);
+
+	*pw = w;
+	*ph = h;
+
+	return pix;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура записи прямоугольника: одноцветный - FILL, иначе RAW
+//==============================================================================
+static void PutRect(const uint16_t *cur, int w, const Rect_t *r, long *pPixels)
+{
+
+	int x, y, solid = 1;
+	uint16_t c = cur[r->y0 * w + r->x0];
+
+	for (y = r->y0; (y < r->y0 + r->h) && solid; y++)
+	{
+		for (x = r->x0; x < r->x1; x++)
+		{
+			if (cur[y * w + x] != c)
+			{
+				solid = 0;
+				break;
+			}
+		}
+	}
+
+	Put((uint16_t)r->x0);
+	Put((uint16_t)r->y0);
+	Put((uint16_t)(r->x1 - r->x0));
+	Put((uint16_t)(r->h | ((solid ? ANIM_RECT_FILL : ANIM_RECT_RAW) << 12)));
+
+	if (solid)
+	{
+		Put(c);
+	}
+	else
+	{
+		// порядок байт дисплея, как у картинок в bitmap.h
+		for (y = r->y0; y < r->y0 + r->h; y++)
+		{
+			for (x = r->x0; x < r->x1; x++)
+			{
+				c = cur[y * w + x];
+				Put((uint16_t)((c >> 8) | (c << 8)));
+			}
+		}
+	}
+
+	*pPixels += (long)(r->x1 - r->x0) * r->h;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура кодирования кадра относительно предыдущего ( prev == NULL - ключевой )
+// строки разбиваются на изменившиеся отрезки ( зазоры короче gap объединяются ),
+// отрезки соседних строк сливаются в прямоугольник, если это не дороже отдельного окна
+//==============================================================================
+static int EncodeFrame(const uint16_t *prev, const uint16_t *cur, int w, int h, int gap, uint16_t delay, long *pPixels)
+{
+
+	static Rect_t rects[4096];
+	int nrect = 0, nopen = 0, i, x, y, x0, x1, last, best;
+	long cost, merged;
+	size_t countPos;
+
+	Put(delay);
+	countPos = StreamLen;
+	Put(0);
+
+	if (prev == NULL)
+	{
+		Rect_t all = { 0, w, 0, h, 0 };
+
+		PutRect(cur, w, &all, pPixels);
+		Stream[countPos] = 1;
+
+		return 1;
+	}
+
+	for (y = 0; y < h; y++)
+	{
+		x = 0;
+		while (x < w)
+		{
+			// начало отрезка
+			while ((x < w) && (prev[y * w + x] == cur[y * w + x]))
+			{
+				x++;
+			}
+			if (x == w)
+			{
+				break;
+			}
+
+			x0 = x;
+			last = x;
+			while ((x < w) && (x - last <= gap))
+			{
+				if (prev[y * w + x] != cur[y * w + x])
+				{
+					last = x;
+				}
+				x++;
+			}
+			x1 = last + 1;
+			x = x1;
+
+			// присоединение к открытому прямоугольнику предыдущей строки
+			best = -1;
+			for (i = nrect - nopen; i < nrect; i++)
+			{
+				Rect_t *r = &rects[i];
+				int ux0, ux1;
+
+				if ((r->row != y - 1) || (r->x1 <= x0 - gap) || (r->x0 >= x1 + gap))
+				{
+					continue;
+				}
+
+				ux0 = (r->x0 < x0) ? r->x0 : x0;
+				ux1 = (r->x1 > x1) ? r->x1 : x1;
+				merged = (long)(ux1 - ux0) * (r->h + 1);
+				cost = (long)(r->x1 - r->x0) * r->h + (x1 - x0) + WINDOW_COST;
+
+				if (merged <= cost)
+				{
+					best = i;
+					r->x0 = ux0;
+					r->x1 = ux1;
+					r->h++;
+					r->row = y;
+					break;
+				}
+			}
+
+			if (best < 0)
+			{
+				if (nrect == (int)(sizeof(rects) / sizeof(rects[0])))
+				{
+					fprintf(stderr, "too many rectangles in one frame\n");
+					exit(1);
+				}
+				rects[nrect].x0 = x0;
+				rects[nrect].x1 = x1;
+				rects[nrect].y0 = y;
+				rects[nrect].h = 1;
+				rects[nrect].row = y;
+				nrect++;
+				nopen++;
+			}
+		}
+
+		// закрываем прямоугольники, не получившие отрезка в этой строке
+		while (nopen && (rects[nrect - nopen].row != y))
+		{
+			nopen--;
+		}
+	}
+
+	for (i = 0; i < nrect; i++)
+	{
+		PutRect(cur, w, &rects[i], pPixels);
+	}
+
+	Stream[countPos] = (uint16_t)nrect;
+
+	return nrect;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура проверки: декодирование потока на холст и сравнение с кадрами
+//==============================================================================
+static int Verify(uint16_t **frames, int nframes, int w, int h, int loop)
+{
+
+	uint16_t *canvas = calloc((size_t)w * h, sizeof(uint16_t));
+	const uint16_t *p = Stream + ANIM_HEADER_WORDS;
+	int f, n, x, y, rx, ry, rw, rh, type, total = nframes + (loop ? 1 : 0);
+
+	for (f = 0; f < total; f++)
+	{
+		p++;			// задержка
+		n = *p++;
+
+		while (n--)
+		{
+			rx = p[0];
+			ry = p[1];
+			rw = p[2];
+			rh = p[3] & 0x0FFF;
+			type = p[3] >> 12;
+			p += 4;
+
+			for (y = ry; y < ry + rh; y++)
+			{
+				for (x = rx; x < rx + rw; x++)
+				{
+					canvas[y * w + x] = (type == ANIM_RECT_FILL) ? p[0] : (uint16_t)((*p >> 8) | (*p << 8));
+					if (type != ANIM_RECT_FILL)
+					{
+						p++;
+					}
+				}
+			}
+
+			if (type == ANIM_RECT_FILL)
+			{
+				p++;
+			}
+		}
+
+		if (memcmp(canvas, frames[(f < nframes) ? f : 0], sizeof(uint16_t) * w * h) != 0)
+		{
+			fprintf(stderr, "verify failed at frame %d\n", f);
+			return 0;
+		}
+	}
+
+	free(canvas);
+
+	return (p == Stream + StreamLen);
+}
+//==============================================================================
+
+int main(int argc, char **argv)
+{
+
+	static uint16_t *frames[MAX_FRAMES];
+	const char *name = "anim", *outName = NULL;
+	int nframes = 0, w = 0, h = 0, fw, fh, gap = WINDOW_COST, loop = 0, delay = 100, i, rects;
+	long pixels, totalPixels = 0;
+	FILE *out;
+	size_t pos;
+
+	for (i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-n") && (i + 1 < argc))
+		{
+			name = argv[++i];
+		}
+		else if (!strcmp(argv[i], "-d") && (i + 1 < argc))
+		{
+			delay = atoi(argv[++i]);
+		}
+		else if (!strcmp(argv[i], "-g") && (i + 1 < argc))
+		{
+			gap = atoi(argv[++i]);
+		}
+		else if (!strcmp(argv[i], "-o") && (i + 1 < argc))
+		{
+			outName = argv[++i];
+		}
+		else if (!strcmp(argv[i], "-loop"))
+		{
+			loop = 1;
+		}
+		else if (nframes < MAX_FRAMES)
+		{
+			frames[nframes] = LoadPpm(argv[i], &fw, &fh);
+			if (nframes && ((fw != w) || (fh != h)))
+			{
+				fprintf(stderr, "%s: frame size differs\n", argv[i]);
+				return 1;
+			}
+			w = fw;
+			h = fh;
+			nframes++;
+		}
+	}
+
+	if (nframes == 0)
+	{
+		fprintf(stderr, "usage: st7789_animenc [-n name] [-d ms] [-g gap] [-loop] [-o out.h] frame0.ppm ...\n");
+		return 1;
+	}
+
+	Put(ANIM_MAGIC);
+	Put((uint16_t)(ANIM_VERSION | ((loop ? ANIM_FLAG_LOOP : 0) << 8)));
+	Put((uint16_t)w);
+	Put((uint16_t)h);
+	Put((uint16_t)nframes);
+	Put(0);
+
+	out = outName ? fopen(outName, "w") : stdout;
+	if (out == NULL)
+	{
+		fprintf(stderr, "%s: cannot create\n", outName);
+		return 1;
+	}
+
+	fprintf(out, "/* %s: %d x %d, %d frames%s, generated by st7789_animenc */\n", name, w, h, nframes, loop ? ", loop" : "");
+	fprintf(out, "/* frame  rects  pixels */\n");
+
+	for (i = 0; i <= nframes; i++)
+	{
+		if ((i == nframes) && !loop)
+		{
+			break;
+		}
+
+		pixels = 0;
+		if (i == 0)
+		{
+			rects = EncodeFrame(NULL, frames[0], w, h, gap, (uint16_t)delay, &pixels);
+		}
+		else if (i < nframes)
+		{
+			rects = EncodeFrame(frames[i - 1], frames[i], w, h, gap, (uint16_t)delay, &pixels);
+		}
+		else
+		{
+			// кадр возврата: последний -> нулевой
+			rects = EncodeFrame(frames[nframes - 1], frames[0], w, h, gap, (uint16_t)delay, &pixels);
+		}
+
+		totalPixels += pixels;
+		fprintf(out, "/* %5d  %5d  %6ld */\n", i, rects, pixels);
+	}
+
+	if (!Verify(frames, nframes, w, h, loop))
+	{
+		fprintf(stderr, "internal error: stream does not decode to the source frames\n");
+		return 1;
+	}
+
+	fprintf(out, "/* stream %lu bytes, full frames %lu bytes; pixels written %ld of %ld */\n\n",
+			(unsigned long)(StreamLen * 2), (unsigned long)nframes * w * h * 2, totalPixels, (long)(nframes + loop) * w * h);
+
+	fprintf(out, "const uint16_t %s[] = {\n", name);
+	for (pos = 0; pos < StreamLen; pos++)
+	{
+		fprintf(out, "%s0x%04X,%s", ((pos % 16) == 0) ? "\t" : "", Stream[pos], ((pos % 16) == 15) ? "\n" : " ");
+	}
+	fprintf(out, "\n};\n");
+
+	if (out != stdout)
+	{
+		fclose(out);
+	}
+
+	fprintf(stderr, "%s: %d frames, %lu bytes (%lu%% of full frames)\n", name, nframes, (unsigned long)(StreamLen * 2),
+			(unsigned long)(StreamLen * 2 * 100 / ((unsigned long)nframes * w * h * 2)));
+
+	return 0;
+}
+
+/************************ (C) COPYRIGHT GKP *****END OF FILE****/
@@ -0,0 +1,223 @@
+/*
+ * st77xx_tracedump.c
+ *
+ * Разбор выгрузки ST77XX_Trace_Dump() ( запускается на ПК )
+ *
+ * Сборка:   gcc -O2 -o st77xx_tracedump st77xx_tracedump.c
+ * Запуск:   st77xx_tracedump [-hist] [-csv] trace.bin
+ *
+ * trace.bin - байты, записанные ST77XX_Trace_Dump(): с UART ( например
+ *           stty -F /dev/ttyUSB0 115200 raw; cat /dev/ttyUSB0 > trace.bin ) или fwrite при симуляции.
+ * Перед заголовком допускается мусор - ищется сигнатура "S7TR".
+ * Выводится таблица по примитивам; -hist - гистограммы задержек,
+ * -csv - записи кольцевого буфера в CSV ( t_us, dt_us, id, name, windows, pixels ).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+// формат - должен совпадать с st77xx_trace.h
+#define TRACE_MAGIC			0x52543753
+#define TRACE_VERSION		1
+#define TRACE_HEADER_SIZE	28
+#define TRACE_NAME_SIZE		16
+
+static uint8_t *Data;
+static size_t DataLen;
+
+//==============================================================================
+// Процедура чтения little-endian слов
+//==============================================================================
+static uint32_t Get16(const uint8_t *p)
+{
+
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static uint32_t Get32(const uint8_t *p)
+{
+
+	return Get16(p) | (Get16(p + 2) << 16);
+}
+
+static uint64_t Get64(const uint8_t *p)
+{
+
+	return (uint64_t)Get32(p) | ((uint64_t)Get32(p + 4) << 32);
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура чтения файла целиком
+//==============================================================================
+static int Load(const char *name)
+{
+
+	FILE *f = fopen(name, "rb");
+	size_t cap = 65536, n;
+
+	if (f == NULL)
+	{
+		perror(name);
+		return 0;
+	}
+
+	Data = malloc(cap);
+	while (Data && (n = fread(Data + DataLen, 1, cap - DataLen, f)) > 0)
+	{
+		DataLen += n;
+		if (DataLen == cap)
+		{
+			cap *= 2;
+			Data = realloc(Data, cap);
+		}
+	}
+	fclose(f);
+
+	if (Data == NULL)
+	{
+		fprintf(stderr, "out of memory\n");
+		return 0;
+	}
+
+	return 1;
+}
+//==============================================================================
+
+//==============================================================================
+// Процедура перевода тактов в микросекунды
+//==============================================================================
+static double Us(uint64_t ticks, uint32_t hz)
+{
+
+	return hz ? (double)ticks * 1e6 / hz : 0.0;
+}
+//==============================================================================
+
+int main(int argc, char **argv)
+{
+
+	const char *name = NULL;
+	int hist = 0, csv = 0, i, k;
+	size_t off;
+	const uint8_t *h, *c, *r;
+	uint32_t count, nhist, csize, rsize, hz, records, dropped, t_first = 0;
+
+	for (i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-hist"))
+		{
+			hist = 1;
+		}
+		else if (!strcmp(argv[i], "-csv"))
+		{
+			csv = 1;
+		}
+		else
+		{
+			name = argv[i];
+		}
+	}
+
+	if (name == NULL)
+	{
+		fprintf(stderr, "usage: st77xx_tracedump [-hist] [-csv] trace.bin\n");
+		return 1;
+	}
+
+	if (!Load(name))
+	{
+		return 1;
+	}
+
+	for (off = 0; off + TRACE_HEADER_SIZE <= DataLen; off++)
+	{
+		if (Get32(Data + off) == TRACE_MAGIC)
+		{
+			break;
+		}
+	}
+
+	if (off + TRACE_HEADER_SIZE > DataLen)
+	{
+		fprintf(stderr, "%s: no trace header\n", name);
+		return 1;
+	}
+
+	h = Data + off;
+	if (Get16(h + 4) != TRACE_VERSION)
+	{
+		fprintf(stderr, "%s: unsupported version %u\n", name, (unsigned)Get16(h + 4));
+		return 1;
+	}
+
+	count = Get16(h + 6);
+	nhist = Get16(h + 8);
+	csize = Get16(h + 10);
+	rsize = Get16(h + 12);
+	hz = Get32(h + 16);
+	records = Get32(h + 20);
+	dropped = Get32(h + 24);
+
+	c = h + TRACE_HEADER_SIZE;
+	r = c + count * (TRACE_NAME_SIZE + csize);
+
+	if ((size_t)(r + (size_t)records * rsize - Data) > DataLen)
+	{
+		fprintf(stderr, "%s: truncated ( %u records expected )\n", name, (unsigned)records);
+		return 1;
+	}
+
+	if (csv)
+	{
+		printf("t_us,dt_us,id,name,windows,pixels\n");
+		for (i = 0; i < (int)records; i++, r += rsize)
+		{
+			if (i == 0)
+			{
+				t_first = Get32(r);
+			}
+			printf("%.3f,%.3f,%u,%.16s,%u,%u\n", Us((uint32_t)(Get32(r) - t_first), hz), Us(Get32(r + 4), hz), r[8],
+				   (r[8] < count) ? (const char *)(c + r[8] * (TRACE_NAME_SIZE + csize)) : "?", r[9], (unsigned)Get16(r + 10));
+		}
+		return 0;
+	}
+
+	printf("clock %u Hz, %u records in ring, %u overwritten\n\n", (unsigned)hz, (unsigned)records, (unsigned)dropped);
+	printf("%-16s %8s %10s %10s %9s %8s %12s %10s %10s\n", "primitive", "calls", "pixels", "bytes", "xfers", "windows",
+		   "total_us", "avg_us", "max_us");
+
+	for (i = 0; i < (int)count; i++, c += TRACE_NAME_SIZE + csize)
+	{
+		const uint8_t *v = c + TRACE_NAME_SIZE;
+		uint32_t calls = Get32(v);
+		uint64_t cycles = Get64(v + 24);
+
+		if (calls == 0)
+		{
+			continue;
+		}
+
+		printf("%-16.16s %8u %10u %10u %9u %8u %12.1f %10.2f %10.2f\n", (const char *)c, (unsigned)calls, (unsigned)Get32(v + 4),
+			   (unsigned)Get32(v + 8), (unsigned)Get32(v + 12), (unsigned)Get32(v + 16), Us(cycles, hz), Us(cycles, hz) / calls,
+			   Us(Get32(v + 20), hz));
+
+		if (hist)
+		{
+			for (k = 0; k < (int)nhist; k++)
+			{
+				uint32_t n = Get32(v + 32 + 4 * k);
+
+				if (n)
+				{
+					printf("    %s%10.2f us  %u\n", (k == (int)nhist - 1) ? ">=" : "< ", Us((k == (int)nhist - 1) ? (1ULL << k) : (2ULL << k), hz),
+						   (unsigned)n);
+				}
+			}
+		}
+	}
+
+	return 0;
+}